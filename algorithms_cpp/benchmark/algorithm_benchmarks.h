@@ -0,0 +1,339 @@
+/*
+ * Copyright (c) 2014-2015, Siemens AG. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef ALGORITHMS_CPP_BENCHMARK_ALGORITHM_BENCHMARKS_H_
+#define ALGORITHMS_CPP_BENCHMARK_ALGORITHM_BENCHMARKS_H_
+
+#include <embb/algorithms/algorithms.h>
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <vector>
+
+/**
+ * Base of the benchmark kernels, holding the input and two working copies,
+ * one for the serial baseline and one for the parallel algorithm.
+ *
+ * Element values are small integers, so that sums of floating-point elements
+ * are exact and the parallel results can be compared for equality.
+ */
+template<typename T>
+class BenchmarkKernel {
+ public:
+  typedef T ValueType;
+
+  /**
+   * Creates \c size elements with values in [0, \c range).
+   */
+  void Initialize(size_t size, unsigned int range) {
+    input_.resize(size);
+    unsigned int state = 12345;
+    for (size_t i = 0; i < size; i++) {
+      // Linear congruential generator, deterministic across platforms
+      state = state * 1103515245u + 12345u;
+      input_[i] = static_cast<T>((state >> 8) % range);
+    }
+  }
+
+  /**
+   * Restores the working copy of the serial baseline from the input.
+   */
+  void PrepareSerial() {
+    serial_ = input_;
+  }
+
+  /**
+   * Restores the working copy of the parallel algorithm from the input.
+   */
+  void PrepareParallel() {
+    parallel_ = input_;
+  }
+
+ protected:
+  std::vector<T> input_;
+  std::vector<T> serial_;
+  std::vector<T> parallel_;
+};
+
+/**
+ * Element-wise work done by the ForEach benchmark.
+ */
+template<typename T>
+struct BenchmarkForEachWork {
+  void operator()(T& value) const {
+    value = value * 3 + 1;
+  }
+};
+
+/**
+ * Benchmarks ForEach against std::for_each.
+ */
+template<typename T>
+class ForEachBenchmark : public BenchmarkKernel<T> {
+ public:
+  static const bool kHasBlockSize = true;
+
+  void Initialize(size_t size) {
+    BenchmarkKernel<T>::Initialize(size, 1000);
+  }
+
+  void RunSerial() {
+    std::for_each(this->serial_.begin(), this->serial_.end(),
+                  BenchmarkForEachWork<T>());
+  }
+
+  void RunParallel(const embb::tasks::ExecutionPolicy& policy,
+                   size_t block_size) {
+    embb::algorithms::ForEach(this->parallel_.begin(), this->parallel_.end(),
+                              BenchmarkForEachWork<T>(), policy, block_size);
+  }
+
+  bool Check() const {
+    return this->serial_ == this->parallel_;
+  }
+};
+
+/**
+ * Benchmarks Reduce against std::accumulate.
+ */
+template<typename T>
+class ReduceBenchmark : public BenchmarkKernel<T> {
+ public:
+  static const bool kHasBlockSize = true;
+
+  ReduceBenchmark() : serial_sum_(), parallel_sum_() {}
+
+  void Initialize(size_t size) {
+    BenchmarkKernel<T>::Initialize(size, 16);
+  }
+
+  void RunSerial() {
+    serial_sum_ = std::accumulate(this->serial_.begin(), this->serial_.end(),
+                                  T(0));
+  }
+
+  void RunParallel(const embb::tasks::ExecutionPolicy& policy,
+                   size_t block_size) {
+    parallel_sum_ = embb::algorithms::Reduce(
+      this->parallel_.begin(), this->parallel_.end(), T(0), std::plus<T>(),
+      embb::algorithms::Identity(), policy, block_size);
+  }
+
+  bool Check() const {
+    return serial_sum_ == parallel_sum_;
+  }
+
+ private:
+  T serial_sum_;
+  T parallel_sum_;
+};
+
+/**
+ * Benchmarks Scan against std::partial_sum.
+ */
+template<typename T>
+class ScanBenchmark : public BenchmarkKernel<T> {
+ public:
+  static const bool kHasBlockSize = true;
+
+  void Initialize(size_t size) {
+    BenchmarkKernel<T>::Initialize(size, 16);
+    serial_output_.resize(size);
+    parallel_output_.resize(size);
+  }
+
+  void RunSerial() {
+    std::partial_sum(this->serial_.begin(), this->serial_.end(),
+                     serial_output_.begin());
+  }
+
+  void RunParallel(const embb::tasks::ExecutionPolicy& policy,
+                   size_t block_size) {
+    embb::algorithms::Scan(
+      this->parallel_.begin(), this->parallel_.end(),
+      parallel_output_.begin(), T(0), std::plus<T>(),
+      embb::algorithms::Identity(), policy, block_size);
+  }
+
+  bool Check() const {
+    return serial_output_ == parallel_output_;
+  }
+
+ private:
+  std::vector<T> serial_output_;
+  std::vector<T> parallel_output_;
+};
+
+/**
+ * Benchmarks Count against std::count.
+ */
+template<typename T>
+class CountBenchmark : public BenchmarkKernel<T> {
+ public:
+  static const bool kHasBlockSize = true;
+
+  CountBenchmark() : serial_count_(0), parallel_count_(0) {}
+
+  void Initialize(size_t size) {
+    BenchmarkKernel<T>::Initialize(size, 16);
+  }
+
+  void RunSerial() {
+    serial_count_ = std::count(this->serial_.begin(), this->serial_.end(),
+                               T(7));
+  }
+
+  void RunParallel(const embb::tasks::ExecutionPolicy& policy,
+                   size_t block_size) {
+    parallel_count_ = embb::algorithms::Count(
+      this->parallel_.begin(), this->parallel_.end(), T(7), policy,
+      block_size);
+  }
+
+  bool Check() const {
+    return serial_count_ == parallel_count_;
+  }
+
+ private:
+  std::ptrdiff_t serial_count_;
+  std::ptrdiff_t parallel_count_;
+};
+
+/**
+ * Benchmarks MergeSort against std::stable_sort.
+ */
+template<typename T>
+class MergeSortBenchmark : public BenchmarkKernel<T> {
+ public:
+  static const bool kHasBlockSize = true;
+
+  void Initialize(size_t size) {
+    BenchmarkKernel<T>::Initialize(size, 1u << 24);
+    temporary_.resize(size);
+  }
+
+  void RunSerial() {
+    std::stable_sort(this->serial_.begin(), this->serial_.end());
+  }
+
+  void RunParallel(const embb::tasks::ExecutionPolicy& policy,
+                   size_t block_size) {
+    embb::algorithms::MergeSort(this->parallel_.begin(),
+                                this->parallel_.end(), temporary_.begin(),
+                                std::less<T>(), policy, block_size);
+  }
+
+  bool Check() const {
+    return this->serial_ == this->parallel_;
+  }
+
+ private:
+  std::vector<T> temporary_;
+};
+
+/**
+ * Benchmarks QuickSort against std::sort.
+ */
+template<typename T>
+class QuickSortBenchmark : public BenchmarkKernel<T> {
+ public:
+  static const bool kHasBlockSize = true;
+
+  void Initialize(size_t size) {
+    BenchmarkKernel<T>::Initialize(size, 1u << 24);
+  }
+
+  void RunSerial() {
+    std::sort(this->serial_.begin(), this->serial_.end());
+  }
+
+  void RunParallel(const embb::tasks::ExecutionPolicy& policy,
+                   size_t block_size) {
+    embb::algorithms::QuickSort(this->parallel_.begin(),
+                                this->parallel_.end(), std::less<T>(),
+                                policy, block_size);
+  }
+
+  bool Check() const {
+    return this->serial_ == this->parallel_;
+  }
+};
+
+/**
+ * Sorts a range with std::sort, used as work item of the Invoke benchmark.
+ */
+template<typename T>
+class BenchmarkSortRange {
+ public:
+  BenchmarkSortRange(typename std::vector<T>::iterator first,
+                     typename std::vector<T>::iterator last)
+    : first_(first), last_(last) {}
+
+  void operator()() const {
+    std::sort(first_, last_);
+  }
+
+ private:
+  typename std::vector<T>::iterator first_;
+  typename std::vector<T>::iterator last_;
+};
+
+/**
+ * Benchmarks Invoke by sorting the two halves of the input, compared to
+ * sorting them one after the other.
+ */
+template<typename T>
+class InvokeBenchmark : public BenchmarkKernel<T> {
+ public:
+  static const bool kHasBlockSize = false;
+
+  void Initialize(size_t size) {
+    BenchmarkKernel<T>::Initialize(size, 1u << 24);
+  }
+
+  void RunSerial() {
+    typename std::vector<T>::iterator middle =
+      this->serial_.begin() + this->serial_.size() / 2;
+    BenchmarkSortRange<T>(this->serial_.begin(), middle)();
+    BenchmarkSortRange<T>(middle, this->serial_.end())();
+  }
+
+  void RunParallel(const embb::tasks::ExecutionPolicy& policy, size_t) {
+    typename std::vector<T>::iterator middle =
+      this->parallel_.begin() + this->parallel_.size() / 2;
+    embb::algorithms::Invoke(
+      BenchmarkSortRange<T>(this->parallel_.begin(), middle),
+      BenchmarkSortRange<T>(middle, this->parallel_.end()), policy);
+  }
+
+  bool Check() const {
+    return this->serial_ == this->parallel_;
+  }
+};
+
+#endif  // ALGORITHMS_CPP_BENCHMARK_ALGORITHM_BENCHMARKS_H_
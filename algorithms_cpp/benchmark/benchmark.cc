@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) 2014-2015, Siemens AG. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <benchmark.h>
+#include <embb/base/c/time.h>
+
+#include <cstdlib>
+#include <iomanip>
+#include <sstream>
+
+namespace {
+
+/**
+ * Splits a comma-separated list into its elements.
+ */
+std::vector<std::string> SplitList(const std::string& list) {
+  std::vector<std::string> elements;
+  std::string::size_type begin = 0;
+  while (begin <= list.size()) {
+    std::string::size_type end = list.find(',', begin);
+    if (end == std::string::npos) {
+      end = list.size();
+    }
+    if (end > begin) {
+      elements.push_back(list.substr(begin, end - begin));
+    }
+    begin = end + 1;
+  }
+  return elements;
+}
+
+/**
+ * Parses a comma-separated list of numbers.
+ *
+ * \return \c false if the list is empty or an element is not a number
+ */
+template<typename T>
+bool ParseNumbers(const std::string& list, std::vector<T>& numbers) {
+  std::vector<std::string> elements = SplitList(list);
+  numbers.clear();
+  for (size_t i = 0; i < elements.size(); i++) {
+    std::istringstream stream(elements[i]);
+    T number;
+    if (!(stream >> number) || !stream.eof()) {
+      return false;
+    }
+    numbers.push_back(number);
+  }
+  return !numbers.empty();
+}
+
+/**
+ * Writes a string as JSON string literal. Names used in the output contain
+ * no characters that need escaping.
+ */
+void WriteJsonString(std::ostream& out, const std::string& value) {
+  out << '"' << value << '"';
+}
+
+}  // namespace
+
+BenchmarkConfig::BenchmarkConfig()
+  : repetitions(5), format("csv") {
+  sizes.push_back(1 << 10);
+  sizes.push_back(1 << 14);
+  sizes.push_back(1 << 18);
+  sizes.push_back(1 << 22);
+  unsigned int core_count = embb::tasks::Node::GetInstance().GetCoreCount();
+  for (unsigned int c = 1; c < core_count; c *= 2) {
+    cores.push_back(c);
+  }
+  cores.push_back(core_count);
+  block_sizes.push_back(0);
+  block_sizes.push_back(1 << 10);
+  block_sizes.push_back(1 << 14);
+}
+
+bool BenchmarkConfig::Parse(int argc, char** argv) {
+  unsigned int core_count = embb::tasks::Node::GetInstance().GetCoreCount();
+  for (int i = 1; i < argc; i++) {
+    std::string argument(argv[i]);
+    std::string::size_type separator = argument.find('=');
+    if (argument.compare(0, 2, "--") != 0 ||
+        separator == std::string::npos) {
+      return false;
+    }
+    std::string name = argument.substr(2, separator - 2);
+    std::string value = argument.substr(separator + 1);
+    if (name == "sizes") {
+      if (!ParseNumbers(value, sizes)) return false;
+    } else if (name == "cores") {
+      if (!ParseNumbers(value, cores)) return false;
+      for (size_t c = 0; c < cores.size(); c++) {
+        if (cores[c] == 0 || cores[c] > core_count) return false;
+      }
+    } else if (name == "block-sizes") {
+      if (!ParseNumbers(value, block_sizes)) return false;
+    } else if (name == "repetitions") {
+      std::vector<size_t> numbers;
+      if (!ParseNumbers(value, numbers) || numbers.size() != 1 ||
+          numbers[0] == 0) {
+        return false;
+      }
+      repetitions = numbers[0];
+    } else if (name == "format") {
+      if (value != "csv" && value != "json") return false;
+      format = value;
+    } else if (name == "algorithms") {
+      algorithms = SplitList(value);
+    } else {
+      return false;
+    }
+  }
+  return true;
+}
+
+void BenchmarkConfig::PrintUsage(std::ostream& out) {
+  out <<
+    "Usage: embb_algorithms_cpp_benchmark [--name=value ...]\n"
+    "  --sizes=N,...        Numbers of elements\n"
+    "  --cores=N,...        Numbers of cores of the parallel runs\n"
+    "  --block-sizes=N,...  Block sizes, 0 lets the algorithm decide\n"
+    "  --repetitions=N      Timed runs per measurement, fastest is reported\n"
+    "  --format=csv|json    Output format\n"
+    "  --algorithms=A,...   Algorithms to run: ForEach, Reduce, Scan, Count,\n"
+    "                       MergeSort, QuickSort, Invoke\n";
+}
+
+bool BenchmarkConfig::IsSelected(const std::string& algorithm) const {
+  return algorithms.empty() ||
+    std::find(algorithms.begin(), algorithms.end(), algorithm) !=
+    algorithms.end();
+}
+
+BenchmarkReporter::BenchmarkReporter(std::ostream& out,
+  const std::string& format)
+  : out_(out), json_(format == "json"), count_(0) {
+}
+
+void BenchmarkReporter::Begin(const BenchmarkConfig& config) {
+  if (json_) {
+    out_ << "{\n  \"available_cores\": "
+         << embb::tasks::Node::GetInstance().GetCoreCount()
+         << ",\n  \"repetitions\": " << config.repetitions
+         << ",\n  \"results\": [";
+  } else {
+    out_ << "algorithm,type,size,cores,block_size,serial_ns,parallel_ns,"
+            "speedup,valid\n";
+  }
+}
+
+void BenchmarkReporter::Report(const BenchmarkResult& result) {
+  double speedup = result.parallel_ns == 0 ? 0.0 :
+    static_cast<double>(result.serial_ns) /
+    static_cast<double>(result.parallel_ns);
+  std::ostringstream speedup_string;
+  speedup_string << std::fixed << std::setprecision(3) << speedup;
+  if (json_) {
+    out_ << (count_ == 0 ? "\n" : ",\n") << "    {\"algorithm\": ";
+    WriteJsonString(out_, result.algorithm);
+    out_ << ", \"type\": ";
+    WriteJsonString(out_, result.type);
+    out_ << ", \"size\": " << result.size
+         << ", \"cores\": " << result.cores
+         << ", \"block_size\": " << result.block_size
+         << ", \"serial_ns\": " << result.serial_ns
+         << ", \"parallel_ns\": " << result.parallel_ns
+         << ", \"speedup\": " << speedup_string.str()
+         << ", \"valid\": " << (result.valid ? "true" : "false") << "}";
+  } else {
+    out_ << result.algorithm << ',' << result.type << ','
+         << result.size << ',' << result.cores << ','
+         << result.block_size << ',' << result.serial_ns << ','
+         << result.parallel_ns << ',' << speedup_string.str() << ','
+         << (result.valid ? "true" : "false") << '\n';
+  }
+  out_.flush();
+  count_++;
+}
+
+void BenchmarkReporter::End() {
+  if (json_) {
+    out_ << (count_ == 0 ? "]\n}\n" : "\n  ]\n}\n");
+  }
+  out_.flush();
+}
+
+unsigned long long BenchmarkNow() {
+  embb_time_t now;
+  embb_time_now(&now);
+  return now.seconds * 1000000000ULL + now.nanoseconds;
+}
+
+embb::tasks::ExecutionPolicy BenchmarkPolicy(unsigned int cores) {
+  embb::tasks::ExecutionPolicy policy(false);
+  for (unsigned int worker = 0; worker < cores; worker++) {
+    policy.AddWorker(worker);
+  }
+  return policy;
+}
@@ -0,0 +1,348 @@
+/*
+ * Copyright (c) 2014-2015, Siemens AG. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef ALGORITHMS_CPP_BENCHMARK_BENCHMARK_H_
+#define ALGORITHMS_CPP_BENCHMARK_BENCHMARK_H_
+
+#include <embb/base/exceptions.h>
+#include <embb/tasks/tasks.h>
+
+#include <algorithm>
+#include <exception>
+#include <iostream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * Parameters of a benchmark run, filled from the command line.
+ */
+class BenchmarkConfig {
+ public:
+  /**
+   * Creates the default sweep for the cores of the current node.
+   */
+  BenchmarkConfig();
+
+  /**
+   * Parses command line arguments of the form --name=value.
+   *
+   * \return \c false if an argument is invalid or help was requested
+   */
+  bool Parse(
+    int argc,                          /**< [in] Number of arguments */
+    char** argv                        /**< [in] Arguments */
+    );
+
+  /**
+   * Writes the supported command line arguments.
+   */
+  static void PrintUsage(
+    std::ostream& out                  /**< [in] Output stream */
+    );
+
+  /**
+   * Checks whether the algorithm with the given name is to be run.
+   *
+   * \return \c true if no filter is set or the name is part of it
+   */
+  bool IsSelected(
+    const std::string& algorithm       /**< [in] Name of the algorithm */
+    ) const;
+
+  /**
+   * Input sizes in number of elements.
+   */
+  std::vector<size_t> sizes;
+
+  /**
+   * Numbers of cores used by the parallel runs.
+   */
+  std::vector<unsigned int> cores;
+
+  /**
+   * Block sizes passed to the algorithms, 0 lets the algorithm decide.
+   */
+  std::vector<size_t> block_sizes;
+
+  /**
+   * Names of the algorithms to run, all if empty.
+   */
+  std::vector<std::string> algorithms;
+
+  /**
+   * Number of timed runs per measurement, the fastest one is reported.
+   */
+  size_t repetitions;
+
+  /**
+   * Output format, either "csv" or "json".
+   */
+  std::string format;
+};
+
+/**
+ * Timings of one algorithm for one point of the sweep.
+ */
+struct BenchmarkResult {
+  /**
+   * Name of the algorithm.
+   */
+  std::string algorithm;
+
+  /**
+   * Name of the element type.
+   */
+  std::string type;
+
+  /**
+   * Number of elements.
+   */
+  size_t size;
+
+  /**
+   * Number of cores of the parallel run.
+   */
+  unsigned int cores;
+
+  /**
+   * Block size of the parallel run.
+   */
+  size_t block_size;
+
+  /**
+   * Fastest run of the serial baseline in nanoseconds.
+   */
+  unsigned long long serial_ns;
+
+  /**
+   * Fastest parallel run in nanoseconds.
+   */
+  unsigned long long parallel_ns;
+
+  /**
+   * Whether the parallel result matched the serial one.
+   */
+  bool valid;
+};
+
+/**
+ * Writes benchmark results as CSV or JSON.
+ */
+class BenchmarkReporter {
+ public:
+  /**
+   * Creates a reporter writing in the given format ("csv" or "json").
+   */
+  BenchmarkReporter(
+    std::ostream& out,                 /**< [in] Output stream */
+    const std::string& format          /**< [in] Output format */
+    );
+
+  /**
+   * Writes the header of the output.
+   */
+  void Begin(
+    const BenchmarkConfig& config      /**< [in] Configuration of the run */
+    );
+
+  /**
+   * Writes a single result.
+   */
+  void Report(
+    const BenchmarkResult& result      /**< [in] Result to write */
+    );
+
+  /**
+   * Writes the trailer of the output.
+   */
+  void End();
+
+ private:
+  std::ostream& out_;
+  bool json_;
+  size_t count_;
+};
+
+/**
+ * Returns the current time in nanoseconds.
+ */
+unsigned long long BenchmarkNow();
+
+/**
+ * Returns a policy for the parallel runs that uses the first \c cores workers.
+ */
+embb::tasks::ExecutionPolicy BenchmarkPolicy(
+  unsigned int cores                   /**< [in] Number of workers */
+  );
+
+/**
+ * Returns the name of an element type used in the output.
+ */
+template<typename T>
+struct BenchmarkTypeName;
+
+template<>
+struct BenchmarkTypeName<int> {
+  static const char* Get() { return "int"; }
+};
+
+template<>
+struct BenchmarkTypeName<double> {
+  static const char* Get() { return "double"; }
+};
+
+/**
+ * Times the serial baseline of a kernel and stores the fastest run.
+ *
+ * \return \c false if an exception was thrown, which is written to the
+ *         standard error output
+ */
+template<typename Kernel>
+bool BenchmarkMeasureSerial(
+  Kernel& kernel,                      /**< [in,out] Kernel to run */
+  size_t repetitions,                  /**< [in] Number of timed runs */
+  unsigned long long& fastest          /**< [out] Fastest run in ns */
+  ) {
+  fastest = 0;
+  EMBB_TRY {
+    for (size_t r = 0; r < repetitions; r++) {
+      kernel.PrepareSerial();
+      unsigned long long start = BenchmarkNow();
+      kernel.RunSerial();
+      unsigned long long time = BenchmarkNow() - start;
+      if (r == 0 || time < fastest) {
+        fastest = time;
+      }
+    }
+  } EMBB_CATCH (embb::base::Exception & e) {
+#ifdef EMBB_USE_EXCEPTIONS
+    std::cerr << "Serial run failed: " << e.What() << std::endl;
+#endif
+    return false;
+  } EMBB_CATCH (std::exception & e) {
+#ifdef EMBB_USE_EXCEPTIONS
+    std::cerr << "Serial run failed: " << e.what() << std::endl;
+#endif
+    return false;
+  }
+  return true;
+}
+
+/**
+ * Times the parallel algorithm of a kernel and stores the fastest run.
+ *
+ * \return \c false if an exception was thrown, which is written to the
+ *         standard error output
+ */
+template<typename Kernel>
+bool BenchmarkMeasureParallel(
+  Kernel& kernel,                      /**< [in,out] Kernel to run */
+  const embb::tasks::ExecutionPolicy& policy,
+                                       /**< [in] Policy of the runs */
+  size_t block_size,                   /**< [in] Block size of the runs */
+  size_t repetitions,                  /**< [in] Number of timed runs */
+  unsigned long long& fastest          /**< [out] Fastest run in ns */
+  ) {
+  fastest = 0;
+  EMBB_TRY {
+    for (size_t r = 0; r < repetitions; r++) {
+      kernel.PrepareParallel();
+      unsigned long long start = BenchmarkNow();
+      kernel.RunParallel(policy, block_size);
+      unsigned long long time = BenchmarkNow() - start;
+      if (r == 0 || time < fastest) {
+        fastest = time;
+      }
+    }
+  } EMBB_CATCH (embb::base::Exception & e) {
+#ifdef EMBB_USE_EXCEPTIONS
+    std::cerr << "Parallel run failed: " << e.What() << std::endl;
+#endif
+    return false;
+  } EMBB_CATCH (std::exception & e) {
+#ifdef EMBB_USE_EXCEPTIONS
+    std::cerr << "Parallel run failed: " << e.what() << std::endl;
+#endif
+    return false;
+  }
+  return true;
+}
+
+/**
+ * Runs a benchmark kernel for all points of the sweep and reports the results.
+ *
+ * A kernel provides
+ * - \c Initialize(size) to create its input,
+ * - \c PrepareSerial() and \c PrepareParallel() to restore the input before
+ *   each timed run,
+ * - \c RunSerial() running the \c std:: baseline,
+ * - \c RunParallel(policy, block_size) running the parallel algorithm,
+ * - \c Check() comparing the last parallel with the last serial result, and
+ * - \c kHasBlockSize telling whether the algorithm takes a block size.
+ *
+ * The serial baseline is timed once per size, the parallel algorithm once per
+ * combination of size, cores and block size. Each timing is the fastest of
+ * \c config.repetitions runs. A measurement that throws an exception is
+ * reported as invalid, so that the sweep always completes.
+ */
+template<typename Kernel>
+void RunBenchmark(
+  const char* algorithm,               /**< [in] Name of the algorithm */
+  const BenchmarkConfig& config,       /**< [in] Sweep to run */
+  BenchmarkReporter& reporter          /**< [in,out] Receives the results */
+  ) {
+  if (!config.IsSelected(algorithm)) {
+    return;
+  }
+  Kernel kernel;
+  BenchmarkResult result;
+  result.algorithm = algorithm;
+  result.type = BenchmarkTypeName<typename Kernel::ValueType>::Get();
+  for (size_t s = 0; s < config.sizes.size(); s++) {
+    result.size = config.sizes[s];
+    kernel.Initialize(result.size);
+    bool serial_valid = BenchmarkMeasureSerial(kernel, config.repetitions,
+                                               result.serial_ns);
+    for (size_t c = 0; c < config.cores.size(); c++) {
+      result.cores = config.cores[c];
+      embb::tasks::ExecutionPolicy policy = BenchmarkPolicy(result.cores);
+      // Algorithms without a block size are run once with block size 0
+      size_t block_count = Kernel::kHasBlockSize ?
+        config.block_sizes.size() : 1;
+      for (size_t b = 0; b < block_count; b++) {
+        result.block_size = Kernel::kHasBlockSize ? config.block_sizes[b] : 0;
+        bool parallel_valid = BenchmarkMeasureParallel(kernel, policy,
+          result.block_size, config.repetitions, result.parallel_ns);
+        result.valid = serial_valid && parallel_valid && kernel.Check();
+        reporter.Report(result);
+      }
+    }
+  }
+}
+
+#endif  // ALGORITHMS_CPP_BENCHMARK_BENCHMARK_H_
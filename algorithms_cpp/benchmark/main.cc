@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2014-2015, Siemens AG. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <embb/tasks/tasks.h>
+#include <benchmark.h>
+#include <algorithm_benchmarks.h>
+
+#include <iostream>
+
+#define THIS_DOMAIN_ID 1
+#define THIS_NODE_ID 1
+
+/**
+ * Runs the benchmarks of the algorithms and writes speedups over the serial
+ * std:: baselines to the standard output.
+ */
+int main(int argc, char** argv) {
+  embb::tasks::Node::Initialize(THIS_DOMAIN_ID, THIS_NODE_ID);
+
+  int result = 0;
+  BenchmarkConfig config;
+  if (config.Parse(argc, argv)) {
+    BenchmarkReporter reporter(std::cout, config.format);
+    reporter.Begin(config);
+    RunBenchmark<ForEachBenchmark<int> >("ForEach", config, reporter);
+    RunBenchmark<ForEachBenchmark<double> >("ForEach", config, reporter);
+    RunBenchmark<ReduceBenchmark<int> >("Reduce", config, reporter);
+    RunBenchmark<ReduceBenchmark<double> >("Reduce", config, reporter);
+    RunBenchmark<ScanBenchmark<int> >("Scan", config, reporter);
+    RunBenchmark<ScanBenchmark<double> >("Scan", config, reporter);
+    RunBenchmark<CountBenchmark<int> >("Count", config, reporter);
+    RunBenchmark<CountBenchmark<double> >("Count", config, reporter);
+    RunBenchmark<MergeSortBenchmark<int> >("MergeSort", config, reporter);
+    RunBenchmark<MergeSortBenchmark<double> >("MergeSort", config, reporter);
+    RunBenchmark<QuickSortBenchmark<int> >("QuickSort", config, reporter);
+    RunBenchmark<QuickSortBenchmark<double> >("QuickSort", config, reporter);
+    RunBenchmark<InvokeBenchmark<int> >("Invoke", config, reporter);
+    RunBenchmark<InvokeBenchmark<double> >("Invoke", config, reporter);
+    reporter.End();
+  } else {
+    BenchmarkConfig::PrintUsage(std::cerr);
+    result = 1;
+  }
+
+  embb::tasks::Node::Finalize();
+  return result;
+}
@@ -33,14 +33,22 @@
  * \ingroup CPP
  */
 
+#include <embb/algorithms/compaction.h>
 #include <embb/algorithms/count.h>
+#include <embb/algorithms/find.h>
 #include <embb/algorithms/for_each.h>
+#include <embb/algorithms/histogram.h>
 #include <embb/algorithms/identity.h>
 #include <embb/algorithms/invoke.h>
+#include <embb/algorithms/merge.h>
 #include <embb/algorithms/merge_sort.h>
+#include <embb/algorithms/min_max_element.h>
 #include <embb/algorithms/quick_sort.h>
+#include <embb/algorithms/radix_sort.h>
 #include <embb/algorithms/reduce.h>
 #include <embb/algorithms/scan.h>
+#include <embb/algorithms/selection.h>
+#include <embb/algorithms/transform.h>
 #include <embb/algorithms/zip_iterator.h>
 
 #endif  // EMBB_ALGORITHMS_ALGORITHMS_H_
@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2014-2015, Siemens AG. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef EMBB_ALGORITHMS_BLOCKED_RANGE_H_
+#define EMBB_ALGORITHMS_BLOCKED_RANGE_H_
+
+#include <cassert>
+#include <cstddef>
+
+namespace embb {
+namespace algorithms {
+
+namespace internal {
+
+/**
+ * Index bounds of a multi-dimensional range, shared by the blocked range
+ * classes.
+ */
+template<size_t Dimensions>
+class BlockedRangeBounds {
+ public:
+  /**
+   * Number of dimensions of the range.
+   */
+  static const size_t kDimensions = Dimensions;
+
+  /**
+   * Returns the first index of a dimension.
+   *
+   * \return First index of the dimension
+   */
+  size_t GetFirst(
+    size_t dimension
+    /**< [IN] Dimension, starting with 0 for the outermost one */
+    ) const {
+    assert(dimension < Dimensions);
+    return first_[dimension];
+  }
+
+  /**
+   * Returns the last plus one index of a dimension.
+   *
+   * \return Last plus one index of the dimension
+   */
+  size_t GetLast(
+    size_t dimension
+    /**< [IN] Dimension, starting with 0 for the outermost one */
+    ) const {
+    assert(dimension < Dimensions);
+    return last_[dimension];
+  }
+
+  /**
+   * Returns the number of indices of a dimension.
+   *
+   * \return Number of indices of the dimension, 0 if the range is negative in
+   *         that dimension
+   */
+  size_t GetSize(
+    size_t dimension
+    /**< [IN] Dimension, starting with 0 for the outermost one */
+    ) const {
+    assert(dimension < Dimensions);
+    return (last_[dimension] > first_[dimension]) ?
+      last_[dimension] - first_[dimension] : 0;
+  }
+
+  /**
+   * Returns the number of index tuples contained in the range.
+   *
+   * \return Product of the numbers of indices of all dimensions
+   */
+  size_t GetSize() const {
+    size_t size = 1;
+    for (size_t dimension = 0; dimension < Dimensions; dimension++) {
+      size *= GetSize(dimension);
+    }
+    return size;
+  }
+
+  /**
+   * Splits the range at the middle of its largest dimension. Of equally large
+   * dimensions, the outermost one is split, such that the innermost
+   * dimension, which is usually contiguous in memory, stays long.
+   *
+   * This range keeps the lower half, \c upper receives the upper half.
+   */
+  void Split(
+    BlockedRangeBounds& upper
+    /**< [OUT] Upper half of the range */
+    ) {
+    size_t largest = 0;
+    for (size_t dimension = 1; dimension < Dimensions; dimension++) {
+      if (GetSize(dimension) > GetSize(largest)) {
+        largest = dimension;
+      }
+    }
+    upper = *this;
+    size_t middle = first_[largest] + GetSize(largest) / 2;
+    last_[largest] = middle;
+    upper.first_[largest] = middle;
+  }
+
+ protected:
+  BlockedRangeBounds() {
+  }
+
+  size_t first_[Dimensions];
+  size_t last_[Dimensions];
+};
+
+}  // namespace internal
+
+/**
+ * \ingroup CPP_ALGORITHMS_FOREACH
+ * \{
+ */
+
+/**
+ * Two-dimensional range of indices, such as the rows and columns of a
+ * matrix.
+ *
+ * Dimension 0 is the outer dimension (the rows of a matrix stored in
+ * row-major order), dimension 1 the inner dimension (the columns). ForEach()
+ * splits such a range into tiles that are processed in parallel.
+ *
+ * \notthreadsafe
+ * \see BlockedRange3D, ForEach()
+ */
+class BlockedRange2D : public internal::BlockedRangeBounds<2> {
+ public:
+  /**
+   * Constructs a range from the bounds of both dimensions.
+   */
+  BlockedRange2D(
+    size_t row_first,
+    /**< [IN] First index of the outer dimension */
+    size_t row_last,
+    /**< [IN] Last plus one index of the outer dimension */
+    size_t column_first,
+    /**< [IN] First index of the inner dimension */
+    size_t column_last
+    /**< [IN] Last plus one index of the inner dimension */
+    ) {
+    first_[0] = row_first;
+    last_[0] = row_last;
+    first_[1] = column_first;
+    last_[1] = column_last;
+  }
+};
+
+/**
+ * Three-dimensional range of indices, such as the slices, rows, and columns
+ * of a volume.
+ *
+ * Dimension 0 is the outermost dimension (the slices of a volume stored in
+ * row-major order), dimension 2 the innermost dimension (the columns).
+ * ForEach() splits such a range into tiles that are processed in parallel.
+ *
+ * \notthreadsafe
+ * \see BlockedRange2D, ForEach()
+ */
+class BlockedRange3D : public internal::BlockedRangeBounds<3> {
+ public:
+  /**
+   * Constructs a range from the bounds of all three dimensions.
+   */
+  BlockedRange3D(
+    size_t slice_first,
+    /**< [IN] First index of the outermost dimension */
+    size_t slice_last,
+    /**< [IN] Last plus one index of the outermost dimension */
+    size_t row_first,
+    /**< [IN] First index of the middle dimension */
+    size_t row_last,
+    /**< [IN] Last plus one index of the middle dimension */
+    size_t column_first,
+    /**< [IN] First index of the innermost dimension */
+    size_t column_last
+    /**< [IN] Last plus one index of the innermost dimension */
+    ) {
+    first_[0] = slice_first;
+    last_[0] = slice_last;
+    first_[1] = row_first;
+    last_[1] = row_last;
+    first_[2] = column_first;
+    last_[2] = column_last;
+  }
+};
+
+/**
+ * \}
+ */
+
+}  // namespace algorithms
+}  // namespace embb
+
+#endif  // EMBB_ALGORITHMS_BLOCKED_RANGE_H_
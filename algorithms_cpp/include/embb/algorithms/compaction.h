@@ -0,0 +1,398 @@
+/*
+ * Copyright (c) 2014-2015, Siemens AG. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef EMBB_ALGORITHMS_COMPACTION_H_
+#define EMBB_ALGORITHMS_COMPACTION_H_
+
+#include <functional>
+#include <iterator>
+#include <embb/tasks/execution_policy.h>
+
+namespace embb {
+namespace algorithms {
+
+/**
+ * \defgroup CPP_ALGORITHMS_COMPACTION Stream compaction
+ * Parallel filtering of ranges preserving the order of the elements
+ * \ingroup CPP_ALGORITHMS
+ *
+ * The selected elements are counted, their output positions are determined by
+ * a scan of the counts, and they are written to their positions, all in a
+ * single pass over the chunks of the range like in Scan(). The selection
+ * criterion may thus be evaluated more than once per element.
+ * \{
+ */
+
+#ifdef DOXYGEN
+
+/**
+ * Copies the elements of a range for which a predicate returns \c true to an
+ * output range in parallel, preserving their order.
+ *
+ * The input range consists of the elements from \c first to \c last,
+ * excluding the last element. The output range starts at \c output and must
+ * have room for all elements of the input range. The ranges must not overlap.
+ *
+ * \return Iterator pointing to the last plus one element written to the
+ *         output range, such that the number of written elements is the
+ *         distance from \c output to the returned iterator
+ * \throws embb::base::ErrorException if the range is negative, the execution
+ *         policy contains no cores, or a task could not be started.
+ * \threadsafe if the elements in the ranges are not modified by another thread
+ *             while the algorithm is executed.
+ * \note No guarantee is given on the order in which the predicate is applied
+ *       to the elements, and it may be applied more than once to an element.
+ * \see RemoveIf(), CountIf(), Scan(), embb::mtapi::ExecutionPolicy
+ * \tparam RAIIn Random access iterator of the input range
+ * \tparam RAIOut Random access iterator of the output range
+ * \tparam Predicate Unary predicate with argument of type
+ *         <tt>std::iterator_traits<RAIIn>::value_type</tt>
+ */
+template<typename RAIIn, typename RAIOut, typename Predicate>
+RAIOut CopyIf(
+  RAIIn first,
+  /**< [IN] Random access iterator pointing to the first element of the input
+            range */
+  RAIIn last,
+  /**< [IN] Random access iterator pointing to the last plus one element of the
+            input range */
+  RAIOut output,
+  /**< [OUT] Random access iterator pointing to the first element of the
+             output range */
+  Predicate predicate,
+  /**< [IN] Unary predicate selecting the elements to copy */
+  const embb::mtapi::ExecutionPolicy& policy = embb::mtapi::ExecutionPolicy(),
+  /**< [IN] embb::mtapi::ExecutionPolicy for the compaction */
+  size_t block_size = 0
+  /**< [IN] Number of elements per chunk. The default value 0 means that
+            chunks contain between 256 and 8192 elements, aiming at four chunks
+            per core. */
+  );
+
+/**
+ * Removes the elements of a range for which a predicate returns \c true in
+ * parallel, preserving the order of the remaining elements.
+ *
+ * The range consists of the elements from \c first to \c last, excluding the
+ * last element. The remaining elements are moved to the beginning of the
+ * range. The elements after them have unspecified values.
+ *
+ * \return Iterator pointing to the last plus one remaining element
+ * \throws embb::base::ErrorException if the range is negative, the execution
+ *         policy contains no cores, or a task could not be started.
+ * \memory Array with <tt>last-first</tt> elements of type
+ *         <tt>std::iterator_traits<RAI>::value_type</tt>.
+ * \threadsafe if the elements in the range are not accessed by another thread
+ *             while the algorithm is executed.
+ * \note No guarantee is given on the order in which the predicate is applied
+ *       to the elements, and it may be applied more than once to an element.
+ * \see CopyIf(), Partition(), embb::mtapi::ExecutionPolicy
+ * \tparam RAI Random access iterator
+ * \tparam Predicate Unary predicate with argument of type
+ *         <tt>std::iterator_traits<RAI>::value_type</tt>
+ */
+template<typename RAI, typename Predicate>
+RAI RemoveIf(
+  RAI first,
+  /**< [IN/OUT] Random access iterator pointing to the first element of the
+                range */
+  RAI last,
+  /**< [IN/OUT] Random access iterator pointing to the last plus one element
+                of the range */
+  Predicate predicate,
+  /**< [IN] Unary predicate selecting the elements to remove */
+  const embb::mtapi::ExecutionPolicy& policy = embb::mtapi::ExecutionPolicy(),
+  /**< [IN] embb::mtapi::ExecutionPolicy for the compaction */
+  size_t block_size = 0
+  /**< [IN] Number of elements per chunk. The default value 0 means that
+            chunks contain between 256 and 8192 elements, aiming at four chunks
+            per core. */
+  );
+
+/**
+ * Reorders the elements of a range in parallel such that the elements for
+ * which a predicate returns \c true precede the other elements. The order of
+ * the elements within both groups is preserved.
+ *
+ * The range consists of the elements from \c first to \c last, excluding the
+ * last element.
+ *
+ * \return Iterator pointing to the first element of the second group
+ * \throws embb::base::ErrorException if the range is negative, the execution
+ *         policy contains no cores, or a task could not be started.
+ * \memory Array with <tt>last-first</tt> elements of type
+ *         <tt>std::iterator_traits<RAI>::value_type</tt>.
+ * \threadsafe if the elements in the range are not accessed by another thread
+ *             while the algorithm is executed.
+ * \note No guarantee is given on the order in which the predicate is applied
+ *       to the elements, and it may be applied more than once to an element.
+ * \see RemoveIf(), embb::mtapi::ExecutionPolicy
+ * \tparam RAI Random access iterator
+ * \tparam Predicate Unary predicate with argument of type
+ *         <tt>std::iterator_traits<RAI>::value_type</tt>
+ */
+template<typename RAI, typename Predicate>
+RAI Partition(
+  RAI first,
+  /**< [IN/OUT] Random access iterator pointing to the first element of the
+                range */
+  RAI last,
+  /**< [IN/OUT] Random access iterator pointing to the last plus one element
+                of the range */
+  Predicate predicate,
+  /**< [IN] Unary predicate selecting the elements of the first group */
+  const embb::mtapi::ExecutionPolicy& policy = embb::mtapi::ExecutionPolicy(),
+  /**< [IN] embb::mtapi::ExecutionPolicy for the compaction */
+  size_t block_size = 0
+  /**< [IN] Number of elements per chunk. The default value 0 means that
+            chunks contain between 256 and 8192 elements, aiming at four chunks
+            per core. */
+  );
+
+/**
+ * Removes in parallel all but the first element of every group of consecutive
+ * equivalent elements in a range, preserving the order of the remaining
+ * elements.
+ *
+ * The range consists of the elements from \c first to \c last, excluding the
+ * last element. The remaining elements are moved to the beginning of the
+ * range. The elements after them have unspecified values.
+ *
+ * \return Iterator pointing to the last plus one remaining element
+ * \throws embb::base::ErrorException if the range is negative, the execution
+ *         policy contains no cores, or a task could not be started.
+ * \memory Array with <tt>last-first</tt> elements of type
+ *         <tt>std::iterator_traits<RAI>::value_type</tt>.
+ * \threadsafe if the elements in the range are not accessed by another thread
+ *             while the algorithm is executed.
+ * \note No guarantee is given on the order in which the predicate is applied
+ *       to the elements, and it may be applied more than once to a pair of
+ *       elements.
+ * \see RemoveIf(), embb::mtapi::ExecutionPolicy
+ * \tparam RAI Random access iterator
+ * \tparam BinaryPredicate Binary predicate with both arguments of type
+ *         <tt>std::iterator_traits<RAI>::value_type</tt>
+ */
+template<typename RAI, typename BinaryPredicate>
+RAI Unique(
+  RAI first,
+  /**< [IN/OUT] Random access iterator pointing to the first element of the
+                range */
+  RAI last,
+  /**< [IN/OUT] Random access iterator pointing to the last plus one element
+                of the range */
+  BinaryPredicate equivalence
+    = std::equal_to<typename std::iterator_traits<RAI>::value_type>(),
+  /**< [IN] Binary predicate returning \c true if two consecutive elements
+            are equivalent. The default value uses \c operator==. */
+  const embb::mtapi::ExecutionPolicy& policy = embb::mtapi::ExecutionPolicy(),
+  /**< [IN] embb::mtapi::ExecutionPolicy for the compaction */
+  size_t block_size = 0
+  /**< [IN] Number of elements per chunk. The default value 0 means that
+            chunks contain between 256 and 8192 elements, aiming at four chunks
+            per core. */
+  );
+
+#else // DOXYGEN
+
+/**
+ * Overload of above described Doxygen dummy.
+ */
+template<typename RAIIn, typename RAIOut, typename Predicate>
+RAIOut CopyIf(
+  RAIIn first,
+  RAIIn last,
+  RAIOut output,
+  Predicate predicate,
+  const embb::tasks::ExecutionPolicy& policy,
+  size_t block_size
+  );
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename RAIIn, typename RAIOut, typename Predicate>
+RAIOut CopyIf(
+  RAIIn first,
+  RAIIn last,
+  RAIOut output,
+  Predicate predicate
+  ) {
+  return CopyIf(first, last, output, predicate,
+                embb::tasks::ExecutionPolicy(), 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename RAIIn, typename RAIOut, typename Predicate>
+RAIOut CopyIf(
+  RAIIn first,
+  RAIIn last,
+  RAIOut output,
+  Predicate predicate,
+  const embb::tasks::ExecutionPolicy& policy
+  ) {
+  return CopyIf(first, last, output, predicate, policy, 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy.
+ */
+template<typename RAI, typename Predicate>
+RAI RemoveIf(
+  RAI first,
+  RAI last,
+  Predicate predicate,
+  const embb::tasks::ExecutionPolicy& policy,
+  size_t block_size
+  );
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename RAI, typename Predicate>
+RAI RemoveIf(
+  RAI first,
+  RAI last,
+  Predicate predicate
+  ) {
+  return RemoveIf(first, last, predicate, embb::tasks::ExecutionPolicy(), 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename RAI, typename Predicate>
+RAI RemoveIf(
+  RAI first,
+  RAI last,
+  Predicate predicate,
+  const embb::tasks::ExecutionPolicy& policy
+  ) {
+  return RemoveIf(first, last, predicate, policy, 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy.
+ */
+template<typename RAI, typename Predicate>
+RAI Partition(
+  RAI first,
+  RAI last,
+  Predicate predicate,
+  const embb::tasks::ExecutionPolicy& policy,
+  size_t block_size
+  );
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename RAI, typename Predicate>
+RAI Partition(
+  RAI first,
+  RAI last,
+  Predicate predicate
+  ) {
+  return Partition(first, last, predicate, embb::tasks::ExecutionPolicy(), 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename RAI, typename Predicate>
+RAI Partition(
+  RAI first,
+  RAI last,
+  Predicate predicate,
+  const embb::tasks::ExecutionPolicy& policy
+  ) {
+  return Partition(first, last, predicate, policy, 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy.
+ */
+template<typename RAI, typename BinaryPredicate>
+RAI Unique(
+  RAI first,
+  RAI last,
+  BinaryPredicate equivalence,
+  const embb::tasks::ExecutionPolicy& policy,
+  size_t block_size
+  );
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename RAI, typename BinaryPredicate>
+RAI Unique(
+  RAI first,
+  RAI last,
+  BinaryPredicate equivalence
+  ) {
+  return Unique(first, last, equivalence, embb::tasks::ExecutionPolicy(), 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename RAI, typename BinaryPredicate>
+RAI Unique(
+  RAI first,
+  RAI last,
+  BinaryPredicate equivalence,
+  const embb::tasks::ExecutionPolicy& policy
+  ) {
+  return Unique(first, last, equivalence, policy, 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename RAI>
+RAI Unique(
+  RAI first,
+  RAI last
+  ) {
+  return Unique(first, last,
+    std::equal_to<typename std::iterator_traits<RAI>::value_type>(),
+    embb::tasks::ExecutionPolicy(), 0);
+}
+
+#endif // else DOXYGEN
+
+/**
+ * \}
+ */
+
+}  // namespace algorithms
+}  // namespace embb
+
+#include <embb/algorithms/internal/compaction-inl.h>
+
+#endif  // EMBB_ALGORITHMS_COMPACTION_H_
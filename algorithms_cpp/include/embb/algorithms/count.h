@@ -50,12 +50,14 @@ namespace algorithms {
  * last element.
  *
  * \return The number of elements that are equal to \c value
- * \throws embb::base::ErrorException if not enough MTAPI tasks can be created
- *         to satisfy the requirements of the algorithm.
+ * \throws embb::base::ErrorException if the range is negative, the execution
+ *         policy contains no cores, or a task could not be started.
  * \threadsafe if the elements in the range are not modified by another thread
  *             while the algorithm is executed.
  * \note No guarantee is given on the execution order of the comparison
- *       operations.
+ *       operations. Elements addressed by pointers or vector iterators are
+ *       counted with several independent counters per block, which lets the
+ *       compiler vectorize the comparisons.
  * \see CountIf(), embb::mtapi::ExecutionPolicy
  * \tparam RAI Random access iterator
  * \tparam ValueType Type of \c value that is compared to the elements in the
@@ -77,9 +79,11 @@ typename std::iterator_traits<RAI>::difference_type Count(
   /**< [IN] Lower bound for partitioning the range of elements into blocks that
             are sorted in parallel. Partitioning of a block stops if its size
             is less than or equal to \c block_size. The default value 0 means
-            that the minimum block size is determined automatically depending on
-            the number of elements in the range divided by the number of
-            available cores. */
+            that ranges of more than n/(4*c) elements are always split, where
+            n is the number of elements in the range and c the number of cores
+            of the policy. Smaller ranges are split only while workers of the
+            policy are idle, down to blocks of n/(128*c) elements, but at
+            least one element. */
   );
 
 /**
@@ -90,12 +94,13 @@ typename std::iterator_traits<RAI>::difference_type Count(
  * last element.
  *
  * \return The number of elements for which \c comparison returns true
- * \throws embb::base::ErrorException if not enough MTAPI tasks can be created
- *         to satisfy the requirements of the algorithm.
+ * \throws embb::base::ErrorException if the range is negative, the execution
+ *         policy contains no cores, or a task could not be started.
  * \threadsafe if the elements in the range are not modified by another thread
  *             while the algorithm is executed.
  * \note No guarantee is given on the execution order of the comparison
- *       function.
+ *       function. Elements addressed by pointers or vector iterators are
+ *       counted with several independent counters per block.
  * \see Count(), embb::mtapi::ExecutionPolicy
  * \tparam RAI Random access iterator
  * \tparam ComparisonFunction Unary predicate with argument of type
@@ -117,9 +122,11 @@ typename std::iterator_traits<RAI>::difference_type CountIf(
   /**< [IN] Lower bound for partitioning the range of elements into blocks that
             are sorted in parallel. Partitioning of a block stops if its size
             is less than or equal to \c block_size. The default value 0 means
-            that the minimum block size is determined automatically depending on
-            the number of elements in the range divided by the number of
-            available cores. */
+            that ranges of more than n/(4*c) elements are always split, where
+            n is the number of elements in the range and c the number of cores
+            of the policy. Smaller ranges are split only while workers of the
+            policy are idle, down to blocks of n/(128*c) elements, but at
+            least one element. */
   );
 
 #else // DOXYGEN
@@ -0,0 +1,476 @@
+/*
+ * Copyright (c) 2014-2015, Siemens AG. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef EMBB_ALGORITHMS_FIND_H_
+#define EMBB_ALGORITHMS_FIND_H_
+
+#include <embb/tasks/execution_policy.h>
+#include <iterator>
+
+namespace embb {
+namespace algorithms {
+
+/**
+ * \defgroup CPP_ALGORITHMS_FIND Searching
+ * Parallel search operations with early termination
+ * \ingroup CPP_ALGORITHMS
+ * \{
+ */
+
+#ifdef DOXYGEN
+
+/**
+ * Searches in parallel for the first element in a range that is equal to
+ * the specified value.
+ *
+ * The range consists of the elements from \c first to \c last, excluding the
+ * last element.
+ *
+ * Blocks to the right of the leftmost match found so far are skipped, so that
+ * the search stops early if a match is found.
+ *
+ * \return Iterator to the first element that is equal to \c value, or
+ *         \c last if there is none
+ * \throws embb::base::ErrorException if the range is negative, the execution
+ *         policy contains no cores, or a task could not be started.
+ * \threadsafe if the elements in the range are not modified by another thread
+ *             while the algorithm is executed.
+ * \note No guarantee is given on the execution order of the comparisons. As
+ *       soon as the result is known, blocks that cannot change it are not
+ *       searched anymore, but elements beyond the result may still be tested.
+ * \see FindIf(), embb::mtapi::ExecutionPolicy
+ * \tparam RAI Random access iterator
+ * \tparam ValueType Type of \c value that is compared to the elements in the
+ *         range using the \c operator==.
+ */
+template<typename RAI, typename ValueType>
+RAI Find(
+  RAI first,
+  /**< [IN] Random access iterator pointing to the first element of the range */
+  RAI last,
+  /**< [IN] Random access iterator pointing to the last plus one element of the
+            range */
+  const ValueType& value,
+  /**< [IN] Value that the elements in the range are compared to using
+            \c operator== */
+  const embb::mtapi::ExecutionPolicy& policy = embb::mtapi::ExecutionPolicy(),
+  /**< [IN] embb::mtapi::ExecutionPolicy for the search */
+  size_t block_size = 0
+  /**< [IN] Lower bound for partitioning the range of elements into blocks that
+            are searched in parallel. Partitioning of a block stops if its size
+            is less than or equal to \c block_size. The default value 0 means
+            that ranges of more than n/(4*c) elements are always split, where
+            n is the number of elements in the range and c the number of cores
+            of the policy. Smaller ranges are split only while workers of the
+            policy are idle, down to blocks of n/(128*c) elements, but at
+            least one element. */
+  );
+
+/**
+ * Searches in parallel for the first element in a range for which the
+ * predicate returns \c true.
+ *
+ * The range consists of the elements from \c first to \c last, excluding the
+ * last element.
+ *
+ * Blocks to the right of the leftmost match found so far are skipped, so that
+ * the search stops early if a match is found.
+ *
+ * \return Iterator to the first element for which \c predicate returns
+ *         \c true, or \c last if there is none
+ * \throws embb::base::ErrorException if the range is negative, the execution
+ *         policy contains no cores, or a task could not be started.
+ * \threadsafe if the elements in the range are not modified by another thread
+ *             while the algorithm is executed.
+ * \note No guarantee is given on the execution order of the comparisons. As
+ *       soon as the result is known, blocks that cannot change it are not
+ *       searched anymore, but elements beyond the result may still be tested.
+ * \see Find(), AnyOf(), embb::mtapi::ExecutionPolicy
+ * \tparam RAI Random access iterator
+ * \tparam Predicate Unary predicate with argument of type
+ *         <tt>std::iterator_traits<RAI>::value_type</tt>, returning a value
+ *         convertible to \c bool
+ */
+template<typename RAI, typename Predicate>
+RAI FindIf(
+  RAI first,
+  /**< [IN] Random access iterator pointing to the first element of the range */
+  RAI last,
+  /**< [IN] Random access iterator pointing to the last plus one element of the
+            range */
+  Predicate predicate,
+  /**< [IN] Unary predicate used to test the elements in the range */
+  const embb::mtapi::ExecutionPolicy& policy = embb::mtapi::ExecutionPolicy(),
+  /**< [IN] embb::mtapi::ExecutionPolicy for the search */
+  size_t block_size = 0
+  /**< [IN] Lower bound for partitioning the range of elements into blocks that
+            are searched in parallel. Partitioning of a block stops if its size
+            is less than or equal to \c block_size. The default value 0 means
+            that ranges of more than n/(4*c) elements are always split, where
+            n is the number of elements in the range and c the number of cores
+            of the policy. Smaller ranges are split only while workers of the
+            policy are idle, down to blocks of n/(128*c) elements, but at
+            least one element. */
+  );
+
+/**
+ * Checks in parallel whether the predicate returns \c true for any element
+ * in a range.
+ *
+ * The range consists of the elements from \c first to \c last, excluding the
+ * last element.
+ *
+ * The search stops as soon as any element decides the result.
+ *
+ * \return \c true if \c predicate returns \c true for at least one
+ *         element, \c false otherwise or if the range is empty
+ * \throws embb::base::ErrorException if the range is negative, the execution
+ *         policy contains no cores, or a task could not be started.
+ * \threadsafe if the elements in the range are not modified by another thread
+ *             while the algorithm is executed.
+ * \note No guarantee is given on the execution order of the comparisons. As
+ *       soon as the result is known, blocks that cannot change it are not
+ *       searched anymore, but elements beyond the result may still be tested.
+ * \see AllOf(), NoneOf(), FindIf(), embb::mtapi::ExecutionPolicy
+ * \tparam RAI Random access iterator
+ * \tparam Predicate Unary predicate with argument of type
+ *         <tt>std::iterator_traits<RAI>::value_type</tt>, returning a value
+ *         convertible to \c bool
+ */
+template<typename RAI, typename Predicate>
+bool AnyOf(
+  RAI first,
+  /**< [IN] Random access iterator pointing to the first element of the range */
+  RAI last,
+  /**< [IN] Random access iterator pointing to the last plus one element of the
+            range */
+  Predicate predicate,
+  /**< [IN] Unary predicate used to test the elements in the range */
+  const embb::mtapi::ExecutionPolicy& policy = embb::mtapi::ExecutionPolicy(),
+  /**< [IN] embb::mtapi::ExecutionPolicy for the search */
+  size_t block_size = 0
+  /**< [IN] Lower bound for partitioning the range of elements into blocks that
+            are searched in parallel. Partitioning of a block stops if its size
+            is less than or equal to \c block_size. The default value 0 means
+            that ranges of more than n/(4*c) elements are always split, where
+            n is the number of elements in the range and c the number of cores
+            of the policy. Smaller ranges are split only while workers of the
+            policy are idle, down to blocks of n/(128*c) elements, but at
+            least one element. */
+  );
+
+/**
+ * Checks in parallel whether the predicate returns \c true for all elements
+ * in a range.
+ *
+ * The range consists of the elements from \c first to \c last, excluding the
+ * last element.
+ *
+ * The search stops as soon as any element decides the result.
+ *
+ * \return \c true if \c predicate returns \c true for all elements or
+ *         the range is empty, \c false otherwise
+ * \throws embb::base::ErrorException if the range is negative, the execution
+ *         policy contains no cores, or a task could not be started.
+ * \threadsafe if the elements in the range are not modified by another thread
+ *             while the algorithm is executed.
+ * \note No guarantee is given on the execution order of the comparisons. As
+ *       soon as the result is known, blocks that cannot change it are not
+ *       searched anymore, but elements beyond the result may still be tested.
+ * \see AnyOf(), NoneOf(), embb::mtapi::ExecutionPolicy
+ * \tparam RAI Random access iterator
+ * \tparam Predicate Unary predicate with argument of type
+ *         <tt>std::iterator_traits<RAI>::value_type</tt>, returning a value
+ *         convertible to \c bool
+ */
+template<typename RAI, typename Predicate>
+bool AllOf(
+  RAI first,
+  /**< [IN] Random access iterator pointing to the first element of the range */
+  RAI last,
+  /**< [IN] Random access iterator pointing to the last plus one element of the
+            range */
+  Predicate predicate,
+  /**< [IN] Unary predicate used to test the elements in the range */
+  const embb::mtapi::ExecutionPolicy& policy = embb::mtapi::ExecutionPolicy(),
+  /**< [IN] embb::mtapi::ExecutionPolicy for the search */
+  size_t block_size = 0
+  /**< [IN] Lower bound for partitioning the range of elements into blocks that
+            are searched in parallel. Partitioning of a block stops if its size
+            is less than or equal to \c block_size. The default value 0 means
+            that ranges of more than n/(4*c) elements are always split, where
+            n is the number of elements in the range and c the number of cores
+            of the policy. Smaller ranges are split only while workers of the
+            policy are idle, down to blocks of n/(128*c) elements, but at
+            least one element. */
+  );
+
+/**
+ * Checks in parallel whether the predicate returns \c true for no element
+ * in a range.
+ *
+ * The range consists of the elements from \c first to \c last, excluding the
+ * last element.
+ *
+ * The search stops as soon as any element decides the result.
+ *
+ * \return \c true if \c predicate returns \c true for no element or
+ *         the range is empty, \c false otherwise
+ * \throws embb::base::ErrorException if the range is negative, the execution
+ *         policy contains no cores, or a task could not be started.
+ * \threadsafe if the elements in the range are not modified by another thread
+ *             while the algorithm is executed.
+ * \note No guarantee is given on the execution order of the comparisons. As
+ *       soon as the result is known, blocks that cannot change it are not
+ *       searched anymore, but elements beyond the result may still be tested.
+ * \see AnyOf(), AllOf(), embb::mtapi::ExecutionPolicy
+ * \tparam RAI Random access iterator
+ * \tparam Predicate Unary predicate with argument of type
+ *         <tt>std::iterator_traits<RAI>::value_type</tt>, returning a value
+ *         convertible to \c bool
+ */
+template<typename RAI, typename Predicate>
+bool NoneOf(
+  RAI first,
+  /**< [IN] Random access iterator pointing to the first element of the range */
+  RAI last,
+  /**< [IN] Random access iterator pointing to the last plus one element of the
+            range */
+  Predicate predicate,
+  /**< [IN] Unary predicate used to test the elements in the range */
+  const embb::mtapi::ExecutionPolicy& policy = embb::mtapi::ExecutionPolicy(),
+  /**< [IN] embb::mtapi::ExecutionPolicy for the search */
+  size_t block_size = 0
+  /**< [IN] Lower bound for partitioning the range of elements into blocks that
+            are searched in parallel. Partitioning of a block stops if its size
+            is less than or equal to \c block_size. The default value 0 means
+            that ranges of more than n/(4*c) elements are always split, where
+            n is the number of elements in the range and c the number of cores
+            of the policy. Smaller ranges are split only while workers of the
+            policy are idle, down to blocks of n/(128*c) elements, but at
+            least one element. */
+  );
+
+#else // DOXYGEN
+
+/**
+ * Overload of above described Doxygen dummy.
+ */
+template<typename RAI, typename ValueType>
+RAI Find(
+  RAI first,
+  RAI last,
+  const ValueType& value,
+  const embb::tasks::ExecutionPolicy& policy,
+  size_t block_size
+  );
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename RAI, typename ValueType>
+RAI Find(
+  RAI first,
+  RAI last,
+  const ValueType& value
+  ) {
+  return Find(first, last, value, embb::tasks::ExecutionPolicy(), 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename RAI, typename ValueType>
+RAI Find(
+  RAI first,
+  RAI last,
+  const ValueType& value,
+  const embb::tasks::ExecutionPolicy& policy
+  ) {
+  return Find(first, last, value, policy, 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy.
+ */
+template<typename RAI, typename Predicate>
+RAI FindIf(
+  RAI first,
+  RAI last,
+  Predicate predicate,
+  const embb::tasks::ExecutionPolicy& policy,
+  size_t block_size
+  );
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename RAI, typename Predicate>
+RAI FindIf(
+  RAI first,
+  RAI last,
+  Predicate predicate
+  ) {
+  return FindIf(first, last, predicate, embb::tasks::ExecutionPolicy(), 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename RAI, typename Predicate>
+RAI FindIf(
+  RAI first,
+  RAI last,
+  Predicate predicate,
+  const embb::tasks::ExecutionPolicy& policy
+  ) {
+  return FindIf(first, last, predicate, policy, 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy.
+ */
+template<typename RAI, typename Predicate>
+bool AnyOf(
+  RAI first,
+  RAI last,
+  Predicate predicate,
+  const embb::tasks::ExecutionPolicy& policy,
+  size_t block_size
+  );
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename RAI, typename Predicate>
+bool AnyOf(
+  RAI first,
+  RAI last,
+  Predicate predicate
+  ) {
+  return AnyOf(first, last, predicate, embb::tasks::ExecutionPolicy(), 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename RAI, typename Predicate>
+bool AnyOf(
+  RAI first,
+  RAI last,
+  Predicate predicate,
+  const embb::tasks::ExecutionPolicy& policy
+  ) {
+  return AnyOf(first, last, predicate, policy, 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy.
+ */
+template<typename RAI, typename Predicate>
+bool AllOf(
+  RAI first,
+  RAI last,
+  Predicate predicate,
+  const embb::tasks::ExecutionPolicy& policy,
+  size_t block_size
+  );
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename RAI, typename Predicate>
+bool AllOf(
+  RAI first,
+  RAI last,
+  Predicate predicate
+  ) {
+  return AllOf(first, last, predicate, embb::tasks::ExecutionPolicy(), 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename RAI, typename Predicate>
+bool AllOf(
+  RAI first,
+  RAI last,
+  Predicate predicate,
+  const embb::tasks::ExecutionPolicy& policy
+  ) {
+  return AllOf(first, last, predicate, policy, 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy.
+ */
+template<typename RAI, typename Predicate>
+bool NoneOf(
+  RAI first,
+  RAI last,
+  Predicate predicate,
+  const embb::tasks::ExecutionPolicy& policy,
+  size_t block_size
+  );
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename RAI, typename Predicate>
+bool NoneOf(
+  RAI first,
+  RAI last,
+  Predicate predicate
+  ) {
+  return NoneOf(first, last, predicate, embb::tasks::ExecutionPolicy(), 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename RAI, typename Predicate>
+bool NoneOf(
+  RAI first,
+  RAI last,
+  Predicate predicate,
+  const embb::tasks::ExecutionPolicy& policy
+  ) {
+  return NoneOf(first, last, predicate, policy, 0);
+}
+
+#endif // else DOXYGEN
+
+/**
+ * \}
+ */
+
+}  // namespace algorithms
+}  // namespace embb
+
+#include <embb/algorithms/internal/find-inl.h>
+
+#endif  // EMBB_ALGORITHMS_FIND_H_
@@ -28,6 +28,7 @@
 #define EMBB_ALGORITHMS_FOR_EACH_H_
 
 #include <embb/tasks/execution_policy.h>
+#include <embb/algorithms/blocked_range.h>
 
 namespace embb {
 namespace algorithms {
@@ -47,8 +48,8 @@ namespace algorithms {
  * The range consists of the elements from \c first to \c last, excluding the
  * last element.
  *
- * \throws embb::base::ErrorException if not enough MTAPI tasks can be created
- *         to satisfy the requirements of the algorithm.
+ * \throws embb::base::ErrorException if the range is negative, the execution
+ *         policy contains no cores, or a task could not be started.
  * \threadsafe if the elements in the range are not modified by another thread
  *             while the algorithm is executed.
  * \note No guarantee is given on the order in which the function is applied to
@@ -73,9 +74,87 @@ void ForEach(
   /**< [IN] Lower bound for partitioning the range of elements into blocks that
             are treated in parallel. Partitioning of a block stops if its size
             is less than or equal to \c block_size. The default value 0 means
-            that the minimum block size is determined automatically depending on
-            the number of elements in the range divided by the number of
-            available cores. */
+            that ranges of more than n/(4*c) elements are always split, where
+            n is the number of elements in the range and c the number of cores
+            of the policy. Smaller ranges are split only while workers of the
+            policy are idle, down to blocks of n/(128*c) elements, but at
+            least one element. */
+  );
+
+/**
+ * Applies a function to the tiles of a two-dimensional range of indices in
+ * parallel.
+ *
+ * The range is split recursively at the middle of its largest dimension until
+ * the tiles contain at most \c tile_size index tuples. The function is called
+ * once per tile with a BlockedRange2D describing the tile, and typically loops
+ * over the indices of the tile. Compared to splitting only the outer
+ * dimension, tiles keep the accessed data of stencil or transpose-like
+ * computations in the caches. Neighboring tiles are processed one after
+ * another by the same task, unless idle workers take them over.
+ *
+ * \throws embb::base::ErrorException if the range is negative in a dimension,
+ *         the execution policy contains no cores, or a task could not be
+ *         started.
+ * \threadsafe if the data accessed for the indices is not modified by
+ *             another thread while the algorithm is executed.
+ * \note No guarantee is given on the order in which the function is applied to
+ *       the tiles.
+ * \see BlockedRange2D, embb::mtapi::ExecutionPolicy
+ * \tparam Function Unary function with argument of type
+ *         <tt>const BlockedRange2D&</tt>.
+ */
+template<typename Function>
+void ForEach(
+  const BlockedRange2D& range,
+  /**< [IN] Range of indices to be split into tiles */
+  Function function,
+  /**< [IN] Function applied to each tile of the range */
+  const embb::mtapi::ExecutionPolicy& policy = embb::mtapi::ExecutionPolicy(),
+  /**< [IN] embb::mtapi::ExecutionPolicy for the foreach loop execution */
+  size_t tile_size = 0
+  /**< [IN] Maximum number of index tuples of a tile. The default value 0
+            means tiles of at most 4096 index tuples, such as 64 x 64
+            elements, whose data fits into the L1 cache for elements of up to
+            8 bytes. */
+  );
+
+/**
+ * Applies a function to the tiles of a three-dimensional range of indices in
+ * parallel.
+ *
+ * The range is split recursively at the middle of its largest dimension until
+ * the tiles contain at most \c tile_size index tuples. The function is called
+ * once per tile with a BlockedRange3D describing the tile, and typically loops
+ * over the indices of the tile. Compared to splitting only the outer
+ * dimension, tiles keep the accessed data of stencil or transpose-like
+ * computations in the caches. Neighboring tiles are processed one after
+ * another by the same task, unless idle workers take them over.
+ *
+ * \throws embb::base::ErrorException if the range is negative in a dimension,
+ *         the execution policy contains no cores, or a task could not be
+ *         started.
+ * \threadsafe if the data accessed for the indices is not modified by
+ *             another thread while the algorithm is executed.
+ * \note No guarantee is given on the order in which the function is applied to
+ *       the tiles.
+ * \see BlockedRange3D, embb::mtapi::ExecutionPolicy
+ * \tparam Function Unary function with argument of type
+ *         <tt>const BlockedRange3D&</tt>.
+ */
+template<typename Function>
+void ForEach(
+  const BlockedRange3D& range,
+  /**< [IN] Range of indices to be split into tiles */
+  Function function,
+  /**< [IN] Function applied to each tile of the range */
+  const embb::mtapi::ExecutionPolicy& policy = embb::mtapi::ExecutionPolicy(),
+  /**< [IN] embb::mtapi::ExecutionPolicy for the foreach loop execution */
+  size_t tile_size = 0
+  /**< [IN] Maximum number of index tuples of a tile. The default value 0
+            means tiles of at most 4096 index tuples, such as 16 x 16 x 16
+            elements, whose data fits into the L1 cache for elements of up to
+            8 bytes. */
   );
 
 #else // DOXYGEN
@@ -117,6 +196,74 @@ void ForEach(
   ForEach(first, last, unary, policy, 0);
 }
 
+/**
+ * Overload of above described Doxygen dummy.
+ */
+template<typename Function>
+void ForEach(
+  const BlockedRange2D& range,
+  Function function,
+  const embb::tasks::ExecutionPolicy& policy,
+  size_t tile_size
+  );
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename Function>
+void ForEach(
+  const BlockedRange2D& range,
+  Function function
+  ) {
+  ForEach(range, function, embb::tasks::ExecutionPolicy(), 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename Function>
+void ForEach(
+  const BlockedRange2D& range,
+  Function function,
+  const embb::tasks::ExecutionPolicy& policy
+  ) {
+  ForEach(range, function, policy, 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy.
+ */
+template<typename Function>
+void ForEach(
+  const BlockedRange3D& range,
+  Function function,
+  const embb::tasks::ExecutionPolicy& policy,
+  size_t tile_size
+  );
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename Function>
+void ForEach(
+  const BlockedRange3D& range,
+  Function function
+  ) {
+  ForEach(range, function, embb::tasks::ExecutionPolicy(), 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename Function>
+void ForEach(
+  const BlockedRange3D& range,
+  Function function,
+  const embb::tasks::ExecutionPolicy& policy
+  ) {
+  ForEach(range, function, policy, 0);
+}
+
 #endif // else DOXYGEN
 
 /**
@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2014-2015, Siemens AG. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef EMBB_ALGORITHMS_HISTOGRAM_H_
+#define EMBB_ALGORITHMS_HISTOGRAM_H_
+
+#include <iterator>
+#include <embb/tasks/execution_policy.h>
+#include <embb/algorithms/identity.h>
+
+namespace embb {
+namespace algorithms {
+
+/**
+ * \defgroup CPP_ALGORITHMS_HISTOGRAM Histogram
+ * Parallel computation of histograms
+ * \ingroup CPP_ALGORITHMS
+ * \{
+ */
+
+#ifdef DOXYGEN
+
+/**
+ * Counts in parallel how many elements of a range fall into each bin of a
+ * histogram.
+ *
+ * The range consists of the elements from \c first to \c last, excluding the
+ * last element. The bin of an element is given by \c bin_function, elements
+ * whose bin is not less than \c bin_count are not counted. The counts are
+ * stored in the \c bin_count elements starting at \c bins, overwriting their
+ * previous values.
+ *
+ * Each thread counts into private bins, which are merged at the end. This
+ * avoids contention on shared counters even for skewed data. If there are
+ * few bins, the private bins are cache-aligned arrays, which are merged in
+ * parallel. For large numbers of bins, the private bins are hash tables
+ * holding only the bins that occur in the part of the range counted by a
+ * thread, so that memory and merging costs depend on the number of elements
+ * instead of the number of bins.
+ *
+ * \throws embb::base::ErrorException if the range is negative, the execution
+ *         policy contains no cores, a task could not be started, or the
+ *         maximum number of threads has been exceeded.
+ * \throws embb::base::NoMemoryException if not enough memory is available for
+ *         the private bins.
+ * \memory Private bins for each thread counting a part of the range. These are
+ *         arrays of \c bin_count counters if \c bin_count is small, and hash
+ *         tables with up to four entries per distinct bin counted by the
+ *         thread otherwise.
+ * \threadsafe if the elements in the range and the bins are not modified by
+ *             another thread while the algorithm is executed.
+ * \note No guarantee is given on the order in which the bin function is
+ *       applied to the elements.
+ * \see Count(), embb::mtapi::ExecutionPolicy
+ * \tparam RAI Random access iterator
+ * \tparam RAIBins Random access iterator to counters, that is, elements of an
+ *         integral type
+ * \tparam BinFunction Unary function with argument of type
+ *         <tt>std::iterator_traits<RAI>::value_type</tt> returning the bin of
+ *         the element as a value convertible to \c size_t.
+ */
+template<typename RAI, typename RAIBins, typename BinFunction>
+void Histogram(
+  RAI first,
+  /**< [IN] Random access iterator pointing to the first element of the range */
+  RAI last,
+  /**< [IN] Random access iterator pointing to the last plus one element of the
+            range */
+  RAIBins bins,
+  /**< [OUT] Random access iterator pointing to the first counter of the
+             histogram */
+  size_t bin_count,
+  /**< [IN] Number of bins of the histogram */
+  BinFunction bin_function = Identity(),
+  /**< [IN] Unary function mapping an element to its bin. The default value
+            uses the elements themselves as bins. */
+  const embb::mtapi::ExecutionPolicy& policy = embb::mtapi::ExecutionPolicy(),
+  /**< [IN] embb::mtapi::ExecutionPolicy for the counting */
+  size_t block_size = 0
+  /**< [IN] Lower bound for partitioning the range of elements into blocks that
+            are counted in parallel. Partitioning of a block stops if its size
+            is less than or equal to \c block_size. The default value 0 means
+            that ranges of more than n/(4*c) elements are always split, where
+            n is the number of elements in the range and c the number of cores
+            of the policy. Smaller ranges are split only while workers of the
+            policy are idle, down to blocks of n/(128*c) elements, but at
+            least one element. */
+  );
+
+#else // DOXYGEN
+
+/**
+ * Overload of above described Doxygen dummy.
+ */
+template<typename RAI, typename RAIBins, typename BinFunction>
+void Histogram(
+  RAI first,
+  RAI last,
+  RAIBins bins,
+  size_t bin_count,
+  BinFunction bin_function,
+  const embb::tasks::ExecutionPolicy& policy,
+  size_t block_size
+  );
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename RAI, typename RAIBins>
+void Histogram(
+  RAI first,
+  RAI last,
+  RAIBins bins,
+  size_t bin_count
+  ) {
+  Histogram(first, last, bins, bin_count, Identity(),
+            embb::tasks::ExecutionPolicy(), 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename RAI, typename RAIBins, typename BinFunction>
+void Histogram(
+  RAI first,
+  RAI last,
+  RAIBins bins,
+  size_t bin_count,
+  BinFunction bin_function
+  ) {
+  Histogram(first, last, bins, bin_count, bin_function,
+            embb::tasks::ExecutionPolicy(), 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename RAI, typename RAIBins, typename BinFunction>
+void Histogram(
+  RAI first,
+  RAI last,
+  RAIBins bins,
+  size_t bin_count,
+  BinFunction bin_function,
+  const embb::tasks::ExecutionPolicy& policy
+  ) {
+  Histogram(first, last, bins, bin_count, bin_function, policy, 0);
+}
+
+#endif // else DOXYGEN
+
+/**
+ * \}
+ */
+
+}  // namespace algorithms
+}  // namespace embb
+
+#include <embb/algorithms/internal/histogram-inl.h>
+
+#endif  // EMBB_ALGORITHMS_HISTOGRAM_H_
@@ -0,0 +1,331 @@
+/*
+ * Copyright (c) 2014-2015, Siemens AG. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef EMBB_ALGORITHMS_INTERNAL_COMPACTION_INL_H_
+#define EMBB_ALGORITHMS_INTERNAL_COMPACTION_INL_H_
+
+#include <iterator>
+#include <vector>
+
+#include <embb/base/exceptions.h>
+#include <embb/algorithms/scan.h>
+#include <embb/algorithms/transform.h>
+
+namespace embb {
+namespace algorithms {
+namespace internal {
+
+/**
+ * Selects the elements for which a predicate returns \c true.
+ */
+template<typename Predicate>
+class CompactionPredicateSelector {
+ public:
+  CompactionPredicateSelector(Predicate predicate, bool selected)
+  : predicate_(predicate), selected_(selected) {
+  }
+
+  template<typename RAI>
+  bool operator()(RAI element, size_t) {
+    return (predicate_(*element) ? true : false) == selected_;
+  }
+
+ private:
+  Predicate predicate_;
+  bool selected_;
+};
+
+/**
+ * Selects the elements that are not equivalent to their predecessors.
+ */
+template<typename BinaryPredicate>
+class CompactionUniqueSelector {
+ public:
+  explicit CompactionUniqueSelector(BinaryPredicate equivalence)
+  : equivalence_(equivalence) {
+  }
+
+  template<typename RAI>
+  bool operator()(RAI element, size_t index) {
+    if (index == 0) {
+      return true;
+    }
+    RAI predecessor = element;
+    --predecessor;
+    return !equivalence_(*predecessor, *element);
+  }
+
+ private:
+  BinaryPredicate equivalence_;
+};
+
+/**
+ * Operations of a single-pass scan that copies the selected elements to the
+ * output. The scanned state is the number of selected elements, which is the
+ * output position of the next selected element.
+ */
+template<typename RAIIn, typename RAIOut, typename Selector>
+class CompactionOperations {
+ public:
+  typedef size_t State;
+
+  CompactionOperations(RAIIn first, RAIOut output_first, Selector selector)
+  : first_(first), output_first_(output_first), selector_(selector) {
+  }
+
+  State Neutral() const {
+    return 0;
+  }
+
+  bool IsComplete(const State&) const {
+    return false;
+  }
+
+  State Combine(const State& earlier, const State& later) {
+    return earlier + later;
+  }
+
+  State Aggregate(size_t first, size_t last) {
+    RAIIn input = first_ + static_cast<in_difference_type>(first);
+    size_t selected = 0;
+    for (size_t i = first; i < last; i++, ++input) {
+      if (selector_(input, i)) {
+        ++selected;
+      }
+    }
+    return selected;
+  }
+
+  State Write(size_t first, size_t last, const State* prefix) {
+    RAIIn input = first_ + static_cast<in_difference_type>(first);
+    size_t position = (prefix == NULL) ? 0 : *prefix;
+    RAIOut output = output_first_ + static_cast<out_difference_type>(position);
+    for (size_t i = first; i < last; i++, ++input) {
+      if (selector_(input, i)) {
+        *output = *input;
+        ++output;
+        ++position;
+      }
+    }
+    return position;
+  }
+
+ private:
+  typedef typename std::iterator_traits<RAIIn>::difference_type
+    in_difference_type;
+  typedef typename std::iterator_traits<RAIOut>::difference_type
+    out_difference_type;
+
+  RAIIn first_;
+  RAIOut output_first_;
+  Selector selector_;
+};
+
+/**
+ * Operations of a single-pass scan that copies the selected elements to the
+ * beginning of the output, and the other elements in reverse order to its end.
+ * The position of the next other element follows from the index of the
+ * element and the number of selected elements before it.
+ */
+template<typename RAIIn, typename ValueType, typename Predicate>
+class CompactionPartitionOperations {
+ public:
+  typedef size_t State;
+
+  CompactionPartitionOperations(RAIIn first, ValueType* output_first,
+                                size_t count, Predicate predicate)
+  : first_(first), output_first_(output_first), count_(count),
+    predicate_(predicate) {
+  }
+
+  State Neutral() const {
+    return 0;
+  }
+
+  bool IsComplete(const State&) const {
+    return false;
+  }
+
+  State Combine(const State& earlier, const State& later) {
+    return earlier + later;
+  }
+
+  State Aggregate(size_t first, size_t last) {
+    RAIIn input = first_ + static_cast<difference_type>(first);
+    size_t selected = 0;
+    for (size_t i = first; i < last; i++, ++input) {
+      if (predicate_(*input)) {
+        ++selected;
+      }
+    }
+    return selected;
+  }
+
+  State Write(size_t first, size_t last, const State* prefix) {
+    RAIIn input = first_ + static_cast<difference_type>(first);
+    size_t selected = (prefix == NULL) ? 0 : *prefix;
+    size_t rejected = first - selected;
+    for (size_t i = first; i < last; i++, ++input) {
+      if (predicate_(*input)) {
+        output_first_[selected++] = *input;
+      } else {
+        output_first_[count_ - 1 - rejected++] = *input;
+      }
+    }
+    return selected;
+  }
+
+ private:
+  typedef typename std::iterator_traits<RAIIn>::difference_type
+    difference_type;
+
+  RAIIn first_;
+  ValueType* output_first_;
+  size_t count_;
+  Predicate predicate_;
+};
+
+/**
+ * Checks the range and policy common to all compactions and returns the
+ * number of elements.
+ */
+template<typename RAI>
+size_t CompactionCheck(RAI first, RAI last,
+                       const embb::tasks::ExecutionPolicy& policy,
+                       const char* message, std::random_access_iterator_tag) {
+  typedef typename std::iterator_traits<RAI>::difference_type difference_type;
+  difference_type distance = std::distance(first, last);
+  if (distance < 0) {
+    EMBB_THROW(embb::base::ErrorException, message);
+  }
+  if (policy.GetCoreCount() == 0) {
+    EMBB_THROW(embb::base::ErrorException, "No cores in execution policy");
+  }
+  return static_cast<size_t>(distance);
+}
+
+/**
+ * Compacts the selected elements of a range in-place by copying them to a
+ * temporary array, and returns the number of remaining elements.
+ */
+template<typename RAI, typename Selector>
+size_t CompactionInPlace(RAI first, size_t count, Selector selector,
+                         const embb::tasks::ExecutionPolicy& policy,
+                         size_t block_size) {
+  typedef typename std::iterator_traits<RAI>::value_type value_type;
+  // The elements are assigned to, so they have to be constructed before:
+  std::vector<value_type> temporary(count);
+  size_t selected = ScanChunked(
+    CompactionOperations<RAI, value_type*, Selector>(
+      first, &temporary[0], selector),
+    count, policy, block_size);
+  Copy(&temporary[0], &temporary[0] + selected, first, policy, 0);
+  return selected;
+}
+
+}  // namespace internal
+
+template<typename RAIIn, typename RAIOut, typename Predicate>
+RAIOut CopyIf(RAIIn first, RAIIn last, RAIOut output, Predicate predicate,
+              const embb::tasks::ExecutionPolicy& policy, size_t block_size) {
+  typedef internal::CompactionPredicateSelector<Predicate> Selector;
+  typename std::iterator_traits<RAIIn>::iterator_category category;
+  size_t count = internal::CompactionCheck(first, last, policy,
+    "Negative range for CopyIf", category);
+  if (count == 0) {
+    return output;
+  }
+  size_t selected = internal::ScanChunked(
+    internal::CompactionOperations<RAIIn, RAIOut, Selector>(
+      first, output, Selector(predicate, true)),
+    count, policy, block_size);
+  return output +
+    static_cast<typename std::iterator_traits<RAIOut>::difference_type>(
+      selected);
+}
+
+template<typename RAI, typename Predicate>
+RAI RemoveIf(RAI first, RAI last, Predicate predicate,
+             const embb::tasks::ExecutionPolicy& policy, size_t block_size) {
+  typedef internal::CompactionPredicateSelector<Predicate> Selector;
+  typedef typename std::iterator_traits<RAI>::difference_type difference_type;
+  typename std::iterator_traits<RAI>::iterator_category category;
+  size_t count = internal::CompactionCheck(first, last, policy,
+    "Negative range for RemoveIf", category);
+  if (count == 0) {
+    return first;
+  }
+  return first + static_cast<difference_type>(internal::CompactionInPlace(
+    first, count, Selector(predicate, false), policy, block_size));
+}
+
+template<typename RAI, typename Predicate>
+RAI Partition(RAI first, RAI last, Predicate predicate,
+              const embb::tasks::ExecutionPolicy& policy, size_t block_size) {
+  typedef typename std::iterator_traits<RAI>::value_type value_type;
+  typedef typename std::iterator_traits<RAI>::difference_type difference_type;
+  typename std::iterator_traits<RAI>::iterator_category category;
+  size_t count = internal::CompactionCheck(first, last, policy,
+    "Negative range for Partition", category);
+  if (count == 0) {
+    return first;
+  }
+  // The elements are assigned to, so they have to be constructed before:
+  std::vector<value_type> temporary(count);
+  size_t selected = internal::ScanChunked(
+    internal::CompactionPartitionOperations<RAI, value_type, Predicate>(
+      first, &temporary[0], count, predicate),
+    count, policy, block_size);
+  RAI middle = first + static_cast<difference_type>(selected);
+  value_type* temporary_first = &temporary[0];
+  Copy(temporary_first, temporary_first + selected, first, policy, 0);
+  // The other elements are stored in reverse order at the end:
+  Copy(std::reverse_iterator<value_type*>(temporary_first + count),
+       std::reverse_iterator<value_type*>(temporary_first + selected),
+       middle, policy, 0);
+  return middle;
+}
+
+template<typename RAI, typename BinaryPredicate>
+RAI Unique(RAI first, RAI last, BinaryPredicate equivalence,
+           const embb::tasks::ExecutionPolicy& policy, size_t block_size) {
+  typedef internal::CompactionUniqueSelector<BinaryPredicate> Selector;
+  typedef typename std::iterator_traits<RAI>::difference_type difference_type;
+  typename std::iterator_traits<RAI>::iterator_category category;
+  size_t count = internal::CompactionCheck(first, last, policy,
+    "Negative range for Unique", category);
+  if (count == 0) {
+    return first;
+  }
+  return first + static_cast<difference_type>(internal::CompactionInPlace(
+    first, count, Selector(equivalence), policy, block_size));
+}
+
+}  // namespace algorithms
+}  // namespace embb
+
+#endif  // EMBB_ALGORITHMS_INTERNAL_COMPACTION_INL_H_
@@ -0,0 +1,260 @@
+/*
+ * Copyright (c) 2014-2015, Siemens AG. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef EMBB_ALGORITHMS_INTERNAL_FIND_INL_H_
+#define EMBB_ALGORITHMS_INTERNAL_FIND_INL_H_
+
+#include <iterator>
+
+#include <embb/base/atomic.h>
+#include <embb/base/exceptions.h>
+#include <embb/tasks/tasks.h>
+#include <embb/algorithms/internal/partition.h>
+
+namespace embb {
+namespace algorithms {
+namespace internal {
+
+/**
+ * Searches a subrange for the leftmost element satisfying a predicate.
+ *
+ * All tasks of a search share the index of the leftmost match found so far.
+ * Subranges are split lazily like in ForEach(), and the upper halves are
+ * handed over to new tasks. Before each grain, a task checks whether a match
+ * to the left of the grain has been found and, if so, stops. Tasks of upper
+ * halves that have not started yet stop right away. If any match is
+ * sufficient, the shared index is set to 0 on the first match, which stops
+ * all tasks.
+ */
+template<typename RAI, typename Predicate>
+class FindFunctor {
+ public:
+  FindFunctor(RAI global_first, size_t first, size_t last,
+              Predicate predicate,
+              const embb::tasks::ExecutionPolicy& policy,
+              const AutoPartitioner& partitioner,
+              embb::base::Atomic<size_t>& leftmost, bool any_match)
+  : global_first_(global_first), first_(first), last_(last),
+    predicate_(predicate), policy_(policy), partitioner_(partitioner),
+    leftmost_(leftmost), any_match_(any_match) {
+  }
+
+  void operator()(embb::tasks::TaskContext&) {
+    typedef typename std::iterator_traits<RAI>::difference_type
+      difference_type;
+    embb::tasks::TaskGroup group;
+    size_t first = first_;
+    size_t last = last_;
+    while (first < last && first < leftmost_.Load()) {
+      size_t remaining = last - first;
+      if (partitioner_.ShouldSplit(remaining)) {
+        // Hand the upper half over to a new task:
+        size_t middle = first + remaining / 2;
+        group.Spawn(embb::tasks::Action(
+          self_t(global_first_, middle, last, predicate_, policy_,
+                 partitioner_, leftmost_, any_match_),
+          policy_));
+        last = middle;
+      } else {
+        // Search the next grain:
+        size_t grain = partitioner_.GetGrainSize();
+        size_t grain_last = (remaining <= grain) ? last : first + grain;
+        RAI iter = global_first_ + static_cast<difference_type>(first);
+        for (; first != grain_last; ++first, ++iter) {
+          if (predicate_(*iter)) {
+            Found(first);
+            last = first;
+            break;
+          }
+        }
+      }
+    }
+    group.Sync();
+  }
+
+ private:
+  typedef FindFunctor<RAI, Predicate> self_t;
+
+  /**
+   * Lowers the shared index to \c index, unless a match further left has
+   * already been found.
+   */
+  void Found(size_t index) {
+    if (any_match_) {
+      index = 0;
+    }
+    size_t leftmost = leftmost_.Load();
+    while (index < leftmost && !leftmost_.CompareAndSwap(leftmost, index)) {
+    }
+  }
+
+  RAI global_first_;
+  size_t first_;
+  size_t last_;
+  Predicate predicate_;
+  const embb::tasks::ExecutionPolicy& policy_;
+  const AutoPartitioner& partitioner_;
+  embb::base::Atomic<size_t>& leftmost_;
+  bool any_match_;
+
+  /**
+   * Disables assignment.
+   */
+  FindFunctor& operator=(const FindFunctor&);
+};
+
+/**
+ * Returns the index of the leftmost element satisfying \c predicate, or the
+ * number of elements if there is none. If \c any_match is true, the index of
+ * any match is returned as 0.
+ */
+template<typename RAI, typename Predicate>
+size_t FindRecursive(RAI first, RAI last, Predicate predicate,
+                     const embb::tasks::ExecutionPolicy& policy,
+                     size_t block_size, bool any_match) {
+  typedef typename std::iterator_traits<RAI>::difference_type difference_type;
+  difference_type distance = std::distance(first, last);
+  if (distance == 0) {
+    return 0;
+  } else if (distance < 0) {
+    EMBB_THROW(embb::base::ErrorException, "Negative range for Find");
+  }
+  unsigned int num_cores = policy.GetCoreCount();
+  if (num_cores == 0) {
+    EMBB_THROW(embb::base::ErrorException, "No cores in execution policy");
+  }
+  size_t count = static_cast<size_t>(distance);
+  embb::base::Atomic<size_t> leftmost(count);
+  embb::tasks::Node& node = embb::tasks::Node::GetInstance();
+  AutoPartitioner partitioner(count, block_size, policy);
+  FindFunctor<RAI, Predicate> functor(first, 0, count, predicate, policy,
+                                      partitioner, leftmost, any_match);
+  embb::tasks::Task task = node.Spawn(embb::tasks::Action(functor, policy));
+  task.Wait(MTAPI_INFINITE);
+  return leftmost.Load();
+}
+
+template<typename RAI, typename Predicate>
+RAI FindIteratorCheck(RAI first, RAI last, Predicate predicate,
+                      const embb::tasks::ExecutionPolicy& policy,
+                      size_t block_size, std::random_access_iterator_tag) {
+  typedef typename std::iterator_traits<RAI>::difference_type difference_type;
+  return first + static_cast<difference_type>(
+    FindRecursive(first, last, predicate, policy, block_size, false));
+}
+
+template<typename RAI, typename Predicate>
+bool AnyOfIteratorCheck(RAI first, RAI last, Predicate predicate,
+                        const embb::tasks::ExecutionPolicy& policy,
+                        size_t block_size, std::random_access_iterator_tag) {
+  size_t count = static_cast<size_t>(std::distance(first, last));
+  return FindRecursive(first, last, predicate, policy, block_size, true) <
+    count;
+}
+
+template<typename ValueType>
+class FindValuePredicate {
+ public:
+  explicit FindValuePredicate(const ValueType& value)
+  : value_(value) {}
+
+  template<typename ElementType>
+  bool operator()(const ElementType& element) {
+    return element == value_;
+  }
+
+ private:
+  const ValueType& value_;
+
+  FindValuePredicate& operator=(const FindValuePredicate&);
+};
+
+template<typename Predicate>
+class FindNegatedPredicate {
+ public:
+  explicit FindNegatedPredicate(Predicate predicate)
+  : predicate_(predicate) {}
+
+  template<typename ElementType>
+  bool operator()(const ElementType& element) {
+    return !predicate_(element);
+  }
+
+ private:
+  Predicate predicate_;
+
+  FindNegatedPredicate& operator=(const FindNegatedPredicate&);
+};
+
+}  // namespace internal
+
+template<typename RAI, typename ValueType>
+RAI Find(RAI first, RAI last, const ValueType& value,
+         const embb::tasks::ExecutionPolicy& policy, size_t block_size) {
+  typename std::iterator_traits<RAI>::iterator_category category;
+  return internal::FindIteratorCheck(first, last,
+    internal::FindValuePredicate<ValueType>(value), policy, block_size,
+    category);
+}
+
+template<typename RAI, typename Predicate>
+RAI FindIf(RAI first, RAI last, Predicate predicate,
+           const embb::tasks::ExecutionPolicy& policy, size_t block_size) {
+  typename std::iterator_traits<RAI>::iterator_category category;
+  return internal::FindIteratorCheck(first, last, predicate, policy,
+                                     block_size, category);
+}
+
+template<typename RAI, typename Predicate>
+bool AnyOf(RAI first, RAI last, Predicate predicate,
+           const embb::tasks::ExecutionPolicy& policy, size_t block_size) {
+  typename std::iterator_traits<RAI>::iterator_category category;
+  return internal::AnyOfIteratorCheck(first, last, predicate, policy,
+                                      block_size, category);
+}
+
+template<typename RAI, typename Predicate>
+bool AllOf(RAI first, RAI last, Predicate predicate,
+           const embb::tasks::ExecutionPolicy& policy, size_t block_size) {
+  typename std::iterator_traits<RAI>::iterator_category category;
+  return !internal::AnyOfIteratorCheck(first, last,
+    internal::FindNegatedPredicate<Predicate>(predicate), policy, block_size,
+    category);
+}
+
+template<typename RAI, typename Predicate>
+bool NoneOf(RAI first, RAI last, Predicate predicate,
+            const embb::tasks::ExecutionPolicy& policy, size_t block_size) {
+  typename std::iterator_traits<RAI>::iterator_category category;
+  return !internal::AnyOfIteratorCheck(first, last, predicate, policy,
+                                       block_size, category);
+}
+
+}  // namespace algorithms
+}  // namespace embb
+
+#endif  // EMBB_ALGORITHMS_INTERNAL_FIND_INL_H_
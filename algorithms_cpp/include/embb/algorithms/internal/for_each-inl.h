@@ -45,54 +45,49 @@ class ForEachFunctor {
   /**
    * Constructs a for-each functor with arguments.
    */
-  ForEachFunctor(size_t chunk_first, size_t chunk_last, Function unary,
+  ForEachFunctor(RAI first, RAI last, Function unary,
                  const embb::tasks::ExecutionPolicy& policy,
-                 const BlockSizePartitioner<RAI>& partitioner)
-  : chunk_first_(chunk_first), chunk_last_(chunk_last),
+                 const AutoPartitioner& partitioner)
+  : first_(first), last_(last),
     unary_(unary), policy_(policy), partitioner_(partitioner) {
   }
 
-  void Action(embb::tasks::TaskContext&) {
-    if (chunk_first_ == chunk_last_) {
-      // Leaf case, recursed to single chunk. Do work on chunk:
-      ChunkDescriptor<RAI> chunk = partitioner_[chunk_first_];
-      RAI first = chunk.GetFirst();
-      RAI last  = chunk.GetLast();
-      for (RAI it = first; it != last; ++it) {
-        unary_(*it);
+  void operator()(embb::tasks::TaskContext&) {
+    typedef typename std::iterator_traits<RAI>::difference_type
+      difference_type;
+    embb::tasks::TaskGroup group;
+    RAI first = first_;
+    RAI last = last_;
+    while (first != last) {
+      size_t remaining = static_cast<size_t>(std::distance(first, last));
+      if (partitioner_.ShouldSplit(remaining)) {
+        // Hand the upper half over to a new task:
+        RAI middle = first + static_cast<difference_type>(remaining / 2);
+        group.Spawn(embb::tasks::Action(
+          self_t(middle, last, unary_, policy_, partitioner_), policy_));
+        last = middle;
+      } else {
+        // Do work on the next grain:
+        size_t grain = partitioner_.GetGrainSize();
+        RAI grain_last = (remaining <= grain) ?
+          last : first + static_cast<difference_type>(grain);
+        for (; first != grain_last; ++first) {
+          unary_(*first);
+        }
       }
-    } else {
-      // Recurse further:
-      size_t chunk_split_index = (chunk_first_ + chunk_last_) / 2;
-      // Split chunks into left / right branches:
-      self_t functor_l(chunk_first_,
-                       chunk_split_index,
-                       unary_, policy_, partitioner_);
-      self_t functor_r(chunk_split_index + 1,
-                       chunk_last_,
-                       unary_, policy_, partitioner_);
-      embb::tasks::Task task_l = embb::tasks::Node::GetInstance().Spawn(
-        embb::tasks::Action(
-          base::MakeFunction(functor_l, &self_t::Action),
-          policy_));
-      embb::tasks::Task task_r = embb::tasks::Node::GetInstance().Spawn(
-        embb::tasks::Action(
-          base::MakeFunction(functor_r, &self_t::Action),
-          policy_));
-      task_l.Wait(MTAPI_INFINITE);
-      task_r.Wait(MTAPI_INFINITE);
     }
+    group.Sync();
   }
 
  private:
   typedef ForEachFunctor<RAI, Function> self_t;
 
  private:
-  size_t chunk_first_;
-  size_t chunk_last_;
+  RAI first_;
+  RAI last_;
   Function unary_;
   const embb::tasks::ExecutionPolicy& policy_;
-  const BlockSizePartitioner<RAI>& partitioner_;
+  const AutoPartitioner& partitioner_;
 
   /**
    * Disables assignment.
@@ -115,27 +110,11 @@ void ForEachRecursive(RAI first, RAI last, Function unary,
     EMBB_THROW(embb::base::ErrorException, "No cores in execution policy");
   }
   embb::tasks::Node& node = embb::tasks::Node::GetInstance();
-  // Determine actually used block size
-  if (block_size == 0) {
-    block_size = (static_cast<size_t>(distance) / num_cores);
-    if (block_size == 0) {
-      block_size = 1;
-    }
-  }
-  // Check task number sufficiency
-  if (((distance / block_size) * 2) + 1 > MTAPI_NODE_MAX_TASKS_DEFAULT) {
-    EMBB_THROW(embb::base::ErrorException,
-               "Not enough MTAPI tasks available for parallel foreach");
-  }
-
-  BlockSizePartitioner<RAI> partitioner(first, last, block_size);
-  ForEachFunctor<RAI, Function> functor(0,
-                                        partitioner.Size() - 1,
-                                        unary, policy, partitioner);
-  embb::tasks::Task task = node.Spawn(embb::tasks::Action(
-                     base::MakeFunction(functor,
-                       &ForEachFunctor<RAI, Function>::Action),
-                     policy));
+  AutoPartitioner partitioner(static_cast<size_t>(distance), block_size,
+                              policy);
+  ForEachFunctor<RAI, Function> functor(first, last, unary, policy,
+                                        partitioner);
+  embb::tasks::Task task = node.Spawn(embb::tasks::Action(functor, policy));
   task.Wait(MTAPI_INFINITE);
 }
 
@@ -146,6 +125,94 @@ void ForEachIteratorCheck(RAI first, RAI last, Function unary,
   return ForEachRecursive(first, last, unary, policy, block_size);
 }
 
+/**
+ * Default maximum number of index tuples of a tile of a blocked range.
+ */
+const size_t kForEachTileSize = 4096;
+
+template<typename Range, typename Function>
+class ForEachBlockedFunctor {
+ public:
+  ForEachBlockedFunctor(const Range& range, Function function,
+                        const embb::tasks::ExecutionPolicy& policy,
+                        size_t tile_size, const AutoPartitioner& partitioner)
+  : range_(range), function_(function), policy_(policy),
+    tile_size_(tile_size), partitioner_(partitioner) {
+  }
+
+  void operator()(embb::tasks::TaskContext&) {
+    embb::tasks::TaskGroup group;
+    Process(range_, group);
+    group.Sync();
+  }
+
+ private:
+  typedef ForEachBlockedFunctor<Range, Function> self_t;
+
+  /**
+   * Splits the range into tiles and applies the function to them. Halves are
+   * handed over to new tasks as long as the partitioner asks for it, the
+   * rest is processed depth-first, such that consecutive tiles are adjacent.
+   */
+  void Process(Range range, embb::tasks::TaskGroup& group) {
+    while (range.GetSize() > tile_size_) {
+      size_t size = range.GetSize();
+      Range upper(range);
+      range.Split(upper);
+      if (partitioner_.ShouldSplit(size)) {
+        // Hand the upper half over to a new task:
+        group.Spawn(embb::tasks::Action(
+          self_t(upper, function_, policy_, tile_size_, partitioner_),
+          policy_));
+      } else {
+        Process(range, group);
+        range = upper;
+      }
+    }
+    const Range& tile = range;
+    function_(tile);
+  }
+
+  Range range_;
+  Function function_;
+  const embb::tasks::ExecutionPolicy& policy_;
+  size_t tile_size_;
+  const AutoPartitioner& partitioner_;
+
+  /**
+   * Disables assignment.
+   */
+  ForEachBlockedFunctor& operator=(const ForEachBlockedFunctor&);
+};
+
+template<typename Range, typename Function>
+void ForEachBlocked(const Range& range, Function function,
+  const embb::tasks::ExecutionPolicy& policy, size_t tile_size) {
+  for (size_t dimension = 0; dimension < Range::kDimensions; dimension++) {
+    if (range.GetLast(dimension) < range.GetFirst(dimension)) {
+      EMBB_THROW(embb::base::ErrorException, "Negative range for ForEach");
+    }
+  }
+  unsigned int num_cores = policy.GetCoreCount();
+  if (num_cores == 0) {
+    EMBB_THROW(embb::base::ErrorException, "No cores in execution policy");
+  }
+  size_t size = range.GetSize();
+  if (size == 0) {
+    return;
+  }
+  if (tile_size == 0) {
+    tile_size = kForEachTileSize;
+  }
+  embb::tasks::Node& node = embb::tasks::Node::GetInstance();
+  // Ranges of tile size are never split
+  AutoPartitioner partitioner(size, tile_size, policy);
+  ForEachBlockedFunctor<Range, Function> functor(range, function, policy,
+                                                 tile_size, partitioner);
+  embb::tasks::Task task = node.Spawn(embb::tasks::Action(functor, policy));
+  task.Wait(MTAPI_INFINITE);
+}
+
 }  // namespace internal
 
 template<typename RAI, typename Function>
@@ -156,6 +223,18 @@ void ForEach(RAI first, const RAI last, Function unary,
                                  category);
 }
 
+template<typename Function>
+void ForEach(const BlockedRange2D& range, Function function,
+  const embb::tasks::ExecutionPolicy& policy, size_t tile_size) {
+  internal::ForEachBlocked(range, function, policy, tile_size);
+}
+
+template<typename Function>
+void ForEach(const BlockedRange3D& range, Function function,
+  const embb::tasks::ExecutionPolicy& policy, size_t tile_size) {
+  internal::ForEachBlocked(range, function, policy, tile_size);
+}
+
 }  // namespace algorithms
 }  // namespace embb
 
@@ -0,0 +1,468 @@
+/*
+ * Copyright (c) 2014-2015, Siemens AG. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef EMBB_ALGORITHMS_INTERNAL_HISTOGRAM_INL_H_
+#define EMBB_ALGORITHMS_INTERNAL_HISTOGRAM_INL_H_
+
+#include <cstring>
+#include <iterator>
+#include <vector>
+
+#include <embb/base/exceptions.h>
+#include <embb/base/memory_allocation.h>
+#include <embb/tasks/tasks.h>
+#include <embb/algorithms/internal/partition.h>
+#include <embb/algorithms/internal/thread_private.h>
+#include <embb/algorithms/transform.h>
+
+namespace embb {
+namespace algorithms {
+namespace internal {
+
+/**
+ * Histograms with at most this many bins are counted into private arrays.
+ * Larger histograms are counted into private hash tables, since arrays for
+ * every thread would not fit into the caches and merging them would cost
+ * more than counting.
+ */
+const size_t kHistogramDenseBins = 64 * 1024;
+
+/**
+ * Private bins of a thread stored in a cache-aligned array.
+ */
+class HistogramDenseCounts {
+ public:
+  explicit HistogramDenseCounts(size_t bin_count)
+  : counts_(static_cast<size_t*>(
+      embb::base::Allocation::AllocateCacheAligned(
+        bin_count * sizeof(size_t)))) {
+    memset(counts_, 0, bin_count * sizeof(size_t));
+  }
+
+  ~HistogramDenseCounts() {
+    embb::base::Allocation::FreeAligned(counts_);
+  }
+
+  void Add(size_t bin) {
+    ++counts_[bin];
+  }
+
+  const size_t* GetCounts() const {
+    return counts_;
+  }
+
+ private:
+  size_t* counts_;
+
+  /**
+   * Disables copying and assignment.
+   */
+  HistogramDenseCounts(const HistogramDenseCounts&);
+  HistogramDenseCounts& operator=(const HistogramDenseCounts&);
+};
+
+/**
+ * Private bins of a thread stored in a hash table with open addressing, which
+ * contains only the bins counted by the thread. The table is at most half
+ * full, such that the probe sequences stay short.
+ */
+class HistogramSparseCounts {
+ public:
+  struct Entry {
+    size_t bin;
+    size_t count;
+  };
+
+  static const size_t kEmpty = static_cast<size_t>(-1);
+
+  explicit HistogramSparseCounts(size_t)
+  : capacity_(0), capacity_bits_(0), size_(0), entries_(NULL) {
+    Allocate(6);
+  }
+
+  ~HistogramSparseCounts() {
+    embb::base::Allocation::Free(entries_);
+  }
+
+  void Add(size_t bin) {
+    Entry* entry = Find(bin);
+    if (entry->bin == kEmpty) {
+      if ((size_ + 1) * 2 > capacity_) {
+        Grow();
+        entry = Find(bin);
+      }
+      entry->bin = bin;
+      ++size_;
+    }
+    ++entry->count;
+  }
+
+  size_t GetCapacity() const {
+    return capacity_;
+  }
+
+  /**
+   * Returns the entries of the table, including empty ones.
+   */
+  const Entry* GetEntries() const {
+    return entries_;
+  }
+
+ private:
+  Entry* Find(size_t bin) {
+    const size_t mask = capacity_ - 1;
+    // Fibonacci hashing spreads consecutive bins over the table. The high
+    // bits of the 32-bit product are the well-mixed ones, so the slot is
+    // taken from them. Tables with more than 2^32 slots probe the rest.
+    unsigned int hash = static_cast<unsigned int>(bin) * 2654435769u;
+    size_t slot = ((capacity_bits_ < 32) ?
+      static_cast<size_t>(hash >> (32 - capacity_bits_)) :
+      static_cast<size_t>(hash)) & mask;
+    while (entries_[slot].bin != bin && entries_[slot].bin != kEmpty) {
+      slot = (slot + 1) & mask;
+    }
+    return &entries_[slot];
+  }
+
+  /**
+   * Allocates an empty table with 2^capacity_bits slots.
+   */
+  void Allocate(unsigned int capacity_bits) {
+    const size_t capacity = static_cast<size_t>(1) << capacity_bits;
+    entries_ = static_cast<Entry*>(
+      embb::base::Allocation::Allocate(capacity * sizeof(Entry)));
+    capacity_ = capacity;
+    capacity_bits_ = capacity_bits;
+    for (size_t i = 0; i < capacity; i++) {
+      entries_[i].bin = kEmpty;
+      entries_[i].count = 0;
+    }
+  }
+
+  void Grow() {
+    Entry* entries = entries_;
+    size_t capacity = capacity_;
+    Allocate(capacity_bits_ + 1);
+    for (size_t i = 0; i < capacity; i++) {
+      if (entries[i].bin != kEmpty) {
+        *Find(entries[i].bin) = entries[i];
+      }
+    }
+    embb::base::Allocation::Free(entries);
+  }
+
+  size_t capacity_;
+  unsigned int capacity_bits_;
+  size_t size_;
+  Entry* entries_;
+
+  /**
+   * Disables copying and assignment.
+   */
+  HistogramSparseCounts(const HistogramSparseCounts&);
+  HistogramSparseCounts& operator=(const HistogramSparseCounts&);
+};
+
+template<typename RAI, typename BinFunction, typename Counts>
+class HistogramFunctor {
+ public:
+  HistogramFunctor(RAI first, RAI last, BinFunction bin_function,
+                   size_t bin_count,
+                   ThreadPrivate<Counts>& private_counts,
+                   const embb::tasks::ExecutionPolicy& policy,
+                   const AutoPartitioner& partitioner)
+  : first_(first), last_(last), bin_function_(bin_function),
+    bin_count_(bin_count), private_counts_(private_counts), policy_(policy),
+    partitioner_(partitioner) {
+  }
+
+  void operator()(embb::tasks::TaskContext&) {
+    typedef typename std::iterator_traits<RAI>::difference_type
+      difference_type;
+    embb::tasks::TaskGroup group;
+    RAI first = first_;
+    RAI last = last_;
+    while (first != last) {
+      size_t remaining = static_cast<size_t>(std::distance(first, last));
+      if (partitioner_.ShouldSplit(remaining)) {
+        // Hand the upper half over to a new task:
+        RAI middle = first + static_cast<difference_type>(remaining / 2);
+        group.Spawn(embb::tasks::Action(
+          self_t(middle, last, bin_function_, bin_count_, private_counts_,
+                 policy_, partitioner_),
+          policy_));
+        last = middle;
+      } else {
+        // Count the next grain into the private bins of the current thread:
+        size_t grain = partitioner_.GetGrainSize();
+        RAI grain_last = (remaining <= grain) ?
+          last : first + static_cast<difference_type>(grain);
+        Counts& counts = private_counts_.Get();
+        for (; first != grain_last; ++first) {
+          size_t bin = static_cast<size_t>(bin_function_(*first));
+          if (bin < bin_count_) {
+            counts.Add(bin);
+          }
+        }
+      }
+    }
+    group.Sync();
+  }
+
+ private:
+  typedef HistogramFunctor<RAI, BinFunction, Counts> self_t;
+
+  RAI first_;
+  RAI last_;
+  BinFunction bin_function_;
+  size_t bin_count_;
+  ThreadPrivate<Counts>& private_counts_;
+  const embb::tasks::ExecutionPolicy& policy_;
+  const AutoPartitioner& partitioner_;
+
+  /**
+   * Disables assignment.
+   */
+  HistogramFunctor& operator=(const HistogramFunctor&);
+};
+
+/**
+ * Sums up the private arrays of the threads for a range of bins.
+ */
+template<typename RAIBins>
+class HistogramMergeKernel {
+ public:
+  HistogramMergeKernel(RAIBins bins,
+                       const HistogramDenseCounts* const* counts,
+                       size_t count_arrays)
+  : bins_(bins), counts_(counts), count_arrays_(count_arrays) {
+  }
+
+  void operator()(size_t first, size_t last) {
+    typedef typename std::iterator_traits<RAIBins>::value_type value_type;
+    RAIBins bins = bins_ +
+      static_cast<typename std::iterator_traits<RAIBins>::difference_type>(
+        first);
+    for (; first != last; ++first, ++bins) {
+      size_t sum = 0;
+      for (size_t i = 0; i < count_arrays_; i++) {
+        sum += counts_[i]->GetCounts()[first];
+      }
+      *bins = static_cast<value_type>(sum);
+    }
+  }
+
+ private:
+  RAIBins bins_;
+  const HistogramDenseCounts* const* counts_;
+  size_t count_arrays_;
+};
+
+/**
+ * Sorts the entries of a range of private hash tables into buckets of
+ * consecutive bins, such that the buckets can be merged independently.
+ */
+class HistogramScatterKernel {
+ public:
+  typedef std::vector<HistogramSparseCounts::Entry> Bucket;
+
+  HistogramScatterKernel(const HistogramSparseCounts* const* counts,
+                         Bucket* buckets, size_t bucket_count,
+                         size_t bucket_bins)
+  : counts_(counts), buckets_(buckets), bucket_count_(bucket_count),
+    bucket_bins_(bucket_bins) {
+  }
+
+  void operator()(size_t first, size_t last) {
+    for (; first != last; ++first) {
+      const HistogramSparseCounts::Entry* entries =
+        counts_[first]->GetEntries();
+      Bucket* buckets = buckets_ + first * bucket_count_;
+      for (size_t i = 0; i < counts_[first]->GetCapacity(); i++) {
+        if (entries[i].bin != HistogramSparseCounts::kEmpty) {
+          buckets[entries[i].bin / bucket_bins_].push_back(entries[i]);
+        }
+      }
+    }
+  }
+
+ private:
+  const HistogramSparseCounts* const* counts_;
+  Bucket* buckets_;
+  size_t bucket_count_;
+  size_t bucket_bins_;
+};
+
+/**
+ * Adds the buckets of all threads for a range of buckets to the bins. The
+ * bins of different buckets are disjoint, such that no synchronization is
+ * needed.
+ */
+template<typename RAIBins>
+class HistogramGatherKernel {
+ public:
+  typedef HistogramScatterKernel::Bucket Bucket;
+
+  HistogramGatherKernel(RAIBins bins, const Bucket* buckets,
+                        size_t bucket_count, size_t count_tables)
+  : bins_(bins), buckets_(buckets), bucket_count_(bucket_count),
+    count_tables_(count_tables) {
+  }
+
+  void operator()(size_t first, size_t last) {
+    typedef typename std::iterator_traits<RAIBins>::value_type value_type;
+    typedef typename std::iterator_traits<RAIBins>::difference_type
+      difference_type;
+    for (; first != last; ++first) {
+      for (size_t i = 0; i < count_tables_; i++) {
+        const Bucket& bucket = buckets_[i * bucket_count_ + first];
+        for (size_t j = 0; j < bucket.size(); j++) {
+          bins_[static_cast<difference_type>(bucket[j].bin)] +=
+            static_cast<value_type>(bucket[j].count);
+        }
+      }
+    }
+  }
+
+ private:
+  RAIBins bins_;
+  const Bucket* buckets_;
+  size_t bucket_count_;
+  size_t count_tables_;
+};
+
+template<typename RAI, typename Counts, typename BinFunction>
+void HistogramCount(RAI first, RAI last, BinFunction bin_function,
+                    size_t bin_count, ThreadPrivate<Counts>& counts,
+                    const embb::tasks::ExecutionPolicy& policy,
+                    size_t block_size) {
+  embb::tasks::Node& node = embb::tasks::Node::GetInstance();
+  AutoPartitioner partitioner(static_cast<size_t>(std::distance(first, last)),
+                              block_size, policy);
+  HistogramFunctor<RAI, BinFunction, Counts> functor(first, last,
+    bin_function, bin_count, counts, policy, partitioner);
+  embb::tasks::Task task = node.Spawn(embb::tasks::Action(functor, policy));
+  task.Wait(MTAPI_INFINITE);
+}
+
+template<typename RAI, typename RAIBins, typename BinFunction>
+void HistogramDense(RAI first, RAI last, RAIBins bins, size_t bin_count,
+                    BinFunction bin_function,
+                    const embb::tasks::ExecutionPolicy& policy,
+                    size_t block_size) {
+  ThreadPrivate<HistogramDenseCounts> private_counts(bin_count);
+  HistogramCount(first, last, bin_function, bin_count, private_counts, policy,
+                 block_size);
+  std::vector<const HistogramDenseCounts*> counts;
+  private_counts.GetAll(counts);
+  TransformRecursive(bin_count,
+    HistogramMergeKernel<RAIBins>(bins, &counts[0], counts.size()),
+    bins, policy, 0);
+}
+
+template<typename RAI, typename RAIBins, typename BinFunction>
+void HistogramSparse(RAI first, RAI last, RAIBins bins, size_t bin_count,
+                     BinFunction bin_function,
+                     const embb::tasks::ExecutionPolicy& policy,
+                     size_t block_size) {
+  typedef typename std::iterator_traits<RAIBins>::value_type value_type;
+  typedef typename std::iterator_traits<RAIBins>::difference_type
+    difference_type;
+  ThreadPrivate<HistogramSparseCounts> private_counts(bin_count);
+  HistogramCount(first, last, bin_function, bin_count, private_counts, policy,
+                 block_size);
+  Fill(bins, bins + static_cast<difference_type>(bin_count), value_type(0),
+       policy, 0);
+  // Different tables may contain the same bin, so the tables are merged in
+  // two parallel steps: each table is scattered into buckets of consecutive
+  // bins, then the buckets of all tables are gathered bucket by bucket.
+  std::vector<const HistogramSparseCounts*> counts;
+  private_counts.GetAll(counts);
+  size_t bucket_count = static_cast<size_t>(policy.GetCoreCount()) * 4;
+  if (bucket_count > bin_count) {
+    bucket_count = bin_count;
+  }
+  size_t bucket_bins = (bin_count + bucket_count - 1) / bucket_count;
+  std::vector<HistogramScatterKernel::Bucket> buckets(
+    counts.size() * bucket_count);
+  TransformRecursive(counts.size(),
+    HistogramScatterKernel(&counts[0], &buckets[0], bucket_count,
+                           bucket_bins),
+    buckets.begin(), policy, 0);
+  TransformRecursive(bucket_count,
+    HistogramGatherKernel<RAIBins>(bins, &buckets[0], bucket_count,
+                                   counts.size()),
+    bins, policy, 0);
+}
+
+template<typename RAI, typename RAIBins, typename BinFunction>
+void HistogramIteratorCheck(RAI first, RAI last, RAIBins bins,
+                            size_t bin_count, BinFunction bin_function,
+                            const embb::tasks::ExecutionPolicy& policy,
+                            size_t block_size,
+                            std::random_access_iterator_tag) {
+  typedef typename std::iterator_traits<RAIBins>::value_type value_type;
+  typedef typename std::iterator_traits<RAIBins>::difference_type
+    difference_type;
+  typedef typename std::iterator_traits<RAI>::difference_type distance_type;
+  distance_type distance = std::distance(first, last);
+  if (distance < 0) {
+    EMBB_THROW(embb::base::ErrorException, "Negative range for Histogram");
+  }
+  if (policy.GetCoreCount() == 0) {
+    EMBB_THROW(embb::base::ErrorException, "No cores in execution policy");
+  }
+  if (bin_count == 0) {
+    return;
+  } else if (distance == 0) {
+    Fill(bins, bins + static_cast<difference_type>(bin_count), value_type(0),
+         policy, 0);
+  } else if (bin_count <= kHistogramDenseBins) {
+    HistogramDense(first, last, bins, bin_count, bin_function, policy,
+                   block_size);
+  } else {
+    HistogramSparse(first, last, bins, bin_count, bin_function, policy,
+                    block_size);
+  }
+}
+
+}  // namespace internal
+
+template<typename RAI, typename RAIBins, typename BinFunction>
+void Histogram(RAI first, RAI last, RAIBins bins, size_t bin_count,
+               BinFunction bin_function,
+               const embb::tasks::ExecutionPolicy& policy,
+               size_t block_size) {
+  typename std::iterator_traits<RAI>::iterator_category category;
+  internal::HistogramIteratorCheck(first, last, bins, bin_count, bin_function,
+                                   policy, block_size, category);
+}
+
+}  // namespace algorithms
+}  // namespace embb
+
+#endif  // EMBB_ALGORITHMS_INTERNAL_HISTOGRAM_INL_H_
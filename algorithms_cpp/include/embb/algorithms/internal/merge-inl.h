@@ -0,0 +1,443 @@
+/*
+ * Copyright (c) 2014-2015, Siemens AG. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef EMBB_ALGORITHMS_INTERNAL_MERGE_INL_H_
+#define EMBB_ALGORITHMS_INTERNAL_MERGE_INL_H_
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include <embb/base/exceptions.h>
+#include <embb/tasks/tasks.h>
+#include <embb/algorithms/merge_sort.h>
+
+namespace embb {
+namespace algorithms {
+namespace internal {
+
+/**
+ * Output iterator that only counts the elements written to it. Copies of the
+ * iterator share the counter, as the standard algorithms pass output
+ * iterators by value.
+ */
+class SetOperationCounter {
+ public:
+  typedef std::output_iterator_tag iterator_category;
+  typedef void value_type;
+  typedef void difference_type;
+  typedef void pointer;
+  typedef void reference;
+
+  explicit SetOperationCounter(size_t* count)
+  : count_(count) {
+  }
+
+  SetOperationCounter& operator*() {
+    return *this;
+  }
+
+  template<typename T>
+  SetOperationCounter& operator=(const T&) {
+    ++*count_;
+    return *this;
+  }
+
+  SetOperationCounter& operator++() {
+    return *this;
+  }
+
+  SetOperationCounter operator++(int) {
+    return *this;
+  }
+
+ private:
+  size_t* count_;
+};
+
+struct SetUnionOperation {
+  template<typename RAIIn1, typename RAIIn2, typename Output,
+           typename ComparisonFunction>
+  static Output Apply(RAIIn1 first1, RAIIn1 last1, RAIIn2 first2,
+                      RAIIn2 last2, Output output,
+                      ComparisonFunction comparison) {
+    return std::set_union(first1, last1, first2, last2, output, comparison);
+  }
+};
+
+struct SetIntersectionOperation {
+  template<typename RAIIn1, typename RAIIn2, typename Output,
+           typename ComparisonFunction>
+  static Output Apply(RAIIn1 first1, RAIIn1 last1, RAIIn2 first2,
+                      RAIIn2 last2, Output output,
+                      ComparisonFunction comparison) {
+    return std::set_intersection(first1, last1, first2, last2, output,
+                                 comparison);
+  }
+};
+
+struct SetDifferenceOperation {
+  template<typename RAIIn1, typename RAIIn2, typename Output,
+           typename ComparisonFunction>
+  static Output Apply(RAIIn1 first1, RAIIn1 last1, RAIIn2 first2,
+                      RAIIn2 last2, Output output,
+                      ComparisonFunction comparison) {
+    return std::set_difference(first1, last1, first2, last2, output,
+                               comparison);
+  }
+};
+
+/**
+ * Splits two sorted ranges such that the lower parts contain about
+ * \c diagonal elements and all elements equivalent to each other end up on
+ * the same side of the split in both ranges.
+ *
+ * The element at position \c diagonal of the stably merged ranges is found by
+ * binary search over the number of elements taken from the first range. Both
+ * ranges are then split before their first element equivalent to it.
+ */
+template<typename RAIIn1, typename RAIIn2, typename ComparisonFunction>
+void SetOperationSplit(RAIIn1 first1, size_t count1, RAIIn2 first2,
+                       size_t count2, size_t diagonal,
+                       ComparisonFunction comparison,
+                       size_t& split1, size_t& split2) {
+  typedef typename std::iterator_traits<RAIIn1>::difference_type
+    difference_type1;
+  typedef typename std::iterator_traits<RAIIn2>::difference_type
+    difference_type2;
+  // Find the number of elements of the first range among the first
+  // diagonal elements of the merge, taking the first range on ties.
+  size_t low = (diagonal > count2) ? diagonal - count2 : 0;
+  size_t high = (diagonal < count1) ? diagonal : count1;
+  while (low < high) {
+    size_t index1 = low + (high - low) / 2;
+    size_t index2 = diagonal - index1;
+    if (comparison(first2[static_cast<difference_type2>(index2 - 1)],
+                   first1[static_cast<difference_type1>(index1)])) {
+      high = index1;
+    } else {
+      low = index1 + 1;
+    }
+  }
+  size_t index1 = low;
+  size_t index2 = diagonal - low;
+  RAIIn1 last1 = first1 + static_cast<difference_type1>(count1);
+  RAIIn2 last2 = first2 + static_cast<difference_type2>(count2);
+  if (index1 < count1 &&
+      (index2 == count2 ||
+       !comparison(first2[static_cast<difference_type2>(index2)],
+                   first1[static_cast<difference_type1>(index1)]))) {
+    const RAIIn1 split = first1 + static_cast<difference_type1>(index1);
+    split1 = static_cast<size_t>(
+      std::lower_bound(first1, last1, *split, comparison) - first1);
+    split2 = static_cast<size_t>(
+      std::lower_bound(first2, last2, *split, comparison) - first2);
+  } else if (index2 < count2) {
+    const RAIIn2 split = first2 + static_cast<difference_type2>(index2);
+    split1 = static_cast<size_t>(
+      std::lower_bound(first1, last1, *split, comparison) - first1);
+    split2 = static_cast<size_t>(
+      std::lower_bound(first2, last2, *split, comparison) - first2);
+  } else {
+    split1 = count1;
+    split2 = count2;
+  }
+}
+
+/**
+ * Applies a set operation to one part of the split ranges. If \c count is
+ * not \c NULL, the elements of the result are only counted and stored there,
+ * otherwise they are written to \c output.
+ */
+template<typename Operation, typename RAIIn1, typename RAIIn2,
+         typename RAIOut, typename ComparisonFunction>
+class SetOperationPartFunctor {
+ public:
+  SetOperationPartFunctor(RAIIn1 first1, RAIIn1 last1, RAIIn2 first2,
+                          RAIIn2 last2, RAIOut output, size_t* count,
+                          ComparisonFunction comparison)
+  : first1_(first1), last1_(last1), first2_(first2), last2_(last2),
+    output_(output), count_(count), comparison_(comparison) {
+  }
+
+  void operator()(embb::tasks::TaskContext&) {
+    if (count_ != NULL) {
+      *count_ = 0;
+      Operation::Apply(first1_, last1_, first2_, last2_,
+                       SetOperationCounter(count_), comparison_);
+    } else {
+      Operation::Apply(first1_, last1_, first2_, last2_, output_,
+                       comparison_);
+    }
+  }
+
+ private:
+  RAIIn1 first1_;
+  RAIIn1 last1_;
+  RAIIn2 first2_;
+  RAIIn2 last2_;
+  RAIOut output_;
+  size_t* count_;
+  ComparisonFunction comparison_;
+
+  /**
+   * Disables assignment.
+   */
+  SetOperationPartFunctor& operator=(const SetOperationPartFunctor&);
+};
+
+/**
+ * Splits the ranges into parts, counts the size of the result of each part,
+ * and writes the results of the parts at their offsets.
+ */
+template<typename Operation, typename RAIIn1, typename RAIIn2,
+         typename RAIOut, typename ComparisonFunction>
+class SetOperationFunctor {
+ public:
+  SetOperationFunctor(RAIIn1 first1, size_t count1, RAIIn2 first2,
+                      size_t count2, RAIOut output,
+                      ComparisonFunction comparison,
+                      const embb::tasks::ExecutionPolicy& policy,
+                      size_t parts)
+  : first1_(first1), count1_(count1), first2_(first2), count2_(count2),
+    output_(output), comparison_(comparison), policy_(policy), parts_(parts),
+    written_(0) {
+  }
+
+  void Action(embb::tasks::TaskContext&) {
+    std::vector<size_t> splits1(parts_ + 1);
+    std::vector<size_t> splits2(parts_ + 1);
+    const size_t total = count1_ + count2_;
+    for (size_t i = 1; i < parts_; i++) {
+      SetOperationSplit(first1_, count1_, first2_, count2_,
+                        total * i / parts_, comparison_,
+                        splits1[i], splits2[i]);
+    }
+    splits1[parts_] = count1_;
+    splits2[parts_] = count2_;
+
+    std::vector<size_t> counts(parts_);
+    embb::tasks::TaskGroup group;
+    for (size_t i = 0; i < parts_; i++) {
+      group.Spawn(embb::tasks::Action(
+        Part(i, splits1, splits2, output_, &counts[i]), policy_));
+    }
+    group.Sync();
+
+    RAIOut output = output_;
+    for (size_t i = 0; i < parts_; i++) {
+      if (counts[i] > 0) {
+        group.Spawn(embb::tasks::Action(
+          Part(i, splits1, splits2, output, NULL), policy_));
+        output += static_cast<difference_type_out>(counts[i]);
+      }
+      written_ += counts[i];
+    }
+    group.Sync();
+  }
+
+  /**
+   * Returns the number of elements written to the output range.
+   */
+  size_t GetWritten() const {
+    return written_;
+  }
+
+ private:
+  typedef SetOperationPartFunctor<Operation, RAIIn1, RAIIn2, RAIOut,
+    ComparisonFunction> part_t;
+  typedef typename std::iterator_traits<RAIIn1>::difference_type
+    difference_type1;
+  typedef typename std::iterator_traits<RAIIn2>::difference_type
+    difference_type2;
+  typedef typename std::iterator_traits<RAIOut>::difference_type
+    difference_type_out;
+
+  part_t Part(size_t index, const std::vector<size_t>& splits1,
+              const std::vector<size_t>& splits2, RAIOut output,
+              size_t* count) const {
+    return part_t(
+      first1_ + static_cast<difference_type1>(splits1[index]),
+      first1_ + static_cast<difference_type1>(splits1[index + 1]),
+      first2_ + static_cast<difference_type2>(splits2[index]),
+      first2_ + static_cast<difference_type2>(splits2[index + 1]),
+      output, count, comparison_);
+  }
+
+  RAIIn1 first1_;
+  size_t count1_;
+  RAIIn2 first2_;
+  size_t count2_;
+  RAIOut output_;
+  ComparisonFunction comparison_;
+  const embb::tasks::ExecutionPolicy& policy_;
+  size_t parts_;
+  size_t written_;
+
+  /**
+   * Disables assignment and copying.
+   */
+  SetOperationFunctor& operator=(const SetOperationFunctor&);
+  SetOperationFunctor(const SetOperationFunctor&);
+};
+
+/**
+ * Checks the input ranges and the policy, and stores the numbers of elements
+ * of the ranges in \c count1 and \c count2.
+ */
+template<typename RAIIn1, typename RAIIn2>
+void MergeCheck(RAIIn1 first1, RAIIn1 last1, RAIIn2 first2, RAIIn2 last2,
+                const embb::tasks::ExecutionPolicy& policy,
+                const char* message, size_t& count1, size_t& count2) {
+  typename std::iterator_traits<RAIIn1>::difference_type distance1 =
+    std::distance(first1, last1);
+  typename std::iterator_traits<RAIIn2>::difference_type distance2 =
+    std::distance(first2, last2);
+  if (distance1 < 0 || distance2 < 0) {
+    EMBB_THROW(embb::base::ErrorException, message);
+  }
+  if (policy.GetCoreCount() == 0) {
+    EMBB_THROW(embb::base::ErrorException, "No cores in execution policy");
+  }
+  count1 = static_cast<size_t>(distance1);
+  count2 = static_cast<size_t>(distance2);
+}
+
+template<typename RAIIn1, typename RAIIn2, typename RAIOut,
+         typename ComparisonFunction>
+RAIOut MergeIteratorCheck(RAIIn1 first1, RAIIn1 last1, RAIIn2 first2,
+  RAIIn2 last2, RAIOut output, ComparisonFunction comparison,
+  const embb::tasks::ExecutionPolicy& policy, size_t block_size,
+  std::random_access_iterator_tag) {
+  size_t count1;
+  size_t count2;
+  MergeCheck(first1, last1, first2, last2, policy, "Negative range for Merge",
+             count1, count2);
+  const size_t total = count1 + count2;
+  if (total == 0) {
+    return output;
+  }
+  // Merges are split until a few parts per core remain
+  size_t grain = total / (policy.GetCoreCount() * 4);
+  if (block_size > grain) {
+    grain = block_size;
+  }
+  // MergeFunctor writes equivalent elements of its second range first, such
+  // that swapping the ranges yields a stable merge.
+  MergeFunctor<RAIIn2, RAIIn1, RAIOut, ComparisonFunction> functor(
+    first2, last2, first1, last1, output, comparison, policy, grain);
+  embb::tasks::Task task = embb::tasks::Node::GetInstance().Spawn(
+    embb::tasks::Action(functor, policy));
+  task.Wait(MTAPI_INFINITE);
+  return output +
+    static_cast<typename std::iterator_traits<RAIOut>::difference_type>(total);
+}
+
+template<typename Operation, typename RAIIn1, typename RAIIn2,
+         typename RAIOut, typename ComparisonFunction>
+RAIOut SetOperationIteratorCheck(RAIIn1 first1, RAIIn1 last1, RAIIn2 first2,
+  RAIIn2 last2, RAIOut output, ComparisonFunction comparison,
+  const embb::tasks::ExecutionPolicy& policy, size_t block_size,
+  const char* message, std::random_access_iterator_tag) {
+  typedef SetOperationFunctor<Operation, RAIIn1, RAIIn2, RAIOut,
+    ComparisonFunction> functor_t;
+  size_t count1;
+  size_t count2;
+  MergeCheck(first1, last1, first2, last2, policy, message, count1, count2);
+  // Split the ranges into up to four parts per core
+  size_t parts = policy.GetCoreCount() * 4;
+  if (block_size > 0 && (count1 + count2) / block_size < parts) {
+    parts = (count1 + count2) / block_size;
+  }
+  if (parts > count1 + count2) {
+    parts = count1 + count2;
+  }
+  if (parts <= 1) {
+    return Operation::Apply(first1, last1, first2, last2, output, comparison);
+  }
+  functor_t functor(first1, count1, first2, count2, output, comparison,
+                    policy, parts);
+  embb::tasks::Task task = embb::tasks::Node::GetInstance().Spawn(
+    embb::tasks::Action(
+      base::MakeFunction(functor, &functor_t::Action), policy));
+  task.Wait(MTAPI_INFINITE);
+  return output +
+    static_cast<typename std::iterator_traits<RAIOut>::difference_type>(
+      functor.GetWritten());
+}
+
+}  // namespace internal
+
+template<typename RAIIn1, typename RAIIn2, typename RAIOut,
+         typename ComparisonFunction>
+RAIOut Merge(RAIIn1 first1, RAIIn1 last1, RAIIn2 first2, RAIIn2 last2,
+  RAIOut output, ComparisonFunction comparison,
+  const embb::tasks::ExecutionPolicy& policy, size_t block_size) {
+  typedef typename std::iterator_traits<RAIIn1>::iterator_category category;
+  return internal::MergeIteratorCheck(first1, last1, first2, last2, output,
+    comparison, policy, block_size, category());
+}
+
+template<typename RAIIn1, typename RAIIn2, typename RAIOut,
+         typename ComparisonFunction>
+RAIOut SetUnion(RAIIn1 first1, RAIIn1 last1, RAIIn2 first2, RAIIn2 last2,
+  RAIOut output, ComparisonFunction comparison,
+  const embb::tasks::ExecutionPolicy& policy, size_t block_size) {
+  typedef typename std::iterator_traits<RAIIn1>::iterator_category category;
+  return internal::SetOperationIteratorCheck<internal::SetUnionOperation>(
+    first1, last1, first2, last2, output, comparison, policy, block_size,
+    "Negative range for SetUnion", category());
+}
+
+template<typename RAIIn1, typename RAIIn2, typename RAIOut,
+         typename ComparisonFunction>
+RAIOut SetIntersection(RAIIn1 first1, RAIIn1 last1, RAIIn2 first2,
+  RAIIn2 last2, RAIOut output, ComparisonFunction comparison,
+  const embb::tasks::ExecutionPolicy& policy, size_t block_size) {
+  typedef typename std::iterator_traits<RAIIn1>::iterator_category category;
+  return internal::SetOperationIteratorCheck<
+    internal::SetIntersectionOperation>(
+      first1, last1, first2, last2, output, comparison, policy, block_size,
+      "Negative range for SetIntersection", category());
+}
+
+template<typename RAIIn1, typename RAIIn2, typename RAIOut,
+         typename ComparisonFunction>
+RAIOut SetDifference(RAIIn1 first1, RAIIn1 last1, RAIIn2 first2,
+  RAIIn2 last2, RAIOut output, ComparisonFunction comparison,
+  const embb::tasks::ExecutionPolicy& policy, size_t block_size) {
+  typedef typename std::iterator_traits<RAIIn1>::iterator_category category;
+  return internal::SetOperationIteratorCheck<
+    internal::SetDifferenceOperation>(
+      first1, last1, first2, last2, output, comparison, policy, block_size,
+      "Negative range for SetDifference", category());
+}
+
+}  // namespace algorithms
+}  // namespace embb
+
+#endif  // EMBB_ALGORITHMS_INTERNAL_MERGE_INL_H_
@@ -27,6 +27,7 @@
 #ifndef EMBB_ALGORITHMS_INTERNAL_MERGE_SORT_INL_H_
 #define EMBB_ALGORITHMS_INTERNAL_MERGE_SORT_INL_H_
 
+#include <algorithm>
 #include <cassert>
 #include <iterator>
 #include <functional>
@@ -40,72 +41,171 @@ namespace algorithms {
 
 namespace internal {
 
+/**
+ * Merges two sorted ranges serially. Of two equivalent elements, the one
+ * from the second range is written first.
+ */
+template<typename RAIIn1, typename RAIIn2, typename RAIOut,
+         typename ComparisonFunction>
+void SerialMerge(RAIIn1 first1, RAIIn1 last1, RAIIn2 first2, RAIIn2 last2,
+                 RAIOut out, ComparisonFunction comparison) {
+  while ((first1 != last1) && (first2 != last2)) {
+    if (comparison(*first1, *first2)) {
+      *out = *first1;
+      ++out;
+      ++first1;
+    } else {
+      *out = *first2;
+      ++out;
+      ++first2;
+    }
+  }
+  while (first1 != last1) {
+    *out = *first1;
+    ++out;
+    ++first1;
+  }
+  while (first2 != last2) {
+    *out = *first2;
+    ++out;
+    ++first2;
+  }
+}
+
+/**
+ * Merges two sorted ranges in parallel, producing the same output as
+ * SerialMerge().
+ *
+ * As long as the ranges contain more than \c grain elements, the larger
+ * range is split at its middle element and the split position in the other
+ * range is found by binary search. The lower parts are merged by a new task
+ * while the upper parts are split further. Below the grain size, the ranges
+ * are merged serially.
+ */
+template<typename RAIIn1, typename RAIIn2, typename RAIOut,
+         typename ComparisonFunction>
+class MergeFunctor {
+ public:
+  MergeFunctor(RAIIn1 first1, RAIIn1 last1, RAIIn2 first2, RAIIn2 last2,
+               RAIOut out, ComparisonFunction comparison,
+               const embb::tasks::ExecutionPolicy& policy, size_t grain)
+  : first1_(first1), last1_(last1), first2_(first2), last2_(last2),
+    out_(out), comparison_(comparison), policy_(policy),
+    // Grain sizes below 2 would allow splits without progress
+    grain_(grain < 2 ? 2 : grain) {
+  }
+
+  void operator()(embb::tasks::TaskContext&) {
+    embb::tasks::TaskGroup group;
+    RAIIn1 first1 = first1_;
+    RAIIn2 first2 = first2_;
+    RAIOut out = out_;
+    size_t count1 = static_cast<size_t>(std::distance(first1, last1_));
+    size_t count2 = static_cast<size_t>(std::distance(first2, last2_));
+    while (count1 + count2 > grain_) {
+      RAIIn1 mid1;
+      RAIIn2 mid2;
+      if (count1 >= count2) {
+        // Equivalent elements of the second range go to the lower part
+        mid1 = first1 + static_cast<difference_type1>(count1 / 2);
+        mid2 = std::upper_bound(first2, last2_, *mid1, comparison_);
+      } else {
+        // Equivalent elements of the first range go to the upper part
+        mid2 = first2 + static_cast<difference_type2>(count2 / 2);
+        mid1 = std::lower_bound(first1, last1_, *mid2, comparison_);
+      }
+      group.Spawn(embb::tasks::Action(
+        self_t(first1, mid1, first2, mid2, out, comparison_, policy_, grain_),
+        policy_));
+      std::advance(out, std::distance(first1, mid1) +
+                        std::distance(first2, mid2));
+      count1 -= static_cast<size_t>(std::distance(first1, mid1));
+      count2 -= static_cast<size_t>(std::distance(first2, mid2));
+      first1 = mid1;
+      first2 = mid2;
+    }
+    SerialMerge(first1, last1_, first2, last2_, out, comparison_);
+    group.Sync();
+  }
+
+ private:
+  typedef MergeFunctor<RAIIn1, RAIIn2, RAIOut, ComparisonFunction> self_t;
+  typedef typename std::iterator_traits<RAIIn1>::difference_type
+    difference_type1;
+  typedef typename std::iterator_traits<RAIIn2>::difference_type
+    difference_type2;
+
+ private:
+  RAIIn1 first1_;
+  RAIIn1 last1_;
+  RAIIn2 first2_;
+  RAIIn2 last2_;
+  RAIOut out_;
+  ComparisonFunction comparison_;
+  const embb::tasks::ExecutionPolicy& policy_;
+  size_t grain_;
+
+  MergeFunctor& operator=(const MergeFunctor&);
+};
+
 /**
  * Contains the merge sort MTAPI action function and data needed there.
+ *
+ * A range is split at its middle as long as the partitioner decides so. The
+ * lower half is handed over to a new task, the upper half is sorted by the
+ * current task, and both halves are merged in parallel. Ranges that are not
+ * split are sorted serially. The depth of a range in the recursion
+ * determines whether its sorted elements end up in the input or in the
+ * temporary range.
  */
 template <typename RAI, typename RAITemp, typename ComparisonFunction>
 class MergeSortFunctor {
  public:
   typedef typename std::iterator_traits<RAI>::value_type value_type;
 
-  MergeSortFunctor(size_t chunk_first, size_t chunk_last,
-                   RAITemp temporary_first, ComparisonFunction comparison,
+  MergeSortFunctor(RAI first, RAI last, RAITemp temporary_first,
+                   ComparisonFunction comparison,
                    const embb::tasks::ExecutionPolicy& policy,
-                   const BlockSizePartitioner<RAI>& partitioner,
-                   const RAI& global_first, int depth)
-  : chunk_first_(chunk_first), chunk_last_(chunk_last),
-    temp_first_(temporary_first),
+                   const AutoPartitioner& partitioner,
+                   RAI global_first, int depth, size_t merge_grain)
+  : first_(first), last_(last), temp_first_(temporary_first),
     comparison_(comparison), policy_(policy), partitioner_(partitioner),
-    global_first_(global_first), depth_(depth) {
+    global_first_(global_first), depth_(depth), merge_grain_(merge_grain) {
   }
 
-  void Action(embb::tasks::TaskContext&) {
-    size_t chunk_split_index = (chunk_first_ + chunk_last_) / 2;
-    if (chunk_first_ == chunk_last_) {
-      // Leaf case: recurse into a single chunk's elements:
-      ChunkDescriptor<RAI> chunk = partitioner_[chunk_first_];
-      MergeSortChunk(chunk.GetFirst(), chunk.GetLast(), depth_);
-    } else {
-      // Recurse further, split chunks:
-      self_t functor_l(chunk_first_,
-                       chunk_split_index,
-                       temp_first_,
-                       comparison_, policy_, partitioner_,
-                       global_first_, depth_ + 1);
-      self_t functor_r(chunk_split_index + 1,
-                       chunk_last_,
-                       temp_first_,
-                       comparison_, policy_, partitioner_,
-                       global_first_, depth_ + 1);
-      embb::tasks::Node& node = embb::tasks::Node::GetInstance();
-      embb::tasks::Task task_l = node.Spawn(
-        embb::tasks::Action(
-          base::MakeFunction(functor_l, &self_t::Action),
-          policy_));
-      embb::tasks::Task task_r = node.Spawn(
-        embb::tasks::Action(
-          base::MakeFunction(functor_r, &self_t::Action),
-          policy_));
-      task_l.Wait(MTAPI_INFINITE);
-      task_r.Wait(MTAPI_INFINITE);
+  void operator()(embb::tasks::TaskContext& context) {
+    size_t distance = static_cast<size_t>(std::distance(first_, last_));
+    if (!partitioner_.ShouldSplit(distance)) {
+      MergeSortChunk(first_, last_, depth_);
+      return;
+    }
+    RAI mid = first_ + static_cast<difference_type>(distance / 2);
+    embb::tasks::TaskGroup group;
+    group.Spawn(embb::tasks::Action(
+      self_t(first_, mid, temp_first_, comparison_, policy_, partitioner_,
+             global_first_, depth_ + 1, merge_grain_),
+      policy_));
+    self_t upper(mid, last_, temp_first_, comparison_, policy_, partitioner_,
+                 global_first_, depth_ + 1, merge_grain_);
+    upper(context);
+    group.Sync();
 
-      ChunkDescriptor<RAI> ck_f = partitioner_[chunk_first_];
-      ChunkDescriptor<RAI> ck_m = partitioner_[chunk_split_index + 1];
-      ChunkDescriptor<RAI> ck_l = partitioner_[chunk_last_];
-      if(CloneBackToInput(depth_)) {
-        // Merge from temp into input:
-        difference_type first = std::distance(global_first_, ck_f.GetFirst());
-        difference_type mid   = std::distance(global_first_, ck_m.GetFirst());
-        difference_type last  = std::distance(global_first_, ck_l.GetLast());
-        SerialMerge(temp_first_ + first, temp_first_ + mid, temp_first_ + last,
-                    ck_f.GetFirst(),
-                    comparison_);
-      } else {
-        // Merge from input into temp:
-        SerialMerge(ck_f.GetFirst(), ck_m.GetFirst(), ck_l.GetLast(),
-                    temp_first_ + std::distance(global_first_, ck_f.GetFirst()),
-                    comparison_);
-      }
+    difference_type first = std::distance(global_first_, first_);
+    difference_type middle = std::distance(global_first_, mid);
+    difference_type last = std::distance(global_first_, last_);
+    if (CloneBackToInput(depth_)) {
+      // Merge from temp into input:
+      MergeFunctor<RAITemp, RAITemp, RAI, ComparisonFunction> merge(
+        temp_first_ + first, temp_first_ + middle,
+        temp_first_ + middle, temp_first_ + last,
+        first_, comparison_, policy_, merge_grain_);
+      merge(context);
+    } else {
+      // Merge from input into temp:
+      MergeFunctor<RAI, RAI, RAITemp, ComparisonFunction> merge(
+        first_, mid, mid, last_, temp_first_ + first,
+        comparison_, policy_, merge_grain_);
+      merge(context);
     }
   }
 
@@ -173,43 +273,22 @@ class MergeSortFunctor {
     difference_type;
 
  private:
-  size_t chunk_first_;
-  size_t chunk_last_;
+  RAI first_;
+  RAI last_;
   RAITemp temp_first_;
   ComparisonFunction comparison_;
   const embb::tasks::ExecutionPolicy& policy_;
-  const BlockSizePartitioner<RAI>& partitioner_;
-  const RAI& global_first_;
+  const AutoPartitioner& partitioner_;
+  RAI global_first_;
   int depth_;
+  size_t merge_grain_;
 
-  MergeSortFunctor(const MergeSortFunctor&);
   MergeSortFunctor& operator=(const MergeSortFunctor&);
 
   template<typename RAIIn, typename RAIOut>
   void SerialMerge(RAIIn first, RAIIn mid, RAIIn last, RAIOut out,
                    ComparisonFunction comparison) {
-    RAIIn save_mid = mid;
-    while ((first != save_mid) && (mid != last)) {
-      if (comparison(*first, *mid)) {
-        *out = *first;
-        ++out;
-        ++first;
-      } else {
-        *out = *mid;
-        ++out;
-        ++mid;
-      }
-    }
-    while (first != save_mid) {
-      *out = *first;
-      ++out;
-      ++first;
-    }
-    while(mid != last) {
-      *out = *mid;
-      ++out;
-      ++mid;
-    }
+    internal::SerialMerge(first, mid, mid, last, out, comparison);
   }
 };
 
@@ -236,31 +315,15 @@ void MergeSortIteratorCheck(
   if (num_cores == 0) {
     EMBB_THROW(embb::base::ErrorException, "No cores in execution policy");
   }
-  // Determine actually used block size
-  if (block_size == 0) {
-    block_size = (static_cast<size_t>(distance) / num_cores);
-    if (block_size == 0)
-      block_size = 1;
-  }
-  // Check task number sufficiency
-  if (((distance / block_size) * 2) + 1 > MTAPI_NODE_MAX_TASKS_DEFAULT) {
-    EMBB_THROW(embb::base::ErrorException,
-               "Not enough MTAPI tasks available to perform merge sort");
-  }
+  // Merges are split until a few parts per core remain
+  size_t merge_grain = static_cast<size_t>(distance) / (num_cores * 4);
 
-  BlockSizePartitioner<RAI> partitioner(first, last, block_size);
-  functor_t functor(0,
-                    partitioner.Size() - 1,
-                    temporary_first,
-                    comparison,
-                    policy,
-                    partitioner,
-                    first,
-                    0);
+  AutoPartitioner partitioner(static_cast<size_t>(distance), block_size,
+                              policy);
+  functor_t functor(first, last, temporary_first, comparison, policy,
+                    partitioner, first, 0, merge_grain);
   embb::tasks::Task task = embb::tasks::Node::GetInstance().Spawn(
-    embb::tasks::Action(
-      base::MakeFunction(functor, &functor_t::Action),
-      policy));
+    embb::tasks::Action(functor, policy));
 
   task.Wait(MTAPI_INFINITE);
 }
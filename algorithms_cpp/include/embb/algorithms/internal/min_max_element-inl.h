@@ -0,0 +1,394 @@
+/*
+ * Copyright (c) 2014-2015, Siemens AG. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef EMBB_ALGORITHMS_INTERNAL_MIN_MAX_ELEMENT_INL_H_
+#define EMBB_ALGORITHMS_INTERNAL_MIN_MAX_ELEMENT_INL_H_
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <utility>
+
+#include <embb/base/exceptions.h>
+#include <embb/algorithms/reduce.h>
+
+namespace embb {
+namespace algorithms {
+namespace internal {
+
+/**
+ * Selects which extrema are searched.
+ */
+enum MinMaxElementMode {
+  MIN_MAX_ELEMENT_MIN = 1,
+  MIN_MAX_ELEMENT_MAX = 2,
+  MIN_MAX_ELEMENT_BOTH = 3
+};
+
+/**
+ * Positions of the smallest and largest element of a part of the range, or
+ * \c kNone for both if the part is empty.
+ */
+struct MinMaxElementResult {
+  static const size_t kNone = static_cast<size_t>(-1);
+
+  MinMaxElementResult() : min(kNone), max(kNone) {}
+  MinMaxElementResult(size_t min_index, size_t max_index)
+  : min(min_index), max(max_index) {}
+
+  size_t min;
+  size_t max;
+};
+
+/**
+ * Iterator over the positions in a range, such that Reduce() partitions the
+ * positions instead of the elements.
+ */
+class MinMaxElementIndex
+  : public std::iterator<std::random_access_iterator_tag, size_t,
+                         std::ptrdiff_t, const size_t*, size_t> {
+ public:
+  explicit MinMaxElementIndex(size_t index) : index_(index) {}
+
+  size_t operator*() const {
+    return index_;
+  }
+
+  MinMaxElementIndex& operator++() {
+    ++index_;
+    return *this;
+  }
+
+  MinMaxElementIndex operator+(std::ptrdiff_t distance) const {
+    return MinMaxElementIndex(index_ + static_cast<size_t>(distance));
+  }
+
+  std::ptrdiff_t operator-(const MinMaxElementIndex& other) const {
+    return static_cast<std::ptrdiff_t>(index_) -
+      static_cast<std::ptrdiff_t>(other.index_);
+  }
+
+  bool operator==(const MinMaxElementIndex& other) const {
+    return index_ == other.index_;
+  }
+
+  bool operator!=(const MinMaxElementIndex& other) const {
+    return index_ != other.index_;
+  }
+
+ private:
+  size_t index_;
+};
+
+/**
+ * Turns a position into the result of a part with a single element. Only
+ * needed to satisfy Reduce(), as the leaves are searched by
+ * MinMaxElementLeaf.
+ */
+struct MinMaxElementTransformation {
+  MinMaxElementResult operator()(size_t index) const {
+    return MinMaxElementResult(index, index);
+  }
+};
+
+/**
+ * Determines whether a comparison is known to be a strict order on the
+ * arithmetic elements of a contiguous range.
+ */
+template<typename RAI, typename ComparisonFunction>
+struct MinMaxElementUseKernel {
+  typedef typename std::iterator_traits<RAI>::value_type value_type;
+  static const bool value =
+    ReduceIsContiguous<RAI>::value &&
+    std::numeric_limits<value_type>::is_specialized &&
+    !ReduceIsSame<value_type, bool>::value &&
+    (ReduceIsSame<ComparisonFunction, std::less<value_type> >::value ||
+     ReduceIsSame<ComparisonFunction, std::greater<value_type> >::value);
+};
+
+/**
+ * Searches the non-empty part <tt>[first, last)</tt> of a range element by
+ * element.
+ */
+template<typename RAI, typename ComparisonFunction, int Mode,
+         bool UseKernel = MinMaxElementUseKernel<RAI,
+                                                 ComparisonFunction>::value>
+struct MinMaxElementLeaf {
+  static MinMaxElementResult Search(RAI elements, size_t first, size_t last,
+                                    ComparisonFunction& comparison) {
+    typedef typename std::iterator_traits<RAI>::difference_type
+      difference_type;
+    RAI iter = elements + static_cast<difference_type>(first);
+    RAI min = iter;
+    RAI max = iter;
+    size_t min_index = first;
+    size_t max_index = first;
+    ++iter;
+    for (size_t index = first + 1; index != last; ++index, ++iter) {
+      if ((Mode & MIN_MAX_ELEMENT_MIN) && comparison(*iter, *min)) {
+        min = iter;
+        min_index = index;
+      }
+      if ((Mode & MIN_MAX_ELEMENT_MAX) && comparison(*max, *iter)) {
+        max = iter;
+        max_index = index;
+      }
+    }
+    return MinMaxElementResult(min_index, max_index);
+  }
+};
+
+/**
+ * Searches the non-empty part <tt>[first, last)</tt> of a contiguous range of
+ * arithmetic elements.
+ *
+ * Like the kernel of Reduce(), eight lanes each search every eighth element,
+ * which breaks the dependency chain of the element-wise loop. The candidates
+ * are selected without branches, so that the compiler can vectorize the loop.
+ * Equivalent candidates of the lanes are resolved by their positions.
+ */
+template<typename RAI, typename ComparisonFunction, int Mode>
+struct MinMaxElementLeaf<RAI, ComparisonFunction, Mode, true> {
+  static MinMaxElementResult Search(RAI elements, size_t first, size_t last,
+                                    ComparisonFunction& comparison) {
+    typedef typename std::iterator_traits<RAI>::value_type value_type;
+    typedef typename std::iterator_traits<RAI>::difference_type
+      difference_type;
+    const size_t lanes = 8;
+    size_t count = last - first;
+    if (count < lanes * 2) {
+      return MinMaxElementLeaf<RAI, ComparisonFunction, Mode, false>::Search(
+        elements, first, last, comparison);
+    }
+    typename std::iterator_traits<RAI>::pointer values =
+      &*(elements + static_cast<difference_type>(first));
+    value_type min_values[lanes];
+    value_type max_values[lanes];
+    size_t min_indices[lanes];
+    size_t max_indices[lanes];
+    for (size_t lane = 0; lane < lanes; lane++) {
+      min_values[lane] = max_values[lane] = values[lane];
+      min_indices[lane] = max_indices[lane] = lane;
+    }
+    size_t i = lanes;
+    for (; i + lanes <= count; i += lanes) {
+      for (size_t lane = 0; lane < lanes; lane++) {
+        value_type value = values[i + lane];
+        if (Mode & MIN_MAX_ELEMENT_MIN) {
+          bool less = comparison(value, min_values[lane]);
+          min_values[lane] = less ? value : min_values[lane];
+          min_indices[lane] = less ? i + lane : min_indices[lane];
+        }
+        if (Mode & MIN_MAX_ELEMENT_MAX) {
+          bool greater = comparison(max_values[lane], value);
+          max_values[lane] = greater ? value : max_values[lane];
+          max_indices[lane] = greater ? i + lane : max_indices[lane];
+        }
+      }
+    }
+    size_t min_lane = 0;
+    size_t max_lane = 0;
+    for (size_t lane = 1; lane < lanes; lane++) {
+      if (comparison(min_values[lane], min_values[min_lane]) ||
+          (!comparison(min_values[min_lane], min_values[lane]) &&
+           min_indices[lane] < min_indices[min_lane])) {
+        min_lane = lane;
+      }
+      if (comparison(max_values[max_lane], max_values[lane]) ||
+          (!comparison(max_values[lane], max_values[max_lane]) &&
+           max_indices[lane] < max_indices[max_lane])) {
+        max_lane = lane;
+      }
+    }
+    value_type min_value = min_values[min_lane];
+    value_type max_value = max_values[max_lane];
+    size_t min_index = min_indices[min_lane];
+    size_t max_index = max_indices[max_lane];
+    for (; i < count; i++) {
+      if ((Mode & MIN_MAX_ELEMENT_MIN) && comparison(values[i], min_value)) {
+        min_value = values[i];
+        min_index = i;
+      }
+      if ((Mode & MIN_MAX_ELEMENT_MAX) && comparison(max_value, values[i])) {
+        max_value = values[i];
+        max_index = i;
+      }
+    }
+    return MinMaxElementResult(first + min_index, first + max_index);
+  }
+};
+
+/**
+ * Combines the results of two parts of a range. Of equivalent elements, the
+ * one at the lower position is selected, such that the result does not depend
+ * on the partitioning.
+ */
+template<typename RAI, typename ComparisonFunction, int Mode>
+class MinMaxElementReduction {
+ public:
+  MinMaxElementReduction(RAI elements, ComparisonFunction comparison)
+  : elements_(elements), comparison_(comparison) {
+  }
+
+  MinMaxElementResult operator()(const MinMaxElementResult& lhs,
+                                 const MinMaxElementResult& rhs) {
+    MinMaxElementResult result;
+    if (Mode & MIN_MAX_ELEMENT_MIN) {
+      result.min = Select(lhs.min, rhs.min, false);
+    }
+    if (Mode & MIN_MAX_ELEMENT_MAX) {
+      result.max = Select(lhs.max, rhs.max, true);
+    }
+    return result;
+  }
+
+  /**
+   * Searches the non-empty part <tt>[first, last)</tt> of the range and
+   * combines it with the result of the parts before.
+   */
+  MinMaxElementResult Leaf(size_t first, size_t last,
+                           const MinMaxElementResult& result) {
+    return (*this)(result,
+      MinMaxElementLeaf<RAI, ComparisonFunction, Mode>::Search(
+        elements_, first, last, comparison_));
+  }
+
+ private:
+  size_t Select(size_t lhs, size_t rhs, bool largest) {
+    typedef typename std::iterator_traits<RAI>::difference_type
+      difference_type;
+    if (lhs == MinMaxElementResult::kNone) {
+      return rhs;
+    }
+    if (rhs == MinMaxElementResult::kNone) {
+      return lhs;
+    }
+    RAI left = elements_ + static_cast<difference_type>(lhs);
+    RAI right = elements_ + static_cast<difference_type>(rhs);
+    if (largest ? comparison_(*left, *right) : comparison_(*right, *left)) {
+      return rhs;
+    }
+    if (largest ? comparison_(*right, *left) : comparison_(*left, *right)) {
+      return lhs;
+    }
+    return (rhs < lhs) ? rhs : lhs;
+  }
+
+  RAI elements_;
+  ComparisonFunction comparison_;
+};
+
+/**
+ * Searches the leaves of Reduce() with the MinMaxElementLeaf kernels instead
+ * of transforming and reducing the positions one by one.
+ */
+template<typename RAI, typename ComparisonFunction, int Mode, bool UseKernel>
+struct ReduceLeaf<MinMaxElementIndex, MinMaxElementResult,
+                  MinMaxElementReduction<RAI, ComparisonFunction, Mode>,
+                  MinMaxElementTransformation, UseKernel> {
+  static MinMaxElementResult Reduce(
+    MinMaxElementIndex first, MinMaxElementIndex last,
+    MinMaxElementResult result,
+    MinMaxElementReduction<RAI, ComparisonFunction, Mode>& reduction,
+    MinMaxElementTransformation&) {
+    return reduction.Leaf(*first, *last, result);
+  }
+};
+
+template<int Mode, typename RAI, typename ComparisonFunction>
+MinMaxElementResult MinMaxElementIteratorCheck(RAI first, RAI last,
+  ComparisonFunction comparison, const embb::tasks::ExecutionPolicy& policy,
+  size_t block_size, std::random_access_iterator_tag) {
+  typedef typename std::iterator_traits<RAI>::difference_type difference_type;
+  difference_type distance = std::distance(first, last);
+  if (distance == 0) {
+    return MinMaxElementResult();
+  } else if (distance < 0) {
+    EMBB_THROW(embb::base::ErrorException,
+               "Negative range for MinMaxElement");
+  }
+  return ReduceRecursive(MinMaxElementIndex(0),
+    MinMaxElementIndex(static_cast<size_t>(distance)), MinMaxElementResult(),
+    MinMaxElementReduction<RAI, ComparisonFunction, Mode>(first, comparison),
+    MinMaxElementTransformation(), policy, block_size);
+}
+
+/**
+ * Returns the iterator at \c index, or \c last if the range is empty.
+ */
+template<typename RAI>
+RAI MinMaxElementIterator(RAI first, RAI last, size_t index) {
+  if (index == MinMaxElementResult::kNone) {
+    return last;
+  }
+  return first +
+    static_cast<typename std::iterator_traits<RAI>::difference_type>(index);
+}
+
+}  // namespace internal
+
+template<typename RAI, typename ComparisonFunction>
+RAI MinElement(RAI first, RAI last, ComparisonFunction comparison,
+               const embb::tasks::ExecutionPolicy& policy,
+               size_t block_size) {
+  typename std::iterator_traits<RAI>::iterator_category category;
+  internal::MinMaxElementResult result =
+    internal::MinMaxElementIteratorCheck<internal::MIN_MAX_ELEMENT_MIN>(
+      first, last, comparison, policy, block_size, category);
+  return internal::MinMaxElementIterator(first, last, result.min);
+}
+
+template<typename RAI, typename ComparisonFunction>
+RAI MaxElement(RAI first, RAI last, ComparisonFunction comparison,
+               const embb::tasks::ExecutionPolicy& policy,
+               size_t block_size) {
+  typename std::iterator_traits<RAI>::iterator_category category;
+  internal::MinMaxElementResult result =
+    internal::MinMaxElementIteratorCheck<internal::MIN_MAX_ELEMENT_MAX>(
+      first, last, comparison, policy, block_size, category);
+  return internal::MinMaxElementIterator(first, last, result.max);
+}
+
+template<typename RAI, typename ComparisonFunction>
+std::pair<RAI, RAI> MinMaxElement(RAI first, RAI last,
+                                  ComparisonFunction comparison,
+                                  const embb::tasks::ExecutionPolicy& policy,
+                                  size_t block_size) {
+  typename std::iterator_traits<RAI>::iterator_category category;
+  internal::MinMaxElementResult result =
+    internal::MinMaxElementIteratorCheck<internal::MIN_MAX_ELEMENT_BOTH>(
+      first, last, comparison, policy, block_size, category);
+  return std::make_pair(
+    internal::MinMaxElementIterator(first, last, result.min),
+    internal::MinMaxElementIterator(first, last, result.max));
+}
+
+}  // namespace algorithms
+}  // namespace embb
+
+#endif  // EMBB_ALGORITHMS_INTERNAL_MIN_MAX_ELEMENT_INL_H_
@@ -27,6 +27,8 @@
 #ifndef EMBB_ALGORITHMS_INTERNAL_PARTITION_INL_H_
 #define EMBB_ALGORITHMS_INTERNAL_PARTITION_INL_H_
 
+#include <embb/mtapi/c/mtapi_ext.h>
+
 namespace embb {
 namespace algorithms {
 namespace internal {
@@ -131,6 +133,46 @@ const ChunkDescriptor<RAI>
   return ChunkDescriptor<RAI>(first_new, last_new);
 }
 
+inline AutoPartitioner::AutoPartitioner(
+  size_t distance, size_t block_size,
+  const embb::tasks::ExecutionPolicy& policy)
+  : affinity_(policy.GetAffinity()) {
+  unsigned int num_cores = policy.GetCoreCount();
+  // initial splitting creates a few ranges per core, every further split
+  // has to be requested by an idle worker
+  const size_t ranges_per_core = 4;
+  // the default block size keeps the overhead of split decisions low
+  const size_t blocks_per_core = 128;
+  if (num_cores == 0) {
+    num_cores = 1;
+  }
+  block_size_ = block_size;
+  if (block_size_ == 0) {
+    block_size_ = distance / (num_cores * blocks_per_core);
+    if (block_size_ == 0) {
+      block_size_ = 1;
+    }
+  }
+  large_size_ = distance / (num_cores * ranges_per_core);
+  if (large_size_ < block_size_) {
+    large_size_ = block_size_;
+  }
+}
+
+inline size_t AutoPartitioner::GetGrainSize() const {
+  return block_size_;
+}
+
+inline bool AutoPartitioner::ShouldSplit(size_t remaining) const {
+  if (remaining <= block_size_) {
+    return false;
+  }
+  if (remaining > large_size_) {
+    return true;
+  }
+  return mtapi_ext_get_idle_worker_count(&affinity_, MTAPI_NULL) > 0;
+}
+
 }  // namespace internal
 }  // namespace algorithms
 }  // namespace embb
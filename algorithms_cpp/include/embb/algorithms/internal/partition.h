@@ -239,6 +239,58 @@ class ChunkPartitioner : IPartitioner < RAI > {
     size_t const& index) const;
 };
 
+/**
+ * An adaptive partitioner for lazy binary splitting.
+ *
+ * Ranges are not split up front. Instead, a task processes its range from
+ * the front in steps of GetGrainSize() elements and splits off the upper
+ * half of the remaining elements only if ShouldSplit() says so, i.e., if
+ * the remaining range is still large or if there are idle workers of the
+ * execution policy that could take over the split off half. The number of
+ * tasks is therefore bounded by the parallelism actually in use, not by the
+ * number of elements.
+ */
+class AutoPartitioner {
+ public:
+  /**
+   * Constructor.
+   *
+   * \param distance    Number of elements of the whole range.
+   * \param block_size  Ranges of at most this size are not split. If 0, the
+   *                    block size is derived from \c distance and the
+   *                    number of cores of \c policy.
+   * \param policy      Execution policy of the computation, whose workers
+   *                    are asked for idleness.
+   */
+  AutoPartitioner(size_t distance, size_t block_size,
+                  const embb::tasks::ExecutionPolicy& policy);
+
+  /**
+   * Gets the number of elements to process between two split decisions.
+   *
+   * \return  The grain size, at least 1.
+   *
+   * \waitfree
+   */
+  size_t GetGrainSize() const;
+
+  /**
+   * Decides whether a range should be split.
+   *
+   * \param remaining Number of elements in the range.
+   *
+   * \return  \c true if the upper half should be processed by a new task.
+   *
+   * \waitfree
+   */
+  bool ShouldSplit(size_t remaining) const;
+
+ private:
+  size_t block_size_;
+  size_t large_size_;
+  mtapi_affinity_t affinity_;
+};
+
 }  // namespace internal
 }  // namespace algorithms
 }  // namespace embb
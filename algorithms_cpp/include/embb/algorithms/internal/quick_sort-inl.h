@@ -31,6 +31,8 @@
 #include <iterator>
 #include <algorithm>
 #include <functional>
+#include <utility>
+#include <vector>
 
 #include <embb/base/exceptions.h>
 #include <embb/tasks/tasks.h>
@@ -41,6 +43,132 @@ namespace algorithms {
 
 namespace internal {
 
+/**
+ * Partitions the range <tt>[first,last)</tt> around the element \c pivot,
+ * which must not lie inside the range.
+ *
+ * Returns an iterator \c mid such that no element in <tt>[first,mid)</tt> is
+ * greater than the pivot and no element in <tt>[mid,last)</tt> is less than
+ * it. Elements equivalent to the pivot may end up on either side, which keeps
+ * the partitions balanced for ranges with many equal elements.
+ */
+template <typename RAI, typename ComparisonFunction>
+RAI QuickSortBlockPartition(RAI first, RAI last, RAI pivot,
+                            ComparisonFunction comparison) {
+  while (true) {
+    while (first != last && comparison(*first, *pivot)) {
+      ++first;
+    }
+    if (first == last) {
+      return first;
+    }
+    --last;
+    while (first != last && comparison(*pivot, *last)) {
+      --last;
+    }
+    if (first == last) {
+      return first;
+    }
+    std::swap(*first, *last);
+    ++first;
+  }
+}
+
+/**
+ * Partitions one block of a parallel partitioning step and stores the
+ * position of the block's split point.
+ */
+template <typename RAI, typename ComparisonFunction>
+class QuickSortPartitionFunctor {
+ public:
+  QuickSortPartitionFunctor(RAI first, RAI last, RAI pivot,
+                            ComparisonFunction comparison, RAI* split)
+  : first_(first), last_(last), pivot_(pivot), comparison_(comparison),
+    split_(split) {
+  }
+
+  void operator()(embb::tasks::TaskContext&) {
+    *split_ = QuickSortBlockPartition(first_, last_, pivot_, comparison_);
+  }
+
+ private:
+  RAI first_;
+  RAI last_;
+  RAI pivot_;
+  ComparisonFunction comparison_;
+  RAI* split_;
+
+  QuickSortPartitionFunctor& operator=(const QuickSortPartitionFunctor&);
+};
+
+/**
+ * Swaps the misplaced elements with indices <tt>[begin,end)</tt> of a
+ * parallel partitioning step.
+ *
+ * The misplaced elements on either side of the global split point are given
+ * as sequences of subranges. Both sequences contain the same number of
+ * elements, and the i-th element of the first sequence is swapped with the
+ * i-th element of the second sequence.
+ */
+template <typename RAI>
+class QuickSortSwapFunctor {
+ public:
+  typedef std::vector<std::pair<RAI, RAI> > Ranges;
+
+  QuickSortSwapFunctor(const Ranges& left, const Ranges& right,
+                       size_t begin, size_t end)
+  : left_(left), right_(right), begin_(begin), end_(end) {
+  }
+
+  void operator()(embb::tasks::TaskContext&) {
+    size_t left_index = 0;
+    RAI left = Seek(left_, begin_, left_index);
+    size_t right_index = 0;
+    RAI right = Seek(right_, begin_, right_index);
+    for (size_t count = end_ - begin_; count > 0; --count) {
+      if (left == left_[left_index].second) {
+        left = left_[++left_index].first;
+      }
+      if (right == right_[right_index].second) {
+        right = right_[++right_index].first;
+      }
+      std::swap(*left, *right);
+      ++left;
+      ++right;
+    }
+  }
+
+ private:
+  /**
+   * Returns the position of the element with the given index in a sequence
+   * of subranges, and the subrange it lies in.
+   */
+  static RAI Seek(const Ranges& ranges, size_t index, size_t& range_index) {
+    range_index = 0;
+    while (index >= static_cast<size_t>(
+             ranges[range_index].second - ranges[range_index].first)) {
+      index -= static_cast<size_t>(
+        ranges[range_index].second - ranges[range_index].first);
+      ++range_index;
+    }
+    return ranges[range_index].first +
+      static_cast<typename std::iterator_traits<RAI>::difference_type>(index);
+  }
+
+  const Ranges& left_;
+  const Ranges& right_;
+  size_t begin_;
+  size_t end_;
+
+  QuickSortSwapFunctor& operator=(const QuickSortSwapFunctor&);
+};
+
+/**
+ * Sorts a range by partitioning it around pivots. Of the two parts of a
+ * range, the larger one is handed over to a new task if the partitioner
+ * decides to split, otherwise the smaller one is sorted by recursion. The
+ * other part is processed further by the current task.
+ */
 template <typename RAI, typename ComparisonFunction>
 class QuickSortFunctor {
  public:
@@ -48,39 +176,38 @@ class QuickSortFunctor {
    * Constructs a functor.
    */
   QuickSortFunctor(RAI first, RAI last, ComparisonFunction comparison,
-    const embb::tasks::ExecutionPolicy& policy, size_t block_size)
+    const embb::tasks::ExecutionPolicy& policy,
+    const AutoPartitioner& partitioner, size_t partition_grain)
     : first_(first), last_(last), comparison_(comparison), policy_(policy),
-      block_size_(block_size) {
+      partitioner_(partitioner), partition_grain_(partition_grain) {
   }
 
   /**
    * MTAPI action function and starting point of the parallel quick sort.
    */
-  void Action(embb::tasks::TaskContext&) {
-    Difference distance = last_ - first_;
-    if (distance <= 1) {
-      return;
-    } else {
-      Difference pivot = MedianOfNine(first_, last_);
-      RAI mid = first_ + pivot;
-      mid = SerialPartition(first_, last_, mid);
-      if (distance <= static_cast<Difference>(block_size_)) {
-        SerialQuickSort(first_, mid);
-        SerialQuickSort(mid, last_);
-      } else {
-        embb::tasks::Node& node = embb::tasks::Node::GetInstance();
-        QuickSortFunctor functor_l(first_, mid, comparison_, policy_,
-                                   block_size_);
-        embb::tasks::Task task_l = node.Spawn(embb::tasks::Action(
-          base::MakeFunction(functor_l, &QuickSortFunctor::Action)));
-        QuickSortFunctor functor_r(mid, last_, comparison_, policy_,
-                                   block_size_);
-        embb::tasks::Task task_r = node.Spawn(embb::tasks::Action(
-          base::MakeFunction(functor_r, &QuickSortFunctor::Action)));
-        task_l.Wait(MTAPI_INFINITE);
-        task_r.Wait(MTAPI_INFINITE);
-      }
+  void operator()(embb::tasks::TaskContext&) {
+    embb::tasks::TaskGroup group;
+    Sort(group, first_, last_);
+    group.Sync();
+  }
+
+  /**
+   * Partitions the range <tt>[first,last)</tt>, which must contain at least
+   * two elements, around a pivot element and returns the final position of
+   * the pivot. No element before it is greater and no element after it is
+   * less than the pivot.
+   */
+  RAI Partition(RAI first, RAI last) {
+    // Partition in parallel only if there are enough elements for at least
+    // two blocks, using up to four blocks per core like the ranges of the
+    // other algorithms.
+    size_t parts = static_cast<size_t>(last - first) / partition_grain_;
+    size_t max_parts = policy_.GetCoreCount() * 4;
+    if (parts > max_parts) {
+      parts = max_parts;
     }
+    return (parts >= 2) ? ParallelPartition(first, last, parts)
+                        : SerialPartition(first, last);
   }
 
  private:
@@ -88,9 +215,64 @@ class QuickSortFunctor {
   RAI last_;
   ComparisonFunction comparison_;
   const embb::tasks::ExecutionPolicy& policy_;
-  size_t block_size_;
+  const AutoPartitioner& partitioner_;
+  size_t partition_grain_;
 
   typedef typename std::iterator_traits<RAI>::difference_type Difference;
+  typedef std::vector<std::pair<RAI, RAI> > Ranges;
+
+  /**
+   * Sorts the range <tt>[first,last)</tt>, spawning the tasks for split off
+   * parts into \c group.
+   */
+  void Sort(embb::tasks::TaskGroup& group, RAI first, RAI last) {
+    while (last - first > 1) {
+      size_t remaining = static_cast<size_t>(last - first);
+      if (remaining <= partitioner_.GetGrainSize()) {
+        SerialQuickSort(first, last);
+        return;
+      }
+      RAI mid = Partition(first, last);
+      bool lower_is_smaller = mid - first < last - mid;
+      RAI smaller_first = lower_is_smaller ? first : mid + 1;
+      RAI smaller_last = lower_is_smaller ? mid : last;
+      RAI larger_first = lower_is_smaller ? mid + 1 : first;
+      RAI larger_last = lower_is_smaller ? last : mid;
+      if (partitioner_.ShouldSplit(remaining)) {
+        group.Spawn(embb::tasks::Action(
+          QuickSortFunctor(larger_first, larger_last, comparison_, policy_,
+                           partitioner_, partition_grain_),
+          policy_));
+        first = smaller_first;
+        last = smaller_last;
+      } else {
+        // Recursing into the smaller part bounds the recursion depth
+        Sort(group, smaller_first, smaller_last);
+        first = larger_first;
+        last = larger_last;
+      }
+    }
+  }
+
+  /**
+   * Selects the pivot element, returning its offset from \c first.
+   *
+   * Small ranges use the pseudo-median of nine. Larger ranges use the median
+   * of the pseudo-medians of nine of their thirds, which samples 27 elements
+   * and rarely yields degenerate splits on nearly sorted input.
+   */
+  Difference SelectPivot(RAI first, RAI last) {
+    Difference distance = last - first;
+    if (distance < 1024) {
+      return MedianOfNine(first, last);
+    }
+    Difference third = distance / 3;
+    return MedianOfThree(
+        first,
+        MedianOfNine(first, first + third),
+        third + MedianOfNine(first + third, first + third * 2),
+        third * 2 + MedianOfNine(first + third * 2, last));
+  }
 
   /**
    * Computes the pseudo-median of nine by using MedianOfThree().
@@ -137,41 +319,98 @@ class QuickSortFunctor {
 
   /**
    * Performs a quick sort partitioning as serial computation.
+   *
+   * Returns the final position of the pivot element. No element before it is
+   * greater and no element after it is less than the pivot.
    */
-  RAI SerialPartition(RAI first, RAI last, RAI pivot) {
-    while (first != last) {
-      while (comparison_(*first, *pivot)) {
-        ++first;
-        if (first == last)
-          return first;
+  RAI SerialPartition(RAI first, RAI last) {
+    std::swap(*first, *(first + SelectPivot(first, last)));
+    RAI mid = QuickSortBlockPartition(first + 1, last, first, comparison_);
+    std::swap(*first, *(mid - 1));
+    return mid - 1;
+  }
+
+  /**
+   * Performs a quick sort partitioning as parallel computation, with the
+   * same result guarantees as SerialPartition().
+   *
+   * The range is divided into \c parts blocks that are partitioned around
+   * the pivot in parallel. Summing up the sizes of the lower block parts
+   * gives the global split point. The upper block parts that lie before it
+   * and the lower block parts that lie after it contain the same number of
+   * elements, which are then exchanged in parallel.
+   */
+  RAI ParallelPartition(RAI first, RAI last, size_t parts) {
+    std::swap(*first, *(first + SelectPivot(first, last)));
+    RAI begin = first + 1;
+    Difference distance = last - begin;
+    std::vector<RAI> bounds(parts + 1);
+    std::vector<RAI> splits(parts);
+    for (size_t i = 0; i <= parts; ++i) {
+      bounds[i] = begin + static_cast<Difference>(
+        static_cast<size_t>(distance) * i / parts);
+    }
+    embb::tasks::TaskGroup group;
+    for (size_t i = 0; i < parts; ++i) {
+      group.Spawn(embb::tasks::Action(
+        QuickSortPartitionFunctor<RAI, ComparisonFunction>(
+          bounds[i], bounds[i + 1], first, comparison_, &splits[i]),
+        policy_));
+    }
+    group.Sync();
+
+    RAI mid = begin;
+    for (size_t i = 0; i < parts; ++i) {
+      mid += splits[i] - bounds[i];
+    }
+    // Collect upper block parts before and lower block parts after mid
+    Ranges left;
+    Ranges right;
+    size_t misplaced = 0;
+    for (size_t i = 0; i < parts; ++i) {
+      RAI left_first = (splits[i] < mid) ? splits[i] : mid;
+      RAI left_last = (bounds[i + 1] < mid) ? bounds[i + 1] : mid;
+      if (left_first < left_last) {
+        left.push_back(std::make_pair(left_first, left_last));
+        misplaced += static_cast<size_t>(left_last - left_first);
       }
-      do {
-        --last;
-        if (first == last) return first;
-      } while (comparison_(*pivot, *last));
-      std::swap(*first, *last);
-      if(pivot == first) {
-        pivot = last;
-      } else if (pivot == last) {
-        pivot = first;
+      RAI right_first = (bounds[i] > mid) ? bounds[i] : mid;
+      RAI right_last = (splits[i] > mid) ? splits[i] : mid;
+      if (right_first < right_last) {
+        right.push_back(std::make_pair(right_first, right_last));
       }
-      ++first;
     }
-    return first;
+    for (size_t i = 0; i < parts; ++i) {
+      size_t swap_first = misplaced * i / parts;
+      size_t swap_last = misplaced * (i + 1) / parts;
+      if (swap_first < swap_last) {
+        group.Spawn(embb::tasks::Action(
+          QuickSortSwapFunctor<RAI>(left, right, swap_first, swap_last),
+          policy_));
+      }
+    }
+    group.Sync();
+
+    std::swap(*first, *(mid - 1));
+    return mid - 1;
   }
 
   /**
    * Performs the quick sort algorithm as serial computation.
+   *
+   * Recurses into the smaller partition only, so that the recursion depth
+   * stays logarithmic even for degenerate splits.
    */
   void SerialQuickSort(RAI first, RAI last) {
-    if (last - first <= 1) {
-      return;
-    } else {
-      Difference pivot = MedianOfNine(first, last);
-      RAI mid = first + pivot;
-      mid = SerialPartition(first, last, mid);
-      SerialQuickSort(first, mid);
-      SerialQuickSort(mid, last);
+    while (last - first > 1) {
+      RAI mid = SerialPartition(first, last);
+      if (mid - first < last - mid) {
+        SerialQuickSort(first, mid);
+        first = mid + 1;
+      } else {
+        SerialQuickSort(mid + 1, last);
+        last = mid;
+      }
     }
   }
 
@@ -179,13 +418,23 @@ class QuickSortFunctor {
    * Disables assignment.
    */
   QuickSortFunctor& operator=(const QuickSortFunctor&);
-
-  /**
-   * Disables Copying.
-   */
-  QuickSortFunctor(const QuickSortFunctor&);
 };
 
+/**
+ * Returns the minimum number of elements of a block of a parallel
+ * partitioning step. The blocks are not smaller than the given block size,
+ * or a share of a core if none is given, and not so small that spawning them
+ * costs more than partitioning them.
+ */
+inline size_t QuickSortPartitionGrain(size_t distance, size_t block_size,
+                                      unsigned int num_cores) {
+  const size_t min_partition_grain = 2048;
+  size_t partition_grain = (block_size == 0) ? distance / num_cores
+                                             : block_size;
+  return (partition_grain < min_partition_grain) ? min_partition_grain
+                                                 : partition_grain;
+}
+
 template <typename RAI, typename ComparisonFunction>
 void QuickSortIteratorCheck(RAI first, RAI last,
   ComparisonFunction comparison,
@@ -204,19 +453,13 @@ void QuickSortIteratorCheck(RAI first, RAI last,
   if (num_cores == 0) {
     EMBB_THROW(embb::base::ErrorException, "No cores in execution policy");
   }
-  if (block_size == 0) {
-    block_size = (static_cast<size_t>(distance) / num_cores);
-    if (block_size == 0)
-      block_size = 1;
-  }
-  if (((distance / block_size) * 2) + 1 > MTAPI_NODE_MAX_TASKS_DEFAULT) {
-    EMBB_THROW(embb::base::ErrorException,
-               "Not enough MTAPI tasks available for performing quick sort");
-  }
+  AutoPartitioner partitioner(static_cast<size_t>(distance), block_size,
+                              policy);
+  size_t partition_grain = QuickSortPartitionGrain(
+    static_cast<size_t>(distance), block_size, num_cores);
   QuickSortFunctor<RAI, ComparisonFunction> functor(
-      first, last, comparison, policy, block_size);
-  embb::tasks::Task task = node.Spawn(embb::tasks::Action(base::MakeFunction(
-      functor, &QuickSortFunctor<RAI, ComparisonFunction>::Action)));
+      first, last, comparison, policy, partitioner, partition_grain);
+  embb::tasks::Task task = node.Spawn(embb::tasks::Action(functor, policy));
   task.Wait(MTAPI_INFINITE);
 }
 
@@ -0,0 +1,562 @@
+/*
+ * Copyright (c) 2014-2015, Siemens AG. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef EMBB_ALGORITHMS_INTERNAL_RADIX_SORT_INL_H_
+#define EMBB_ALGORITHMS_INTERNAL_RADIX_SORT_INL_H_
+
+#include <stdint.h>
+#include <climits>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <vector>
+
+#include <embb/base/exceptions.h>
+#include <embb/tasks/tasks.h>
+#include <embb/algorithms/identity.h>
+#include <embb/algorithms/scan.h>
+#include <embb/algorithms/zip_iterator.h>
+
+namespace embb {
+namespace algorithms {
+
+namespace internal {
+
+/**
+ * Number of key bits sorted per pass.
+ */
+const unsigned int kRadixSortDigitBits = 8;
+
+/**
+ * Number of different digits, and thus of counters per block histogram.
+ */
+const size_t kRadixSortDigits = 1 << kRadixSortDigitBits;
+
+/**
+ * Number of elements buffered per digit before they are written to the
+ * target range.
+ */
+const size_t kRadixSortBufferSize = 16;
+
+/**
+ * Provides an unsigned integer type of the given size in bytes.
+ */
+template <size_t Size>
+struct RadixSortBits;
+
+template <>
+struct RadixSortBits<1> {
+  typedef uint8_t Type;
+};
+
+template <>
+struct RadixSortBits<2> {
+  typedef uint16_t Type;
+};
+
+template <>
+struct RadixSortBits<4> {
+  typedef uint32_t Type;
+};
+
+template <>
+struct RadixSortBits<8> {
+  typedef uint64_t Type;
+};
+
+/**
+ * Maps an integral key to unsigned bits with the same order.
+ */
+template <typename Key, bool IsInteger = std::numeric_limits<Key>::is_integer>
+struct RadixSortKey {
+  typedef typename RadixSortBits<sizeof(Key)>::Type Bits;
+
+  static Bits ToBits(Key key) {
+    // Flipping the sign bit moves negative keys in front of positive ones
+    const Bits flip = std::numeric_limits<Key>::is_signed ?
+      static_cast<Bits>(static_cast<Bits>(1) << (sizeof(Key) * CHAR_BIT - 1)) :
+      static_cast<Bits>(0);
+    return static_cast<Bits>(static_cast<Bits>(key) ^ flip);
+  }
+};
+
+/**
+ * Maps an IEEE 754 floating-point key to unsigned bits with the same order.
+ */
+template <typename Key>
+struct RadixSortKey<Key, false> {
+  typedef typename RadixSortBits<sizeof(Key)>::Type Bits;
+
+  static Bits ToBits(Key key) {
+    Bits bits;
+    std::memcpy(&bits, &key, sizeof(Bits));
+    const Bits sign =
+      static_cast<Bits>(static_cast<Bits>(1) << (sizeof(Key) * CHAR_BIT - 1));
+    // Negative keys are ordered by descending magnitude
+    return static_cast<Bits>((bits & sign) ? ~bits : (bits | sign));
+  }
+};
+
+/**
+ * Removes references and const qualifiers from a type.
+ */
+template <typename Type>
+struct RadixSortRemoveQualifiers {
+  typedef Type Result;
+};
+
+template <typename Type>
+struct RadixSortRemoveQualifiers<Type&> {
+  typedef typename RadixSortRemoveQualifiers<Type>::Result Result;
+};
+
+template <typename Type>
+struct RadixSortRemoveQualifiers<const Type> {
+  typedef typename RadixSortRemoveQualifiers<Type>::Result Result;
+};
+
+/**
+ * Determines the key type returned by a key extractor functor.
+ */
+template <typename KeyExtractor>
+struct RadixSortKeyType {
+  typedef typename RadixSortRemoveQualifiers<
+    typename KeyExtractor::result_type>::Result Type;
+};
+
+/**
+ * Determines the key type returned by a key extractor function.
+ */
+template <typename Result, typename Argument>
+struct RadixSortKeyType<Result (*)(Argument)> {
+  typedef typename RadixSortRemoveQualifiers<Result>::Result Type;
+};
+
+/**
+ * Key extractor for ranges of keys.
+ */
+template <typename Key>
+struct RadixSortIdentityKey {
+  typedef Key result_type;
+
+  const Key& operator()(const Key& key) const {
+    return key;
+  }
+};
+
+/**
+ * Key extractor for ranges of key/value pairs given by zip iterators.
+ */
+template <typename Key>
+struct RadixSortZipKey {
+  typedef Key result_type;
+
+  template <typename Pair>
+  Key operator()(const Pair& pair) const {
+    return pair.First();
+  }
+};
+
+/**
+ * Copies one element.
+ */
+template <typename RAIIn, typename RAIOut>
+void RadixSortCopy(RAIIn in, RAIOut out) {
+  *out = *in;
+}
+
+/**
+ * Copies one key/value pair. Zip pairs cannot be assigned as a whole.
+ */
+template <typename RAIInA, typename RAIInB, typename RAIOutA,
+          typename RAIOutB>
+void RadixSortCopy(ZipIterator<RAIInA, RAIInB> in,
+                   ZipIterator<RAIOutA, RAIOutB> out) {
+  (*out).First() = (*in).First();
+  (*out).Second() = (*in).Second();
+}
+
+/**
+ * Returns the digit of an element's key that is sorted by the current pass.
+ */
+template <typename KeyExtractor>
+class RadixSortDigit {
+ public:
+  typedef typename RadixSortKeyType<KeyExtractor>::Type Key;
+
+  RadixSortDigit(KeyExtractor key_extractor, unsigned int shift)
+  : key_extractor_(key_extractor), shift_(shift) {
+  }
+
+  template <typename Element>
+  size_t operator()(const Element& element) const {
+    return static_cast<size_t>(
+      (RadixSortKey<Key>::ToBits(key_extractor_(element)) >> shift_) &
+      (kRadixSortDigits - 1));
+  }
+
+ private:
+  mutable KeyExtractor key_extractor_;
+  unsigned int shift_;
+};
+
+/**
+ * Computes the digit histogram of one block. The counter of digit \c d is
+ * stored at <tt>counts[d * stride]</tt>.
+ */
+template <typename RAI, typename KeyExtractor>
+class RadixSortHistogramFunctor {
+ public:
+  RadixSortHistogramFunctor(RAI first, size_t count,
+                            const RadixSortDigit<KeyExtractor>& digit,
+                            size_t* counts, size_t stride)
+  : first_(first), count_(count), digit_(digit), counts_(counts),
+    stride_(stride) {
+  }
+
+  void operator()(embb::tasks::TaskContext&) {
+    size_t histogram[kRadixSortDigits];
+    for (size_t digit = 0; digit < kRadixSortDigits; digit++) {
+      histogram[digit] = 0;
+    }
+    for (size_t i = 0; i < count_; i++) {
+      histogram[digit_(*(first_ + i))]++;
+    }
+    for (size_t digit = 0; digit < kRadixSortDigits; digit++) {
+      counts_[digit * stride_] = histogram[digit];
+    }
+  }
+
+ private:
+  RAI first_;
+  size_t count_;
+  RadixSortDigit<KeyExtractor> digit_;
+  size_t* counts_;
+  size_t stride_;
+
+  RadixSortHistogramFunctor& operator=(const RadixSortHistogramFunctor&);
+};
+
+/**
+ * Scatters the elements of one block to their positions in the target range.
+ * The first position of digit \c d is given by <tt>offsets[d * stride]</tt>.
+ *
+ * The positions of up to kRadixSortBufferSize elements are buffered per
+ * digit, so that the elements of a digit are written to the target range in
+ * bursts of consecutive elements. The buffered elements are reread from the
+ * block while they are still cached.
+ */
+template <typename RAIIn, typename RAIOut, typename KeyExtractor>
+class RadixSortScatterFunctor {
+ public:
+  RadixSortScatterFunctor(RAIIn first, size_t count, RAIOut output,
+                          const RadixSortDigit<KeyExtractor>& digit,
+                          const size_t* offsets, size_t stride)
+  : first_(first), count_(count), output_(output), digit_(digit),
+    offsets_(offsets), stride_(stride) {
+  }
+
+  void operator()(embb::tasks::TaskContext&) {
+    size_t positions[kRadixSortDigits];
+    size_t fill[kRadixSortDigits];
+    std::vector<size_t> buffer(kRadixSortDigits * kRadixSortBufferSize);
+    for (size_t digit = 0; digit < kRadixSortDigits; digit++) {
+      positions[digit] = offsets_[digit * stride_];
+      fill[digit] = 0;
+    }
+    for (size_t i = 0; i < count_; i++) {
+      size_t digit = digit_(*(first_ + i));
+      buffer[digit * kRadixSortBufferSize + fill[digit]] = i;
+      if (++fill[digit] == kRadixSortBufferSize) {
+        Flush(&buffer[digit * kRadixSortBufferSize], fill[digit],
+              positions[digit]);
+        fill[digit] = 0;
+      }
+    }
+    for (size_t digit = 0; digit < kRadixSortDigits; digit++) {
+      Flush(&buffer[digit * kRadixSortBufferSize], fill[digit],
+            positions[digit]);
+    }
+  }
+
+ private:
+  typedef typename std::iterator_traits<RAIOut>::difference_type
+    difference_type;
+
+  void Flush(const size_t* buffer, size_t count, size_t& position) {
+    for (size_t i = 0; i < count; i++) {
+      RadixSortCopy(first_ + static_cast<difference_type>(buffer[i]),
+                    output_ + static_cast<difference_type>(position));
+      position++;
+    }
+  }
+
+  RAIIn first_;
+  size_t count_;
+  RAIOut output_;
+  RadixSortDigit<KeyExtractor> digit_;
+  const size_t* offsets_;
+  size_t stride_;
+
+  RadixSortScatterFunctor& operator=(const RadixSortScatterFunctor&);
+};
+
+/**
+ * Copies one block of elements.
+ */
+template <typename RAIIn, typename RAIOut>
+class RadixSortCopyFunctor {
+ public:
+  RadixSortCopyFunctor(RAIIn first, size_t count, RAIOut output)
+  : first_(first), count_(count), output_(output) {
+  }
+
+  void operator()(embb::tasks::TaskContext&) {
+    for (size_t i = 0; i < count_; i++) {
+      RadixSortCopy(first_ + static_cast<difference_type>(i),
+                    output_ + static_cast<difference_type>(i));
+    }
+  }
+
+ private:
+  typedef typename std::iterator_traits<RAIOut>::difference_type
+    difference_type;
+
+  RAIIn first_;
+  size_t count_;
+  RAIOut output_;
+
+  RadixSortCopyFunctor& operator=(const RadixSortCopyFunctor&);
+};
+
+/**
+ * Sorts a range by moving its elements back and forth between the range and
+ * a temporary range, one digit per pass.
+ */
+template <typename RAI, typename RAITemp, typename KeyExtractor>
+class RadixSorter {
+ public:
+  RadixSorter(RAI first, RAITemp temporary_first, size_t count,
+              KeyExtractor key_extractor,
+              const embb::tasks::ExecutionPolicy& policy, size_t parts)
+  : first_(first), temporary_first_(temporary_first), count_(count),
+    key_extractor_(key_extractor), policy_(policy), parts_(parts),
+    counts_(kRadixSortDigits * parts), offsets_(kRadixSortDigits * parts) {
+  }
+
+  void Sort() {
+    typedef typename RadixSortKeyType<KeyExtractor>::Type Key;
+    const unsigned int key_bits =
+      static_cast<unsigned int>(sizeof(Key) * CHAR_BIT);
+    bool in_temporary = false;
+    for (unsigned int shift = 0; shift < key_bits;
+         shift += kRadixSortDigitBits) {
+      RadixSortDigit<KeyExtractor> digit(key_extractor_, shift);
+      bool moved = in_temporary ?
+        Pass(temporary_first_, first_, digit) :
+        Pass(first_, temporary_first_, digit);
+      if (moved) {
+        in_temporary = !in_temporary;
+      }
+    }
+    if (in_temporary) {
+      embb::tasks::TaskGroup group;
+      for (size_t part = 0; part < parts_; part++) {
+        group.Spawn(embb::tasks::Action(
+          RadixSortCopyFunctor<RAITemp, RAI>(
+            temporary_first_ + Begin(part), Size(part),
+            first_ + Begin(part)),
+          policy_));
+      }
+      group.Sync();
+    }
+  }
+
+ private:
+  typedef typename std::iterator_traits<RAI>::difference_type
+    difference_type;
+
+  /**
+   * Returns the offset of the first element of a block.
+   */
+  difference_type Begin(size_t part) const {
+    return static_cast<difference_type>(count_ * part / parts_);
+  }
+
+  /**
+   * Returns the number of elements of a block.
+   */
+  size_t Size(size_t part) const {
+    return count_ * (part + 1) / parts_ - count_ * part / parts_;
+  }
+
+  /**
+   * Sorts the elements from \c input by one digit into \c output. Returns
+   * false without moving any element if all keys have the same digit.
+   */
+  template <typename RAIIn, typename RAIOut>
+  bool Pass(RAIIn input, RAIOut output,
+            const RadixSortDigit<KeyExtractor>& digit) {
+    embb::tasks::TaskGroup group;
+    for (size_t part = 0; part < parts_; part++) {
+      group.Spawn(embb::tasks::Action(
+        RadixSortHistogramFunctor<RAIIn, KeyExtractor>(
+          input + Begin(part), Size(part), digit, &counts_[part], parts_),
+        policy_));
+    }
+    group.Sync();
+
+    // The counters are ordered by digit first and block second, so that an
+    // exclusive prefix sum yields the first position of each digit in each
+    // block.
+    offsets_[0] = 0;
+    Scan(counts_.begin(), counts_.end() - 1, offsets_.begin() + 1,
+         static_cast<size_t>(0), std::plus<size_t>(), Identity(), policy_, 0);
+    for (size_t d = 0; d < kRadixSortDigits; d++) {
+      size_t end = (d + 1 < kRadixSortDigits) ?
+        offsets_[(d + 1) * parts_] : count_;
+      if (end - offsets_[d * parts_] == count_) {
+        return false;
+      }
+    }
+
+    for (size_t part = 0; part < parts_; part++) {
+      group.Spawn(embb::tasks::Action(
+        RadixSortScatterFunctor<RAIIn, RAIOut, KeyExtractor>(
+          input + Begin(part), Size(part), output, digit, &offsets_[part],
+          parts_),
+        policy_));
+    }
+    group.Sync();
+    return true;
+  }
+
+  RAI first_;
+  RAITemp temporary_first_;
+  size_t count_;
+  KeyExtractor key_extractor_;
+  const embb::tasks::ExecutionPolicy& policy_;
+  size_t parts_;
+  std::vector<size_t> counts_;
+  std::vector<size_t> offsets_;
+
+  RadixSorter& operator=(const RadixSorter&);
+};
+
+/**
+ * Checks the range and policy, and returns the number of blocks to process
+ * in parallel.
+ */
+inline size_t RadixSortParts(ptrdiff_t distance,
+                             const embb::tasks::ExecutionPolicy& policy,
+                             size_t block_size) {
+  if (distance < 0) {
+    EMBB_THROW(embb::base::ErrorException, "Negative range for RadixSort");
+  }
+  unsigned int num_cores = policy.GetCoreCount();
+  if (num_cores == 0) {
+    EMBB_THROW(embb::base::ErrorException, "No cores in execution policy");
+  }
+  if (block_size == 0) {
+    block_size = 2048;
+  }
+  size_t parts = static_cast<size_t>(distance) / block_size;
+  size_t max_parts = static_cast<size_t>(num_cores) * 4;
+  if (parts > max_parts) {
+    parts = max_parts;
+  }
+  return (parts == 0) ? 1 : parts;
+}
+
+template <typename RAI, typename KeyExtractor>
+void RadixSortIteratorCheck(RAI first, RAI last, KeyExtractor key_extractor,
+  const embb::tasks::ExecutionPolicy& policy, size_t block_size,
+  std::random_access_iterator_tag) {
+  typedef typename std::iterator_traits<RAI>::value_type value_type;
+  typename std::iterator_traits<RAI>::difference_type distance = last - first;
+  size_t parts = RadixSortParts(distance, policy, block_size);
+  if (distance <= 1) {
+    return;
+  }
+  // The elements are assigned to, so they have to be constructed before:
+  std::vector<value_type> temporary(static_cast<size_t>(distance));
+  RadixSorter<RAI, value_type*, KeyExtractor> sorter(
+    first, &temporary[0], static_cast<size_t>(distance), key_extractor,
+    policy, parts);
+  sorter.Sort();
+}
+
+}  // namespace internal
+
+template<typename RAI>
+void RadixSort(RAI first, RAI last,
+  const embb::tasks::ExecutionPolicy& policy, size_t block_size) {
+  typedef typename std::iterator_traits<RAI>::iterator_category category;
+  typedef typename std::iterator_traits<RAI>::value_type value_type;
+  internal::RadixSortIteratorCheck(first, last,
+    internal::RadixSortIdentityKey<value_type>(), policy, block_size,
+    category());
+}
+
+template<typename RAI, typename KeyExtractor>
+void RadixSort(RAI first, RAI last, KeyExtractor key_extractor,
+  const embb::tasks::ExecutionPolicy& policy, size_t block_size) {
+  typedef typename std::iterator_traits<RAI>::iterator_category category;
+  internal::RadixSortIteratorCheck(first, last, key_extractor, policy,
+                                   block_size, category());
+}
+
+template<typename RAIKey, typename RAIValue>
+void RadixSort(ZipIterator<RAIKey, RAIValue> first,
+  ZipIterator<RAIKey, RAIValue> last,
+  const embb::tasks::ExecutionPolicy& policy, size_t block_size) {
+  typedef typename std::iterator_traits<RAIKey>::value_type key_type;
+  typedef typename std::iterator_traits<RAIValue>::value_type value_type;
+  typedef ZipIterator<key_type*, value_type*> TemporaryIterator;
+  typedef internal::RadixSortZipKey<key_type> KeyExtractor;
+  ptrdiff_t distance = last - first;
+  size_t parts = internal::RadixSortParts(distance, policy, block_size);
+  if (distance <= 1) {
+    return;
+  }
+  size_t count = static_cast<size_t>(distance);
+  // The elements are assigned to, so they have to be constructed before:
+  std::vector<key_type> temporary_keys(count);
+  std::vector<value_type> temporary_values(count);
+  internal::RadixSorter<ZipIterator<RAIKey, RAIValue>, TemporaryIterator,
+                        KeyExtractor> sorter(
+    first, TemporaryIterator(&temporary_keys[0], &temporary_values[0]),
+    count, KeyExtractor(), policy, parts);
+  sorter.Sort();
+}
+
+}  // namespace algorithms
+}  // namespace embb
+
+#endif  // EMBB_ALGORITHMS_INTERNAL_RADIX_SORT_INL_H_
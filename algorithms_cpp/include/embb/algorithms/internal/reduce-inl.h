@@ -30,7 +30,10 @@
 #include <embb/tasks/tasks.h>
 #include <embb/algorithms/internal/partition.h>
 
+#include <climits>
 #include <functional>
+#include <limits>
+#include <vector>
 #include <embb/base/exceptions.h>
 #include <cassert>
 
@@ -38,63 +41,238 @@ namespace embb {
 namespace algorithms {
 namespace internal {
 
+/**
+ * Result of a split off part of the range. Wrapping the value avoids the
+ * proxy references of std::vector<bool>.
+ */
+template<typename ReturnType>
+struct ReduceSplitResult {
+  explicit ReduceSplitResult(const ReturnType& neutral) : value(neutral) {}
+  ReturnType value;
+};
+
+template<typename TypeA, typename TypeB>
+struct ReduceIsSame {
+  static const bool value = false;
+};
+
+template<typename Type>
+struct ReduceIsSame<Type, Type> {
+  static const bool value = true;
+};
+
+/**
+ * Determines whether a reduction function is known to be associative and
+ * commutative on arithmetic types of \c ReturnType.
+ */
+template<typename ReductionFunction, typename ReturnType>
+struct ReduceIsKnownOperation {
+  static const bool value = false;
+};
+
+template<typename ReturnType>
+struct ReduceIsKnownOperation<std::plus<ReturnType>, ReturnType> {
+  static const bool value = true;
+};
+
+template<typename ReturnType>
+struct ReduceIsKnownOperation<std::multiplies<ReturnType>, ReturnType> {
+  static const bool value = true;
+};
+
+template<typename ReturnType>
+struct ReduceIsKnownOperation<std::bit_and<ReturnType>, ReturnType> {
+  static const bool value = true;
+};
+
+template<typename ReturnType>
+struct ReduceIsKnownOperation<std::bit_or<ReturnType>, ReturnType> {
+  static const bool value = true;
+};
+
+template<typename ReturnType>
+struct ReduceIsKnownOperation<std::bit_xor<ReturnType>, ReturnType> {
+  static const bool value = true;
+};
+
+template<typename ReturnType>
+struct ReduceIsKnownOperation<Min<ReturnType>, ReturnType> {
+  static const bool value = true;
+};
+
+template<typename ReturnType>
+struct ReduceIsKnownOperation<Max<ReturnType>, ReturnType> {
+  static const bool value = true;
+};
+
+/**
+ * Determines whether the elements of a range of type \c RAI are stored
+ * contiguously, i.e., whether the iterator is a pointer or a vector iterator.
+ */
+template<typename RAI>
+struct ReduceIsContiguous {
+  typedef typename std::iterator_traits<RAI>::value_type value_type;
+  static const bool value =
+    ReduceIsSame<RAI, value_type*>::value ||
+    ReduceIsSame<RAI, const value_type*>::value ||
+    (!ReduceIsSame<value_type, bool>::value &&
+     (ReduceIsSame<RAI, typename std::vector<value_type>::iterator>::value ||
+      ReduceIsSame<RAI,
+        typename std::vector<value_type>::const_iterator>::value));
+};
+
+/**
+ * Reduces a leaf range element by element.
+ */
+template<typename RAI, typename ReturnType, typename ReductionFunction,
+         typename TransformationFunction,
+         bool UseKernel = ReduceIsContiguous<RAI>::value &&
+           std::numeric_limits<ReturnType>::is_specialized &&
+           !ReduceIsSame<ReturnType, bool>::value &&
+           ReduceIsKnownOperation<ReductionFunction, ReturnType>::value>
+struct ReduceLeaf {
+  static ReturnType Reduce(RAI first, RAI last, ReturnType result,
+                           ReductionFunction& reduction,
+                           TransformationFunction& transformation) {
+    for (; first != last; ++first) {
+      result = reduction(result, transformation(*first));
+    }
+    return result;
+  }
+};
+
+/**
+ * Reduces a contiguous leaf range of arithmetic results with a known
+ * associative and commutative reduction, such as std::plus or Min.
+ *
+ * Eight independent accumulators each reduce every eighth element. This
+ * breaks the dependency chain of the element-wise loop, so that the compiler
+ * can vectorize the loop or at least overlap the reductions.
+ */
+template<typename RAI, typename ReturnType, typename ReductionFunction,
+         typename TransformationFunction>
+struct ReduceLeaf<RAI, ReturnType, ReductionFunction, TransformationFunction,
+                  true> {
+  static ReturnType Reduce(RAI first, RAI last, ReturnType result,
+                           ReductionFunction& reduction,
+                           TransformationFunction& transformation) {
+    const size_t lanes = 8;
+    size_t count = static_cast<size_t>(last - first);
+    if (count < lanes * 2) {
+      return ReduceLeaf<RAI, ReturnType, ReductionFunction,
+                        TransformationFunction, false>::Reduce(
+        first, last, result, reduction, transformation);
+    }
+    typename std::iterator_traits<RAI>::pointer elements = &*first;
+    ReturnType accumulators[lanes];
+    for (size_t lane = 0; lane < lanes; lane++) {
+      accumulators[lane] = transformation(elements[lane]);
+    }
+    size_t i = lanes;
+    for (; i + lanes <= count; i += lanes) {
+      for (size_t lane = 0; lane < lanes; lane++) {
+        accumulators[lane] = reduction(accumulators[lane],
+                                       transformation(elements[i + lane]));
+      }
+    }
+    for (size_t lane = 0; lane < lanes; lane++) {
+      result = reduction(result, accumulators[lane]);
+    }
+    for (; i < count; i++) {
+      result = reduction(result, transformation(elements[i]));
+    }
+    return result;
+  }
+};
+
+/**
+ * Sums up a leaf range with the compensated summation of Kahan and Neumaier.
+ * The rounding error of every addition is accumulated separately and added
+ * to the sum at the end.
+ */
+template<typename RAI, typename ReturnType, typename TransformationFunction>
+struct ReduceLeaf<RAI, ReturnType, CompensatedPlus<ReturnType>,
+                  TransformationFunction, false> {
+  static ReturnType Reduce(RAI first, RAI last, ReturnType result,
+                           CompensatedPlus<ReturnType>&,
+                           TransformationFunction& transformation) {
+    ReturnType compensation = ReturnType(0);
+    for (; first != last; ++first) {
+      ReturnType value = transformation(*first);
+      ReturnType sum = result + value;
+      if (Magnitude(result) >= Magnitude(value)) {
+        compensation += (result - sum) + value;
+      } else {
+        compensation += (value - sum) + result;
+      }
+      result = sum;
+    }
+    return result + compensation;
+  }
+
+ private:
+  static ReturnType Magnitude(ReturnType value) {
+    return (value < ReturnType(0)) ? -value : value;
+  }
+};
+
 template<typename RAI, typename ReturnType, typename ReductionFunction,
          typename TransformationFunction>
 class ReduceFunctor {
  public:
-  ReduceFunctor(size_t chunk_first, size_t chunk_last,
+  ReduceFunctor(RAI first, RAI last,
                 ReturnType neutral,
                 ReductionFunction reduction,
                 TransformationFunction transformation,
                 const embb::tasks::ExecutionPolicy& policy,
-                const BlockSizePartitioner<RAI>& partitioner,
+                const AutoPartitioner& partitioner,
                 ReturnType& result)
-  : chunk_first_(chunk_first), chunk_last_(chunk_last), neutral_(neutral),
+  : first_(first), last_(last), neutral_(neutral),
     reduction_(reduction), transformation_(transformation), policy_(policy),
     partitioner_(partitioner), result_(result) {
   }
 
-  void Action(embb::tasks::TaskContext&) {
-    if (chunk_first_ == chunk_last_) {
-      // Leaf case, recursed to single chunk. Do work on chunk:
-      ChunkDescriptor<RAI> chunk = partitioner_[chunk_first_];
-      RAI first = chunk.GetFirst();
-      RAI last  = chunk.GetLast();
-      ReturnType result(neutral_);
-      for (RAI it = first; it != last; ++it) {
-        result = reduction_(result, transformation_(*it));
-      }
-      result_ = result;
-    } else {
-      // Recurse further:
-      size_t chunk_split_index = (chunk_first_ + chunk_last_) / 2;
-      // Split chunks into left / right branches:
-      ReturnType result_l(neutral_);
-      ReturnType result_r(neutral_);
-      self_t functor_l(chunk_first_,
-                       chunk_split_index,
-                       neutral_, reduction_, transformation_, policy_,
-                       partitioner_,
-                       result_l);
-      self_t functor_r(chunk_split_index + 1,
-                       chunk_last_,
-                       neutral_, reduction_, transformation_, policy_,
-                       partitioner_,
-                       result_r);
-      embb::tasks::Task task_l = embb::tasks::Node::GetInstance().Spawn(
-        embb::tasks::Action(
-          base::MakeFunction(
-          functor_l, &self_t::Action),
-          policy_));
-      embb::tasks::Task task_r = embb::tasks::Node::GetInstance().Spawn(
-        embb::tasks::Action(
-          base::MakeFunction(
-          functor_r, &self_t::Action),
+  void operator()(embb::tasks::TaskContext&) {
+    typedef typename std::iterator_traits<RAI>::difference_type
+      difference_type;
+    // Results of the split off upper parts, the rightmost part comes first.
+    // Every split halves the range, so there are at most as many splits as
+    // bits in size_t and the results never move while tasks write them.
+    std::vector< ReduceSplitResult<ReturnType> > split_results;
+    embb::tasks::TaskGroup group;
+    ReturnType result(neutral_);
+    RAI first = first_;
+    RAI last = last_;
+    while (first != last) {
+      size_t remaining = static_cast<size_t>(std::distance(first, last));
+      if (partitioner_.ShouldSplit(remaining)) {
+        // Hand the upper half over to a new task:
+        if (split_results.empty()) {
+          split_results.reserve(sizeof(size_t) * CHAR_BIT);
+        }
+        RAI middle = first + static_cast<difference_type>(remaining / 2);
+        split_results.push_back(ReduceSplitResult<ReturnType>(neutral_));
+        group.Spawn(embb::tasks::Action(
+          self_t(middle, last, neutral_, reduction_, transformation_,
+                 policy_, partitioner_, split_results.back().value),
           policy_));
-      task_l.Wait(MTAPI_INFINITE);
-      task_r.Wait(MTAPI_INFINITE);
-      result_ = reduction_(result_l, result_r);
+        last = middle;
+      } else {
+        // Do work on the next grain:
+        size_t grain = partitioner_.GetGrainSize();
+        RAI grain_last = (remaining <= grain) ?
+          last : first + static_cast<difference_type>(grain);
+        result = ReduceLeaf<RAI, ReturnType, ReductionFunction,
+                            TransformationFunction>::Reduce(
+          first, grain_last, result, reduction_, transformation_);
+        first = grain_last;
+      }
+    }
+    group.Sync();
+    for (size_t i = split_results.size(); i > 0; i--) {
+      result = reduction_(result, split_results[i - 1].value);
     }
+    result_ = result;
   }
 
  private:
@@ -103,20 +281,19 @@ class ReduceFunctor {
                         TransformationFunction> self_t;
 
  private:
-  size_t chunk_first_;
-  size_t chunk_last_;
+  RAI first_;
+  RAI last_;
   ReturnType neutral_;
   ReductionFunction reduction_;
   TransformationFunction transformation_;
   const embb::tasks::ExecutionPolicy& policy_;
-  const BlockSizePartitioner<RAI>& partitioner_;
+  const AutoPartitioner& partitioner_;
   ReturnType& result_;
 
   /**
-   * Disables assignment and copy-construction.
+   * Disables assignment.
    */
   ReduceFunctor& operator=(const ReduceFunctor&);
-  ReduceFunctor(const ReduceFunctor&);
 };
 
 template<typename RAI, typename ReturnType, typename ReductionFunction,
@@ -138,33 +315,19 @@ ReturnType ReduceRecursive(RAI first, RAI last, ReturnType neutral,
     EMBB_THROW(embb::base::ErrorException, "No cores in execution policy");
   }
   embb::tasks::Node& node = embb::tasks::Node::GetInstance();
-  // Determine actually used block size
-  if (block_size == 0) {
-    block_size = (static_cast<size_t>(distance) / num_cores);
-    if (block_size == 0) {
-      block_size = 1;
-    }
-  }
-  // Perform check of task number sufficiency
-  if (((distance / block_size) * 2) + 1 > MTAPI_NODE_MAX_TASKS_DEFAULT) {
-    EMBB_THROW(embb::base::ErrorException,
-               "Number of computation tasks required in reduction would "
-               "exceed MTAPI maximum number of tasks");
-  }
   typedef ReduceFunctor<RAI, ReturnType, ReductionFunction,
                         TransformationFunction> Functor;
-  BlockSizePartitioner<RAI> partitioner(first, last, block_size);
+  AutoPartitioner partitioner(static_cast<size_t>(distance), block_size,
+                              policy);
   ReturnType result = neutral;
-  Functor functor(0,
-                  partitioner.Size() - 1,
+  Functor functor(first, last,
                   neutral,
                   reduction, transformation,
                   policy,
                   partitioner,
                   result);
   embb::tasks::Task task = node.Spawn(
-    embb::tasks::Action(base::MakeFunction(
-      functor, &Functor::Action), policy));
+    embb::tasks::Action(functor, policy));
   task.Wait(MTAPI_INFINITE);
   return result;
 }
@@ -181,6 +344,117 @@ ReturnType ReduceIteratorCheck(RAI first, RAI last, ReductionFunction reduction,
                            policy, block_size);
 }
 
+/**
+ * Default number of elements of the blocks of DeterministicReduce(). It must
+ * not depend on the number of cores.
+ */
+const size_t kDeterministicReduceBlockSize = 1024;
+
+/**
+ * Reduces a range along a reduction tree whose shape only depends on the
+ * number of elements and the block size. The partitioner only decides which
+ * subtrees are reduced by new tasks.
+ */
+template<typename RAI, typename ReturnType, typename ReductionFunction,
+         typename TransformationFunction>
+class DeterministicReduceFunctor {
+ public:
+  DeterministicReduceFunctor(RAI first, RAI last, ReturnType neutral,
+                             ReductionFunction reduction,
+                             TransformationFunction transformation,
+                             const embb::tasks::ExecutionPolicy& policy,
+                             size_t block_size,
+                             const AutoPartitioner& partitioner,
+                             ReturnType& result)
+  : first_(first), last_(last), neutral_(neutral), reduction_(reduction),
+    transformation_(transformation), policy_(policy), block_size_(block_size),
+    partitioner_(partitioner), result_(result) {
+  }
+
+  void operator()(embb::tasks::TaskContext&) {
+    result_ = Reduce(first_, last_);
+  }
+
+ private:
+  typedef DeterministicReduceFunctor<RAI, ReturnType, ReductionFunction,
+                                     TransformationFunction> self_t;
+
+  ReturnType Reduce(RAI first, RAI last) {
+    typedef typename std::iterator_traits<RAI>::difference_type
+      difference_type;
+    size_t count = static_cast<size_t>(std::distance(first, last));
+    if (count <= block_size_) {
+      return ReduceLeaf<RAI, ReturnType, ReductionFunction,
+                        TransformationFunction>::Reduce(
+        first, last, neutral_, reduction_, transformation_);
+    }
+    RAI middle = first + static_cast<difference_type>(count / 2);
+    if (partitioner_.ShouldSplit(count)) {
+      // Hand the upper half over to a new task:
+      ReturnType upper(neutral_);
+      embb::tasks::TaskGroup group;
+      group.Spawn(embb::tasks::Action(
+        self_t(middle, last, neutral_, reduction_, transformation_, policy_,
+               block_size_, partitioner_, upper),
+        policy_));
+      ReturnType lower = Reduce(first, middle);
+      group.Sync();
+      return reduction_(lower, upper);
+    }
+    ReturnType lower = Reduce(first, middle);
+    return reduction_(lower, Reduce(middle, last));
+  }
+
+  RAI first_;
+  RAI last_;
+  ReturnType neutral_;
+  ReductionFunction reduction_;
+  TransformationFunction transformation_;
+  const embb::tasks::ExecutionPolicy& policy_;
+  size_t block_size_;
+  const AutoPartitioner& partitioner_;
+  ReturnType& result_;
+
+  /**
+   * Disables assignment.
+   */
+  DeterministicReduceFunctor& operator=(const DeterministicReduceFunctor&);
+};
+
+template<typename RAI, typename TransformationFunction,
+  typename ReductionFunction, typename ReturnType>
+ReturnType DeterministicReduceIteratorCheck(RAI first, RAI last,
+  ReductionFunction reduction, TransformationFunction transformation,
+  ReturnType neutral, const embb::tasks::ExecutionPolicy& policy,
+  size_t block_size, std::random_access_iterator_tag) {
+  typedef typename std::iterator_traits<RAI>::difference_type difference_type;
+  difference_type distance = std::distance(first, last);
+  if (distance == 0) {
+    return neutral;
+  } else if (distance < 0) {
+    EMBB_THROW(embb::base::ErrorException,
+               "Negative range for DeterministicReduce");
+  }
+  unsigned int num_cores = policy.GetCoreCount();
+  if (num_cores == 0) {
+    EMBB_THROW(embb::base::ErrorException, "No cores in execution policy");
+  }
+  if (block_size == 0) {
+    block_size = kDeterministicReduceBlockSize;
+  }
+  embb::tasks::Node& node = embb::tasks::Node::GetInstance();
+  typedef DeterministicReduceFunctor<RAI, ReturnType, ReductionFunction,
+                                     TransformationFunction> Functor;
+  AutoPartitioner partitioner(static_cast<size_t>(distance), block_size,
+                              policy);
+  ReturnType result = neutral;
+  Functor functor(first, last, neutral, reduction, transformation, policy,
+                  block_size, partitioner, result);
+  embb::tasks::Task task = node.Spawn(embb::tasks::Action(functor, policy));
+  task.Wait(MTAPI_INFINITE);
+  return result;
+}
+
 }  // namespace internal
 
 template<typename RAI, typename ReturnType, typename ReductionFunction,
@@ -195,6 +469,18 @@ ReturnType Reduce(RAI first, RAI last, ReturnType neutral,
                                        neutral, policy, block_size, category);
 }
 
+template<typename RAI, typename ReturnType, typename ReductionFunction,
+         typename TransformationFunction>
+ReturnType DeterministicReduce(RAI first, RAI last, ReturnType neutral,
+                               ReductionFunction reduction,
+                               TransformationFunction transformation,
+                               const embb::tasks::ExecutionPolicy& policy,
+                               size_t block_size) {
+  typename std::iterator_traits<RAI>::iterator_category category;
+  return internal::DeterministicReduceIteratorCheck(first, last, reduction,
+    transformation, neutral, policy, block_size, category);
+}
+
 }  // namespace algorithms
 }  // namespace embb
 
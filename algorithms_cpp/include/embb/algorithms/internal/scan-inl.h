@@ -28,195 +28,461 @@
 #define EMBB_ALGORITHMS_INTERNAL_SCAN_INL_H_
 
 #include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <vector>
+#include <embb/base/atomic.h>
 #include <embb/base/exceptions.h>
+#include <embb/base/memory_allocation.h>
+#include <embb/base/thread.h>
 #include <embb/tasks/tasks.h>
 #include <embb/tasks/execution_policy.h>
-#include <embb/algorithms/internal/partition.h>
 
 namespace embb {
 namespace algorithms {
 namespace internal {
 
-template<typename RAIIn, typename RAIOut, typename ReturnType,
-typename ScanFunction, typename TransformationFunction>
-class ScanFunctor {
+/**
+ * Publication states of a chunk in a single-pass scan.
+ */
+enum ScanChunkState {
+  /** Nothing is known about the chunk yet */
+  SCAN_CHUNK_EMPTY = 0,
+  /** The aggregate of the chunk's own elements is available */
+  SCAN_CHUNK_AGGREGATE = 1,
+  /** The inclusive prefix up to the chunk's last element is available */
+  SCAN_CHUNK_INCLUSIVE = 2
+};
+
+/**
+ * Values published by a chunk. Wrapping them avoids the proxy references of
+ * std::vector<bool>.
+ */
+template<typename State>
+struct ScanChunkValues {
+  explicit ScanChunkValues(const State& neutral)
+  : aggregate(neutral), inclusive(neutral) {}
+  State aggregate;
+  State inclusive;
+};
+
+/**
+ * Shared state of a single-pass scan with decoupled look-back.
+ *
+ * Chunks are handed out in ascending order, so that every chunk a task looks
+ * back to has already been claimed by a running task. A chunk publishes the
+ * aggregate of its own elements as soon as it is known, and its inclusive
+ * prefix once the prefix of its predecessors is known.
+ */
+template<typename State>
+class ScanLookBack {
  public:
-  ScanFunctor(size_t chunk_first, size_t chunk_last, RAIOut output_iterator,
-              ReturnType neutral, ScanFunction scan,
-              TransformationFunction transformation,
-              const embb::tasks::ExecutionPolicy& policy,
-              const BlockSizePartitioner<RAIIn>& partitioner,
-              ReturnType* tree_values, size_t node_id,
-              bool going_down)
-    : policy_(policy), chunk_first_(chunk_first), chunk_last_(chunk_last),
-      output_iterator_(output_iterator), scan_(scan),
-      transformation_(transformation),
-      neutral_(neutral), partitioner_(partitioner), tree_values_(tree_values),
-      node_id_(node_id), parent_value_(neutral), is_first_pass_(going_down)  {
-  }
-
-  void Action(embb::tasks::TaskContext&) {
-    if (chunk_first_ == chunk_last_) {
-      ChunkDescriptor<RAIIn> chunk = partitioner_[chunk_first_];
-      RAIIn iter_in = chunk.GetFirst();
-      RAIIn last_in = chunk.GetLast();
-      RAIOut iter_out = output_iterator_;
-      // leaf case -> do work
-      if (is_first_pass_) {
-        ReturnType result = transformation_(*iter_in);
-        *iter_out = result;
-        ++iter_in;
-        ++iter_out;
-        for (; iter_in != last_in; ++iter_in, ++iter_out) {
-          result = scan_(result, transformation_(*iter_in));
-          *iter_out = result;
-        }
-        SetTreeValue(result);
-      } else {
-        // Second pass
-        for (; iter_in != last_in; ++iter_in, ++iter_out) {
-          *iter_out = scan_(parent_value_, *iter_out);
-        }
-      }
-    } else {
-      // recurse further
-      size_t chunk_split_index = (chunk_first_ + chunk_last_) / 2;
-      // Split chunks into left / right branches:
-      ScanFunctor functor_l(
-        chunk_first_, chunk_split_index,
-        output_iterator_, neutral_, scan_, transformation_,
-        policy_, partitioner_, tree_values_, node_id_,
-        is_first_pass_);
-      ScanFunctor functor_r(
-        chunk_split_index + 1, chunk_last_,
-        output_iterator_, neutral_, scan_, transformation_,
-        policy_, partitioner_, tree_values_, node_id_,
-        is_first_pass_);
-      functor_l.SetID(LEFT);
-      functor_r.SetID(RIGHT);
-      // Advance output iterator of right branch:
-      ChunkDescriptor<RAIIn> chunk_left  = partitioner_[chunk_first_];
-      ChunkDescriptor<RAIIn> chunk_right = partitioner_[chunk_split_index + 1];
-      std::advance(functor_r.output_iterator_,
-          std::distance(chunk_left.GetFirst(), chunk_right.GetFirst()));
-      if (!is_first_pass_) {
-        functor_l.parent_value_ = parent_value_;
-        functor_r.parent_value_ = functor_l.GetTreeValue() + parent_value_;
-      }
-      // Spawn tasks to recurse:
-      embb::tasks::Node& node = embb::tasks::Node::GetInstance();
-      embb::tasks::Task task_l = node.Spawn(
-        embb::tasks::Action(
-          base::MakeFunction(functor_l, &ScanFunctor::Action),
-          policy_));
-      embb::tasks::Task task_r = node.Spawn(
-        embb::tasks::Action(
-          base::MakeFunction(functor_r, &ScanFunctor::Action),
-          policy_));
-      // Wait for tasks to complete:
-      task_l.Wait(MTAPI_INFINITE);
-      task_r.Wait(MTAPI_INFINITE);
-      SetTreeValue(scan_(functor_l.GetTreeValue(), functor_r.GetTreeValue()));
+  ScanLookBack(size_t count, size_t chunk_size, const State& neutral)
+  : count_(count), chunk_size_(chunk_size),
+    chunks_((count + chunk_size - 1) / chunk_size),
+    values_(chunks_, ScanChunkValues<State>(neutral)), next_chunk_(0) {
+    states_ = static_cast<embb::base::Atomic<int>*>(
+      embb::base::Allocation::Allocate(
+        chunks_ * sizeof(embb::base::Atomic<int>)));
+    for (size_t chunk = 0; chunk < chunks_; chunk++) {
+      new (&states_[chunk]) embb::base::Atomic<int>(SCAN_CHUNK_EMPTY);
     }
   }
 
-  ReturnType GetTreeValue() {
-    return tree_values_[node_id_];
+  ~ScanLookBack() {
+    for (size_t chunk = 0; chunk < chunks_; chunk++) {
+      states_[chunk].~Atomic();
+    }
+    embb::base::Allocation::Free(states_);
   }
 
-  void SetTreeValue(ReturnType value) {
-    tree_values_[node_id_] = value;
+  size_t Size() const {
+    return chunks_;
+  }
+
+  size_t First(size_t chunk) const {
+    return chunk * chunk_size_;
+  }
+
+  size_t Last(size_t chunk) const {
+    return (chunk + 1 < chunks_) ? (chunk + 1) * chunk_size_ : count_;
+  }
+
+  /**
+   * Returns the next unprocessed chunk, or Size() if there is none.
+   */
+  size_t Claim() {
+    return next_chunk_.FetchAndAdd(1);
+  }
+
+  bool IsInclusive(size_t chunk) const {
+    return states_[chunk].Load() == SCAN_CHUNK_INCLUSIVE;
+  }
+
+  const State& Inclusive(size_t chunk) const {
+    return values_[chunk].inclusive;
+  }
+
+  void PublishAggregate(size_t chunk, const State& aggregate) {
+    values_[chunk].aggregate = aggregate;
+    states_[chunk].Store(SCAN_CHUNK_AGGREGATE);
+  }
+
+  void PublishInclusive(size_t chunk, const State& inclusive) {
+    values_[chunk].inclusive = inclusive;
+    states_[chunk].Store(SCAN_CHUNK_INCLUSIVE);
+  }
+
+  /**
+   * Combines the published values of the predecessors of \c chunk into the
+   * exclusive prefix of \c chunk, waiting for chunks that have not published
+   * anything yet.
+   */
+  template<typename Operations>
+  State LookBack(size_t chunk, Operations& operations) const {
+    size_t predecessor = chunk - 1;
+    int state = Wait(predecessor);
+    if (state == SCAN_CHUNK_INCLUSIVE) {
+      return values_[predecessor].inclusive;
+    }
+    State prefix(values_[predecessor].aggregate);
+    while (predecessor > 0 && !operations.IsComplete(prefix)) {
+      predecessor--;
+      state = Wait(predecessor);
+      if (state == SCAN_CHUNK_INCLUSIVE) {
+        return operations.Combine(values_[predecessor].inclusive, prefix);
+      }
+      prefix = operations.Combine(values_[predecessor].aggregate, prefix);
+    }
+    return prefix;
   }
 
  private:
-  static const int LEFT  = 1;
-  static const int RIGHT = 2;
-  const embb::tasks::ExecutionPolicy& policy_;
-  size_t chunk_first_;
-  size_t chunk_last_;
-  RAIOut output_iterator_;
-  ScanFunction scan_;
-  TransformationFunction transformation_;
-  ReturnType neutral_;
-  const BlockSizePartitioner<RAIIn>& partitioner_;
-  ReturnType* tree_values_;
-  size_t node_id_;
-  ReturnType parent_value_;
-  bool is_first_pass_;
-
-  void SetID(int branch) {
-    if (branch == LEFT) {
-      node_id_ = 2 * node_id_ + 1;
-    } else if (branch == RIGHT) {
-      node_id_ = 2 * node_id_ + 2;
+  /**
+   * Waits until a chunk has published a value and returns its state. The
+   * chunk's task publishes its aggregate without waiting for anything, so
+   * yielding the thread is sufficient.
+   */
+  int Wait(size_t chunk) const {
+    int state = states_[chunk].Load();
+    while (state == SCAN_CHUNK_EMPTY) {
+      embb::base::Thread::CurrentYield();
+      state = states_[chunk].Load();
+    }
+    return state;
+  }
+
+  size_t count_;
+  size_t chunk_size_;
+  size_t chunks_;
+  std::vector< ScanChunkValues<State> > values_;
+  embb::base::Atomic<int>* states_;
+  embb::base::Atomic<size_t> next_chunk_;
+
+  ScanLookBack(const ScanLookBack&);
+  ScanLookBack& operator=(const ScanLookBack&);
+};
+
+/**
+ * Processes chunks of a single-pass scan until all chunks are claimed.
+ *
+ * If the predecessor's inclusive prefix is already known when a chunk is
+ * claimed, the chunk is scanned in a single read. Otherwise, the chunk first
+ * publishes its aggregate and looks back for its prefix, and then scans its
+ * elements, which are still cached after computing the aggregate.
+ */
+template<typename Operations>
+class ScanChunkFunctor {
+ public:
+  typedef typename Operations::State State;
+
+  ScanChunkFunctor(const Operations& operations,
+                   ScanLookBack<State>& look_back)
+  : operations_(operations), look_back_(look_back) {
+  }
+
+  void operator()(embb::tasks::TaskContext&) {
+    for (size_t chunk = look_back_.Claim(); chunk < look_back_.Size();
+         chunk = look_back_.Claim()) {
+      size_t first = look_back_.First(chunk);
+      size_t last = look_back_.Last(chunk);
+      if (chunk == 0) {
+        look_back_.PublishInclusive(chunk,
+          operations_.Write(first, last, NULL));
+      } else if (look_back_.IsInclusive(chunk - 1)) {
+        State prefix(look_back_.Inclusive(chunk - 1));
+        look_back_.PublishInclusive(chunk,
+          operations_.Write(first, last, &prefix));
+      } else {
+        State aggregate(operations_.Aggregate(first, last));
+        look_back_.PublishAggregate(chunk, aggregate);
+        State prefix(look_back_.LookBack(chunk, operations_));
+        look_back_.PublishInclusive(chunk,
+          operations_.Combine(prefix, aggregate));
+        operations_.Write(first, last, &prefix);
+      }
     }
   }
 
+ private:
+  Operations operations_;
+  ScanLookBack<State>& look_back_;
+
+  ScanChunkFunctor& operator=(const ScanChunkFunctor&);
+};
+
+/**
+ * Operations of an inclusive or exclusive scan.
+ */
+template<typename RAIIn, typename RAIOut, typename ReturnType,
+         typename ScanFunction, typename TransformationFunction>
+class ScanOperations {
+ public:
+  typedef ReturnType State;
+
+  ScanOperations(RAIIn first, RAIOut output_first, ReturnType neutral,
+                 ScanFunction scan, TransformationFunction transformation,
+                 bool exclusive)
+  : first_(first), output_first_(output_first), neutral_(neutral),
+    scan_(scan), transformation_(transformation), exclusive_(exclusive) {
+  }
+
+  State Neutral() const {
+    return neutral_;
+  }
+
+  bool IsComplete(const State&) const {
+    return false;
+  }
+
+  State Combine(const State& earlier, const State& later) {
+    return scan_(earlier, later);
+  }
+
   /**
-   * Disables assignment.
+   * Returns the aggregate of the elements with indices
+   * <tt>[first,last)</tt>.
    */
-  ScanFunctor& operator=(const ScanFunctor&);
+  State Aggregate(size_t first, size_t last) {
+    RAIIn input = first_ + static_cast<difference_type>(first);
+    State result = transformation_(*input);
+    for (size_t i = first + 1; i < last; i++) {
+      ++input;
+      result = scan_(result, transformation_(*input));
+    }
+    return result;
+  }
 
   /**
-   * Disables copying.
+   * Writes the scanned elements with indices <tt>[first,last)</tt>, given the
+   * exclusive \c prefix of the first element, if there is one. Returns the
+   * inclusive prefix of the last element. Each element is read before its
+   * output is written, which allows scanning in-place.
    */
-  ScanFunctor(const ScanFunctor&);
+  State Write(size_t first, size_t last, const State* prefix) {
+    RAIIn input = first_ + static_cast<difference_type>(first);
+    RAIOut output = output_first_ + static_cast<difference_type>(first);
+    State running(neutral_);
+    if (prefix == NULL) {
+      running = transformation_(*input);
+      *output = exclusive_ ? neutral_ : running;
+    } else if (exclusive_) {
+      running = transformation_(*input);
+      *output = *prefix;
+      running = scan_(*prefix, running);
+    } else {
+      running = scan_(*prefix, transformation_(*input));
+      *output = running;
+    }
+    for (size_t i = first + 1; i < last; i++) {
+      ++input;
+      ++output;
+      if (exclusive_) {
+        State value(transformation_(*input));
+        *output = running;
+        running = scan_(running, value);
+      } else {
+        running = scan_(running, transformation_(*input));
+        *output = running;
+      }
+    }
+    return running;
+  }
+
+ private:
+  typedef typename std::iterator_traits<RAIIn>::difference_type
+    difference_type;
+
+  RAIIn first_;
+  RAIOut output_first_;
+  ReturnType neutral_;
+  ScanFunction scan_;
+  TransformationFunction transformation_;
+  bool exclusive_;
+
+  ScanOperations& operator=(const ScanOperations&);
 };
 
-template<typename RAIIn, typename RAIOut, typename ReturnType,
-typename ScanFunction, typename TransformationFunction>
-void ScanIteratorCheck(RAIIn first, RAIIn last, RAIOut output_iterator,
-                       ReturnType neutral, ScanFunction scan,
-                       TransformationFunction transformation,
-                       const embb::tasks::ExecutionPolicy& policy,
-                       size_t block_size,
-                       std::random_access_iterator_tag) {
+/**
+ * Prefix of a segmented scan: the scanned value, and whether a segment starts
+ * within the prefix, which makes any earlier elements irrelevant.
+ */
+template<typename ReturnType>
+struct SegmentedScanState {
+  SegmentedScanState(bool starts_segment_value, const ReturnType& value_value)
+  : starts_segment(starts_segment_value), value(value_value) {}
+  bool starts_segment;
+  ReturnType value;
+};
+
+/**
+ * Operations of an inclusive segmented scan.
+ */
+template<typename RAIIn, typename RAIFlags, typename RAIOut,
+         typename ReturnType, typename ScanFunction,
+         typename TransformationFunction>
+class SegmentedScanOperations {
+ public:
+  typedef SegmentedScanState<ReturnType> State;
+
+  SegmentedScanOperations(RAIIn first, RAIFlags flags_first,
+                          RAIOut output_first, ReturnType neutral,
+                          ScanFunction scan,
+                          TransformationFunction transformation)
+  : first_(first), flags_first_(flags_first), output_first_(output_first),
+    neutral_(neutral), scan_(scan), transformation_(transformation) {
+  }
+
+  State Neutral() const {
+    return State(false, neutral_);
+  }
+
+  bool IsComplete(const State& state) const {
+    return state.starts_segment;
+  }
+
+  State Combine(const State& earlier, const State& later) {
+    if (later.starts_segment) {
+      return later;
+    }
+    return State(earlier.starts_segment, scan_(earlier.value, later.value));
+  }
+
+  State Aggregate(size_t first, size_t last) {
+    RAIIn input = first_ + static_cast<difference_type>(first);
+    RAIFlags flag = flags_first_ + static_cast<difference_type>(first);
+    State result(*flag ? true : false, transformation_(*input));
+    for (size_t i = first + 1; i < last; i++) {
+      ++input;
+      ++flag;
+      if (*flag) {
+        result.starts_segment = true;
+        result.value = transformation_(*input);
+      } else {
+        result.value = scan_(result.value, transformation_(*input));
+      }
+    }
+    return result;
+  }
+
+  State Write(size_t first, size_t last, const State* prefix) {
+    RAIIn input = first_ + static_cast<difference_type>(first);
+    RAIFlags flag = flags_first_ + static_cast<difference_type>(first);
+    RAIOut output = output_first_ + static_cast<difference_type>(first);
+    State running(Neutral());
+    if (prefix == NULL || *flag) {
+      running.starts_segment = true;
+      running.value = transformation_(*input);
+    } else {
+      running.starts_segment = prefix->starts_segment;
+      running.value = scan_(prefix->value, transformation_(*input));
+    }
+    *output = running.value;
+    for (size_t i = first + 1; i < last; i++) {
+      ++input;
+      ++flag;
+      ++output;
+      if (*flag) {
+        running.starts_segment = true;
+        running.value = transformation_(*input);
+      } else {
+        running.value = scan_(running.value, transformation_(*input));
+      }
+      *output = running.value;
+    }
+    return running;
+  }
+
+ private:
+  typedef typename std::iterator_traits<RAIIn>::difference_type
+    difference_type;
+
+  RAIIn first_;
+  RAIFlags flags_first_;
+  RAIOut output_first_;
+  ReturnType neutral_;
+  ScanFunction scan_;
+  TransformationFunction transformation_;
+
+  SegmentedScanOperations& operator=(const SegmentedScanOperations&);
+};
+
+/**
+ * Checks the range and policy common to all scans. Returns the number of
+ * elements, or 0 if there is nothing to do.
+ */
+template<typename RAIIn>
+size_t ScanCheck(RAIIn first, RAIIn last,
+                 const embb::tasks::ExecutionPolicy& policy,
+                 std::random_access_iterator_tag) {
   typedef typename std::iterator_traits<RAIIn>::difference_type difference_type;
   difference_type distance = std::distance(first, last);
   if (distance == 0) {
-    return;
+    return 0;
   } else if (distance < 0) {
     EMBB_THROW(embb::base::ErrorException, "Negative range for Scan");
   }
-  unsigned int num_cores = policy.GetCoreCount();
-  if (num_cores == 0) {
+  if (policy.GetCoreCount() == 0) {
     EMBB_THROW(embb::base::ErrorException, "No cores in execution policy");
   }
+  return static_cast<size_t>(distance);
+}
 
-  ReturnType values[MTAPI_NODE_MAX_TASKS_DEFAULT];
+/**
+ * Runs a single-pass scan over \c count elements and returns the inclusive
+ * prefix of the last element.
+ */
+template<typename Operations>
+typename Operations::State ScanChunked(
+  const Operations& operations, size_t count,
+  const embb::tasks::ExecutionPolicy& policy, size_t block_size) {
+  typedef typename Operations::State State;
+  unsigned int num_cores = policy.GetCoreCount();
   if (block_size == 0) {
-    block_size = static_cast<size_t>(distance) / num_cores;
-    if (block_size == 0) {
-      block_size = 1;
+    // Chunks stay cached between computing their aggregate and writing
+    // them, and there are a few chunks per core to balance the load.
+    const size_t min_chunk_size = 256;
+    const size_t max_chunk_size = 8192;
+    block_size = count / (static_cast<size_t>(num_cores) * 4);
+    if (block_size < min_chunk_size) {
+      block_size = min_chunk_size;
+    } else if (block_size > max_chunk_size) {
+      block_size = max_chunk_size;
     }
   }
-  if (((distance / block_size) * 2) + 1 > MTAPI_NODE_MAX_TASKS_DEFAULT) {
-    EMBB_THROW(embb::base::ErrorException,
-               "Not enough MTAPI tasks available for parallel scan");
-  }
-
-  // first pass. Calculates prefix sums for leaves and when recursion returns
-  // it creates the tree.
-  typedef ScanFunctor<RAIIn, RAIOut, ReturnType, ScanFunction,
-                      TransformationFunction> Functor;
-  embb::tasks::Node& node = embb::tasks::Node::GetInstance();
-
-  BlockSizePartitioner<RAIIn> partitioner_down(first, last, block_size);
-  Functor functor_down(0, partitioner_down.Size() - 1, output_iterator,
-                       neutral, scan, transformation, policy, partitioner_down,
-                       values, 0, true);
-  embb::tasks::Task task_down = node.Spawn(embb::tasks::Action(
-    base::MakeFunction(functor_down, &Functor::Action), policy));
-  task_down.Wait(MTAPI_INFINITE);
-
-  // Second pass. Gives to each leaf the part of the prefix missing
-  BlockSizePartitioner<RAIIn> partitioner_up(first, last, block_size);
-  Functor functor_up(0, partitioner_up.Size() - 1, output_iterator,
-                     neutral, scan, transformation, policy, partitioner_up,
-                     values, 0, false);
-  embb::tasks::Task task_up = node.Spawn(embb::tasks::Action(
-    base::MakeFunction(functor_up, &Functor::Action), policy));
-  task_up.Wait(MTAPI_INFINITE);
+  ScanLookBack<State> look_back(count, block_size, operations.Neutral());
+  size_t tasks = look_back.Size();
+  if (tasks > num_cores) {
+    tasks = num_cores;
+  }
+  embb::tasks::TaskGroup group;
+  for (size_t task = 0; task < tasks; task++) {
+    group.Spawn(embb::tasks::Action(
+      ScanChunkFunctor<Operations>(operations, look_back), policy));
+  }
+  group.Sync();
+  return look_back.Inclusive(look_back.Size() - 1);
 }
 
 }  // namespace internal
@@ -227,8 +493,54 @@ void Scan(RAIIn first, RAIIn last, RAIOut output_iterator, ReturnType neutral,
           ScanFunction scan, TransformationFunction transformation,
           const embb::tasks::ExecutionPolicy& policy, size_t block_size) {
   typedef typename std::iterator_traits<RAIIn>::iterator_category category;
-  internal::ScanIteratorCheck(first, last, output_iterator, neutral,
-      scan, transformation, policy, block_size, category());
+  size_t count = internal::ScanCheck(first, last, policy, category());
+  if (count == 0) {
+    return;
+  }
+  internal::ScanChunked(
+    internal::ScanOperations<RAIIn, RAIOut, ReturnType, ScanFunction,
+                             TransformationFunction>(
+      first, output_iterator, neutral, scan, transformation, false),
+    count, policy, block_size);
+}
+
+template<typename RAIIn, typename RAIOut, typename ReturnType,
+         typename ScanFunction, typename TransformationFunction>
+void ExclusiveScan(RAIIn first, RAIIn last, RAIOut output_iterator,
+                   ReturnType neutral, ScanFunction scan,
+                   TransformationFunction transformation,
+                   const embb::tasks::ExecutionPolicy& policy,
+                   size_t block_size) {
+  typedef typename std::iterator_traits<RAIIn>::iterator_category category;
+  size_t count = internal::ScanCheck(first, last, policy, category());
+  if (count == 0) {
+    return;
+  }
+  internal::ScanChunked(
+    internal::ScanOperations<RAIIn, RAIOut, ReturnType, ScanFunction,
+                             TransformationFunction>(
+      first, output_iterator, neutral, scan, transformation, true),
+    count, policy, block_size);
+}
+
+template<typename RAIIn, typename RAIFlags, typename RAIOut,
+         typename ReturnType, typename ScanFunction,
+         typename TransformationFunction>
+void SegmentedScan(RAIIn first, RAIIn last, RAIFlags flags_first,
+                   RAIOut output_iterator, ReturnType neutral,
+                   ScanFunction scan, TransformationFunction transformation,
+                   const embb::tasks::ExecutionPolicy& policy,
+                   size_t block_size) {
+  typedef typename std::iterator_traits<RAIIn>::iterator_category category;
+  size_t count = internal::ScanCheck(first, last, policy, category());
+  if (count == 0) {
+    return;
+  }
+  internal::ScanChunked(
+    internal::SegmentedScanOperations<RAIIn, RAIFlags, RAIOut, ReturnType,
+                                      ScanFunction, TransformationFunction>(
+      first, flags_first, output_iterator, neutral, scan, transformation),
+    count, policy, block_size);
 }
 
 }  // namespace algorithms
@@ -0,0 +1,331 @@
+/*
+ * Copyright (c) 2014-2015, Siemens AG. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef EMBB_ALGORITHMS_INTERNAL_SELECTION_INL_H_
+#define EMBB_ALGORITHMS_INTERNAL_SELECTION_INL_H_
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include <embb/base/exceptions.h>
+#include <embb/tasks/tasks.h>
+#include <embb/algorithms/internal/partition.h>
+#include <embb/algorithms/internal/thread_private.h>
+#include <embb/algorithms/quick_sort.h>
+#include <embb/algorithms/transform.h>
+
+namespace embb {
+namespace algorithms {
+namespace internal {
+
+/**
+ * TopK() collects the elements in private heaps if \c k is at most the
+ * number of elements divided by this value. Otherwise, most elements would
+ * enter the heaps and selecting them by partitioning is faster.
+ */
+const size_t kTopKHeapRatio = 16;
+
+template <typename RAI, typename ComparisonFunction>
+class NthElementFunctor {
+ public:
+  NthElementFunctor(RAI first, RAI nth, RAI last,
+                    ComparisonFunction comparison,
+                    const embb::tasks::ExecutionPolicy& policy,
+                    size_t block_size, size_t partition_grain)
+  : first_(first), nth_(nth), last_(last), comparison_(comparison),
+    policy_(policy), block_size_(block_size),
+    partition_grain_(partition_grain) {
+  }
+
+  /**
+   * Partitions the range around pivots until the part containing the n-th
+   * element is small enough to be processed sequentially.
+   */
+  void Action(embb::tasks::TaskContext&) {
+    typedef typename std::iterator_traits<RAI>::difference_type
+      difference_type;
+    // Only the partitioning of the quick sort functor is used
+    AutoPartitioner partitioner(static_cast<size_t>(last_ - first_),
+                                block_size_, policy_);
+    QuickSortFunctor<RAI, ComparisonFunction> quick_sort(first_, last_,
+      comparison_, policy_, partitioner, partition_grain_);
+    RAI first = first_;
+    RAI last = last_;
+    while (last - first > static_cast<difference_type>(block_size_)) {
+      RAI mid = quick_sort.Partition(first, last);
+      if (mid == nth_) {
+        return;
+      } else if (nth_ < mid) {
+        last = mid;
+      } else {
+        first = mid + 1;
+      }
+    }
+    std::nth_element(first, nth_, last, comparison_);
+  }
+
+ private:
+  RAI first_;
+  RAI nth_;
+  RAI last_;
+  ComparisonFunction comparison_;
+  const embb::tasks::ExecutionPolicy& policy_;
+  size_t block_size_;
+  size_t partition_grain_;
+
+  /**
+   * Disables assignment and copying.
+   */
+  NthElementFunctor& operator=(const NthElementFunctor&);
+  NthElementFunctor(const NthElementFunctor&);
+};
+
+template <typename RAI, typename ComparisonFunction>
+void NthElementIteratorCheck(RAI first, RAI nth, RAI last,
+  ComparisonFunction comparison,
+  const embb::tasks::ExecutionPolicy& policy,
+  size_t block_size,
+  std::random_access_iterator_tag) {
+  typedef typename std::iterator_traits<RAI>::difference_type difference_type;
+  difference_type distance = std::distance(first, last);
+  if (distance < 0) {
+    EMBB_THROW(embb::base::ErrorException, "Negative range for NthElement");
+  }
+  if (nth - first < 0 || last - nth < 0) {
+    EMBB_THROW(embb::base::ErrorException,
+               "Element not inside the range for NthElement");
+  }
+  unsigned int num_cores = policy.GetCoreCount();
+  if (num_cores == 0) {
+    EMBB_THROW(embb::base::ErrorException, "No cores in execution policy");
+  }
+  if (nth == last || distance <= 1) {
+    return;
+  }
+  if (block_size == 0) {
+    block_size = (static_cast<size_t>(distance) / num_cores);
+    if (block_size == 0)
+      block_size = 1;
+  }
+  // Use the same partitioning blocks as QuickSort
+  size_t partition_grain = QuickSortPartitionGrain(
+    static_cast<size_t>(distance), block_size, num_cores);
+  embb::tasks::Node& node = embb::tasks::Node::GetInstance();
+  NthElementFunctor<RAI, ComparisonFunction> functor(
+      first, nth, last, comparison, policy, block_size, partition_grain);
+  embb::tasks::Task task = node.Spawn(embb::tasks::Action(base::MakeFunction(
+      functor, &NthElementFunctor<RAI, ComparisonFunction>::Action), policy));
+  task.Wait(MTAPI_INFINITE);
+}
+
+/**
+ * Bounded heap holding the \c k smallest elements added to it. The largest of
+ * them is at the top, such that most elements can be rejected by a single
+ * comparison once the heap is full.
+ */
+template <typename T>
+class TopKHeap {
+ public:
+  explicit TopKHeap(size_t k)
+  : k_(k) {
+  }
+
+  template <typename ComparisonFunction>
+  void Add(const T& value, ComparisonFunction& comparison) {
+    if (elements_.size() < k_) {
+      elements_.push_back(value);
+      std::push_heap(elements_.begin(), elements_.end(), comparison);
+    } else if (comparison(value, elements_.front())) {
+      std::pop_heap(elements_.begin(), elements_.end(), comparison);
+      elements_.back() = value;
+      std::push_heap(elements_.begin(), elements_.end(), comparison);
+    }
+  }
+
+  const std::vector<T>& GetElements() const {
+    return elements_;
+  }
+
+ private:
+  size_t k_;
+  std::vector<T> elements_;
+};
+
+template <typename RAI, typename ComparisonFunction>
+class TopKFunctor {
+ public:
+  typedef TopKHeap<typename std::iterator_traits<RAI>::value_type> Heap;
+
+  TopKFunctor(RAI first, RAI last, ComparisonFunction comparison,
+              ThreadPrivate<Heap>& heaps,
+              const embb::tasks::ExecutionPolicy& policy,
+              const AutoPartitioner& partitioner)
+  : first_(first), last_(last), comparison_(comparison), heaps_(heaps),
+    policy_(policy), partitioner_(partitioner) {
+  }
+
+  void operator()(embb::tasks::TaskContext&) {
+    typedef typename std::iterator_traits<RAI>::difference_type
+      difference_type;
+    embb::tasks::TaskGroup group;
+    RAI first = first_;
+    RAI last = last_;
+    while (first != last) {
+      size_t remaining = static_cast<size_t>(std::distance(first, last));
+      if (partitioner_.ShouldSplit(remaining)) {
+        // Hand the upper half over to a new task:
+        RAI middle = first + static_cast<difference_type>(remaining / 2);
+        group.Spawn(embb::tasks::Action(
+          self_t(middle, last, comparison_, heaps_, policy_, partitioner_),
+          policy_));
+        last = middle;
+      } else {
+        // Add the next grain to the heap of the current thread:
+        size_t grain = partitioner_.GetGrainSize();
+        RAI grain_last = (remaining <= grain) ?
+          last : first + static_cast<difference_type>(grain);
+        Heap& heap = heaps_.Get();
+        for (; first != grain_last; ++first) {
+          heap.Add(*first, comparison_);
+        }
+      }
+    }
+    group.Sync();
+  }
+
+ private:
+  typedef TopKFunctor<RAI, ComparisonFunction> self_t;
+
+  RAI first_;
+  RAI last_;
+  ComparisonFunction comparison_;
+  ThreadPrivate<Heap>& heaps_;
+  const embb::tasks::ExecutionPolicy& policy_;
+  const AutoPartitioner& partitioner_;
+
+  /**
+   * Disables assignment.
+   */
+  TopKFunctor& operator=(const TopKFunctor&);
+};
+
+template <typename RAIIn, typename RAIOut, typename ComparisonFunction>
+RAIOut TopKIteratorCheck(RAIIn first, RAIIn last, RAIOut output, size_t k,
+  ComparisonFunction comparison,
+  const embb::tasks::ExecutionPolicy& policy,
+  size_t block_size,
+  std::random_access_iterator_tag) {
+  typedef typename std::iterator_traits<RAIIn>::value_type value_type;
+  typedef typename std::iterator_traits<RAIIn>::difference_type
+    difference_type;
+  difference_type distance = std::distance(first, last);
+  if (distance < 0) {
+    EMBB_THROW(embb::base::ErrorException, "Negative range for TopK");
+  }
+  unsigned int num_cores = policy.GetCoreCount();
+  if (num_cores == 0) {
+    EMBB_THROW(embb::base::ErrorException, "No cores in execution policy");
+  }
+  size_t count = static_cast<size_t>(distance);
+  if (k > count) {
+    k = count;
+  }
+  if (k == 0) {
+    return output;
+  }
+  std::vector<value_type> selected;
+  if (k <= count / kTopKHeapRatio) {
+    typedef typename TopKFunctor<RAIIn, ComparisonFunction>::Heap Heap;
+    ThreadPrivate<Heap> heaps(k);
+    embb::tasks::Node& node = embb::tasks::Node::GetInstance();
+    AutoPartitioner partitioner(count, block_size, policy);
+    TopKFunctor<RAIIn, ComparisonFunction> functor(first, last, comparison,
+      heaps, policy, partitioner);
+    embb::tasks::Task task = node.Spawn(embb::tasks::Action(functor, policy));
+    task.Wait(MTAPI_INFINITE);
+    // The heaps contain at most k elements per thread, such that merging
+    // them sequentially costs less than collecting them.
+    std::vector<const Heap*> all;
+    heaps.GetAll(all);
+    for (size_t i = 0; i < all.size(); i++) {
+      selected.insert(selected.end(), all[i]->GetElements().begin(),
+                      all[i]->GetElements().end());
+    }
+    std::partial_sort(selected.begin(),
+                      selected.begin() + static_cast<difference_type>(k),
+                      selected.end(), comparison);
+  } else {
+    // The block size refers to the input range, the temporary array is
+    // partitioned automatically.
+    selected.resize(count);
+    Copy(first, last, selected.begin(), policy, 0);
+    PartialSort(selected.begin(),
+                selected.begin() + static_cast<difference_type>(k),
+                selected.end(), comparison, policy, 0);
+  }
+  return Copy(selected.begin(),
+              selected.begin() + static_cast<difference_type>(k), output,
+              policy, 0);
+}
+
+}  // namespace internal
+
+template <typename RAI, typename ComparisonFunction>
+void NthElement(RAI first, RAI nth, RAI last, ComparisonFunction comparison,
+  const embb::tasks::ExecutionPolicy& policy, size_t block_size) {
+  typedef typename std::iterator_traits<RAI>::iterator_category category;
+  internal::NthElementIteratorCheck(first, nth, last, comparison,
+                                    policy, block_size, category());
+}
+
+template <typename RAI, typename ComparisonFunction>
+void PartialSort(RAI first, RAI middle, RAI last,
+  ComparisonFunction comparison,
+  const embb::tasks::ExecutionPolicy& policy, size_t block_size) {
+  if (middle - first < 0 || last - middle < 0) {
+    EMBB_THROW(embb::base::ErrorException,
+               "Element not inside the range for PartialSort");
+  }
+  // Selecting the smallest elements also checks the range and the policy
+  NthElement(first, middle, last, comparison, policy, block_size);
+  QuickSort(first, middle, comparison, policy, block_size);
+}
+
+template <typename RAIIn, typename RAIOut, typename ComparisonFunction>
+RAIOut TopK(RAIIn first, RAIIn last, RAIOut output, size_t k,
+  ComparisonFunction comparison,
+  const embb::tasks::ExecutionPolicy& policy, size_t block_size) {
+  typedef typename std::iterator_traits<RAIIn>::iterator_category category;
+  return internal::TopKIteratorCheck(first, last, output, k, comparison,
+                                     policy, block_size, category());
+}
+
+}  // namespace algorithms
+}  // namespace embb
+
+#endif  // EMBB_ALGORITHMS_INTERNAL_SELECTION_INL_H_
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2014-2015, Siemens AG. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef EMBB_ALGORITHMS_INTERNAL_THREAD_PRIVATE_H_
+#define EMBB_ALGORITHMS_INTERNAL_THREAD_PRIVATE_H_
+
+#include <vector>
+
+#include <embb/base/c/internal/thread_index.h>
+#include <embb/base/exceptions.h>
+#include <embb/base/memory_allocation.h>
+#include <embb/base/thread.h>
+
+namespace embb {
+namespace algorithms {
+namespace internal {
+
+/**
+ * Holds private instances of \c T for the threads, indexed by their internal
+ * thread indices. The instance of a thread is created with the given argument
+ * when the thread first accesses it, and only that thread accesses it until
+ * the parallel computation has finished.
+ */
+template<typename T, typename Argument = size_t>
+class ThreadPrivate {
+ public:
+  explicit ThreadPrivate(const Argument& argument)
+  : argument_(argument),
+    slot_count_(embb::base::Thread::GetThreadsMaxCount()),
+    slots_(static_cast<T**>(embb::base::Allocation::Allocate(
+      slot_count_ * sizeof(T*)))) {
+    for (size_t i = 0; i < slot_count_; i++) {
+      slots_[i] = NULL;
+    }
+  }
+
+  ~ThreadPrivate() {
+    for (size_t i = 0; i < slot_count_; i++) {
+      if (slots_[i] != NULL) {
+        embb::base::Allocation::Delete(slots_[i]);
+      }
+    }
+    embb::base::Allocation::Free(slots_);
+  }
+
+  /**
+   * Returns the private instance of the current thread.
+   */
+  T& Get() {
+    unsigned int index;
+    if (embb_internal_thread_index(&index) != EMBB_SUCCESS ||
+        index >= slot_count_) {
+      EMBB_THROW(embb::base::ErrorException,
+                 "Could not get thread index for private storage");
+    }
+    if (slots_[index] == NULL) {
+      slots_[index] = embb::base::Allocation::New<T>(argument_);
+    }
+    return *slots_[index];
+  }
+
+  /**
+   * Returns the private instances of all threads that accessed theirs.
+   */
+  void GetAll(std::vector<const T*>& all) const {
+    for (size_t i = 0; i < slot_count_; i++) {
+      if (slots_[i] != NULL) {
+        all.push_back(slots_[i]);
+      }
+    }
+  }
+
+ private:
+  Argument argument_;
+  size_t slot_count_;
+  T** slots_;
+
+  /**
+   * Disables copying and assignment.
+   */
+  ThreadPrivate(const ThreadPrivate&);
+  ThreadPrivate& operator=(const ThreadPrivate&);
+};
+
+}  // namespace internal
+}  // namespace algorithms
+}  // namespace embb
+
+#endif  // EMBB_ALGORITHMS_INTERNAL_THREAD_PRIVATE_H_
@@ -0,0 +1,588 @@
+/*
+ * Copyright (c) 2014-2015, Siemens AG. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef EMBB_ALGORITHMS_INTERNAL_TRANSFORM_INL_H_
+#define EMBB_ALGORITHMS_INTERNAL_TRANSFORM_INL_H_
+
+#include <stdint.h>
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <vector>
+
+#include <embb/base/internal/config.h>
+#include <embb/base/exceptions.h>
+#include <embb/tasks/tasks.h>
+#include <embb/algorithms/internal/partition.h>
+
+#ifdef EMBB_PLATFORM_ARCH_X86_64
+#include <emmintrin.h>
+#endif
+
+namespace embb {
+namespace algorithms {
+
+namespace internal {
+
+/**
+ * Outputs of at least this many bytes are written with non-temporal stores,
+ * if supported. Outputs this large do not fit into the last level cache of
+ * most processors, such that caching them would only evict other data.
+ */
+const size_t kTransformStreamingBytes = 16 * 1024 * 1024;
+
+template<typename Type1, typename Type2>
+struct TransformIsSame {
+  static const bool value = false;
+};
+
+template<typename Type>
+struct TransformIsSame<Type, Type> {
+  static const bool value = true;
+};
+
+/**
+ * Determines whether the elements referenced by an iterator are stored
+ * contiguously in memory, which is the case for pointers and iterators of
+ * vectors other than <tt>std::vector<bool></tt>.
+ */
+template<typename RAI>
+struct TransformIsContiguous {
+  typedef typename std::iterator_traits<RAI>::value_type value_type;
+  static const bool value =
+    TransformIsSame<RAI, value_type*>::value ||
+    TransformIsSame<RAI, const value_type*>::value ||
+    (!TransformIsSame<value_type, bool>::value &&
+     (TransformIsSame<RAI, typename std::vector<value_type>::iterator>::value ||
+      TransformIsSame<RAI,
+        typename std::vector<value_type>::const_iterator>::value));
+};
+
+/**
+ * Determines whether an output range can be written with non-temporal stores,
+ * which requires contiguous elements of an arithmetic type whose size divides
+ * the size of a vector register. For copies, the input range must consist of
+ * contiguous elements of the same type.
+ */
+template<typename RAIOut, typename RAIIn = RAIOut>
+struct TransformIsStreamable {
+  typedef typename std::iterator_traits<RAIOut>::value_type value_type;
+  static const bool value =
+#ifdef EMBB_PLATFORM_ARCH_X86_64
+    TransformIsContiguous<RAIOut>::value &&
+    TransformIsContiguous<RAIIn>::value &&
+    TransformIsSame<value_type,
+      typename std::iterator_traits<RAIIn>::value_type>::value &&
+    std::numeric_limits<value_type>::is_specialized &&
+    !TransformIsSame<value_type, bool>::value &&
+    sizeof(__m128i) % sizeof(value_type) == 0;
+#else
+    false;
+#endif
+};
+
+#ifdef EMBB_PLATFORM_ARCH_X86_64
+
+/**
+ * Assigns \c value to \c count elements starting at \c output with
+ * non-temporal stores. Elements before the first and after the last complete
+ * vector register are assigned normally.
+ */
+template<typename ValueType>
+void TransformStreamFill(ValueType* output, size_t count,
+                         const ValueType& value) {
+  const size_t vector_size = sizeof(__m128i);
+  const size_t per_vector = vector_size / sizeof(ValueType);
+  size_t index = 0;
+  for (; index < count &&
+    reinterpret_cast<uintptr_t>(output + index) % vector_size != 0; ++index) {
+    output[index] = value;
+  }
+  ValueType pattern[vector_size / sizeof(ValueType)];
+  for (size_t i = 0; i < per_vector; ++i) {
+    pattern[i] = value;
+  }
+  __m128i vector = _mm_loadu_si128(reinterpret_cast<__m128i*>(pattern));
+  for (; index + per_vector <= count; index += per_vector) {
+    _mm_stream_si128(reinterpret_cast<__m128i*>(output + index), vector);
+  }
+  for (; index < count; ++index) {
+    output[index] = value;
+  }
+  // Make the non-temporal stores visible before the task finishes:
+  _mm_sfence();
+}
+
+/**
+ * Copies \c count elements from \c input to \c output with non-temporal
+ * stores. Elements before the first and after the last complete vector
+ * register are copied normally.
+ */
+template<typename ValueType>
+void TransformStreamCopy(const ValueType* input, ValueType* output,
+                         size_t count) {
+  const size_t vector_size = sizeof(__m128i);
+  const size_t per_vector = vector_size / sizeof(ValueType);
+  size_t index = 0;
+  for (; index < count &&
+    reinterpret_cast<uintptr_t>(output + index) % vector_size != 0; ++index) {
+    output[index] = input[index];
+  }
+  for (; index + per_vector <= count; index += per_vector) {
+    _mm_stream_si128(reinterpret_cast<__m128i*>(output + index),
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + index)));
+  }
+  for (; index < count; ++index) {
+    output[index] = input[index];
+  }
+  // Make the non-temporal stores visible before the task finishes:
+  _mm_sfence();
+}
+
+#endif  // EMBB_PLATFORM_ARCH_X86_64
+
+/**
+ * Aligns split points of an output range to cache lines. For output ranges
+ * that are not contiguous in memory, split points are not changed.
+ */
+template<typename RAI, bool IsContiguous = TransformIsContiguous<RAI>::value>
+class TransformAlignment {
+ public:
+  explicit TransformAlignment(RAI) {}
+
+  /**
+   * Returns the largest index not above \c index, at which the output range
+   * starts a new cache line.
+   */
+  size_t Align(size_t index) const {
+    return index;
+  }
+};
+
+template<typename RAI>
+class TransformAlignment<RAI, true> {
+ public:
+  /**
+   * Constructs the alignment of a non-empty output range.
+   */
+  explicit TransformAlignment(RAI output)
+  : offset_(0), line_elements_(1) {
+    typedef typename std::iterator_traits<RAI>::value_type value_type;
+    const size_t line_size = EMBB_PLATFORM_CACHE_LINE_SIZE;
+    const size_t element_size = sizeof(value_type);
+    if (element_size < line_size && line_size % element_size == 0) {
+      size_t misalignment =
+        static_cast<size_t>(reinterpret_cast<uintptr_t>(&*output) % line_size);
+      if (misalignment % element_size == 0) {
+        offset_ = ((line_size - misalignment) % line_size) / element_size;
+        line_elements_ = line_size / element_size;
+      }
+    }
+  }
+
+  size_t Align(size_t index) const {
+    if (index <= offset_) {
+      return index;
+    }
+    return index - (index - offset_) % line_elements_;
+  }
+
+ private:
+  /** Index of the first element at the start of a cache line */
+  size_t offset_;
+  /** Number of elements per cache line */
+  size_t line_elements_;
+};
+
+/**
+ * Applies a kernel to a range of indices, which is split lazily like in
+ * ForEach(). Split points are aligned to the cache lines of the output range
+ * whenever the resulting parts are not empty.
+ */
+template<typename Kernel, typename Alignment>
+class TransformFunctor {
+ public:
+  TransformFunctor(size_t first, size_t last, const Kernel& kernel,
+                   const Alignment& alignment,
+                   const embb::tasks::ExecutionPolicy& policy,
+                   const AutoPartitioner& partitioner)
+  : first_(first), last_(last), kernel_(kernel), alignment_(alignment),
+    policy_(policy), partitioner_(partitioner) {
+  }
+
+  void operator()(embb::tasks::TaskContext&) {
+    embb::tasks::TaskGroup group;
+    size_t first = first_;
+    size_t last = last_;
+    while (first != last) {
+      size_t remaining = last - first;
+      if (partitioner_.ShouldSplit(remaining)) {
+        // Hand the upper half over to a new task:
+        size_t middle = Split(first, first + remaining / 2);
+        group.Spawn(embb::tasks::Action(
+          self_t(middle, last, kernel_, alignment_, policy_, partitioner_),
+          policy_));
+        last = middle;
+      } else {
+        // Do work on the next grain:
+        size_t grain = partitioner_.GetGrainSize();
+        size_t grain_last = (remaining <= grain) ?
+          last : Split(first, first + grain);
+        kernel_(first, grain_last);
+        first = grain_last;
+      }
+    }
+    group.Sync();
+  }
+
+ private:
+  typedef TransformFunctor<Kernel, Alignment> self_t;
+
+  /**
+   * Aligns the split point \c index if this leaves elements before it.
+   */
+  size_t Split(size_t first, size_t index) const {
+    size_t aligned = alignment_.Align(index);
+    return (aligned > first) ? aligned : index;
+  }
+
+  size_t first_;
+  size_t last_;
+  Kernel kernel_;
+  Alignment alignment_;
+  const embb::tasks::ExecutionPolicy& policy_;
+  const AutoPartitioner& partitioner_;
+
+  /**
+   * Disables assignment.
+   */
+  TransformFunctor& operator=(const TransformFunctor&);
+};
+
+template<typename RAIIn, typename RAIOut, typename UnaryFunction>
+class TransformUnaryKernel {
+ public:
+  TransformUnaryKernel(RAIIn input, RAIOut output, UnaryFunction unary)
+  : input_(input), output_(output), unary_(unary) {
+  }
+
+  void operator()(size_t first, size_t last) {
+    RAIIn input = input_ +
+      static_cast<typename std::iterator_traits<RAIIn>::difference_type>(first);
+    RAIOut output = output_ +
+      static_cast<typename std::iterator_traits<RAIOut>::difference_type>(
+        first);
+    for (; first != last; ++first, ++input, ++output) {
+      *output = unary_(*input);
+    }
+  }
+
+ private:
+  RAIIn input_;
+  RAIOut output_;
+  UnaryFunction unary_;
+};
+
+template<typename RAIIn1, typename RAIIn2, typename RAIOut,
+         typename BinaryFunction>
+class TransformBinaryKernel {
+ public:
+  TransformBinaryKernel(RAIIn1 input1, RAIIn2 input2, RAIOut output,
+                        BinaryFunction binary)
+  : input1_(input1), input2_(input2), output_(output), binary_(binary) {
+  }
+
+  void operator()(size_t first, size_t last) {
+    RAIIn1 input1 = input1_ +
+      static_cast<typename std::iterator_traits<RAIIn1>::difference_type>(
+        first);
+    RAIIn2 input2 = input2_ +
+      static_cast<typename std::iterator_traits<RAIIn2>::difference_type>(
+        first);
+    RAIOut output = output_ +
+      static_cast<typename std::iterator_traits<RAIOut>::difference_type>(
+        first);
+    for (; first != last; ++first, ++input1, ++input2, ++output) {
+      *output = binary_(*input1, *input2);
+    }
+  }
+
+ private:
+  RAIIn1 input1_;
+  RAIIn2 input2_;
+  RAIOut output_;
+  BinaryFunction binary_;
+};
+
+template<typename RAI, typename Generator>
+class TransformGenerateKernel {
+ public:
+  TransformGenerateKernel(RAI output, Generator generator)
+  : output_(output), generator_(generator) {
+  }
+
+  void operator()(size_t first, size_t last) {
+    RAI output = output_ +
+      static_cast<typename std::iterator_traits<RAI>::difference_type>(first);
+    for (; first != last; ++first, ++output) {
+      *output = generator_();
+    }
+  }
+
+ private:
+  RAI output_;
+  Generator generator_;
+};
+
+template<typename RAI, typename ValueType,
+         bool IsStreamable = TransformIsStreamable<RAI>::value>
+class TransformFillKernel {
+ public:
+  TransformFillKernel(RAI output, const ValueType& value, bool)
+  : output_(output), value_(value) {
+  }
+
+  void operator()(size_t first, size_t last) {
+    typedef typename std::iterator_traits<RAI>::difference_type
+      difference_type;
+    std::fill(output_ + static_cast<difference_type>(first),
+              output_ + static_cast<difference_type>(last), value_);
+  }
+
+ private:
+  RAI output_;
+  const ValueType& value_;
+
+  /**
+   * Disables assignment.
+   */
+  TransformFillKernel& operator=(const TransformFillKernel&);
+};
+
+#ifdef EMBB_PLATFORM_ARCH_X86_64
+
+template<typename RAI, typename ValueType>
+class TransformFillKernel<RAI, ValueType, true> {
+ public:
+  typedef typename std::iterator_traits<RAI>::value_type value_type;
+
+  TransformFillKernel(RAI output, const ValueType& value, bool stream)
+  : output_(&*output), value_(static_cast<value_type>(value)),
+    stream_(stream) {
+  }
+
+  void operator()(size_t first, size_t last) {
+    if (stream_) {
+      TransformStreamFill(output_ + first, last - first, value_);
+    } else {
+      std::fill(output_ + first, output_ + last, value_);
+    }
+  }
+
+ private:
+  value_type* output_;
+  value_type value_;
+  bool stream_;
+};
+
+#endif  // EMBB_PLATFORM_ARCH_X86_64
+
+template<typename RAIIn, typename RAIOut,
+         bool IsStreamable = TransformIsStreamable<RAIOut, RAIIn>::value>
+class TransformCopyKernel {
+ public:
+  TransformCopyKernel(RAIIn input, RAIOut output, bool)
+  : input_(input), output_(output) {
+  }
+
+  void operator()(size_t first, size_t last) {
+    typedef typename std::iterator_traits<RAIIn>::difference_type
+      difference_type;
+    std::copy(input_ + static_cast<difference_type>(first),
+              input_ + static_cast<difference_type>(last),
+              output_ + static_cast<
+                typename std::iterator_traits<RAIOut>::difference_type>(first));
+  }
+
+ private:
+  RAIIn input_;
+  RAIOut output_;
+};
+
+#ifdef EMBB_PLATFORM_ARCH_X86_64
+
+template<typename RAIIn, typename RAIOut>
+class TransformCopyKernel<RAIIn, RAIOut, true> {
+ public:
+  typedef typename std::iterator_traits<RAIOut>::value_type value_type;
+
+  TransformCopyKernel(RAIIn input, RAIOut output, bool stream)
+  : input_(&*input), output_(&*output), stream_(stream) {
+  }
+
+  void operator()(size_t first, size_t last) {
+    if (stream_) {
+      TransformStreamCopy(input_ + first, output_ + first, last - first);
+    } else {
+      std::copy(input_ + first, input_ + last, output_ + first);
+    }
+  }
+
+ private:
+  const value_type* input_;
+  value_type* output_;
+  bool stream_;
+};
+
+#endif  // EMBB_PLATFORM_ARCH_X86_64
+
+/**
+ * Returns the number of elements in a range, throwing an exception with
+ * \c message if the range is negative.
+ */
+template<typename RAI>
+size_t TransformDistance(RAI first, RAI last, const char* message,
+                         std::random_access_iterator_tag) {
+  typedef typename std::iterator_traits<RAI>::difference_type difference_type;
+  difference_type distance = std::distance(first, last);
+  if (distance < 0) {
+    EMBB_THROW(embb::base::ErrorException, message);
+  }
+  return static_cast<size_t>(distance);
+}
+
+/**
+ * Returns whether an output range of \c count elements should be written
+ * with non-temporal stores.
+ */
+template<typename RAIOut>
+bool TransformShouldStream(size_t count) {
+  typedef typename std::iterator_traits<RAIOut>::value_type value_type;
+  return count >= kTransformStreamingBytes / sizeof(value_type);
+}
+
+template<typename Kernel, typename RAIOut>
+void TransformRecursive(size_t count, const Kernel& kernel, RAIOut output,
+                        const embb::tasks::ExecutionPolicy& policy,
+                        size_t block_size) {
+  if (count == 0) {
+    return;
+  }
+  unsigned int num_cores = policy.GetCoreCount();
+  if (num_cores == 0) {
+    EMBB_THROW(embb::base::ErrorException, "No cores in execution policy");
+  }
+  typedef TransformAlignment<RAIOut> Alignment;
+  embb::tasks::Node& node = embb::tasks::Node::GetInstance();
+  AutoPartitioner partitioner(count, block_size, policy);
+  TransformFunctor<Kernel, Alignment> functor(0, count, kernel,
+    Alignment(output), policy, partitioner);
+  embb::tasks::Task task = node.Spawn(embb::tasks::Action(functor, policy));
+  task.Wait(MTAPI_INFINITE);
+}
+
+}  // namespace internal
+
+template<typename RAIIn, typename RAIOut, typename UnaryFunction>
+RAIOut Transform(RAIIn first, RAIIn last, RAIOut output, UnaryFunction unary,
+                 const embb::tasks::ExecutionPolicy& policy,
+                 size_t block_size) {
+  typename std::iterator_traits<RAIIn>::iterator_category category;
+  size_t count = internal::TransformDistance(first, last,
+    "Negative range for Transform", category);
+  internal::TransformRecursive(count,
+    internal::TransformUnaryKernel<RAIIn, RAIOut, UnaryFunction>(
+      first, output, unary),
+    output, policy, block_size);
+  return output +
+    static_cast<typename std::iterator_traits<RAIOut>::difference_type>(count);
+}
+
+template<typename RAIIn1, typename RAIIn2, typename RAIOut,
+         typename BinaryFunction>
+RAIOut Transform(RAIIn1 first1, RAIIn1 last1, RAIIn2 first2, RAIOut output,
+                 BinaryFunction binary,
+                 const embb::tasks::ExecutionPolicy& policy,
+                 size_t block_size) {
+  typename std::iterator_traits<RAIIn1>::iterator_category category;
+  size_t count = internal::TransformDistance(first1, last1,
+    "Negative range for Transform", category);
+  internal::TransformRecursive(count,
+    internal::TransformBinaryKernel<RAIIn1, RAIIn2, RAIOut, BinaryFunction>(
+      first1, first2, output, binary),
+    output, policy, block_size);
+  return output +
+    static_cast<typename std::iterator_traits<RAIOut>::difference_type>(count);
+}
+
+template<typename RAI, typename ValueType>
+void Fill(RAI first, RAI last, const ValueType& value,
+          const embb::tasks::ExecutionPolicy& policy, size_t block_size) {
+  typename std::iterator_traits<RAI>::iterator_category category;
+  size_t count = internal::TransformDistance(first, last,
+    "Negative range for Fill", category);
+  if (count == 0) {
+    return;
+  }
+  internal::TransformRecursive(count,
+    internal::TransformFillKernel<RAI, ValueType>(first, value,
+      internal::TransformShouldStream<RAI>(count)),
+    first, policy, block_size);
+}
+
+template<typename RAIIn, typename RAIOut>
+RAIOut Copy(RAIIn first, RAIIn last, RAIOut output,
+            const embb::tasks::ExecutionPolicy& policy, size_t block_size) {
+  typename std::iterator_traits<RAIIn>::iterator_category category;
+  size_t count = internal::TransformDistance(first, last,
+    "Negative range for Copy", category);
+  if (count == 0) {
+    return output;
+  }
+  internal::TransformRecursive(count,
+    internal::TransformCopyKernel<RAIIn, RAIOut>(first, output,
+      internal::TransformShouldStream<RAIOut>(count)),
+    output, policy, block_size);
+  return output +
+    static_cast<typename std::iterator_traits<RAIOut>::difference_type>(count);
+}
+
+template<typename RAI, typename Generator>
+void Generate(RAI first, RAI last, Generator generator,
+              const embb::tasks::ExecutionPolicy& policy, size_t block_size) {
+  typename std::iterator_traits<RAI>::iterator_category category;
+  size_t count = internal::TransformDistance(first, last,
+    "Negative range for Generate", category);
+  internal::TransformRecursive(count,
+    internal::TransformGenerateKernel<RAI, Generator>(first, generator),
+    first, policy, block_size);
+}
+
+}  // namespace algorithms
+}  // namespace embb
+
+#endif  // EMBB_ALGORITHMS_INTERNAL_TRANSFORM_INL_H_
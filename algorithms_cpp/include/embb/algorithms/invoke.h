@@ -27,6 +27,7 @@
 #ifndef EMBB_ALGORITHMS_INVOKE_H_
 #define EMBB_ALGORITHMS_INVOKE_H_
 
+#include <embb/base/exceptions.h>
 #include <embb/base/function.h>
 #include <embb/tasks/tasks.h>
 
@@ -51,7 +52,8 @@ typedef embb::base::Function<void> InvokeFunctionType;
 /**
  * Spawns two to ten function objects at once and runs them in parallel.
  *
- * Blocks until all of them are done.
+ * All but the last function object are spawned as tasks, the last one is run
+ * by the calling thread. Blocks until all of them are done.
  *
  * \ingroup CPP_ALGORITHMS_INVOKE
  */
@@ -67,7 +69,8 @@ void Invoke(
 * Spawns two to ten function objects at once and runs them in parallel using the
 * given embb::mtapi::ExecutionPolicy.
 *
-* Blocks until all of them are done.
+* All but the last function object are spawned as tasks, the last one is run
+* by the calling thread. Blocks until all of them are done.
 *
 * \ingroup CPP_ALGORITHMS_INVOKE
 */
@@ -82,44 +85,69 @@ void Invoke(
   /**< [in] embb::tasks::ExecutionPolicy to use */
   );
 
+/**
+ * Runs an arbitrary number of function objects given as range in parallel.
+ *
+ * All but the last function object are spawned as tasks, the last one is run
+ * by the calling thread. Blocks until all of them are done. Use this instead
+ * of Invoke when the number of function objects exceeds ten or is not known
+ * at compile time.
+ *
+ * \throws embb::base::ErrorException if the range is negative
+ * \see Invoke()
+ * \ingroup CPP_ALGORITHMS_INVOKE
+ * \tparam RAI Random access iterator whose value type is a function object
+ *             callable without arguments, e.g., InvokeFunctionType
+ */
+template<typename RAI>
+void InvokeRange(
+  RAI first,
+  /**< [in] Random access iterator pointing to the first function object */
+  RAI last,
+  /**< [in] Random access iterator pointing to the last plus one function
+            object */
+  const embb::tasks::ExecutionPolicy & policy =
+    embb::tasks::ExecutionPolicy()
+  /**< [in] embb::tasks::ExecutionPolicy to use */
+  );
+
 #else // DOXYGEN
 
 namespace internal {
 
 /**
- * Spawns an MTAPI task on construction and waits for it on destruction.
+ * Runs a function object as child of a TaskGroup.
  */
 template<typename Function>
-class TaskWrapper {
+class InvokeFunctor {
  public:
-  /**
-   * Wraps the function into an embb::tasks::Action and spawns an
-   * embb::tasks::Task.
-   */
-  explicit TaskWrapper(
-    Function function,
-    const embb::tasks::ExecutionPolicy& policy)
-      : function_(function), task_() {
-    embb::tasks::Action action(embb::base::MakeFunction(
-      *this, &TaskWrapper::Run), policy);
-    task_ = embb::tasks::Node::GetInstance().Spawn(action);
+  explicit InvokeFunctor(Function function) : function_(function) {
   }
 
-  /**
-   * Waits until the task has finished execution.
-   */
-  ~TaskWrapper() {
-    task_.Wait(MTAPI_INFINITE);
+  void operator()(embb::tasks::TaskContext&) {
+    function_();
   }
 
  private:
   Function function_;
-  embb::tasks::Task task_;
 
-  void Run(embb::tasks::TaskContext&) {
-    function_();
-  }
+  /**
+   * Disables assignment.
+   */
+  InvokeFunctor& operator=(const InvokeFunctor&);
 };
+
+/**
+ * Spawns a function object into the given TaskGroup.
+ */
+template<typename Function>
+void InvokeSpawn(
+  embb::tasks::TaskGroup& group,
+  Function function,
+  const embb::tasks::ExecutionPolicy& policy) {
+  group.Spawn(embb::tasks::Action(InvokeFunctor<Function>(function), policy));
+}
+
 } // namespace internal
 
 template<typename Function1, typename Function2>
@@ -127,8 +155,10 @@ void Invoke(
   Function1 func1,
   Function2 func2,
   const embb::tasks::ExecutionPolicy& policy) {
-  internal::TaskWrapper<Function1> wrap1(func1, policy);
-  internal::TaskWrapper<Function2> wrap2(func2, policy);
+  embb::tasks::TaskGroup group;
+  internal::InvokeSpawn(group, func1, policy);
+  func2();
+  group.Sync();
 }
 
 template<typename Function1, typename Function2, typename Function3>
@@ -137,44 +167,50 @@ void Invoke(
   Function2 func2,
   Function3 func3,
   const embb::tasks::ExecutionPolicy& policy) {
-  internal::TaskWrapper<Function1> wrap1(func1, policy);
-  internal::TaskWrapper<Function2> wrap2(func2, policy);
-  internal::TaskWrapper<Function3> wrap3(func3, policy);
+  embb::tasks::TaskGroup group;
+  internal::InvokeSpawn(group, func1, policy);
+  internal::InvokeSpawn(group, func2, policy);
+  func3();
+  group.Sync();
 }
 
 template<typename Function1, typename Function2, typename Function3,
   typename Function4>
-  void Invoke(
+void Invoke(
   Function1 func1,
   Function2 func2,
   Function3 func3,
   Function4 func4,
   const embb::tasks::ExecutionPolicy& policy) {
-  internal::TaskWrapper<Function1> wrap1(func1, policy);
-  internal::TaskWrapper<Function2> wrap2(func2, policy);
-  internal::TaskWrapper<Function3> wrap3(func3, policy);
-  internal::TaskWrapper<Function4> wrap4(func4, policy);
+  embb::tasks::TaskGroup group;
+  internal::InvokeSpawn(group, func1, policy);
+  internal::InvokeSpawn(group, func2, policy);
+  internal::InvokeSpawn(group, func3, policy);
+  func4();
+  group.Sync();
 }
 
 template<typename Function1, typename Function2, typename Function3,
   typename Function4, typename Function5>
-  void Invoke(
+void Invoke(
   Function1 func1,
   Function2 func2,
   Function3 func3,
   Function4 func4,
   Function5 func5,
   const embb::tasks::ExecutionPolicy& policy) {
-  internal::TaskWrapper<Function1> wrap1(func1, policy);
-  internal::TaskWrapper<Function2> wrap2(func2, policy);
-  internal::TaskWrapper<Function3> wrap3(func3, policy);
-  internal::TaskWrapper<Function4> wrap4(func4, policy);
-  internal::TaskWrapper<Function5> wrap5(func5, policy);
+  embb::tasks::TaskGroup group;
+  internal::InvokeSpawn(group, func1, policy);
+  internal::InvokeSpawn(group, func2, policy);
+  internal::InvokeSpawn(group, func3, policy);
+  internal::InvokeSpawn(group, func4, policy);
+  func5();
+  group.Sync();
 }
 
 template<typename Function1, typename Function2, typename Function3,
   typename Function4, typename Function5, typename Function6>
-  void Invoke(
+void Invoke(
   Function1 func1,
   Function2 func2,
   Function3 func3,
@@ -182,18 +218,20 @@ template<typename Function1, typename Function2, typename Function3,
   Function5 func5,
   Function6 func6,
   const embb::tasks::ExecutionPolicy& policy) {
-  internal::TaskWrapper<Function1> wrap1(func1, policy);
-  internal::TaskWrapper<Function2> wrap2(func2, policy);
-  internal::TaskWrapper<Function3> wrap3(func3, policy);
-  internal::TaskWrapper<Function4> wrap4(func4, policy);
-  internal::TaskWrapper<Function5> wrap5(func5, policy);
-  internal::TaskWrapper<Function6> wrap6(func6, policy);
+  embb::tasks::TaskGroup group;
+  internal::InvokeSpawn(group, func1, policy);
+  internal::InvokeSpawn(group, func2, policy);
+  internal::InvokeSpawn(group, func3, policy);
+  internal::InvokeSpawn(group, func4, policy);
+  internal::InvokeSpawn(group, func5, policy);
+  func6();
+  group.Sync();
 }
 
 template<typename Function1, typename Function2, typename Function3,
   typename Function4, typename Function5, typename Function6,
   typename Function7>
-  void Invoke(
+void Invoke(
   Function1 func1,
   Function2 func2,
   Function3 func3,
@@ -202,19 +240,21 @@ template<typename Function1, typename Function2, typename Function3,
   Function6 func6,
   Function7 func7,
   const embb::tasks::ExecutionPolicy& policy) {
-  internal::TaskWrapper<Function1> wrap1(func1, policy);
-  internal::TaskWrapper<Function2> wrap2(func2, policy);
-  internal::TaskWrapper<Function3> wrap3(func3, policy);
-  internal::TaskWrapper<Function4> wrap4(func4, policy);
-  internal::TaskWrapper<Function5> wrap5(func5, policy);
-  internal::TaskWrapper<Function6> wrap6(func6, policy);
-  internal::TaskWrapper<Function7> wrap7(func7, policy);
+  embb::tasks::TaskGroup group;
+  internal::InvokeSpawn(group, func1, policy);
+  internal::InvokeSpawn(group, func2, policy);
+  internal::InvokeSpawn(group, func3, policy);
+  internal::InvokeSpawn(group, func4, policy);
+  internal::InvokeSpawn(group, func5, policy);
+  internal::InvokeSpawn(group, func6, policy);
+  func7();
+  group.Sync();
 }
 
 template<typename Function1, typename Function2, typename Function3,
   typename Function4, typename Function5, typename Function6,
   typename Function7, typename Function8>
-  void Invoke(
+void Invoke(
   Function1 func1,
   Function2 func2,
   Function3 func3,
@@ -224,20 +264,22 @@ template<typename Function1, typename Function2, typename Function3,
   Function7 func7,
   Function8 func8,
   const embb::tasks::ExecutionPolicy& policy) {
-  internal::TaskWrapper<Function1> wrap1(func1, policy);
-  internal::TaskWrapper<Function2> wrap2(func2, policy);
-  internal::TaskWrapper<Function3> wrap3(func3, policy);
-  internal::TaskWrapper<Function4> wrap4(func4, policy);
-  internal::TaskWrapper<Function5> wrap5(func5, policy);
-  internal::TaskWrapper<Function6> wrap6(func6, policy);
-  internal::TaskWrapper<Function7> wrap7(func7, policy);
-  internal::TaskWrapper<Function8> wrap8(func8, policy);
+  embb::tasks::TaskGroup group;
+  internal::InvokeSpawn(group, func1, policy);
+  internal::InvokeSpawn(group, func2, policy);
+  internal::InvokeSpawn(group, func3, policy);
+  internal::InvokeSpawn(group, func4, policy);
+  internal::InvokeSpawn(group, func5, policy);
+  internal::InvokeSpawn(group, func6, policy);
+  internal::InvokeSpawn(group, func7, policy);
+  func8();
+  group.Sync();
 }
 
 template<typename Function1, typename Function2, typename Function3,
   typename Function4, typename Function5, typename Function6,
   typename Function7, typename Function8, typename Function9>
-  void Invoke(
+void Invoke(
   Function1 func1,
   Function2 func2,
   Function3 func3,
@@ -248,22 +290,24 @@ template<typename Function1, typename Function2, typename Function3,
   Function8 func8,
   Function9 func9,
   const embb::tasks::ExecutionPolicy& policy) {
-  internal::TaskWrapper<Function1> wrap1(func1, policy);
-  internal::TaskWrapper<Function2> wrap2(func2, policy);
-  internal::TaskWrapper<Function3> wrap3(func3, policy);
-  internal::TaskWrapper<Function4> wrap4(func4, policy);
-  internal::TaskWrapper<Function5> wrap5(func5, policy);
-  internal::TaskWrapper<Function6> wrap6(func6, policy);
-  internal::TaskWrapper<Function7> wrap7(func7, policy);
-  internal::TaskWrapper<Function8> wrap8(func8, policy);
-  internal::TaskWrapper<Function9> wrap9(func9, policy);
+  embb::tasks::TaskGroup group;
+  internal::InvokeSpawn(group, func1, policy);
+  internal::InvokeSpawn(group, func2, policy);
+  internal::InvokeSpawn(group, func3, policy);
+  internal::InvokeSpawn(group, func4, policy);
+  internal::InvokeSpawn(group, func5, policy);
+  internal::InvokeSpawn(group, func6, policy);
+  internal::InvokeSpawn(group, func7, policy);
+  internal::InvokeSpawn(group, func8, policy);
+  func9();
+  group.Sync();
 }
 
 template<typename Function1, typename Function2, typename Function3,
   typename Function4, typename Function5, typename Function6,
   typename Function7, typename Function8, typename Function9,
   typename Function10>
-  void Invoke(
+void Invoke(
   Function1 func1,
   Function2 func2,
   Function3 func3,
@@ -274,17 +318,19 @@ template<typename Function1, typename Function2, typename Function3,
   Function8 func8,
   Function9 func9,
   Function10 func10,
-  const embb::tasks::ExecutionPolicy& policy)  {
-  internal::TaskWrapper<Function1> wrap1(func1, policy);
-  internal::TaskWrapper<Function2> wrap2(func2, policy);
-  internal::TaskWrapper<Function3> wrap3(func3, policy);
-  internal::TaskWrapper<Function4> wrap4(func4, policy);
-  internal::TaskWrapper<Function5> wrap5(func5, policy);
-  internal::TaskWrapper<Function6> wrap6(func6, policy);
-  internal::TaskWrapper<Function7> wrap7(func7, policy);
-  internal::TaskWrapper<Function8> wrap8(func8, policy);
-  internal::TaskWrapper<Function9> wrap9(func9, policy);
-  internal::TaskWrapper<Function10> wrap10(func10, policy);
+  const embb::tasks::ExecutionPolicy& policy) {
+  embb::tasks::TaskGroup group;
+  internal::InvokeSpawn(group, func1, policy);
+  internal::InvokeSpawn(group, func2, policy);
+  internal::InvokeSpawn(group, func3, policy);
+  internal::InvokeSpawn(group, func4, policy);
+  internal::InvokeSpawn(group, func5, policy);
+  internal::InvokeSpawn(group, func6, policy);
+  internal::InvokeSpawn(group, func7, policy);
+  internal::InvokeSpawn(group, func8, policy);
+  internal::InvokeSpawn(group, func9, policy);
+  func10();
+  group.Sync();
 }
 
 template<typename Function1, typename Function2>
@@ -402,6 +448,31 @@ void Invoke(
     embb::tasks::ExecutionPolicy());
 }
 
+template<typename RAI>
+void InvokeRange(
+  RAI first,
+  RAI last,
+  const embb::tasks::ExecutionPolicy& policy) {
+  if (first == last) {
+    return;
+  } else if (last - first < 0) {
+    EMBB_THROW(embb::base::ErrorException, "Negative range for InvokeRange");
+  }
+  embb::tasks::TaskGroup group;
+  for (--last; first != last; ++first) {
+    internal::InvokeSpawn(group, *first, policy);
+  }
+  (*last)();
+  group.Sync();
+}
+
+template<typename RAI>
+void InvokeRange(
+  RAI first,
+  RAI last) {
+  InvokeRange(first, last, embb::tasks::ExecutionPolicy());
+}
+
 #endif // else DOXYGEN
 
 }  // namespace algorithms
@@ -0,0 +1,569 @@
+/*
+ * Copyright (c) 2014-2015, Siemens AG. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef EMBB_ALGORITHMS_MERGE_H_
+#define EMBB_ALGORITHMS_MERGE_H_
+
+#include <functional>
+#include <iterator>
+#include <embb/tasks/execution_policy.h>
+
+namespace embb {
+namespace algorithms {
+
+/**
+ * \defgroup CPP_ALGORITHMS_MERGE Merging
+ * Parallel merging of sorted ranges and set operations on sorted ranges
+ * \ingroup CPP_ALGORITHMS
+ * \{
+ */
+
+#ifdef DOXYGEN
+
+/**
+ * Merges two sorted ranges into a sorted output range in parallel.
+ *
+ * The input ranges consist of the elements from \c first1 to \c last1 and
+ * from \c first2 to \c last2, excluding the last elements. The merge is
+ * stable: of two equivalent elements, the one from the first range is
+ * written first, and equivalent elements from the same range keep their
+ * order. The larger range is split at its middle element and the other range
+ * at the corresponding position found by binary search, which yields
+ * independent merges that are executed as tasks.
+ *
+ * \return Iterator pointing to the last plus one element written to the
+ *         output range
+ * \throws embb::base::ErrorException if a range is negative, the execution
+ *         policy contains no cores, or a task could not be started.
+ * \threadsafe if the elements in the ranges are not modified by another thread
+ *             while the algorithm is executed.
+ * \note The output range must not overlap the input ranges. No guarantee is
+ *       given on the execution order of the comparison operations.
+ * \see SetUnion(), MergeSort(), embb::mtapi::ExecutionPolicy
+ * \tparam RAIIn1 Random access iterator of the first input range
+ * \tparam RAIIn2 Random access iterator of the second input range
+ * \tparam RAIOut Random access iterator of the output range
+ * \tparam ComparisonFunction Binary predicate with both arguments of type
+ *         <tt>std::iterator_traits<RAIIn1>::value_type</tt>.
+ */
+template <typename RAIIn1, typename RAIIn2, typename RAIOut,
+          typename ComparisonFunction>
+RAIOut Merge(
+  RAIIn1 first1,
+  /**< [IN] Random access iterator pointing to the first element of the first
+            input range */
+  RAIIn1 last1,
+  /**< [IN] Random access iterator pointing to the last plus one element of the
+            first input range */
+  RAIIn2 first2,
+  /**< [IN] Random access iterator pointing to the first element of the second
+            input range */
+  RAIIn2 last2,
+  /**< [IN] Random access iterator pointing to the last plus one element of the
+            second input range */
+  RAIOut output,
+  /**< [OUT] Random access iterator pointing to the first element of the
+             output range */
+  ComparisonFunction comparison
+    = std::less<typename std::iterator_traits<RAIIn1>::value_type>(),
+  /**< [IN] Binary predicate establishing the order in which the input ranges
+            are sorted. The default value uses the less-than relation. */
+  const embb::mtapi::ExecutionPolicy& policy = embb::mtapi::ExecutionPolicy(),
+  /**< [IN] embb::mtapi::ExecutionPolicy for the merge */
+  size_t block_size = 0
+  /**< [IN] Lower bound for the number of input elements processed by a
+            task. The default value 0 means that the input ranges are split
+            into about four parts per available core. */
+  );
+
+/**
+ * Computes the union of two sorted ranges in parallel.
+ *
+ * The input ranges consist of the elements from \c first1 to \c last1 and
+ * from \c first2 to \c last2, excluding the last elements. As for
+ * <tt>std::set_union</tt>, an element that is contained \c m times in the
+ * first and \c n times in the second range is contained
+ * <tt>max(m,n)</tt> times in the sorted output range, and equivalent elements
+ * are copied from the first range before the second.
+ *
+ * Both ranges are split by co-ranking: the element at an evenly spaced
+ * position of the merged ranges is located by binary search, and both ranges
+ * are split before the first element equivalent to it. This yields balanced
+ * parts that can be processed independently. The size of the result of each
+ * part is counted in parallel, followed by writing the results in parallel
+ * at their offsets.
+ *
+ * \return Iterator pointing to the last plus one element written to the
+ *         output range
+ * \throws embb::base::ErrorException if a range is negative, the execution
+ *         policy contains no cores, or a task could not be started.
+ * \threadsafe if the elements in the ranges are not modified by another thread
+ *             while the algorithm is executed.
+ * \note The output range must not overlap the input ranges. No guarantee is
+ *       given on the execution order of the comparison operations.
+ * \see SetIntersection(), SetDifference(), Merge(),
+ *      embb::mtapi::ExecutionPolicy
+ * \tparam RAIIn1 Random access iterator of the first input range
+ * \tparam RAIIn2 Random access iterator of the second input range
+ * \tparam RAIOut Random access iterator of the output range
+ * \tparam ComparisonFunction Binary predicate with both arguments of type
+ *         <tt>std::iterator_traits<RAIIn1>::value_type</tt>.
+ */
+template <typename RAIIn1, typename RAIIn2, typename RAIOut,
+          typename ComparisonFunction>
+RAIOut SetUnion(
+  RAIIn1 first1,
+  /**< [IN] Random access iterator pointing to the first element of the first
+            input range */
+  RAIIn1 last1,
+  /**< [IN] Random access iterator pointing to the last plus one element of the
+            first input range */
+  RAIIn2 first2,
+  /**< [IN] Random access iterator pointing to the first element of the second
+            input range */
+  RAIIn2 last2,
+  /**< [IN] Random access iterator pointing to the last plus one element of the
+            second input range */
+  RAIOut output,
+  /**< [OUT] Random access iterator pointing to the first element of the
+             output range */
+  ComparisonFunction comparison
+    = std::less<typename std::iterator_traits<RAIIn1>::value_type>(),
+  /**< [IN] Binary predicate establishing the order in which the input ranges
+            are sorted. The default value uses the less-than relation. */
+  const embb::mtapi::ExecutionPolicy& policy = embb::mtapi::ExecutionPolicy(),
+  /**< [IN] embb::mtapi::ExecutionPolicy for the union */
+  size_t block_size = 0
+  /**< [IN] Lower bound for the number of input elements processed by a
+            task. The default value 0 means that the input ranges are split
+            into about four parts per available core. */
+  );
+
+/**
+ * Computes the intersection of two sorted ranges in parallel.
+ *
+ * The input ranges consist of the elements from \c first1 to \c last1 and
+ * from \c first2 to \c last2, excluding the last elements. As for
+ * <tt>std::set_intersection</tt>, an element that is contained \c m times in
+ * the first and \c n times in the second range is contained
+ * <tt>min(m,n)</tt> times in the sorted output range, copied from the first
+ * range.
+ *
+ * Both ranges are split by co-ranking: the element at an evenly spaced
+ * position of the merged ranges is located by binary search, and both ranges
+ * are split before the first element equivalent to it. This yields balanced
+ * parts that can be processed independently. The size of the result of each
+ * part is counted in parallel, followed by writing the results in parallel
+ * at their offsets.
+ *
+ * \return Iterator pointing to the last plus one element written to the
+ *         output range
+ * \throws embb::base::ErrorException if a range is negative, the execution
+ *         policy contains no cores, or a task could not be started.
+ * \threadsafe if the elements in the ranges are not modified by another thread
+ *             while the algorithm is executed.
+ * \note The output range must not overlap the input ranges. No guarantee is
+ *       given on the execution order of the comparison operations.
+ * \see SetUnion(), SetDifference(), embb::mtapi::ExecutionPolicy
+ * \tparam RAIIn1 Random access iterator of the first input range
+ * \tparam RAIIn2 Random access iterator of the second input range
+ * \tparam RAIOut Random access iterator of the output range
+ * \tparam ComparisonFunction Binary predicate with both arguments of type
+ *         <tt>std::iterator_traits<RAIIn1>::value_type</tt>.
+ */
+template <typename RAIIn1, typename RAIIn2, typename RAIOut,
+          typename ComparisonFunction>
+RAIOut SetIntersection(
+  RAIIn1 first1,
+  /**< [IN] Random access iterator pointing to the first element of the first
+            input range */
+  RAIIn1 last1,
+  /**< [IN] Random access iterator pointing to the last plus one element of the
+            first input range */
+  RAIIn2 first2,
+  /**< [IN] Random access iterator pointing to the first element of the second
+            input range */
+  RAIIn2 last2,
+  /**< [IN] Random access iterator pointing to the last plus one element of the
+            second input range */
+  RAIOut output,
+  /**< [OUT] Random access iterator pointing to the first element of the
+             output range */
+  ComparisonFunction comparison
+    = std::less<typename std::iterator_traits<RAIIn1>::value_type>(),
+  /**< [IN] Binary predicate establishing the order in which the input ranges
+            are sorted. The default value uses the less-than relation. */
+  const embb::mtapi::ExecutionPolicy& policy = embb::mtapi::ExecutionPolicy(),
+  /**< [IN] embb::mtapi::ExecutionPolicy for the intersection */
+  size_t block_size = 0
+  /**< [IN] Lower bound for the number of input elements processed by a
+            task. The default value 0 means that the input ranges are split
+            into about four parts per available core. */
+  );
+
+/**
+ * Computes the difference of two sorted ranges in parallel.
+ *
+ * The input ranges consist of the elements from \c first1 to \c last1 and
+ * from \c first2 to \c last2, excluding the last elements. As for
+ * <tt>std::set_difference</tt>, an element that is contained \c m times in
+ * the first and \c n times in the second range is contained
+ * <tt>max(m-n,0)</tt> times in the sorted output range, copied from the first
+ * range.
+ *
+ * Both ranges are split by co-ranking: the element at an evenly spaced
+ * position of the merged ranges is located by binary search, and both ranges
+ * are split before the first element equivalent to it. This yields balanced
+ * parts that can be processed independently. The size of the result of each
+ * part is counted in parallel, followed by writing the results in parallel
+ * at their offsets.
+ *
+ * \return Iterator pointing to the last plus one element written to the
+ *         output range
+ * \throws embb::base::ErrorException if a range is negative, the execution
+ *         policy contains no cores, or a task could not be started.
+ * \threadsafe if the elements in the ranges are not modified by another thread
+ *             while the algorithm is executed.
+ * \note The output range must not overlap the input ranges. No guarantee is
+ *       given on the execution order of the comparison operations.
+ * \see SetUnion(), SetIntersection(), embb::mtapi::ExecutionPolicy
+ * \tparam RAIIn1 Random access iterator of the first input range
+ * \tparam RAIIn2 Random access iterator of the second input range
+ * \tparam RAIOut Random access iterator of the output range
+ * \tparam ComparisonFunction Binary predicate with both arguments of type
+ *         <tt>std::iterator_traits<RAIIn1>::value_type</tt>.
+ */
+template <typename RAIIn1, typename RAIIn2, typename RAIOut,
+          typename ComparisonFunction>
+RAIOut SetDifference(
+  RAIIn1 first1,
+  /**< [IN] Random access iterator pointing to the first element of the first
+            input range */
+  RAIIn1 last1,
+  /**< [IN] Random access iterator pointing to the last plus one element of the
+            first input range */
+  RAIIn2 first2,
+  /**< [IN] Random access iterator pointing to the first element of the second
+            input range */
+  RAIIn2 last2,
+  /**< [IN] Random access iterator pointing to the last plus one element of the
+            second input range */
+  RAIOut output,
+  /**< [OUT] Random access iterator pointing to the first element of the
+             output range */
+  ComparisonFunction comparison
+    = std::less<typename std::iterator_traits<RAIIn1>::value_type>(),
+  /**< [IN] Binary predicate establishing the order in which the input ranges
+            are sorted. The default value uses the less-than relation. */
+  const embb::mtapi::ExecutionPolicy& policy = embb::mtapi::ExecutionPolicy(),
+  /**< [IN] embb::mtapi::ExecutionPolicy for the difference */
+  size_t block_size = 0
+  /**< [IN] Lower bound for the number of input elements processed by a
+            task. The default value 0 means that the input ranges are split
+            into about four parts per available core. */
+  );
+
+#else // DOXYGEN
+
+/**
+ * Overload of above described Doxygen dummy.
+ */
+template <typename RAIIn1, typename RAIIn2, typename RAIOut,
+          typename ComparisonFunction>
+RAIOut Merge(
+  RAIIn1 first1,
+  RAIIn1 last1,
+  RAIIn2 first2,
+  RAIIn2 last2,
+  RAIOut output,
+  ComparisonFunction comparison,
+  const embb::tasks::ExecutionPolicy& policy,
+  size_t block_size
+  );
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template <typename RAIIn1, typename RAIIn2, typename RAIOut>
+RAIOut Merge(
+  RAIIn1 first1,
+  RAIIn1 last1,
+  RAIIn2 first2,
+  RAIIn2 last2,
+  RAIOut output
+  ) {
+  return Merge(first1, last1, first2, last2, output,
+    std::less<typename std::iterator_traits<RAIIn1>::value_type>(),
+    embb::tasks::ExecutionPolicy(), 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template <typename RAIIn1, typename RAIIn2, typename RAIOut,
+          typename ComparisonFunction>
+RAIOut Merge(
+  RAIIn1 first1,
+  RAIIn1 last1,
+  RAIIn2 first2,
+  RAIIn2 last2,
+  RAIOut output,
+  ComparisonFunction comparison
+  ) {
+  return Merge(first1, last1, first2, last2, output, comparison,
+    embb::tasks::ExecutionPolicy(), 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template <typename RAIIn1, typename RAIIn2, typename RAIOut,
+          typename ComparisonFunction>
+RAIOut Merge(
+  RAIIn1 first1,
+  RAIIn1 last1,
+  RAIIn2 first2,
+  RAIIn2 last2,
+  RAIOut output,
+  ComparisonFunction comparison,
+  const embb::tasks::ExecutionPolicy& policy
+  ) {
+  return Merge(first1, last1, first2, last2, output, comparison, policy, 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy.
+ */
+template <typename RAIIn1, typename RAIIn2, typename RAIOut,
+          typename ComparisonFunction>
+RAIOut SetUnion(
+  RAIIn1 first1,
+  RAIIn1 last1,
+  RAIIn2 first2,
+  RAIIn2 last2,
+  RAIOut output,
+  ComparisonFunction comparison,
+  const embb::tasks::ExecutionPolicy& policy,
+  size_t block_size
+  );
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template <typename RAIIn1, typename RAIIn2, typename RAIOut>
+RAIOut SetUnion(
+  RAIIn1 first1,
+  RAIIn1 last1,
+  RAIIn2 first2,
+  RAIIn2 last2,
+  RAIOut output
+  ) {
+  return SetUnion(first1, last1, first2, last2, output,
+    std::less<typename std::iterator_traits<RAIIn1>::value_type>(),
+    embb::tasks::ExecutionPolicy(), 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template <typename RAIIn1, typename RAIIn2, typename RAIOut,
+          typename ComparisonFunction>
+RAIOut SetUnion(
+  RAIIn1 first1,
+  RAIIn1 last1,
+  RAIIn2 first2,
+  RAIIn2 last2,
+  RAIOut output,
+  ComparisonFunction comparison
+  ) {
+  return SetUnion(first1, last1, first2, last2, output, comparison,
+    embb::tasks::ExecutionPolicy(), 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template <typename RAIIn1, typename RAIIn2, typename RAIOut,
+          typename ComparisonFunction>
+RAIOut SetUnion(
+  RAIIn1 first1,
+  RAIIn1 last1,
+  RAIIn2 first2,
+  RAIIn2 last2,
+  RAIOut output,
+  ComparisonFunction comparison,
+  const embb::tasks::ExecutionPolicy& policy
+  ) {
+  return SetUnion(first1, last1, first2, last2, output, comparison, policy, 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy.
+ */
+template <typename RAIIn1, typename RAIIn2, typename RAIOut,
+          typename ComparisonFunction>
+RAIOut SetIntersection(
+  RAIIn1 first1,
+  RAIIn1 last1,
+  RAIIn2 first2,
+  RAIIn2 last2,
+  RAIOut output,
+  ComparisonFunction comparison,
+  const embb::tasks::ExecutionPolicy& policy,
+  size_t block_size
+  );
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template <typename RAIIn1, typename RAIIn2, typename RAIOut>
+RAIOut SetIntersection(
+  RAIIn1 first1,
+  RAIIn1 last1,
+  RAIIn2 first2,
+  RAIIn2 last2,
+  RAIOut output
+  ) {
+  return SetIntersection(first1, last1, first2, last2, output,
+    std::less<typename std::iterator_traits<RAIIn1>::value_type>(),
+    embb::tasks::ExecutionPolicy(), 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template <typename RAIIn1, typename RAIIn2, typename RAIOut,
+          typename ComparisonFunction>
+RAIOut SetIntersection(
+  RAIIn1 first1,
+  RAIIn1 last1,
+  RAIIn2 first2,
+  RAIIn2 last2,
+  RAIOut output,
+  ComparisonFunction comparison
+  ) {
+  return SetIntersection(first1, last1, first2, last2, output, comparison,
+    embb::tasks::ExecutionPolicy(), 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template <typename RAIIn1, typename RAIIn2, typename RAIOut,
+          typename ComparisonFunction>
+RAIOut SetIntersection(
+  RAIIn1 first1,
+  RAIIn1 last1,
+  RAIIn2 first2,
+  RAIIn2 last2,
+  RAIOut output,
+  ComparisonFunction comparison,
+  const embb::tasks::ExecutionPolicy& policy
+  ) {
+  return SetIntersection(first1, last1, first2, last2, output, comparison,
+    policy, 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy.
+ */
+template <typename RAIIn1, typename RAIIn2, typename RAIOut,
+          typename ComparisonFunction>
+RAIOut SetDifference(
+  RAIIn1 first1,
+  RAIIn1 last1,
+  RAIIn2 first2,
+  RAIIn2 last2,
+  RAIOut output,
+  ComparisonFunction comparison,
+  const embb::tasks::ExecutionPolicy& policy,
+  size_t block_size
+  );
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template <typename RAIIn1, typename RAIIn2, typename RAIOut>
+RAIOut SetDifference(
+  RAIIn1 first1,
+  RAIIn1 last1,
+  RAIIn2 first2,
+  RAIIn2 last2,
+  RAIOut output
+  ) {
+  return SetDifference(first1, last1, first2, last2, output,
+    std::less<typename std::iterator_traits<RAIIn1>::value_type>(),
+    embb::tasks::ExecutionPolicy(), 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template <typename RAIIn1, typename RAIIn2, typename RAIOut,
+          typename ComparisonFunction>
+RAIOut SetDifference(
+  RAIIn1 first1,
+  RAIIn1 last1,
+  RAIIn2 first2,
+  RAIIn2 last2,
+  RAIOut output,
+  ComparisonFunction comparison
+  ) {
+  return SetDifference(first1, last1, first2, last2, output, comparison,
+    embb::tasks::ExecutionPolicy(), 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template <typename RAIIn1, typename RAIIn2, typename RAIOut,
+          typename ComparisonFunction>
+RAIOut SetDifference(
+  RAIIn1 first1,
+  RAIIn1 last1,
+  RAIIn2 first2,
+  RAIIn2 last2,
+  RAIOut output,
+  ComparisonFunction comparison,
+  const embb::tasks::ExecutionPolicy& policy
+  ) {
+  return SetDifference(first1, last1, first2, last2, output, comparison,
+    policy, 0);
+}
+
+#endif // else DOXYGEN
+
+/**
+ * \}
+ */
+
+}  // namespace algorithms
+}  // namespace embb
+
+#include <embb/algorithms/internal/merge-inl.h>
+
+#endif  // EMBB_ALGORITHMS_MERGE_H_
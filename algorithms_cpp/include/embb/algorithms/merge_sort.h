@@ -36,7 +36,7 @@ namespace algorithms {
 
 /**
  * \defgroup CPP_ALGORITHMS_SORTING Sorting
- * Parallel merge sort and quick sort algorithms
+ * Parallel merge sort, quick sort and radix sort algorithms
  * \ingroup CPP_ALGORITHMS
  * \{
  */
@@ -51,8 +51,8 @@ namespace algorithms {
  * last element. Since the algorithm does not sort in-place, it requires
  * additional memory which is implicitly allocated by the function.
  *
- * \throws embb::base::ErrorException if not enough MTAPI tasks can be created
- *         to satisfy the requirements of the algorithm.
+ * \throws embb::base::ErrorException if the range is negative, the execution
+ *         policy contains no cores, or a task could not be started.
  * \memory Array with <tt>last-first</tt> elements of type
  *         <tt>std::iterator_traits<RAI>::value_type</tt>.
  * \threadsafe if the elements in the range <tt>[first,last)</tt> are not
@@ -83,9 +83,11 @@ void MergeSortAllocate(
   /**< [IN] Lower bound for partitioning the range of elements into blocks that
             are sorted in parallel. Partitioning of a block stops if its size
             is less than or equal to \c block_size. The default value 0 means
-            that the minimum block size is determined automatically depending on
-            the number of elements in the range divided by the number of
-            available cores. */
+            that ranges of more than n/(4*c) elements are always split, where
+            n is the number of elements in the range and c the number of cores
+            of the policy. Smaller ranges are split only while workers of the
+            policy are idle, down to blocks of n/(128*c) elements, but at
+            least one element. */
   );
 
 /**
@@ -98,8 +100,8 @@ void MergeSortAllocate(
  * by \c temporary_first must have the same number of elements as the range to
  * be sorted, and the elements of both ranges must have the same type.
  *
- * \throws embb::base::ErrorException if not enough MTAPI tasks can be created
- *         to satisfy the requirements of the algorithm.
+ * \throws embb::base::ErrorException if the range is negative, the execution
+ *         policy contains no cores, or a task could not be started.
  * \threadsafe if the elements in the ranges <tt>[first,last)</tt> and
  *             <tt>[temporary_first,temporary_first+(last-first)</tt> are not
  *             modified by another thread while the algorithm is executed.
@@ -133,9 +135,11 @@ void MergeSort(
   /**< [IN] Lower bound for partitioning the range of elements into blocks that
             are sorted in parallel. Partitioning of a block stops if its size
             is less than or equal to \c block_size. The default value 0 means
-            that the minimum block size is determined automatically depending on
-            the number of elements in the range divided by the number of
-            available cores. */
+            that ranges of more than n/(4*c) elements are always split, where
+            n is the number of elements in the range and c the number of cores
+            of the policy. Smaller ranges are split only while workers of the
+            policy are idle, down to blocks of n/(128*c) elements, but at
+            least one element. */
   );
 
 #else // DOXYGEN
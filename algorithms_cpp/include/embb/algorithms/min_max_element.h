@@ -0,0 +1,355 @@
+/*
+ * Copyright (c) 2014-2015, Siemens AG. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef EMBB_ALGORITHMS_MIN_MAX_ELEMENT_H_
+#define EMBB_ALGORITHMS_MIN_MAX_ELEMENT_H_
+
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <embb/tasks/execution_policy.h>
+
+namespace embb {
+namespace algorithms {
+
+/**
+ * \defgroup CPP_ALGORITHMS_MIN_MAX Minimum and maximum
+ * Parallel search for the smallest and largest elements of a range
+ * \ingroup CPP_ALGORITHMS
+ * \{
+ */
+
+#ifdef DOXYGEN
+
+/**
+ * Searches in parallel for the smallest element in a range.
+ *
+ * The range consists of the elements from \c first to \c last, excluding the
+ * last element.
+ *
+ * If several elements are equivalent, the one with the lowest position in the
+ * range is selected, independently of the partitioning of the range.
+ *
+ * \return Iterator pointing to the smallest element, or \c last if the range
+ *         is empty
+ * \throws embb::base::ErrorException if the range is negative, the execution
+ *         policy contains no cores, or a task could not be started.
+ * \threadsafe if the elements in the range are not modified by another thread
+ *             while the algorithm is executed.
+ * \note No guarantee is given on the execution order of the comparisons.
+ * \see MaxElement(), MinMaxElement(), Reduce(), embb::mtapi::ExecutionPolicy
+ * \tparam RAI Random access iterator
+ * \tparam ComparisonFunction Binary predicate with both arguments of type
+ *         <tt>std::iterator_traits<RAI>::value_type</tt>.
+ */
+template<typename RAI, typename ComparisonFunction>
+RAI MinElement(
+  RAI first,
+  /**< [IN] Random access iterator pointing to the first element of the range */
+  RAI last,
+  /**< [IN] Random access iterator pointing to the last plus one element of the
+            range */
+  ComparisonFunction comparison
+    = std::less<typename std::iterator_traits<RAI>::value_type>(),
+  /**< [IN] Binary predicate used to compare the elements. An element \c a is
+            less than an element \c b if <tt>comparison(a, b) == true</tt>.
+            The default value uses the less-than relation. */
+  const embb::mtapi::ExecutionPolicy& policy = embb::mtapi::ExecutionPolicy(),
+  /**< [IN] embb::mtapi::ExecutionPolicy for the search */
+  size_t block_size = 0
+  /**< [IN] Lower bound for partitioning the range of elements into blocks that
+            are searched in parallel. Partitioning of a block stops if its size
+            is less than or equal to \c block_size. The default value 0 means
+            that ranges of more than n/(4*c) elements are always split, where
+            n is the number of elements in the range and c the number of cores
+            of the policy. Smaller ranges are split only while workers of the
+            policy are idle, down to blocks of n/(128*c) elements, but at
+            least one element. */
+  );
+
+/**
+ * Searches in parallel for the largest element in a range.
+ *
+ * The range consists of the elements from \c first to \c last, excluding the
+ * last element.
+ *
+ * If several elements are equivalent, the one with the lowest position in the
+ * range is selected, independently of the partitioning of the range.
+ *
+ * \return Iterator pointing to the largest element, or \c last if the range
+ *         is empty
+ * \throws embb::base::ErrorException if the range is negative, the execution
+ *         policy contains no cores, or a task could not be started.
+ * \threadsafe if the elements in the range are not modified by another thread
+ *             while the algorithm is executed.
+ * \note No guarantee is given on the execution order of the comparisons.
+ * \see MinElement(), MinMaxElement(), Reduce(), embb::mtapi::ExecutionPolicy
+ * \tparam RAI Random access iterator
+ * \tparam ComparisonFunction Binary predicate with both arguments of type
+ *         <tt>std::iterator_traits<RAI>::value_type</tt>.
+ */
+template<typename RAI, typename ComparisonFunction>
+RAI MaxElement(
+  RAI first,
+  /**< [IN] Random access iterator pointing to the first element of the range */
+  RAI last,
+  /**< [IN] Random access iterator pointing to the last plus one element of the
+            range */
+  ComparisonFunction comparison
+    = std::less<typename std::iterator_traits<RAI>::value_type>(),
+  /**< [IN] Binary predicate used to compare the elements. An element \c a is
+            less than an element \c b if <tt>comparison(a, b) == true</tt>.
+            The default value uses the less-than relation. */
+  const embb::mtapi::ExecutionPolicy& policy = embb::mtapi::ExecutionPolicy(),
+  /**< [IN] embb::mtapi::ExecutionPolicy for the search */
+  size_t block_size = 0
+  /**< [IN] Lower bound for partitioning the range of elements into blocks that
+            are searched in parallel. Partitioning of a block stops if its size
+            is less than or equal to \c block_size. The default value 0 means
+            that ranges of more than n/(4*c) elements are always split, where
+            n is the number of elements in the range and c the number of cores
+            of the policy. Smaller ranges are split only while workers of the
+            policy are idle, down to blocks of n/(128*c) elements, but at
+            least one element. */
+  );
+
+/**
+ * Searches in parallel for the smallest and the largest element in a range
+ * in a single pass.
+ *
+ * The range consists of the elements from \c first to \c last, excluding the
+ * last element.
+ *
+ * If several elements are equivalent, the one with the lowest position in the
+ * range is selected, independently of the partitioning of the range.
+ *
+ * \return Pair of iterators pointing to the smallest and the largest element,
+ *         or a pair of \c last if the range is empty. Unlike
+ *         <tt>std::minmax_element</tt>, the first of several largest elements
+ *         is selected.
+ * \throws embb::base::ErrorException if the range is negative, the execution
+ *         policy contains no cores, or a task could not be started.
+ * \threadsafe if the elements in the range are not modified by another thread
+ *             while the algorithm is executed.
+ * \note No guarantee is given on the execution order of the comparisons.
+ * \see MinElement(), MaxElement(), Reduce(), embb::mtapi::ExecutionPolicy
+ * \tparam RAI Random access iterator
+ * \tparam ComparisonFunction Binary predicate with both arguments of type
+ *         <tt>std::iterator_traits<RAI>::value_type</tt>.
+ */
+template<typename RAI, typename ComparisonFunction>
+std::pair<RAI, RAI> MinMaxElement(
+  RAI first,
+  /**< [IN] Random access iterator pointing to the first element of the range */
+  RAI last,
+  /**< [IN] Random access iterator pointing to the last plus one element of the
+            range */
+  ComparisonFunction comparison
+    = std::less<typename std::iterator_traits<RAI>::value_type>(),
+  /**< [IN] Binary predicate used to compare the elements. An element \c a is
+            less than an element \c b if <tt>comparison(a, b) == true</tt>.
+            The default value uses the less-than relation. */
+  const embb::mtapi::ExecutionPolicy& policy = embb::mtapi::ExecutionPolicy(),
+  /**< [IN] embb::mtapi::ExecutionPolicy for the search */
+  size_t block_size = 0
+  /**< [IN] Lower bound for partitioning the range of elements into blocks that
+            are searched in parallel. Partitioning of a block stops if its size
+            is less than or equal to \c block_size. The default value 0 means
+            that ranges of more than n/(4*c) elements are always split, where
+            n is the number of elements in the range and c the number of cores
+            of the policy. Smaller ranges are split only while workers of the
+            policy are idle, down to blocks of n/(128*c) elements, but at
+            least one element. */
+  );
+
+#else // DOXYGEN
+
+/**
+ * Overload of above described Doxygen dummy.
+ */
+template<typename RAI, typename ComparisonFunction>
+RAI MinElement(
+  RAI first,
+  RAI last,
+  ComparisonFunction comparison,
+  const embb::tasks::ExecutionPolicy& policy,
+  size_t block_size
+  );
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename RAI>
+RAI MinElement(
+  RAI first,
+  RAI last
+  ) {
+  return MinElement(first, last,
+    std::less<typename std::iterator_traits<RAI>::value_type>(),
+    embb::tasks::ExecutionPolicy(), 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename RAI, typename ComparisonFunction>
+RAI MinElement(
+  RAI first,
+  RAI last,
+  ComparisonFunction comparison
+  ) {
+  return MinElement(first, last, comparison,
+    embb::tasks::ExecutionPolicy(), 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename RAI, typename ComparisonFunction>
+RAI MinElement(
+  RAI first,
+  RAI last,
+  ComparisonFunction comparison,
+  const embb::tasks::ExecutionPolicy& policy
+  ) {
+  return MinElement(first, last, comparison, policy, 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy.
+ */
+template<typename RAI, typename ComparisonFunction>
+RAI MaxElement(
+  RAI first,
+  RAI last,
+  ComparisonFunction comparison,
+  const embb::tasks::ExecutionPolicy& policy,
+  size_t block_size
+  );
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename RAI>
+RAI MaxElement(
+  RAI first,
+  RAI last
+  ) {
+  return MaxElement(first, last,
+    std::less<typename std::iterator_traits<RAI>::value_type>(),
+    embb::tasks::ExecutionPolicy(), 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename RAI, typename ComparisonFunction>
+RAI MaxElement(
+  RAI first,
+  RAI last,
+  ComparisonFunction comparison
+  ) {
+  return MaxElement(first, last, comparison,
+    embb::tasks::ExecutionPolicy(), 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename RAI, typename ComparisonFunction>
+RAI MaxElement(
+  RAI first,
+  RAI last,
+  ComparisonFunction comparison,
+  const embb::tasks::ExecutionPolicy& policy
+  ) {
+  return MaxElement(first, last, comparison, policy, 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy.
+ */
+template<typename RAI, typename ComparisonFunction>
+std::pair<RAI, RAI> MinMaxElement(
+  RAI first,
+  RAI last,
+  ComparisonFunction comparison,
+  const embb::tasks::ExecutionPolicy& policy,
+  size_t block_size
+  );
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename RAI>
+std::pair<RAI, RAI> MinMaxElement(
+  RAI first,
+  RAI last
+  ) {
+  return MinMaxElement(first, last,
+    std::less<typename std::iterator_traits<RAI>::value_type>(),
+    embb::tasks::ExecutionPolicy(), 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename RAI, typename ComparisonFunction>
+std::pair<RAI, RAI> MinMaxElement(
+  RAI first,
+  RAI last,
+  ComparisonFunction comparison
+  ) {
+  return MinMaxElement(first, last, comparison,
+    embb::tasks::ExecutionPolicy(), 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename RAI, typename ComparisonFunction>
+std::pair<RAI, RAI> MinMaxElement(
+  RAI first,
+  RAI last,
+  ComparisonFunction comparison,
+  const embb::tasks::ExecutionPolicy& policy
+  ) {
+  return MinMaxElement(first, last, comparison, policy, 0);
+}
+
+#endif // else DOXYGEN
+
+/**
+ * \}
+ */
+
+}  // namespace algorithms
+}  // namespace embb
+
+#include <embb/algorithms/internal/min_max_element-inl.h>
+
+#endif  // EMBB_ALGORITHMS_MIN_MAX_ELEMENT_H_
@@ -44,12 +44,12 @@ namespace algorithms {
  * Sorts a range of elements using a parallel quick sort algorithm.
  *
  * The range consists of the elements from \c first to \c last, excluding the
- * last element. The algorithm sorts in-place and requires no additional memory.
- * It has, however, a worst-case time complexity of
- * <tt>O((last-first)<sup>2</sup>)</tt>.
+ * last element. The algorithm sorts in-place and requires no additional memory
+ * apart from bookkeeping for partitioning large ranges in parallel. It has,
+ * however, a worst-case time complexity of <tt>O((last-first)<sup>2</sup>)</tt>.
  *
- * \throws embb::base::ErrorException if not enough MTAPI tasks can be created
- *         to satisfy the requirements of the algorithm.
+ * \throws embb::base::ErrorException if the range is negative, the execution
+ *         policy contains no cores, or a task could not be started.
  * \threadsafe if the elements in the range <tt>[first,last)</tt> are not
  *             modified by another thread while the algorithm is executed.
  * \note No guarantee is given on the execution order of the comparison
@@ -78,11 +78,13 @@ void QuickSort(
   /**< [IN] Lower bound for partitioning the range of elements into blocks that
             are sorted in parallel. Partitioning of a block stops if its size
             is less than or equal to \c block_size. The default value 0 means
-            that the minimum block size is determined automatically depending on
-            the number of elements in the range divided by the number of
-            available cores. Note that quick sort does not guarantee a
-            partitioning into evenly sized blocks, as the partitions depend on
-            the values to be sorted. */
+            that ranges of more than n/(4*c) elements are always split, where
+            n is the number of elements in the range and c the number of cores
+            of the policy. Smaller ranges are split only while workers of the
+            policy are idle, down to blocks of n/(128*c) elements, but at
+            least one element. Note that quick sort does not guarantee a
+            partitioning into evenly sized blocks, as the partitions depend
+            on the values to be sorted. */
   );
 
 #else // DOXYGEN
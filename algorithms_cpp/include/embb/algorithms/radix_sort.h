@@ -0,0 +1,290 @@
+/*
+ * Copyright (c) 2014-2015, Siemens AG. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef EMBB_ALGORITHMS_RADIX_SORT_H_
+#define EMBB_ALGORITHMS_RADIX_SORT_H_
+
+#include <iterator>
+#include <embb/tasks/execution_policy.h>
+#include <embb/algorithms/zip_iterator.h>
+
+namespace embb {
+namespace algorithms {
+
+/**
+ * \ingroup CPP_ALGORITHMS_SORTING
+ * \{
+ */
+
+#ifdef DOXYGEN
+
+/**
+ * Sorts a range of integral or floating-point keys using a parallel least
+ * significant digit radix sort algorithm.
+ *
+ * The range consists of the elements from \c first to \c last, excluding the
+ * last element. The keys are sorted in ascending order, eight bits per pass,
+ * with a time complexity of <tt>O(last-first)</tt> per pass. Passes in which
+ * all keys have the same digit are skipped. The sort is stable, which allows
+ * sorting elements by a key (see the overload with a key extractor) and
+ * key/value pairs (see the overload for ZipIterator). Since the algorithm does
+ * not sort in-place, it requires additional memory which is implicitly
+ * allocated by the function.
+ *
+ * Each pass divides the range into blocks which are processed in parallel:
+ * First, a histogram of the digits is computed for every block. A parallel
+ * Scan() of the histograms then yields the target position of each digit in
+ * each block, to which the blocks scatter their elements in parallel. Each
+ * block buffers the positions of a few elements per digit and writes them to
+ * the target in bursts.
+ *
+ * \throws embb::base::ErrorException if the range is negative or the execution
+ *         policy contains no cores.
+ * \memory Array with <tt>last-first</tt> elements of type
+ *         <tt>std::iterator_traits<RAI>::value_type</tt>, and a histogram of
+ *         256 counters per block.
+ * \threadsafe if the elements in the range <tt>[first,last)</tt> are not
+ *             modified by another thread while the algorithm is executed.
+ * \note Negative floating-point keys precede positive ones, and negative zero
+ *       precedes positive zero. NaNs are sorted according to their sign and
+ *       payload bits.
+ * \see embb::mtapi::ExecutionPolicy, MergeSortAllocate(), QuickSort()
+ * \tparam RAI Random access iterator with an integral or floating-point
+ *         <tt>std::iterator_traits<RAI>::value_type</tt> of at most 64 bits
+ */
+template<typename RAI>
+void RadixSort(
+  RAI first,
+  /**< [IN] Random access iterator pointing to the first element of the range */
+  RAI last,
+  /**< [IN] Random access iterator pointing to the last plus one element of the
+            range */
+  const embb::tasks::ExecutionPolicy& policy = embb::tasks::ExecutionPolicy(),
+  /**< [IN] embb::mtapi::ExecutionPolicy for the radix sort algorithm */
+  size_t block_size = 0
+  /**< [IN] Lower bound for partitioning the range of elements into blocks that
+            are processed in parallel. There are at most four blocks per core.
+            The default value 0 means that blocks contain at least 2048
+            elements. */
+  );
+
+/**
+ * Sorts a range of elements by integral or floating-point keys using a
+ * parallel least significant digit radix sort algorithm.
+ *
+ * Behaves like the overload without key extractor, but sorts the elements in
+ * ascending order of <tt>key_extractor(element)</tt>. Elements with equal keys
+ * keep their relative order.
+ *
+ * \throws embb::base::ErrorException if the range is negative or the execution
+ *         policy contains no cores.
+ * \memory Array with <tt>last-first</tt> elements of type
+ *         <tt>std::iterator_traits<RAI>::value_type</tt>, and a histogram of
+ *         256 counters per block.
+ * \threadsafe if the elements in the range <tt>[first,last)</tt> are not
+ *             modified by another thread while the algorithm is executed.
+ * \note The key extractor is called twice per element and pass, in no
+ *       particular order.
+ * \see embb::mtapi::ExecutionPolicy
+ * \tparam RAI Random access iterator
+ * \tparam KeyExtractor Pointer to a function or functor with one argument of
+ *         type <tt>std::iterator_traits<RAI>::value_type</tt>, returning an
+ *         integral or floating-point key of at most 64 bits. A functor has to
+ *         define the key type as \c result_type.
+ */
+template<typename RAI, typename KeyExtractor>
+void RadixSort(
+  RAI first,
+  /**< [IN] Random access iterator pointing to the first element of the range */
+  RAI last,
+  /**< [IN] Random access iterator pointing to the last plus one element of the
+            range */
+  KeyExtractor key_extractor,
+  /**< [IN] Returns the key of an element */
+  const embb::tasks::ExecutionPolicy& policy = embb::tasks::ExecutionPolicy(),
+  /**< [IN] embb::mtapi::ExecutionPolicy for the radix sort algorithm */
+  size_t block_size = 0
+  /**< [IN] Lower bound for partitioning the range of elements into blocks that
+            are processed in parallel. There are at most four blocks per core.
+            The default value 0 means that blocks contain at least 2048
+            elements. */
+  );
+
+/**
+ * Sorts a range of key/value pairs by their keys using a parallel least
+ * significant digit radix sort algorithm.
+ *
+ * Behaves like the overload for a range of keys, but moves the value at the
+ * same position along with each key. Values with equal keys keep their
+ * relative order.
+ *
+ * \throws embb::base::ErrorException if the range is negative or the execution
+ *         policy contains no cores.
+ * \memory Arrays with <tt>last-first</tt> elements of the key and value types,
+ *         and a histogram of 256 counters per block.
+ * \threadsafe if the keys and values in the range <tt>[first,last)</tt> are
+ *             not modified by another thread while the algorithm is executed.
+ * \see embb::mtapi::ExecutionPolicy, Zip()
+ * \tparam RAIKey Random access iterator with an integral or floating-point
+ *         <tt>std::iterator_traits<RAIKey>::value_type</tt> of at most 64 bits
+ * \tparam RAIValue Random access iterator
+ */
+template<typename RAIKey, typename RAIValue>
+void RadixSort(
+  ZipIterator<RAIKey, RAIValue> first,
+  /**< [IN] Zip iterator pointing to the first key and value of the range */
+  ZipIterator<RAIKey, RAIValue> last,
+  /**< [IN] Zip iterator pointing to the last plus one key and value of the
+            range */
+  const embb::tasks::ExecutionPolicy& policy = embb::tasks::ExecutionPolicy(),
+  /**< [IN] embb::mtapi::ExecutionPolicy for the radix sort algorithm */
+  size_t block_size = 0
+  /**< [IN] Lower bound for partitioning the range of elements into blocks that
+            are processed in parallel. There are at most four blocks per core.
+            The default value 0 means that blocks contain at least 2048
+            elements. */
+  );
+
+#else // DOXYGEN
+
+/**
+ * Overload of above described Doxygen dummy.
+ */
+template<typename RAI>
+void RadixSort(
+  RAI first,
+  RAI last,
+  const embb::tasks::ExecutionPolicy& policy,
+  size_t block_size
+  );
+
+/**
+ * Overload of above described Doxygen dummy.
+ */
+template<typename RAI, typename KeyExtractor>
+void RadixSort(
+  RAI first,
+  RAI last,
+  KeyExtractor key_extractor,
+  const embb::tasks::ExecutionPolicy& policy,
+  size_t block_size
+  );
+
+/**
+ * Overload of above described Doxygen dummy.
+ */
+template<typename RAIKey, typename RAIValue>
+void RadixSort(
+  ZipIterator<RAIKey, RAIValue> first,
+  ZipIterator<RAIKey, RAIValue> last,
+  const embb::tasks::ExecutionPolicy& policy,
+  size_t block_size
+  );
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename RAI>
+void RadixSort(
+  RAI first,
+  RAI last
+  ) {
+  RadixSort(first, last, embb::tasks::ExecutionPolicy(), 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename RAI>
+void RadixSort(
+  RAI first,
+  RAI last,
+  const embb::tasks::ExecutionPolicy& policy
+  ) {
+  RadixSort(first, last, policy, 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename RAI, typename KeyExtractor>
+void RadixSort(
+  RAI first,
+  RAI last,
+  KeyExtractor key_extractor
+  ) {
+  RadixSort(first, last, key_extractor, embb::tasks::ExecutionPolicy(), 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename RAI, typename KeyExtractor>
+void RadixSort(
+  RAI first,
+  RAI last,
+  KeyExtractor key_extractor,
+  const embb::tasks::ExecutionPolicy& policy
+  ) {
+  RadixSort(first, last, key_extractor, policy, 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename RAIKey, typename RAIValue>
+void RadixSort(
+  ZipIterator<RAIKey, RAIValue> first,
+  ZipIterator<RAIKey, RAIValue> last
+  ) {
+  RadixSort(first, last, embb::tasks::ExecutionPolicy(), 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename RAIKey, typename RAIValue>
+void RadixSort(
+  ZipIterator<RAIKey, RAIValue> first,
+  ZipIterator<RAIKey, RAIValue> last,
+  const embb::tasks::ExecutionPolicy& policy
+  ) {
+  RadixSort(first, last, policy, 0);
+}
+
+#endif // else DOXYGEN
+
+/**
+ * \}
+ */
+
+}  // namespace algorithms
+}  // namespace embb
+
+#include <embb/algorithms/internal/radix_sort-inl.h>
+
+#endif  // EMBB_ALGORITHMS_RADIX_SORT_H_
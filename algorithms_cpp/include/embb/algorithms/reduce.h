@@ -40,6 +40,87 @@ namespace algorithms {
  * \{
  */
 
+/**
+ * Addition of floating-point values with compensated summation.
+ *
+ * Used as reduction function of Reduce() or DeterministicReduce(), the
+ * elements of each block are summed up with the compensated summation of
+ * Kahan and Neumaier, which carries the rounding error of each addition
+ * along. The error of the sum of a block is thereby independent of the
+ * number of its elements. Partial results of blocks are added without
+ * compensation.
+ *
+ * \tparam Type Floating-point type of the values
+ */
+template<typename Type>
+struct CompensatedPlus {
+  /**
+   * Adds two values.
+   *
+   * \return <tt>lhs + rhs</tt>
+   */
+  Type operator()(
+    const Type& lhs,
+    /**< [IN] First summand */
+    const Type& rhs
+    /**< [IN] Second summand */
+    ) const {
+    return lhs + rhs;
+  }
+};
+
+/**
+ * Minimum of two values.
+ *
+ * Used as reduction function of Reduce(), the minimum of a range is
+ * computed. Its neutral element is the largest value of \c Type, e.g.,
+ * <tt>std::numeric_limits<Type>::max()</tt>.
+ *
+ * \tparam Type Type of the values, which must be less-than comparable
+ */
+template<typename Type>
+struct Min {
+  /**
+   * Compares two values.
+   *
+   * \return \c rhs if it is less than \c lhs, otherwise \c lhs
+   */
+  Type operator()(
+    const Type& lhs,
+    /**< [IN] First value */
+    const Type& rhs
+    /**< [IN] Second value */
+    ) const {
+    return (rhs < lhs) ? rhs : lhs;
+  }
+};
+
+/**
+ * Maximum of two values.
+ *
+ * Used as reduction function of Reduce(), the maximum of a range is
+ * computed. Its neutral element is the smallest value of \c Type, e.g.,
+ * <tt>std::numeric_limits<Type>::min()</tt> for integers.
+ *
+ * \tparam Type Type of the values, which must be less-than comparable
+ */
+template<typename Type>
+struct Max {
+  /**
+   * Compares two values.
+   *
+   * \return \c rhs if \c lhs is less than it, otherwise \c lhs
+   */
+  Type operator()(
+    const Type& lhs,
+    /**< [IN] First value */
+    const Type& rhs
+    /**< [IN] Second value */
+    ) const {
+    return (lhs < rhs) ? rhs : lhs;
+  }
+};
+
 #ifdef DOXYGEN
 
 /**
@@ -52,8 +133,8 @@ namespace algorithms {
  * \return
  * <tt>reduction(transformation(*first), ..., transformation(*(last-1)))</tt>
  * where the reduction function is applied pairwise.
- * \throws embb::base::ErrorException if not enough MTAPI tasks can be created
- *         to satisfy the requirements of the algorithm.
+ * \throws embb::base::ErrorException if the range is negative, the execution
+ *         policy contains no cores, or a task could not be started.
  * \threadsafe if the elements in the range are not modified by another thread
  *             while the algorithm is executed.
  * \note No guarantee is given on the order in which the functions \c reduction
@@ -64,7 +145,20 @@ namespace algorithms {
  *       associative, i.e., <tt>reduction(x, reduction(y, z)) ==
  *       reduction(reduction(x, y), z))</tt> for all \c x, \c y, \c z of type
  *       \c ReturnType.
- * \see embb::mtapi::ExecutionPolicy, ZipIterator, Identity
+ * \note Pointers and vector iterators to arithmetic elements reduced by
+ *       \c std::plus, \c std::multiplies, \c std::bit_and, \c std::bit_or,
+ *       \c std::bit_xor, Min or Max of \c ReturnType use several independent
+ *       accumulators per block, which lets the compiler vectorize the loop.
+ *       For Min and Max of floating-point values, the range must not contain
+ *       NaNs, since the result would then depend on the order. As these
+ *       reductions are also commutative, the elements are then combined out of
+ *       order, which may change the rounding of floating-point results.
+ * \note The blocks depend on the number of cores and on idle workers, so
+ *       results of reductions that are not exactly associative, such as sums
+ *       of floating-point values, may differ between runs. Use
+ *       DeterministicReduce() for reproducible results.
+ * \see embb::mtapi::ExecutionPolicy, ZipIterator, Identity,
+ *      DeterministicReduce(), Min, Max
  * \tparam RAI Random access iterator
  * \tparam ReturnType Type of result of reduction operation, deduced from
  *         \c neutral
@@ -95,9 +189,75 @@ ReturnType Reduce(
   /**< [IN] Lower bound for partitioning the range of elements into blocks that
             are treated in parallel. Partitioning of a block stops if its size
             is less than or equal to \c block_size. The default value 0 means
-            that the minimum block size is determined automatically depending on
-            the number of elements in the range divided by the number of
-            available cores. */
+            that ranges of more than n/(4*c) elements are always split, where
+            n is the number of elements in the range and c the number of cores
+            of the policy. Smaller ranges are split only while workers of the
+            policy are idle, down to blocks of n/(128*c) elements, but at
+            least one element. */
+  );
+
+/**
+ * Performs a parallel reduction operation on a range of elements, whose
+ * result does not depend on the number of cores or the scheduling.
+ *
+ * The range consists of the elements from \c first to \c last, excluding the
+ * last element. It is split at its middle recursively until the parts
+ * contain at most \c block_size elements, which are reduced from left to
+ * right. The results of the two halves of a split are then combined by
+ * <tt>reduction(lower, upper)</tt>. The shape of this reduction tree only
+ * depends on the number of elements and the block size. Which of its
+ * subtrees are reduced by separate tasks does not influence the result, such
+ * that floating-point reductions yield bitwise identical results for any
+ * execution policy and on any machine, unlike Reduce(), whose blocks depend
+ * on the number of cores and on idle workers.
+ *
+ * Above the blocks, the reduction tree performs a pairwise reduction. For
+ * sums of floating-point values, CompensatedPlus additionally compensates
+ * the rounding errors within the blocks.
+ *
+ * \return
+ * <tt>reduction(transformation(*first), ..., transformation(*(last-1)))</tt>
+ * where the reduction function is applied pairwise as described above.
+ * \throws embb::base::ErrorException if the range is negative, the execution
+ *         policy contains no cores, or a task could not be started.
+ * \threadsafe if the elements in the range are not modified by another thread
+ *             while the algorithm is executed.
+ * \note No guarantee is given on the order in which the functions are
+ *       applied, only on how their results are combined. For all \c x of
+ *       type \c ReturnType it must hold that
+ *       <tt>reduction(x, neutral) == x</tt>. The reduction operation need not
+ *       be commutative.
+ * \see Reduce(), CompensatedPlus, embb::mtapi::ExecutionPolicy
+ * \tparam RAI Random access iterator
+ * \tparam ReturnType Type of result of reduction operation, deduced from
+ *         \c neutral
+ * \tparam ReductionFunction Binary reduction function object with signature
+ *         <tt>ReturnType ReductionFunction(ReturnType, ReturnType)</tt>.
+ * \tparam TransformationFunction Unary transformation function object with
+ *         signature <tt>ReturnType TransformationFunction(typename
+ *         std::iterator_traits<RAI>::value_type)</tt>
+ */
+template<typename RAI, typename ReturnType, typename ReductionFunction,
+         typename TransformationFunction>
+ReturnType DeterministicReduce(
+  RAI first,
+  /**< [IN] Random access iterator pointing to the first element of the range */
+  RAI last,
+  /**< [IN] Random access iterator pointing to the last plus one element of the
+            range */
+  ReturnType neutral,
+  /**< [IN] Neutral element of the reduction operation. */
+  ReductionFunction reduction,
+  /**< [IN] Reduction operation to be applied to the elements of the range */
+  TransformationFunction transformation = Identity(),
+  /**< [IN] Transforms the elements of the range before the reduction operation
+            is applied */
+  const embb::mtapi::ExecutionPolicy& policy = embb::mtapi::ExecutionPolicy(),
+  /**< [IN] embb::mtapi::ExecutionPolicy for the reduction computation */
+  size_t block_size = 0
+  /**< [IN] Maximum number of elements of the blocks that are reduced from
+            left to right. The default value 0 means 1024 elements, which does
+            not depend on the number of available cores. */
   );
 
 #else // DOXYGEN
@@ -163,6 +323,68 @@ ReturnType Reduce(
   return Reduce(first, last, neutral, reduction, transformation, policy, 0);
 }
 
+/**
+ * Overload of above described Doxygen dummy.
+ */
+template<typename RAI, typename ReturnType, typename ReductionFunction,
+         typename TransformationFunction>
+ReturnType DeterministicReduce(
+  RAI first,
+  RAI last,
+  ReturnType neutral,
+  ReductionFunction reduction,
+  TransformationFunction transformation,
+  const embb::tasks::ExecutionPolicy& policy,
+  size_t block_size
+  );
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename RAI, typename ReturnType, typename ReductionFunction>
+ReturnType DeterministicReduce(
+  RAI first,
+  RAI last,
+  ReturnType neutral,
+  ReductionFunction reduction
+  ) {
+  return DeterministicReduce(first, last, neutral, reduction, Identity(),
+    embb::tasks::ExecutionPolicy(), 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename RAI, typename ReturnType, typename ReductionFunction,
+         typename TransformationFunction>
+ReturnType DeterministicReduce(
+  RAI first,
+  RAI last,
+  ReturnType neutral,
+  ReductionFunction reduction,
+  TransformationFunction transformation
+  ) {
+  return DeterministicReduce(first, last, neutral, reduction, transformation,
+    embb::tasks::ExecutionPolicy(), 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename RAI, typename ReturnType, typename ReductionFunction,
+         typename TransformationFunction>
+ReturnType DeterministicReduce(
+  RAI first,
+  RAI last,
+  ReturnType neutral,
+  ReductionFunction reduction,
+  TransformationFunction transformation,
+  const embb::tasks::ExecutionPolicy& policy
+  ) {
+  return DeterministicReduce(first, last, neutral, reduction, transformation,
+    policy, 0);
+}
+
 #endif // else DOXYGEN
 
 /**
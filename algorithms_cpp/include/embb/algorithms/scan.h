@@ -51,11 +51,18 @@ namespace algorithms {
  * excluding the last element. The output range consists of the elements from
  * \c output_first to <tt>output_first + std::difference(last - first)</tt>.
  *
- * The algorithm performs two runs on the given range. Hence, a performance
- * speedup can only be expected on processors with more than two cores.
+ * The output range may be the input range itself, in which case the scan is
+ * computed in-place.
  *
- * \throws embb::base::ErrorException if not enough MTAPI tasks can be created
- *         to satisfy the requirements of the algorithm.
+ * The algorithm reads the range in a single pass: Chunks of the range are
+ * processed in ascending order by one task per core. Each chunk publishes the
+ * aggregate of its elements and then looks back at its predecessors' published
+ * values to obtain its prefix (decoupled look-back). Chunks whose predecessor
+ * has already published its full prefix are scanned directly.
+ *
+ * \throws embb::base::ErrorException if the range is negative or the execution
+ *         policy contains no cores.
+ * \memory Two values of type \c ReturnType and a flag per chunk.
  * \threadsafe if the elements in the range are not modified by another thread
  *             while the algorithm is executed.
  * \note No guarantee is given on the order in which the functions \c scan
@@ -99,12 +106,126 @@ void Scan(
   const embb::mtapi::ExecutionPolicy& policy = embb::mtapi::ExecutionPolicy(),
   /**< [IN] embb::mtapi::ExecutionPolicy for the scan computation */
   size_t block_size = 0
-  /**< [IN] Lower bound for partitioning the range of elements into blocks that
-            are treated in parallel. Partitioning of a block stops if its size
-            is less than or equal to \c block_size. The default value 0 means
-            that the minimum block size is determined automatically depending on
-            the number of elements in the range divided by the number of
-            available cores. */
+  /**< [IN] Number of elements per chunk. The default value 0 means that
+            chunks contain between 256 and 8192 elements, aiming at four chunks
+            per core. */
+  );
+
+/**
+ * Performs a parallel exclusive scan (or prefix) computation on a range of
+ * elements.
+ *
+ * Behaves like Scan(), but the output of an element does not include the
+ * element itself: The first output element is \c neutral, and the i-th output
+ * element is the scan of the first <tt>i-1</tt> transformed input elements.
+ * The output range may be the input range itself.
+ *
+ * \throws embb::base::ErrorException if the range is negative or the execution
+ *         policy contains no cores.
+ * \memory Two values of type \c ReturnType and a flag per chunk.
+ * \threadsafe if the elements in the range are not modified by another thread
+ *             while the algorithm is executed.
+ * \note No guarantee is given on the order in which the functions \c scan
+ *       and \c transformation are applied to the elements. The requirements
+ *       on \c scan and \c neutral are the same as for Scan().
+ * \see Scan(), SegmentedScan()
+ * \tparam RAIIn Random access iterator type of input range
+ * \tparam RAIOut Random access iterator type of output range
+ * \tparam ReturnType Type of output elements of scan operation, deduced from
+ *         \c neutral
+ * \tparam ScanFunction Binary scan function object with signature
+ *         <tt>ReturnType ScanFunction(ReturnType, ReturnType)</tt>
+ * \tparam TransformationFunction Unary transformation function object with
+ *         signature <tt>ReturnType TransformationFunction(typename
+ *         std::iterator_traits<RAIIn>::value_type)</tt>.
+ */
+template<typename RAIIn, typename RAIOut, typename ReturnType,
+         typename ScanFunction, typename TransformationFunction>
+void ExclusiveScan(
+  RAIIn first,
+  /**< [IN] Random access iterator pointing to the first element of the input
+            range */
+  RAIIn last,
+  /**< [IN] Random access iterator pointing to the last plus one element of the
+            input range */
+  RAIOut output_first,
+  /**< [IN] Random access iterator pointing to the first element of the output
+            range */
+  ReturnType neutral,
+  /**< [IN] Neutral element of the \c scan operation, and first output
+            element */
+  ScanFunction scan,
+  /**< [IN] Scan operation to be applied to the elements of the input range */
+  TransformationFunction transformation = Identity(),
+  /**< [IN] Transforms the elements of the input range before the scan operation
+            is applied */
+  const embb::mtapi::ExecutionPolicy& policy = embb::mtapi::ExecutionPolicy(),
+  /**< [IN] embb::mtapi::ExecutionPolicy for the scan computation */
+  size_t block_size = 0
+  /**< [IN] Number of elements per chunk. The default value 0 means that
+            chunks contain between 256 and 8192 elements, aiming at four chunks
+            per core. */
+  );
+
+/**
+ * Performs a parallel segmented scan (or prefix) computation on a range of
+ * elements.
+ *
+ * Behaves like Scan(), but the range is divided into segments which are
+ * scanned independently of each other. A new segment starts at each element
+ * whose flag in the range starting at \c flags_first is \c true. The output
+ * range may be the input range itself.
+ *
+ * \throws embb::base::ErrorException if the range is negative or the execution
+ *         policy contains no cores.
+ * \memory Two values of type \c ReturnType and three flags per chunk.
+ * \threadsafe if the elements and flags in the ranges are not modified by
+ *             another thread while the algorithm is executed.
+ * \note No guarantee is given on the order in which the functions \c scan
+ *       and \c transformation are applied to the elements. The requirements
+ *       on \c scan and \c neutral are the same as for Scan().
+ * \see Scan(), ExclusiveScan()
+ * \tparam RAIIn Random access iterator type of input range
+ * \tparam RAIFlags Random access iterator type of the flags range, whose
+ *         values are convertible to \c bool
+ * \tparam RAIOut Random access iterator type of output range
+ * \tparam ReturnType Type of output elements of scan operation, deduced from
+ *         \c neutral
+ * \tparam ScanFunction Binary scan function object with signature
+ *         <tt>ReturnType ScanFunction(ReturnType, ReturnType)</tt>
+ * \tparam TransformationFunction Unary transformation function object with
+ *         signature <tt>ReturnType TransformationFunction(typename
+ *         std::iterator_traits<RAIIn>::value_type)</tt>.
+ */
+template<typename RAIIn, typename RAIFlags, typename RAIOut,
+         typename ReturnType, typename ScanFunction,
+         typename TransformationFunction>
+void SegmentedScan(
+  RAIIn first,
+  /**< [IN] Random access iterator pointing to the first element of the input
+            range */
+  RAIIn last,
+  /**< [IN] Random access iterator pointing to the last plus one element of the
+            input range */
+  RAIFlags flags_first,
+  /**< [IN] Random access iterator pointing to the flag of the first element
+            of the input range */
+  RAIOut output_first,
+  /**< [IN] Random access iterator pointing to the first element of the output
+            range */
+  ReturnType neutral,
+  /**< [IN] Neutral element of the \c scan operation. */
+  ScanFunction scan,
+  /**< [IN] Scan operation to be applied to the elements of the input range */
+  TransformationFunction transformation = Identity(),
+  /**< [IN] Transforms the elements of the input range before the scan operation
+            is applied */
+  const embb::mtapi::ExecutionPolicy& policy = embb::mtapi::ExecutionPolicy(),
+  /**< [IN] embb::mtapi::ExecutionPolicy for the scan computation */
+  size_t block_size = 0
+  /**< [IN] Number of elements per chunk. The default value 0 means that
+            chunks contain between 256 and 8192 elements, aiming at four chunks
+            per core. */
   );
 
 #else // DOXYGEN
@@ -175,6 +296,147 @@ void Scan(
   Scan(first, last, output_iterator, neutral, scan, transformation, policy, 0);
 }
 
+/**
+ * Overload of above described Doxygen dummy.
+ */
+template<typename RAIIn, typename RAIOut, typename ReturnType,
+         typename ScanFunction, typename TransformationFunction>
+void ExclusiveScan(
+  RAIIn first,
+  RAIIn last,
+  RAIOut output_iterator,
+  ReturnType neutral,
+  ScanFunction scan,
+  TransformationFunction transformation,
+  const embb::tasks::ExecutionPolicy& policy,
+  size_t block_size
+  );
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename RAIIn, typename RAIOut, typename ReturnType,
+         typename ScanFunction>
+void ExclusiveScan(
+  RAIIn first,
+  RAIIn last,
+  RAIOut output_iterator,
+  ReturnType neutral,
+  ScanFunction scan
+  ) {
+  ExclusiveScan(first, last, output_iterator, neutral, scan, Identity(),
+    embb::tasks::ExecutionPolicy(), 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename RAIIn, typename RAIOut, typename ReturnType,
+         typename ScanFunction, typename TransformationFunction>
+void ExclusiveScan(
+  RAIIn first,
+  RAIIn last,
+  RAIOut output_iterator,
+  ReturnType neutral,
+  ScanFunction scan,
+  TransformationFunction transformation
+  ) {
+  ExclusiveScan(first, last, output_iterator, neutral, scan, transformation,
+    embb::tasks::ExecutionPolicy(), 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename RAIIn, typename RAIOut, typename ReturnType,
+         typename ScanFunction, typename TransformationFunction>
+void ExclusiveScan(
+  RAIIn first,
+  RAIIn last,
+  RAIOut output_iterator,
+  ReturnType neutral,
+  ScanFunction scan,
+  TransformationFunction transformation,
+  const embb::tasks::ExecutionPolicy& policy
+  ) {
+  ExclusiveScan(first, last, output_iterator, neutral, scan, transformation,
+    policy, 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy.
+ */
+template<typename RAIIn, typename RAIFlags, typename RAIOut,
+         typename ReturnType, typename ScanFunction,
+         typename TransformationFunction>
+void SegmentedScan(
+  RAIIn first,
+  RAIIn last,
+  RAIFlags flags_first,
+  RAIOut output_iterator,
+  ReturnType neutral,
+  ScanFunction scan,
+  TransformationFunction transformation,
+  const embb::tasks::ExecutionPolicy& policy,
+  size_t block_size
+  );
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename RAIIn, typename RAIFlags, typename RAIOut,
+         typename ReturnType, typename ScanFunction>
+void SegmentedScan(
+  RAIIn first,
+  RAIIn last,
+  RAIFlags flags_first,
+  RAIOut output_iterator,
+  ReturnType neutral,
+  ScanFunction scan
+  ) {
+  SegmentedScan(first, last, flags_first, output_iterator, neutral, scan,
+    Identity(), embb::tasks::ExecutionPolicy(), 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename RAIIn, typename RAIFlags, typename RAIOut,
+         typename ReturnType, typename ScanFunction,
+         typename TransformationFunction>
+void SegmentedScan(
+  RAIIn first,
+  RAIIn last,
+  RAIFlags flags_first,
+  RAIOut output_iterator,
+  ReturnType neutral,
+  ScanFunction scan,
+  TransformationFunction transformation
+  ) {
+  SegmentedScan(first, last, flags_first, output_iterator, neutral, scan,
+    transformation, embb::tasks::ExecutionPolicy(), 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename RAIIn, typename RAIFlags, typename RAIOut,
+         typename ReturnType, typename ScanFunction,
+         typename TransformationFunction>
+void SegmentedScan(
+  RAIIn first,
+  RAIIn last,
+  RAIFlags flags_first,
+  RAIOut output_iterator,
+  ReturnType neutral,
+  ScanFunction scan,
+  TransformationFunction transformation,
+  const embb::tasks::ExecutionPolicy& policy
+  ) {
+  SegmentedScan(first, last, flags_first, output_iterator, neutral, scan,
+    transformation, policy, 0);
+}
+
 #endif // else DOXYGEN
 
 /**
@@ -0,0 +1,383 @@
+/*
+ * Copyright (c) 2014-2015, Siemens AG. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef EMBB_ALGORITHMS_SELECTION_H_
+#define EMBB_ALGORITHMS_SELECTION_H_
+
+#include <functional>
+#include <iterator>
+#include <embb/tasks/execution_policy.h>
+
+namespace embb {
+namespace algorithms {
+
+/**
+ * \ingroup CPP_ALGORITHMS_SORTING
+ * \{
+ */
+
+#ifdef DOXYGEN
+
+/**
+ * Rearranges a range of elements in parallel such that the element at
+ * position \c nth is the one that would be there if the range was sorted.
+ *
+ * The range consists of the elements from \c first to \c last, excluding the
+ * last element. Afterwards, no element before \c nth is greater and no
+ * element after \c nth is less than the element at \c nth. The range is
+ * repeatedly partitioned around a pivot selected from a sample of its
+ * elements, using the parallel partitioning of QuickSort(), and only the part
+ * containing \c nth is processed further. This requires linear work on
+ * average.
+ *
+ * \throws embb::base::ErrorException if the range is negative, \c nth does
+ *         not lie in the range, the execution policy contains no cores, or a
+ *         task could not be started.
+ * \threadsafe if the elements in the range <tt>[first,last)</tt> are not
+ *             modified by another thread while the algorithm is executed.
+ * \note No guarantee is given on the execution order of the comparison
+ *       operations.
+ * \see PartialSort(), TopK(), QuickSort(), embb::mtapi::ExecutionPolicy
+ * \tparam RAI Random access iterator
+ * \tparam ComparisonFunction Binary predicate with both arguments of type
+ *         <tt>std::iterator_traits<RAI>::value_type</tt>.
+ */
+template <typename RAI, typename ComparisonFunction>
+void NthElement(
+  RAI first,
+  /**< [IN] Random access iterator pointing to the first element of the range */
+  RAI nth,
+  /**< [IN] Random access iterator pointing to the element to be placed at its
+            sorted position */
+  RAI last,
+  /**< [IN] Random access iterator pointing to the last plus one element of the
+            range */
+  ComparisonFunction comparison
+    = std::less<typename std::iterator_traits<RAI>::value_type>(),
+  /**< [IN] Binary predicate used to establish the sorting order. An element
+            \c a appears before an element \c b in the sorted range if
+            <tt>comparison(a, b) == true</tt>. The default value uses the
+            less-than relation. */
+  const embb::mtapi::ExecutionPolicy& policy = embb::mtapi::ExecutionPolicy(),
+  /**< [IN] embb::mtapi::ExecutionPolicy for the selection */
+  size_t block_size = 0
+  /**< [IN] Ranges with at most this many elements are not partitioned in
+            parallel anymore, but processed sequentially. The default value 0
+            means that the block size is the number of elements in the range
+            divided by the number of available cores. */
+  );
+
+/**
+ * Sorts the smallest elements of a range in parallel.
+ *
+ * The range consists of the elements from \c first to \c last, excluding the
+ * last element. Afterwards, the range <tt>[first,middle)</tt> contains the
+ * <tt>middle-first</tt> smallest elements in sorted order. The remaining
+ * elements are in unspecified order. The smallest elements are selected by
+ * NthElement() and then sorted by QuickSort().
+ *
+ * \throws embb::base::ErrorException if the range is negative, \c middle does
+ *         not lie in the range, the execution policy contains no cores, or a
+ *         task could not be started.
+ * \threadsafe if the elements in the range <tt>[first,last)</tt> are not
+ *             modified by another thread while the algorithm is executed.
+ * \note No guarantee is given on the execution order of the comparison
+ *       operations.
+ * \see NthElement(), TopK(), QuickSort(), embb::mtapi::ExecutionPolicy
+ * \tparam RAI Random access iterator
+ * \tparam ComparisonFunction Binary predicate with both arguments of type
+ *         <tt>std::iterator_traits<RAI>::value_type</tt>.
+ */
+template <typename RAI, typename ComparisonFunction>
+void PartialSort(
+  RAI first,
+  /**< [IN] Random access iterator pointing to the first element of the range */
+  RAI middle,
+  /**< [IN] Random access iterator pointing to the last plus one element of the
+            sorted part of the range */
+  RAI last,
+  /**< [IN] Random access iterator pointing to the last plus one element of the
+            range */
+  ComparisonFunction comparison
+    = std::less<typename std::iterator_traits<RAI>::value_type>(),
+  /**< [IN] Binary predicate used to establish the sorting order. An element
+            \c a appears before an element \c b in the sorted range if
+            <tt>comparison(a, b) == true</tt>. The default value uses the
+            less-than relation. */
+  const embb::mtapi::ExecutionPolicy& policy = embb::mtapi::ExecutionPolicy(),
+  /**< [IN] embb::mtapi::ExecutionPolicy for the selection and sorting */
+  size_t block_size = 0
+  /**< [IN] Lower bound for partitioning ranges into blocks that are processed
+            in parallel. The default value 0 selects the default block sizes
+            of NthElement() for selecting the smallest elements and of
+            QuickSort() for sorting them. */
+  );
+
+/**
+ * Copies the \c k smallest elements of a range in sorted order to an output
+ * range in parallel.
+ *
+ * The input range consists of the elements from \c first to \c last,
+ * excluding the last element, and is not modified. If the range contains
+ * less than \c k elements, all of them are copied. To obtain the \c k largest
+ * elements, use <tt>std::greater</tt> as comparison function.
+ *
+ * If \c k is small compared to the number of elements, each thread collects
+ * the smallest elements it encounters in a private heap holding at most \c k
+ * elements, and the heaps are merged at the end. Otherwise, the elements are
+ * copied to a temporary array and selected by PartialSort().
+ *
+ * \return Iterator pointing to the last plus one element written to the
+ *         output range
+ * \throws embb::base::ErrorException if the range is negative, the execution
+ *         policy contains no cores, or a task could not be started.
+ * \memory Up to \c k elements of type
+ *         <tt>std::iterator_traits<RAIIn>::value_type</tt> per thread, or an
+ *         array with <tt>last-first</tt> elements if \c k is large.
+ * \threadsafe if the elements in the ranges are not modified by another thread
+ *             while the algorithm is executed.
+ * \note No guarantee is given on the execution order of the comparison
+ *       operations.
+ * \see PartialSort(), NthElement(), embb::mtapi::ExecutionPolicy
+ * \tparam RAIIn Random access iterator of the input range
+ * \tparam RAIOut Random access iterator of the output range
+ * \tparam ComparisonFunction Binary predicate with both arguments of type
+ *         <tt>std::iterator_traits<RAIIn>::value_type</tt>.
+ */
+template <typename RAIIn, typename RAIOut, typename ComparisonFunction>
+RAIOut TopK(
+  RAIIn first,
+  /**< [IN] Random access iterator pointing to the first element of the input
+            range */
+  RAIIn last,
+  /**< [IN] Random access iterator pointing to the last plus one element of the
+            input range */
+  RAIOut output,
+  /**< [OUT] Random access iterator pointing to the first element of the
+             output range, which must have space for \c k elements */
+  size_t k,
+  /**< [IN] Number of elements to select */
+  ComparisonFunction comparison
+    = std::less<typename std::iterator_traits<RAIIn>::value_type>(),
+  /**< [IN] Binary predicate used to establish the sorting order. An element
+            \c a is selected before an element \c b if
+            <tt>comparison(a, b) == true</tt>. The default value uses the
+            less-than relation. */
+  const embb::mtapi::ExecutionPolicy& policy = embb::mtapi::ExecutionPolicy(),
+  /**< [IN] embb::mtapi::ExecutionPolicy for the selection */
+  size_t block_size = 0
+  /**< [IN] Lower bound for partitioning the input range into blocks that are
+            processed in parallel. The default value 0 means that ranges of
+            more than n/(4*c) elements are always split, where n is the number
+            of elements in the range and c the number of cores of the policy.
+            Smaller ranges are split only while workers of the policy are
+            idle, down to blocks of n/(128*c) elements, but at least one
+            element. */
+  );
+
+#else // DOXYGEN
+
+/**
+ * Overload of above described Doxygen dummy.
+ */
+template <typename RAI, typename ComparisonFunction>
+void NthElement(
+  RAI first,
+  RAI nth,
+  RAI last,
+  ComparisonFunction comparison,
+  const embb::tasks::ExecutionPolicy& policy,
+  size_t block_size
+  );
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template <typename RAI>
+void NthElement(
+  RAI first,
+  RAI nth,
+  RAI last
+  ) {
+  NthElement(first, nth, last,
+             std::less<typename std::iterator_traits<RAI>::value_type>(),
+             embb::tasks::ExecutionPolicy(), 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template <typename RAI, typename ComparisonFunction>
+void NthElement(
+  RAI first,
+  RAI nth,
+  RAI last,
+  ComparisonFunction comparison
+  ) {
+  NthElement(first, nth, last, comparison, embb::tasks::ExecutionPolicy(), 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template <typename RAI, typename ComparisonFunction>
+void NthElement(
+  RAI first,
+  RAI nth,
+  RAI last,
+  ComparisonFunction comparison,
+  const embb::tasks::ExecutionPolicy& policy
+  ) {
+  NthElement(first, nth, last, comparison, policy, 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy.
+ */
+template <typename RAI, typename ComparisonFunction>
+void PartialSort(
+  RAI first,
+  RAI middle,
+  RAI last,
+  ComparisonFunction comparison,
+  const embb::tasks::ExecutionPolicy& policy,
+  size_t block_size
+  );
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template <typename RAI>
+void PartialSort(
+  RAI first,
+  RAI middle,
+  RAI last
+  ) {
+  PartialSort(first, middle, last,
+              std::less<typename std::iterator_traits<RAI>::value_type>(),
+              embb::tasks::ExecutionPolicy(), 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template <typename RAI, typename ComparisonFunction>
+void PartialSort(
+  RAI first,
+  RAI middle,
+  RAI last,
+  ComparisonFunction comparison
+  ) {
+  PartialSort(first, middle, last, comparison, embb::tasks::ExecutionPolicy(),
+              0);
+}
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template <typename RAI, typename ComparisonFunction>
+void PartialSort(
+  RAI first,
+  RAI middle,
+  RAI last,
+  ComparisonFunction comparison,
+  const embb::tasks::ExecutionPolicy& policy
+  ) {
+  PartialSort(first, middle, last, comparison, policy, 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy.
+ */
+template <typename RAIIn, typename RAIOut, typename ComparisonFunction>
+RAIOut TopK(
+  RAIIn first,
+  RAIIn last,
+  RAIOut output,
+  size_t k,
+  ComparisonFunction comparison,
+  const embb::tasks::ExecutionPolicy& policy,
+  size_t block_size
+  );
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template <typename RAIIn, typename RAIOut>
+RAIOut TopK(
+  RAIIn first,
+  RAIIn last,
+  RAIOut output,
+  size_t k
+  ) {
+  return TopK(first, last, output, k,
+              std::less<typename std::iterator_traits<RAIIn>::value_type>(),
+              embb::tasks::ExecutionPolicy(), 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template <typename RAIIn, typename RAIOut, typename ComparisonFunction>
+RAIOut TopK(
+  RAIIn first,
+  RAIIn last,
+  RAIOut output,
+  size_t k,
+  ComparisonFunction comparison
+  ) {
+  return TopK(first, last, output, k, comparison,
+              embb::tasks::ExecutionPolicy(), 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template <typename RAIIn, typename RAIOut, typename ComparisonFunction>
+RAIOut TopK(
+  RAIIn first,
+  RAIIn last,
+  RAIOut output,
+  size_t k,
+  ComparisonFunction comparison,
+  const embb::tasks::ExecutionPolicy& policy
+  ) {
+  return TopK(first, last, output, k, comparison, policy, 0);
+}
+
+#endif // else DOXYGEN
+
+/**
+ * \}
+ */
+
+}  // namespace algorithms
+}  // namespace embb
+
+#include <embb/algorithms/internal/selection-inl.h>
+
+#endif  // EMBB_ALGORITHMS_SELECTION_H_
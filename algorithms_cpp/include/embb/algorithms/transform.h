@@ -0,0 +1,488 @@
+/*
+ * Copyright (c) 2014-2015, Siemens AG. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef EMBB_ALGORITHMS_TRANSFORM_H_
+#define EMBB_ALGORITHMS_TRANSFORM_H_
+
+#include <embb/tasks/execution_policy.h>
+#include <iterator>
+
+namespace embb {
+namespace algorithms {
+
+/**
+ * \defgroup CPP_ALGORITHMS_TRANSFORM Transformation
+ * Parallel element-wise transformation, filling, copying, and generation
+ * \ingroup CPP_ALGORITHMS
+ *
+ * The range is partitioned into blocks whose boundaries are aligned to the
+ * cache lines of the output, so that no two tasks write to the same cache
+ * line. On x86-64 platforms, Fill() and Copy() write outputs of arithmetic
+ * types that are larger than typical last level caches with non-temporal
+ * stores, which bypass the caches and do not evict the working sets of other
+ * workers.
+ * \{
+ */
+
+#ifdef DOXYGEN
+
+/**
+ * Applies a unary function to the elements of a range in parallel and stores
+ * the results in an output range.
+ *
+ * The input range consists of the elements from \c first to \c last,
+ * excluding the last element. The output range starts at \c output and has
+ * the same number of elements. The input and output ranges may be identical,
+ * but must not overlap otherwise.
+ *
+ * \return Iterator pointing to the last plus one element of the output range
+ * \throws embb::base::ErrorException if the range is negative, the execution
+ *         policy contains no cores, or a task could not be started.
+ * \threadsafe if the elements in the ranges are not modified by another thread
+ *             while the algorithm is executed.
+ * \note No guarantee is given on the order in which the function is applied to
+ *       the elements.
+ * \see ForEach(), ZipIterator, embb::mtapi::ExecutionPolicy
+ * \tparam RAIIn Random access iterator of the input range
+ * \tparam RAIOut Random access iterator of the output range
+ * \tparam UnaryFunction Unary function with argument of type
+ *         <tt>std::iterator_traits<RAIIn>::value_type</tt> and a result
+ *         assignable to <tt>std::iterator_traits<RAIOut>::value_type</tt>.
+ */
+template<typename RAIIn, typename RAIOut, typename UnaryFunction>
+RAIOut Transform(
+  RAIIn first,
+  /**< [IN] Random access iterator pointing to the first element of the input
+            range */
+  RAIIn last,
+  /**< [IN] Random access iterator pointing to the last plus one element of the
+            input range */
+  RAIOut output,
+  /**< [OUT] Random access iterator pointing to the first element of the
+             output range */
+  UnaryFunction unary,
+  /**< [IN] Unary function applied to each element in the input range */
+  const embb::mtapi::ExecutionPolicy& policy = embb::mtapi::ExecutionPolicy(),
+  /**< [IN] embb::mtapi::ExecutionPolicy for the transformation */
+  size_t block_size = 0
+  /**< [IN] Lower bound for partitioning the range of elements into blocks that
+            are treated in parallel. Partitioning of a block stops if its size
+            is less than or equal to \c block_size. The default value 0 means
+            that ranges of more than n/(4*c) elements are always split, where
+            n is the number of elements in the range and c the number of cores
+            of the policy. Smaller ranges are split only while workers of the
+            policy are idle, down to blocks of n/(128*c) elements, but at
+            least one element. */
+  );
+
+/**
+ * Applies a binary function to the pairs of elements of two ranges in
+ * parallel and stores the results in an output range.
+ *
+ * The first input range consists of the elements from \c first1 to \c last1,
+ * excluding the last element. The second input range and the output range
+ * start at \c first2 and \c output, respectively, and have the same number of
+ * elements. The output range may be identical to one of the input ranges, but
+ * must not overlap them otherwise.
+ *
+ * \return Iterator pointing to the last plus one element of the output range
+ * \throws embb::base::ErrorException if the range is negative, the execution
+ *         policy contains no cores, or a task could not be started.
+ * \threadsafe if the elements in the ranges are not modified by another thread
+ *             while the algorithm is executed.
+ * \note No guarantee is given on the order in which the function is applied to
+ *       the elements.
+ * \see ForEach(), ZipIterator, embb::mtapi::ExecutionPolicy
+ * \tparam RAIIn1 Random access iterator of the first input range
+ * \tparam RAIIn2 Random access iterator of the second input range
+ * \tparam RAIOut Random access iterator of the output range
+ * \tparam BinaryFunction Binary function with arguments of types
+ *         <tt>std::iterator_traits<RAIIn1>::value_type</tt> and
+ *         <tt>std::iterator_traits<RAIIn2>::value_type</tt> and a result
+ *         assignable to <tt>std::iterator_traits<RAIOut>::value_type</tt>.
+ */
+template<typename RAIIn1, typename RAIIn2, typename RAIOut,
+         typename BinaryFunction>
+RAIOut Transform(
+  RAIIn1 first1,
+  /**< [IN] Random access iterator pointing to the first element of the first
+            input range */
+  RAIIn1 last1,
+  /**< [IN] Random access iterator pointing to the last plus one element of the
+            first input range */
+  RAIIn2 first2,
+  /**< [IN] Random access iterator pointing to the first element of the second
+            input range */
+  RAIOut output,
+  /**< [OUT] Random access iterator pointing to the first element of the
+             output range */
+  BinaryFunction binary,
+  /**< [IN] Binary function applied to each pair of elements */
+  const embb::mtapi::ExecutionPolicy& policy = embb::mtapi::ExecutionPolicy(),
+  /**< [IN] embb::mtapi::ExecutionPolicy for the transformation */
+  size_t block_size = 0
+  /**< [IN] Lower bound for partitioning the range of elements into blocks that
+            are treated in parallel. Partitioning of a block stops if its size
+            is less than or equal to \c block_size. The default value 0 means
+            that ranges of more than n/(4*c) elements are always split, where
+            n is the number of elements in the range and c the number of cores
+            of the policy. Smaller ranges are split only while workers of the
+            policy are idle, down to blocks of n/(128*c) elements, but at
+            least one element. */
+  );
+
+/**
+ * Assigns a value to all elements of a range in parallel.
+ *
+ * The range consists of the elements from \c first to \c last, excluding the
+ * last element.
+ *
+ * \throws embb::base::ErrorException if the range is negative, the execution
+ *         policy contains no cores, or a task could not be started.
+ * \threadsafe if the elements in the range are not accessed by another thread
+ *             while the algorithm is executed.
+ * \see Generate(), embb::mtapi::ExecutionPolicy
+ * \tparam RAI Random access iterator
+ * \tparam ValueType Type of \c value, which is assignable to
+ *         <tt>std::iterator_traits<RAI>::value_type</tt>.
+ */
+template<typename RAI, typename ValueType>
+void Fill(
+  RAI first,
+  /**< [IN] Random access iterator pointing to the first element of the range */
+  RAI last,
+  /**< [IN] Random access iterator pointing to the last plus one element of the
+            range */
+  const ValueType& value,
+  /**< [IN] Value assigned to the elements in the range */
+  const embb::mtapi::ExecutionPolicy& policy = embb::mtapi::ExecutionPolicy(),
+  /**< [IN] embb::mtapi::ExecutionPolicy for the filling */
+  size_t block_size = 0
+  /**< [IN] Lower bound for partitioning the range of elements into blocks that
+            are treated in parallel. Partitioning of a block stops if its size
+            is less than or equal to \c block_size. The default value 0 means
+            that ranges of more than n/(4*c) elements are always split, where
+            n is the number of elements in the range and c the number of cores
+            of the policy. Smaller ranges are split only while workers of the
+            policy are idle, down to blocks of n/(128*c) elements, but at
+            least one element. */
+  );
+
+/**
+ * Copies the elements of a range in parallel to an output range.
+ *
+ * The input range consists of the elements from \c first to \c last,
+ * excluding the last element. The output range starts at \c output and has
+ * the same number of elements. The ranges must not overlap.
+ *
+ * \return Iterator pointing to the last plus one element of the output range
+ * \throws embb::base::ErrorException if the range is negative, the execution
+ *         policy contains no cores, or a task could not be started.
+ * \threadsafe if the elements in the ranges are not modified by another thread
+ *             while the algorithm is executed.
+ * \see Transform(), embb::mtapi::ExecutionPolicy
+ * \tparam RAIIn Random access iterator of the input range
+ * \tparam RAIOut Random access iterator of the output range
+ */
+template<typename RAIIn, typename RAIOut>
+RAIOut Copy(
+  RAIIn first,
+  /**< [IN] Random access iterator pointing to the first element of the input
+            range */
+  RAIIn last,
+  /**< [IN] Random access iterator pointing to the last plus one element of the
+            input range */
+  RAIOut output,
+  /**< [OUT] Random access iterator pointing to the first element of the
+             output range */
+  const embb::mtapi::ExecutionPolicy& policy = embb::mtapi::ExecutionPolicy(),
+  /**< [IN] embb::mtapi::ExecutionPolicy for the copying */
+  size_t block_size = 0
+  /**< [IN] Lower bound for partitioning the range of elements into blocks that
+            are treated in parallel. Partitioning of a block stops if its size
+            is less than or equal to \c block_size. The default value 0 means
+            that ranges of more than n/(4*c) elements are always split, where
+            n is the number of elements in the range and c the number of cores
+            of the policy. Smaller ranges are split only while workers of the
+            policy are idle, down to blocks of n/(128*c) elements, but at
+            least one element. */
+  );
+
+/**
+ * Assigns the results of successive calls of a generator to the elements of a
+ * range in parallel.
+ *
+ * The range consists of the elements from \c first to \c last, excluding the
+ * last element.
+ *
+ * \throws embb::base::ErrorException if the range is negative, the execution
+ *         policy contains no cores, or a task could not be started.
+ * \threadsafe if the elements in the range are not accessed by another thread
+ *             while the algorithm is executed.
+ * \note The generator is copied and called concurrently by several tasks. No
+ *       guarantee is given on the order in which the elements are assigned,
+ *       so the generator should not depend on the number of previous calls.
+ * \see Fill(), embb::mtapi::ExecutionPolicy
+ * \tparam RAI Random access iterator
+ * \tparam Generator Function without arguments and a result assignable to
+ *         <tt>std::iterator_traits<RAI>::value_type</tt>.
+ */
+template<typename RAI, typename Generator>
+void Generate(
+  RAI first,
+  /**< [IN] Random access iterator pointing to the first element of the range */
+  RAI last,
+  /**< [IN] Random access iterator pointing to the last plus one element of the
+            range */
+  Generator generator,
+  /**< [IN] Generator called for each element in the range */
+  const embb::mtapi::ExecutionPolicy& policy = embb::mtapi::ExecutionPolicy(),
+  /**< [IN] embb::mtapi::ExecutionPolicy for the generation */
+  size_t block_size = 0
+  /**< [IN] Lower bound for partitioning the range of elements into blocks that
+            are treated in parallel. Partitioning of a block stops if its size
+            is less than or equal to \c block_size. The default value 0 means
+            that ranges of more than n/(4*c) elements are always split, where
+            n is the number of elements in the range and c the number of cores
+            of the policy. Smaller ranges are split only while workers of the
+            policy are idle, down to blocks of n/(128*c) elements, but at
+            least one element. */
+  );
+
+#else // DOXYGEN
+
+/**
+ * Overload of above described Doxygen dummy.
+ */
+template<typename RAIIn, typename RAIOut, typename UnaryFunction>
+RAIOut Transform(
+  RAIIn first,
+  RAIIn last,
+  RAIOut output,
+  UnaryFunction unary,
+  const embb::tasks::ExecutionPolicy& policy,
+  size_t block_size
+  );
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename RAIIn, typename RAIOut, typename UnaryFunction>
+RAIOut Transform(
+  RAIIn first,
+  RAIIn last,
+  RAIOut output,
+  UnaryFunction unary
+  ) {
+  return Transform(first, last, output, unary, embb::tasks::ExecutionPolicy(),
+                   0);
+}
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename RAIIn, typename RAIOut, typename UnaryFunction>
+RAIOut Transform(
+  RAIIn first,
+  RAIIn last,
+  RAIOut output,
+  UnaryFunction unary,
+  const embb::tasks::ExecutionPolicy& policy
+  ) {
+  return Transform(first, last, output, unary, policy, 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy.
+ */
+template<typename RAIIn1, typename RAIIn2, typename RAIOut,
+         typename BinaryFunction>
+RAIOut Transform(
+  RAIIn1 first1,
+  RAIIn1 last1,
+  RAIIn2 first2,
+  RAIOut output,
+  BinaryFunction binary,
+  const embb::tasks::ExecutionPolicy& policy,
+  size_t block_size
+  );
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename RAIIn1, typename RAIIn2, typename RAIOut,
+         typename BinaryFunction>
+RAIOut Transform(
+  RAIIn1 first1,
+  RAIIn1 last1,
+  RAIIn2 first2,
+  RAIOut output,
+  BinaryFunction binary
+  ) {
+  return Transform(first1, last1, first2, output, binary,
+                   embb::tasks::ExecutionPolicy(), 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename RAIIn1, typename RAIIn2, typename RAIOut,
+         typename BinaryFunction>
+RAIOut Transform(
+  RAIIn1 first1,
+  RAIIn1 last1,
+  RAIIn2 first2,
+  RAIOut output,
+  BinaryFunction binary,
+  const embb::tasks::ExecutionPolicy& policy
+  ) {
+  return Transform(first1, last1, first2, output, binary, policy, 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy.
+ */
+template<typename RAI, typename ValueType>
+void Fill(
+  RAI first,
+  RAI last,
+  const ValueType& value,
+  const embb::tasks::ExecutionPolicy& policy,
+  size_t block_size
+  );
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename RAI, typename ValueType>
+void Fill(
+  RAI first,
+  RAI last,
+  const ValueType& value
+  ) {
+  Fill(first, last, value, embb::tasks::ExecutionPolicy(), 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename RAI, typename ValueType>
+void Fill(
+  RAI first,
+  RAI last,
+  const ValueType& value,
+  const embb::tasks::ExecutionPolicy& policy
+  ) {
+  Fill(first, last, value, policy, 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy.
+ */
+template<typename RAIIn, typename RAIOut>
+RAIOut Copy(
+  RAIIn first,
+  RAIIn last,
+  RAIOut output,
+  const embb::tasks::ExecutionPolicy& policy,
+  size_t block_size
+  );
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename RAIIn, typename RAIOut>
+RAIOut Copy(
+  RAIIn first,
+  RAIIn last,
+  RAIOut output
+  ) {
+  return Copy(first, last, output, embb::tasks::ExecutionPolicy(), 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename RAIIn, typename RAIOut>
+RAIOut Copy(
+  RAIIn first,
+  RAIIn last,
+  RAIOut output,
+  const embb::tasks::ExecutionPolicy& policy
+  ) {
+  return Copy(first, last, output, policy, 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy.
+ */
+template<typename RAI, typename Generator>
+void Generate(
+  RAI first,
+  RAI last,
+  Generator generator,
+  const embb::tasks::ExecutionPolicy& policy,
+  size_t block_size
+  );
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename RAI, typename Generator>
+void Generate(
+  RAI first,
+  RAI last,
+  Generator generator
+  ) {
+  Generate(first, last, generator, embb::tasks::ExecutionPolicy(), 0);
+}
+
+/**
+ * Overload of above described Doxygen dummy with less arguments.
+ */
+template<typename RAI, typename Generator>
+void Generate(
+  RAI first,
+  RAI last,
+  Generator generator,
+  const embb::tasks::ExecutionPolicy& policy
+  ) {
+  Generate(first, last, generator, policy, 0);
+}
+
+#endif // else DOXYGEN
+
+/**
+ * \}
+ */
+
+}  // namespace algorithms
+}  // namespace embb
+
+#include <embb/algorithms/internal/transform-inl.h>
+
+#endif  // EMBB_ALGORITHMS_TRANSFORM_H_
@@ -0,0 +1,347 @@
+/*
+ * Copyright (c) 2014-2015, Siemens AG. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <compaction_test.h>
+#include <embb/algorithms/compaction.h>
+#include <embb/tasks/execution_policy.h>
+#include <algorithm>
+#include <deque>
+#include <functional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct IsEven {
+  bool operator()(int val) const {
+    return val % 2 == 0;
+  }
+};
+
+bool IsEvenFunction(int val) {
+  return val % 2 == 0;
+}
+
+struct IsOdd {
+  bool operator()(int val) const {
+    return val % 2 != 0;
+  }
+};
+
+struct IsNonNegative {
+  bool operator()(int val) const {
+    return val >= 0;
+  }
+};
+
+struct IsNegative {
+  bool operator()(int val) const {
+    return val < 0;
+  }
+};
+
+struct HasEvenLength {
+  bool operator()(const std::string& val) const {
+    return val.size() % 2 == 0;
+  }
+};
+
+struct HasOddLength {
+  bool operator()(const std::string& val) const {
+    return val.size() % 2 != 0;
+  }
+};
+
+struct SameLength {
+  bool operator()(const std::string& lhs, const std::string& rhs) const {
+    return lhs.size() == rhs.size();
+  }
+};
+
+struct SameTens {
+  bool operator()(int lhs, int rhs) const {
+    return lhs / 10 == rhs / 10;
+  }
+};
+
+}  // namespace
+
+CompactionTest::CompactionTest() {
+  CreateUnit("Different data structures")
+    .Add(&CompactionTest::TestDataStructures, this);
+  CreateUnit("CopyIf").Add(&CompactionTest::TestCopyIf, this);
+  CreateUnit("RemoveIf").Add(&CompactionTest::TestRemoveIf, this);
+  CreateUnit("Partition").Add(&CompactionTest::TestPartition, this);
+  CreateUnit("Unique").Add(&CompactionTest::TestUnique, this);
+  CreateUnit("Non-trivial elements")
+    .Add(&CompactionTest::TestNonTrivialElements, this);
+  CreateUnit("Chunk sizes").Add(&CompactionTest::TestChunkSizes, this);
+  CreateUnit("Policies").Add(&CompactionTest::TestPolicy, this);
+  CreateUnit("Stress test").Add(&CompactionTest::StressTest, this);
+}
+
+void CompactionTest::TestDataStructures() {
+  using embb::algorithms::CopyIf;
+  const int size = 10;
+  int array[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+  std::vector<int> vector(array, array + size);
+  std::deque<int> deque(array, array + size);
+  const std::vector<int> const_vector(array, array + size);
+
+  int array_out[size];
+  std::vector<int> vector_out(size);
+  std::deque<int> deque_out(size);
+
+  PT_EXPECT(CopyIf(array, array + size, array_out, IsEven()) ==
+            array_out + 5);
+  PT_EXPECT(CopyIf(vector.begin(), vector.end(), deque_out.begin(),
+                   IsEven()) == deque_out.begin() + 5);
+  PT_EXPECT(CopyIf(deque.begin(), deque.end(), vector_out.begin(),
+                   IsEven()) == vector_out.begin() + 5);
+  for (int i = 0; i < 5; i++) {
+    PT_EXPECT_EQ(array_out[i], 2 * (i + 1));
+    PT_EXPECT_EQ(deque_out[i], 2 * (i + 1));
+    PT_EXPECT_EQ(vector_out[i], 2 * (i + 1));
+  }
+  PT_EXPECT(CopyIf(const_vector.begin(), const_vector.end(),
+                   vector_out.begin(), IsNegative()) == vector_out.begin());
+}
+
+void CompactionTest::TestCopyIf() {
+  using embb::algorithms::CopyIf;
+  const int size = 10;
+  int array[] = { 10, 21, 30, 31, 20, 11, 10, 21, 20, 20 };
+  int expected[] = { 10, 30, 20, 10, 20, 20 };
+  std::vector<int> output(size, -1);
+  PT_EXPECT(CopyIf(array, array + size, output.begin(), &IsEvenFunction) ==
+            output.begin() + 6);
+  for (int i = 0; i < size; i++) {
+    PT_EXPECT_EQ(output[i], (i < 6) ? expected[i] : -1);
+  }
+
+  // Empty range
+  PT_EXPECT(CopyIf(array, array, output.begin(), IsEven()) == output.begin());
+}
+
+void CompactionTest::TestRemoveIf() {
+  using embb::algorithms::RemoveIf;
+  const int size = 10;
+  int array[] = { 10, 21, 30, 31, 20, 11, 10, 21, 20, 20 };
+  int expected[] = { 21, 31, 11, 21 };
+  PT_EXPECT(RemoveIf(array, array + size, IsEven()) == array + 4);
+  for (int i = 0; i < 4; i++) {
+    PT_EXPECT_EQ(array[i], expected[i]);
+  }
+
+  // Nothing removed, everything removed, and empty range
+  std::deque<int> deque(expected, expected + 4);
+  PT_EXPECT(RemoveIf(deque.begin(), deque.end(), IsEven()) == deque.end());
+  PT_EXPECT(std::equal(deque.begin(), deque.end(), expected));
+  PT_EXPECT(RemoveIf(deque.begin(), deque.end(), IsNonNegative()) ==
+            deque.begin());
+  PT_EXPECT(RemoveIf(array, array, IsEven()) == array);
+}
+
+void CompactionTest::TestPartition() {
+  using embb::algorithms::Partition;
+  const int size = 10;
+  int array[] = { 10, 21, 30, 31, 20, 11, 12, 23, 24, 25 };
+  int expected[] = { 10, 30, 20, 12, 24, 21, 31, 11, 23, 25 };
+  PT_EXPECT(Partition(array, array + size, IsEven()) == array + 5);
+  for (int i = 0; i < size; i++) {
+    PT_EXPECT_EQ(array[i], expected[i]);
+  }
+
+  std::vector<int> vector(expected, expected + size);
+  PT_EXPECT(Partition(vector.begin(), vector.end(), IsNegative()) ==
+            vector.begin());
+  PT_EXPECT(std::equal(vector.begin(), vector.end(), expected));
+  PT_EXPECT(Partition(array, array, IsEven()) == array);
+}
+
+void CompactionTest::TestUnique() {
+  using embb::algorithms::Unique;
+  const int size = 10;
+  int array[] = { 1, 1, 2, 2, 2, 3, 1, 1, 4, 4 };
+  int expected[] = { 1, 2, 3, 1, 4 };
+  PT_EXPECT(Unique(array, array + size) == array + 5);
+  for (int i = 0; i < 5; i++) {
+    PT_EXPECT_EQ(array[i], expected[i]);
+  }
+
+  int tens[] = { 10, 15, 21, 29, 20, 31, 5, 3 };
+  int expected_tens[] = { 10, 21, 31, 5 };
+  std::deque<int> deque(tens, tens + 8);
+  PT_EXPECT(Unique(deque.begin(), deque.end(), SameTens()) ==
+            deque.begin() + 4);
+  PT_EXPECT(std::equal(deque.begin(), deque.begin() + 4, expected_tens));
+  PT_EXPECT(Unique(array, array + 1) == array + 1);
+  PT_EXPECT(Unique(array, array) == array);
+}
+
+void CompactionTest::TestNonTrivialElements() {
+  using embb::algorithms::CopyIf;
+  using embb::algorithms::RemoveIf;
+  using embb::algorithms::Partition;
+  using embb::algorithms::Unique;
+  // Strings exceeding the small string buffer, so that copies allocate
+  const size_t size = 5000;
+  std::vector<std::string> input(size);
+  for (size_t i = 0; i < size; i++) {
+    std::ostringstream stream;
+    stream << "element with a long enough name " << (i / 3) % 1000;
+    input[i] = stream.str();
+  }
+
+  std::vector<std::string> output(size);
+  std::vector<std::string> expected(size);
+  std::vector<std::string>::iterator last = CopyIf(input.begin(), input.end(),
+    output.begin(), HasEvenLength());
+  std::vector<std::string>::iterator expected_last = std::remove_copy_if(
+    input.begin(), input.end(), expected.begin(), HasOddLength());
+  PT_EXPECT(last - output.begin() == expected_last - expected.begin());
+  PT_EXPECT(std::equal(output.begin(), last, expected.begin()));
+
+  output = input;
+  expected = input;
+  last = RemoveIf(output.begin(), output.end(), HasEvenLength());
+  expected_last = std::remove_if(expected.begin(), expected.end(),
+                                 HasEvenLength());
+  PT_EXPECT(last - output.begin() == expected_last - expected.begin());
+  PT_EXPECT(std::equal(output.begin(), last, expected.begin()));
+
+  output = input;
+  expected = input;
+  last = Partition(output.begin(), output.end(), HasEvenLength());
+  expected_last = std::stable_partition(expected.begin(), expected.end(),
+                                        HasEvenLength());
+  PT_EXPECT(last - output.begin() == expected_last - expected.begin());
+  PT_EXPECT(output == expected);
+
+  output = input;
+  expected = input;
+  last = Unique(output.begin(), output.end(), SameLength());
+  expected_last = std::unique(expected.begin(), expected.end(), SameLength());
+  PT_EXPECT(last - output.begin() == expected_last - expected.begin());
+  PT_EXPECT(std::equal(output.begin(), last, expected.begin()));
+}
+
+void CompactionTest::TestChunkSizes() {
+  using embb::algorithms::CopyIf;
+  using embb::algorithms::RemoveIf;
+  using embb::algorithms::Partition;
+  using embb::algorithms::Unique;
+  using embb::tasks::ExecutionPolicy;
+  const size_t sizes[] = { 1, 2, 100, 1000, 10007 };
+  const size_t chunk_sizes[] = { 0, 1, 3, 64, 1000 };
+  for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+    size_t count = sizes[s];
+    std::vector<int> input(count);
+    for (size_t i = 0; i < count; i++) {
+      input[i] = static_cast<int>((i * 7919) % 13) - 3;
+    }
+    std::vector<int> expected(count);
+    std::vector<int>::iterator expected_end = std::remove_copy_if(
+      input.begin(), input.end(), expected.begin(), IsOdd());
+    expected.erase(expected_end, expected.end());
+    std::vector<int> expected_partition(input);
+    std::stable_partition(expected_partition.begin(),
+                          expected_partition.end(), IsNegative());
+    std::vector<int> expected_unique(input);
+    for (size_t i = 0; i < count; i++) {
+      expected_unique[i] /= 4;
+    }
+    expected_unique.erase(std::unique(expected_unique.begin(),
+                                      expected_unique.end()),
+                          expected_unique.end());
+
+    for (size_t c = 0; c < sizeof(chunk_sizes) / sizeof(chunk_sizes[0]);
+         c++) {
+      size_t chunk_size = chunk_sizes[c];
+      std::vector<int> output(count);
+      std::vector<int>::iterator end = CopyIf(input.begin(), input.end(),
+        output.begin(), IsEven(), ExecutionPolicy(), chunk_size);
+      PT_EXPECT(end - output.begin() ==
+                static_cast<std::ptrdiff_t>(expected.size()));
+      PT_EXPECT(std::equal(expected.begin(), expected.end(), output.begin()));
+
+      output = input;
+      end = RemoveIf(output.begin(), output.end(), IsOdd(),
+                     ExecutionPolicy(), chunk_size);
+      PT_EXPECT(end - output.begin() ==
+                static_cast<std::ptrdiff_t>(expected.size()));
+      PT_EXPECT(std::equal(expected.begin(), expected.end(), output.begin()));
+
+      output = input;
+      Partition(output.begin(), output.end(), IsNegative(),
+                ExecutionPolicy(), chunk_size);
+      PT_EXPECT(output == expected_partition);
+
+      output = input;
+      for (size_t i = 0; i < count; i++) {
+        output[i] /= 4;
+      }
+      end = Unique(output.begin(), output.end(), std::equal_to<int>(),
+                   ExecutionPolicy(), chunk_size);
+      PT_EXPECT(end - output.begin() ==
+                static_cast<std::ptrdiff_t>(expected_unique.size()));
+      PT_EXPECT(std::equal(expected_unique.begin(), expected_unique.end(),
+                           output.begin()));
+    }
+  }
+}
+
+void CompactionTest::TestPolicy() {
+  using embb::algorithms::CopyIf;
+  using embb::tasks::ExecutionPolicy;
+  int a[] = { 10, 21, 30, 31, 20, 11, 10, 21, 20, 20 };
+  std::vector<int> vector(a, a + (sizeof a / sizeof a[0]));
+  std::vector<int> output(vector.size());
+  PT_EXPECT(CopyIf(vector.begin(), vector.end(), output.begin(), IsEven(),
+                   ExecutionPolicy()) == output.begin() + 6);
+  PT_EXPECT(CopyIf(vector.begin(), vector.end(), output.begin(), IsEven(),
+                   ExecutionPolicy(true)) == output.begin() + 6);
+  PT_EXPECT(CopyIf(vector.begin(), vector.end(), output.begin(), IsEven(),
+                   ExecutionPolicy(true, 1)) == output.begin() + 6);
+}
+
+void CompactionTest::StressTest() {
+  using embb::algorithms::RemoveIf;
+  size_t count = embb::tasks::Node::GetInstance().GetCoreCount() * 10;
+  std::vector<int> large_vector(count);
+  for (size_t i = 0; i < count; i++) {
+    large_vector[i] = static_cast<int>(i);
+  }
+  std::vector<int>::iterator end =
+    RemoveIf(large_vector.begin(), large_vector.end(), IsEven());
+  PT_EXPECT(end - large_vector.begin() ==
+            static_cast<std::ptrdiff_t>(count / 2));
+  for (size_t i = 0; i < count / 2; i++) {
+    PT_EXPECT_EQ(large_vector[i], static_cast<int>(2 * i + 1));
+  }
+}
@@ -53,6 +53,8 @@ CountTest::CountTest() {
   CreateUnit("CountIf").Add(&CountTest::TestCountIf, this);
   CreateUnit("Ranges").Add(&CountTest::TestRanges, this);
   CreateUnit("Block sizes").Add(&CountTest::TestBlockSizes, this);
+  CreateUnit("Contiguous ranges")
+    .Add(&CountTest::TestContiguousRanges, this);
   CreateUnit("Policies").Add(&CountTest::TestPolicy, this);
   CreateUnit("Stress test").Add(&CountTest::StressTest, this);
 }
@@ -120,6 +122,29 @@ void CountTest::TestBlockSizes() {
   }
 }
 
+void CountTest::TestContiguousRanges() {
+  using embb::algorithms::Count;
+  using embb::algorithms::CountIf;
+  // Sizes below, at and above multiples of the counter count
+  const size_t sizes[] = { 1, 9, 16, 23, 1000, 1005 };
+  for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+    size_t count = sizes[s];
+    std::vector<int> vector(count);
+    std::ptrdiff_t threes = 0;
+    std::ptrdiff_t evens = 0;
+    for (size_t i = 0; i < count; i++) {
+      vector[i] = static_cast<int>((i * 7) % 10);
+      if (vector[i] == 3) threes++;
+      if (vector[i] % 2 == 0) evens++;
+    }
+    const int* array = &vector[0];
+    PT_EXPECT_EQ(Count(vector.begin(), vector.end(), 3), threes);
+    PT_EXPECT_EQ(Count(array, array + count, 3), threes);
+    PT_EXPECT_EQ(CountIf(vector.begin(), vector.end(), IsEven()), evens);
+    PT_EXPECT_EQ(CountIf(array, array + count, &IsEvenFunction), evens);
+  }
+}
+
 void CountTest::TestPolicy() {
   using embb::algorithms::Count;
   using embb::tasks::ExecutionPolicy;
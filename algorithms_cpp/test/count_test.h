@@ -60,6 +60,11 @@ class CountTest : public partest::TestCase {
    */
   void TestBlockSizes();
 
+  /**
+   * Tests counting contiguous ranges of various sizes.
+   */
+  void TestContiguousRanges();
+
   /**
    * Tests setting policies (without checking their actual execution).
    */
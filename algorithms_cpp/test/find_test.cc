@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2014-2015, Siemens AG. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <find_test.h>
+#include <embb/algorithms/find.h>
+#include <embb/tasks/execution_policy.h>
+#include <algorithm>
+#include <deque>
+#include <vector>
+
+namespace {
+
+struct IsOdd {
+  bool operator()(int val) const {
+    return val % 2 != 0;
+  }
+};
+
+bool IsOddFunction(int val) {
+  return val % 2 != 0;
+}
+
+struct IsNegative {
+  bool operator()(int val) const {
+    return val < 0;
+  }
+};
+
+}  // namespace
+
+FindTest::FindTest() {
+  CreateUnit("Different data structures")
+    .Add(&FindTest::TestDataStructures, this);
+  CreateUnit("FindIf").Add(&FindTest::TestFindIf, this);
+  CreateUnit("Leftmost match").Add(&FindTest::TestLeftmostMatch, this);
+  CreateUnit("Ranges").Add(&FindTest::TestRanges, this);
+  CreateUnit("Block sizes").Add(&FindTest::TestBlockSizes, this);
+  CreateUnit("Quantifiers").Add(&FindTest::TestQuantifiers, this);
+  CreateUnit("Policies").Add(&FindTest::TestPolicy, this);
+  CreateUnit("Stress test").Add(&FindTest::StressTest, this);
+}
+
+void FindTest::TestDataStructures() {
+  using embb::algorithms::Find;
+  const int size = 10;
+  int array[] = { 10, 20, 30, 30, 20, 10, 10, 20, 20, 20 };
+  std::vector<int> vector(array, array + size);
+  std::deque<int> deque(array, array + size);
+  const std::vector<int> const_vector(array, array + size);
+
+  PT_EXPECT(Find(array, array + size, 30) == array + 2);
+  PT_EXPECT(Find(vector.begin(), vector.end(), 30) == vector.begin() + 2);
+  PT_EXPECT(Find(deque.begin(), deque.end(), 30) == deque.begin() + 2);
+  PT_EXPECT(Find(const_vector.begin(), const_vector.end(), 30) ==
+            const_vector.begin() + 2);
+
+  // No match
+  PT_EXPECT(Find(array, array + size, 40) == array + size);
+  PT_EXPECT(Find(vector.begin(), vector.end(), 40) == vector.end());
+  PT_EXPECT(Find(deque.begin(), deque.end(), 40) == deque.end());
+}
+
+void FindTest::TestFindIf() {
+  using embb::algorithms::FindIf;
+  const int size = 10;
+  int array[] = { 10, 20, 30, 31, 20, 11, 10, 21, 20, 20 };
+  PT_EXPECT(FindIf(array, array + size, IsOdd()) == array + 3);
+  PT_EXPECT(FindIf(array, array + size, &IsOddFunction) == array + 3);
+  PT_EXPECT(FindIf(array, array + size, IsNegative()) == array + size);
+}
+
+void FindTest::TestLeftmostMatch() {
+  using embb::algorithms::Find;
+  using embb::tasks::ExecutionPolicy;
+  size_t count = 10000;
+  std::vector<int> vector(count, 0);
+  // Matches spread over the range, the leftmost one being at each position
+  const size_t positions[] = { 0, 1, 4999, 5000, 9998, 9999 };
+  for (size_t p = 0; p < sizeof(positions) / sizeof(positions[0]); p++) {
+    std::fill(vector.begin(), vector.end(), 0);
+    for (size_t i = positions[p]; i < count; i += 97) {
+      vector[i] = 1;
+    }
+    for (size_t block_size = 1; block_size <= count; block_size *= 10) {
+      PT_EXPECT(Find(vector.begin(), vector.end(), 1, ExecutionPolicy(),
+                     block_size) ==
+                vector.begin() + static_cast<std::ptrdiff_t>(positions[p]));
+    }
+  }
+}
+
+void FindTest::TestRanges() {
+  using embb::algorithms::Find;
+  size_t count = 4;
+  std::vector<int> vector(count, -1);
+  typedef std::vector<int>::iterator Iterator;
+
+  // Empty range
+  PT_EXPECT(Find(vector.begin(), vector.begin(), -1) == vector.begin());
+
+  // Ommit first element
+  PT_EXPECT(Find(vector.begin() + 1, vector.end(), -1) == vector.begin() + 1);
+
+  // Ommit last element
+  vector[count - 1] = 0;
+  Iterator last = vector.end() - 1;
+  PT_EXPECT(Find(vector.begin() + 1, last, 0) == last);
+
+  // Only do last element
+  PT_EXPECT(Find(vector.end() - 1, vector.end(), 0) == vector.end() - 1);
+
+  // Only do second element
+  PT_EXPECT(Find(vector.begin() + 1, vector.begin() + 2, -1) ==
+            vector.begin() + 1);
+}
+
+void FindTest::TestBlockSizes() {
+  using embb::algorithms::Find;
+  using embb::tasks::ExecutionPolicy;
+  size_t count = 4;
+  std::vector<int> vector(count, -1);
+  vector[count - 1] = 1;
+
+  for (size_t block_size = 1; block_size < count + 2; block_size++) {
+    PT_EXPECT(Find(vector.begin(), vector.end(), 1, ExecutionPolicy(),
+                   block_size) == vector.end() - 1);
+  }
+}
+
+void FindTest::TestQuantifiers() {
+  using embb::algorithms::AnyOf;
+  using embb::algorithms::AllOf;
+  using embb::algorithms::NoneOf;
+  const int size = 6;
+  int odd[] = { 1, 3, 5, 7, 9, 11 };
+  int mixed[] = { 2, 4, 6, 8, 10, 11 };
+  int even[] = { 2, 4, 6, 8, 10, 12 };
+
+  PT_EXPECT(AnyOf(odd, odd + size, IsOdd()));
+  PT_EXPECT(AllOf(odd, odd + size, IsOdd()));
+  PT_EXPECT(!NoneOf(odd, odd + size, IsOdd()));
+
+  PT_EXPECT(AnyOf(mixed, mixed + size, &IsOddFunction));
+  PT_EXPECT(!AllOf(mixed, mixed + size, &IsOddFunction));
+  PT_EXPECT(!NoneOf(mixed, mixed + size, &IsOddFunction));
+
+  PT_EXPECT(!AnyOf(even, even + size, IsOdd()));
+  PT_EXPECT(!AllOf(even, even + size, IsOdd()));
+  PT_EXPECT(NoneOf(even, even + size, IsOdd()));
+
+  // Empty range
+  PT_EXPECT(!AnyOf(odd, odd, IsOdd()));
+  PT_EXPECT(AllOf(odd, odd, IsOdd()));
+  PT_EXPECT(NoneOf(odd, odd, IsOdd()));
+}
+
+void FindTest::TestPolicy() {
+  using embb::algorithms::Find;
+  using embb::tasks::ExecutionPolicy;
+  int a[] = { 10, 20, 30, 30, 20, 10, 10, 20, 20, 20 };
+  std::vector<int> vector(a, a + (sizeof a / sizeof a[0]));
+  PT_EXPECT(Find(vector.begin(), vector.end(), 30, ExecutionPolicy()) ==
+            vector.begin() + 2);
+  PT_EXPECT(Find(vector.begin(), vector.end(), 30, ExecutionPolicy(true)) ==
+            vector.begin() + 2);
+  PT_EXPECT(Find(vector.begin(), vector.end(), 30,
+                 ExecutionPolicy(true, 1)) == vector.begin() + 2);
+}
+
+void FindTest::StressTest() {
+  using embb::algorithms::Find;
+  using embb::algorithms::AllOf;
+  size_t count = embb::tasks::Node::GetInstance().GetCoreCount() * 10;
+  std::vector<int> large_vector(count, 0);
+  PT_EXPECT(Find(large_vector.begin(), large_vector.end(), 1) ==
+            large_vector.end());
+  large_vector[count - 1] = 1;
+  PT_EXPECT(Find(large_vector.begin(), large_vector.end(), 1) ==
+            large_vector.end() - 1);
+  PT_EXPECT(!AllOf(large_vector.begin(), large_vector.end(), IsNegative()));
+}
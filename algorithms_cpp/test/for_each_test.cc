@@ -52,12 +52,91 @@ static void SquareFunction(int &val) {
   val = val * val;
 }
 
+/**
+ * Functor counting the visits of the indices of tiles of a two-dimensional
+ * range in a row-major matrix. Tiles larger than the tile size add a large
+ * value to their first index, such that the test detects them.
+ */
+struct CountVisits2D {
+  CountVisits2D(std::vector<int>* visits, size_t columns, size_t tile_size)
+  : visits(visits), columns(columns), tile_size(tile_size) {
+  }
+
+  void operator()(const embb::algorithms::BlockedRange2D& tile) const {
+    for (size_t row = tile.GetFirst(0); row != tile.GetLast(0); row++) {
+      for (size_t column = tile.GetFirst(1); column != tile.GetLast(1);
+           column++) {
+        (*visits)[row * columns + column]++;
+      }
+    }
+    if (tile.GetSize() > tile_size) {
+      (*visits)[tile.GetFirst(0) * columns + tile.GetFirst(1)] += 1000;
+    }
+  }
+
+  std::vector<int>* visits;
+  size_t columns;
+  size_t tile_size;
+};
+
+/**
+ * Functor counting the visits of the indices of tiles of a three-dimensional
+ * range in a row-major volume.
+ */
+struct CountVisits3D {
+  CountVisits3D(std::vector<int>* visits, size_t rows, size_t columns)
+  : visits(visits), rows(rows), columns(columns) {
+  }
+
+  void operator()(const embb::algorithms::BlockedRange3D& tile) const {
+    for (size_t slice = tile.GetFirst(0); slice != tile.GetLast(0); slice++) {
+      for (size_t row = tile.GetFirst(1); row != tile.GetLast(1); row++) {
+        for (size_t column = tile.GetFirst(2); column != tile.GetLast(2);
+             column++) {
+          (*visits)[(slice * rows + row) * columns + column]++;
+        }
+      }
+    }
+  }
+
+  std::vector<int>* visits;
+  size_t rows;
+  size_t columns;
+};
+
+/**
+ * Functor transposing the tiles of a square row-major matrix.
+ */
+struct Transpose {
+  Transpose(const std::vector<int>* input, std::vector<int>* output,
+            size_t size)
+  : input(input), output(output), size(size) {
+  }
+
+  void operator()(const embb::algorithms::BlockedRange2D& tile) const {
+    for (size_t row = tile.GetFirst(0); row != tile.GetLast(0); row++) {
+      for (size_t column = tile.GetFirst(1); column != tile.GetLast(1);
+           column++) {
+        (*output)[column * size + row] = (*input)[row * size + column];
+      }
+    }
+  }
+
+  const std::vector<int>* input;
+  std::vector<int>* output;
+  size_t size;
+};
+
 ForEachTest::ForEachTest() {
   CreateUnit("Different data structures")
     .Add(&ForEachTest::TestDataStructures, this);
   CreateUnit("Function Pointers").Add(&ForEachTest::TestFunctionPointers, this);
   CreateUnit("Ranges").Add(&ForEachTest::TestRanges, this);
   CreateUnit("Block sizes").Add(&ForEachTest::TestBlockSizes, this);
+  CreateUnit("Large ranges").Add(&ForEachTest::TestLargeRanges, this);
+  CreateUnit("Blocked ranges").Add(&ForEachTest::TestBlockedRanges, this);
+  CreateUnit("Blocked 2D").Add(&ForEachTest::TestBlocked2D, this);
+  CreateUnit("Blocked 3D").Add(&ForEachTest::TestBlocked3D, this);
   CreateUnit("Policies").Add(&ForEachTest::TestPolicy, this);
   CreateUnit("Stress test").Add(&ForEachTest::StressTest, this);
 }
@@ -184,6 +263,153 @@ void ForEachTest::TestBlockSizes() {
   }
 }
 
+void ForEachTest::TestLargeRanges() {
+  using embb::algorithms::ForEach;
+  using embb::tasks::ExecutionPolicy;
+  size_t count = MTAPI_NODE_MAX_TASKS_DEFAULT * 64;
+  std::vector<int> init(count);
+  std::vector<int> vector(count);
+  for (size_t i = 0; i < count; i++) {
+    init[i] = static_cast<int>(i % 100);
+  }
+
+  for (size_t block_size = 0; block_size < 3; block_size++) {
+    vector = init;
+    ForEach(vector.begin(), vector.end(), Square(), ExecutionPolicy(),
+            block_size);
+    for (size_t i = 0; i < count; i++) {
+      PT_EXPECT_EQ(vector[i], init[i]*init[i]);
+    }
+  }
+}
+
+void ForEachTest::TestBlockedRanges() {
+  using embb::algorithms::BlockedRange2D;
+  using embb::algorithms::BlockedRange3D;
+
+  BlockedRange2D range(2, 12, 5, 105);
+  PT_EXPECT_EQ(range.GetFirst(0), 2u);
+  PT_EXPECT_EQ(range.GetLast(0), 12u);
+  PT_EXPECT_EQ(range.GetSize(1), 100u);
+  PT_EXPECT_EQ(range.GetSize(), 1000u);
+
+  // The larger inner dimension is split
+  BlockedRange2D upper(range);
+  range.Split(upper);
+  PT_EXPECT_EQ(range.GetSize(0), 10u);
+  PT_EXPECT_EQ(range.GetLast(1), 55u);
+  PT_EXPECT_EQ(upper.GetFirst(1), 55u);
+  PT_EXPECT_EQ(upper.GetLast(1), 105u);
+  PT_EXPECT_EQ(upper.GetFirst(0), 2u);
+
+  // Of equally large dimensions, the outer one is split
+  BlockedRange3D volume(0, 8, 0, 8, 0, 8);
+  BlockedRange3D upper_volume(volume);
+  volume.Split(upper_volume);
+  PT_EXPECT_EQ(volume.GetLast(0), 4u);
+  PT_EXPECT_EQ(upper_volume.GetFirst(0), 4u);
+  PT_EXPECT_EQ(upper_volume.GetSize(), 256u);
+
+  // Negative and empty ranges have no indices
+  PT_EXPECT_EQ(BlockedRange2D(5, 3, 0, 10).GetSize(), 0u);
+  PT_EXPECT_EQ(BlockedRange3D(0, 4, 2, 2, 0, 4).GetSize(), 0u);
+}
+
+void ForEachTest::TestBlocked2D() {
+  using embb::algorithms::ForEach;
+  using embb::algorithms::BlockedRange2D;
+  using embb::tasks::ExecutionPolicy;
+
+  const size_t rows = 300;
+  const size_t columns = 500;
+  const size_t tile_sizes[] = { 0, 1, 7, 64, 100000 };
+  for (size_t t = 0; t < sizeof(tile_sizes) / sizeof(tile_sizes[0]); t++) {
+    size_t tile_size = (tile_sizes[t] == 0) ? 4096 : tile_sizes[t];
+    std::vector<int> visits(rows * columns, 0);
+    ForEach(BlockedRange2D(10, rows - 10, 3, columns - 3),
+            CountVisits2D(&visits, columns, tile_size), ExecutionPolicy(),
+            tile_sizes[t]);
+    bool correct = true;
+    for (size_t row = 0; row < rows; row++) {
+      for (size_t column = 0; column < columns; column++) {
+        bool inside = row >= 10 && row < rows - 10 &&
+                      column >= 3 && column < columns - 3;
+        if (visits[row * columns + column] != (inside ? 1 : 0)) {
+          correct = false;
+        }
+      }
+    }
+    PT_EXPECT(correct);
+  }
+
+  // Tiled transpose
+  const size_t size = 257;
+  std::vector<int> matrix(size * size);
+  std::vector<int> transposed(size * size);
+  for (size_t i = 0; i < size * size; i++) {
+    matrix[i] = static_cast<int>(i);
+  }
+  ForEach(BlockedRange2D(0, size, 0, size),
+          Transpose(&matrix, &transposed, size));
+  bool correct = true;
+  for (size_t row = 0; row < size; row++) {
+    for (size_t column = 0; column < size; column++) {
+      if (transposed[column * size + row] != matrix[row * size + column]) {
+        correct = false;
+      }
+    }
+  }
+  PT_EXPECT(correct);
+
+  // Empty ranges do not call the function
+  std::vector<int> visits(1, 0);
+  ForEach(BlockedRange2D(0, 0, 0, 1), CountVisits2D(&visits, 1, 1));
+  ForEach(BlockedRange2D(0, 1, 1, 1), CountVisits2D(&visits, 1, 1));
+  PT_EXPECT_EQ(visits[0], 0);
+
+#ifdef EMBB_USE_EXCEPTIONS
+  bool negative_range_thrown = false;
+  try {
+    ForEach(BlockedRange2D(0, 1, 1, 0), CountVisits2D(&visits, 1, 1));
+  }
+  catch (embb::base::ErrorException &) {
+    negative_range_thrown = true;
+  }
+  PT_EXPECT_MSG(negative_range_thrown,
+    "Negative range should throw ErrorException");
+#endif
+}
+
+void ForEachTest::TestBlocked3D() {
+  using embb::algorithms::ForEach;
+  using embb::algorithms::BlockedRange3D;
+  using embb::tasks::ExecutionPolicy;
+
+  const size_t slices = 20;
+  const size_t rows = 30;
+  const size_t columns = 40;
+  const size_t tile_sizes[] = { 0, 1, 50, 100000 };
+  for (size_t t = 0; t < sizeof(tile_sizes) / sizeof(tile_sizes[0]); t++) {
+    std::vector<int> visits(slices * rows * columns, 0);
+    ForEach(BlockedRange3D(1, slices, 0, rows - 2, 5, columns),
+            CountVisits3D(&visits, rows, columns), ExecutionPolicy(true),
+            tile_sizes[t]);
+    bool correct = true;
+    for (size_t slice = 0; slice < slices; slice++) {
+      for (size_t row = 0; row < rows; row++) {
+        for (size_t column = 0; column < columns; column++) {
+          bool inside = slice >= 1 && row < rows - 2 && column >= 5;
+          if (visits[(slice * rows + row) * columns + column] !=
+              (inside ? 1 : 0)) {
+            correct = false;
+          }
+        }
+      }
+    }
+    PT_EXPECT(correct);
+  }
+}
+
 void ForEachTest::TestPolicy() {
   using embb::algorithms::ForEach;
   using embb::tasks::ExecutionPolicy;
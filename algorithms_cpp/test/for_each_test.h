@@ -60,6 +60,26 @@ class ForEachTest : public partest::TestCase {
    */
   void TestBlockSizes();
 
+  /**
+   * Tests ranges with more blocks than tasks available.
+   */
+  void TestLargeRanges();
+
+  /**
+   * Tests splitting blocked ranges.
+   */
+  void TestBlockedRanges();
+
+  /**
+   * Tests iterating over the tiles of two-dimensional ranges.
+   */
+  void TestBlocked2D();
+
+  /**
+   * Tests iterating over the tiles of three-dimensional ranges.
+   */
+  void TestBlocked3D();
+
   /**
    * Tests setting policies (without checking their actual execution).
    */
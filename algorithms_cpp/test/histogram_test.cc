@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2014-2015, Siemens AG. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <histogram_test.h>
+#include <embb/algorithms/histogram.h>
+#include <embb/tasks/execution_policy.h>
+#include <deque>
+#include <vector>
+
+namespace {
+
+struct Decade {
+  size_t operator()(double value) const {
+    return static_cast<size_t>(value / 10.0);
+  }
+};
+
+size_t LastDigit(int value) {
+  return static_cast<size_t>(value % 10);
+}
+
+}  // namespace
+
+HistogramTest::HistogramTest() {
+  CreateUnit("Different data structures")
+    .Add(&HistogramTest::TestDataStructures, this);
+  CreateUnit("Bin functions").Add(&HistogramTest::TestBinFunctions, this);
+  CreateUnit("Skewed data").Add(&HistogramTest::TestSkewedData, this);
+  CreateUnit("Many bins").Add(&HistogramTest::TestManyBins, this);
+  CreateUnit("Block sizes").Add(&HistogramTest::TestBlockSizes, this);
+  CreateUnit("Policies").Add(&HistogramTest::TestPolicy, this);
+  CreateUnit("Stress test").Add(&HistogramTest::StressTest, this);
+}
+
+void HistogramTest::TestDataStructures() {
+  using embb::algorithms::Histogram;
+  const int size = 10;
+  int array[] = { 0, 1, 1, 2, 2, 2, 3, 3, 3, 3 };
+  std::vector<int> vector(array, array + size);
+  std::deque<int> deque(array, array + size);
+  const std::vector<int> const_vector(array, array + size);
+
+  size_t array_bins[4] = { 9, 9, 9, 9 };
+  std::vector<int> vector_bins(4, 9);
+  std::deque<size_t> deque_bins(4, 9);
+  std::vector<unsigned char> const_vector_bins(4, 9);
+
+  Histogram(array, array + size, array_bins, 4);
+  Histogram(vector.begin(), vector.end(), vector_bins.begin(), 4);
+  Histogram(deque.begin(), deque.end(), deque_bins.begin(), 4);
+  Histogram(const_vector.begin(), const_vector.end(),
+            const_vector_bins.begin(), 4);
+  for (size_t i = 0; i < 4; i++) {
+    PT_EXPECT_EQ(array_bins[i], i + 1);
+    PT_EXPECT_EQ(vector_bins[i], static_cast<int>(i + 1));
+    PT_EXPECT_EQ(deque_bins[i], i + 1);
+    PT_EXPECT_EQ(const_vector_bins[i], static_cast<unsigned char>(i + 1));
+  }
+
+  // Empty range
+  Histogram(array, array, array_bins, 4);
+  for (size_t i = 0; i < 4; i++) {
+    PT_EXPECT_EQ(array_bins[i], 0u);
+  }
+}
+
+void HistogramTest::TestBinFunctions() {
+  using embb::algorithms::Histogram;
+  const int size = 8;
+  double doubles[] = { 5.0, 15.0, 12.5, 99.0, 0.0, 31.0, 19.9, 1000.0 };
+  size_t bins[4];
+  Histogram(doubles, doubles + size, bins, 4, Decade());
+  PT_EXPECT_EQ(bins[0], 2u);
+  PT_EXPECT_EQ(bins[1], 3u);
+  PT_EXPECT_EQ(bins[2], 0u);
+  PT_EXPECT_EQ(bins[3], 1u);
+
+  int integers[] = { 11, 21, 32, -1, 4, 103, 5, 7 };
+  Histogram(integers, integers + size, bins, 4, &LastDigit);
+  PT_EXPECT_EQ(bins[0], 0u);
+  PT_EXPECT_EQ(bins[1], 2u);
+  PT_EXPECT_EQ(bins[2], 1u);
+  PT_EXPECT_EQ(bins[3], 1u);
+
+  // Negative elements are not counted
+  Histogram(integers, integers + size, bins, 4);
+  PT_EXPECT_EQ(bins[0] + bins[1] + bins[2] + bins[3], 0u);
+}
+
+void HistogramTest::TestSkewedData() {
+  using embb::algorithms::Histogram;
+  using embb::tasks::ExecutionPolicy;
+  size_t count = 100000;
+  std::vector<int> vector(count, 3);
+  vector[count / 2] = 0;
+  std::vector<size_t> bins(16);
+  Histogram(vector.begin(), vector.end(), bins.begin(), bins.size(),
+            embb::algorithms::Identity(), ExecutionPolicy(), 100);
+  for (size_t i = 0; i < bins.size(); i++) {
+    PT_EXPECT_EQ(bins[i], (i == 3) ? count - 1 : ((i == 0) ? 1u : 0u));
+  }
+}
+
+void HistogramTest::TestManyBins() {
+  using embb::algorithms::Histogram;
+  using embb::tasks::ExecutionPolicy;
+  size_t bin_count = 1000000;
+  size_t count = 50000;
+  std::vector<size_t> vector(count);
+  for (size_t i = 0; i < count; i++) {
+    // Every third bin up to 3 * 10000 occurs five times
+    vector[i] = (i % 10000) * 3;
+  }
+  vector[count - 1] = bin_count - 1;
+  vector[count - 2] = bin_count;
+  std::vector<size_t> bins(bin_count, 7);
+  Histogram(vector.begin(), vector.end(), bins.begin(), bin_count,
+            embb::algorithms::Identity(), ExecutionPolicy(), 1000);
+  bool correct = true;
+  size_t total = 0;
+  for (size_t i = 0; i < bin_count; i++) {
+    size_t expected = 0;
+    if (i == bin_count - 1) {
+      expected = 1;
+    } else if (i % 3 == 0 && i < 30000) {
+      // The last two elements replaced occurrences of bins 29994 and 29997
+      expected = (i == 29994 || i == 29997) ? 4 : 5;
+    }
+    correct = correct && bins[i] == expected;
+    total += bins[i];
+  }
+  PT_EXPECT(correct);
+  PT_EXPECT_EQ(total, count - 1);
+}
+
+void HistogramTest::TestBlockSizes() {
+  using embb::algorithms::Histogram;
+  using embb::tasks::ExecutionPolicy;
+  size_t count = 4;
+  std::vector<int> vector(count);
+  for (size_t i = 0; i < count; i++) {
+    vector[i] = static_cast<int>(i % 2);
+  }
+  std::vector<size_t> bins(2);
+
+  for (size_t block_size = 1; block_size < count + 2; block_size++) {
+    Histogram(vector.begin(), vector.end(), bins.begin(), bins.size(),
+              embb::algorithms::Identity(), ExecutionPolicy(), block_size);
+    PT_EXPECT_EQ(bins[0], 2u);
+    PT_EXPECT_EQ(bins[1], 2u);
+  }
+}
+
+void HistogramTest::TestPolicy() {
+  using embb::algorithms::Histogram;
+  using embb::tasks::ExecutionPolicy;
+  int a[] = { 0, 1, 1, 2, 2, 2, 3, 3, 3, 3 };
+  std::vector<int> vector(a, a + (sizeof a / sizeof a[0]));
+  std::vector<size_t> bins(4);
+
+  Histogram(vector.begin(), vector.end(), bins.begin(), bins.size(),
+            &LastDigit, ExecutionPolicy());
+  PT_EXPECT_EQ(bins[3], 4u);
+  Histogram(vector.begin(), vector.end(), bins.begin(), bins.size(),
+            &LastDigit, ExecutionPolicy(true));
+  PT_EXPECT_EQ(bins[3], 4u);
+  Histogram(vector.begin(), vector.end(), bins.begin(), bins.size(),
+            &LastDigit, ExecutionPolicy(true, 1));
+  PT_EXPECT_EQ(bins[3], 4u);
+}
+
+void HistogramTest::StressTest() {
+  using embb::algorithms::Histogram;
+  size_t count = embb::tasks::Node::GetInstance().GetCoreCount() * 10;
+  std::vector<int> large_vector(count);
+  for (size_t i = 0; i < count; i++) {
+    large_vector[i] = static_cast<int>(i % 10);
+  }
+  std::vector<size_t> bins(10);
+  Histogram(large_vector.begin(), large_vector.end(), bins.begin(),
+            bins.size());
+  for (size_t i = 0; i < bins.size(); i++) {
+    PT_EXPECT_EQ(bins[i], count / 10);
+  }
+}
@@ -26,9 +26,16 @@
 
 #include <invoke_test.h>
 #include <embb/algorithms/invoke.h>
+#include <embb/base/thread.h>
+
+#include <vector>
 
 InvokeTest::InvokeTest() {
   CreateUnit("Preliminary").Add(&InvokeTest::Test, this);
+  CreateUnit("Execution").Add(&InvokeTest::TestExecution, this);
+  CreateUnit("InlineLast").Add(&InvokeTest::TestInlineLast, this);
+  CreateUnit("Nested").Add(&InvokeTest::TestNested, this);
+  CreateUnit("Range").Add(&InvokeTest::TestRange, this);
 }
 
 static void Invocable1() {}
@@ -42,6 +49,70 @@ static void Invocable8() {}
 static void Invocable9() {}
 static void Invocable10() {}
 
+namespace {
+
+/**
+ * Increments a counter when invoked.
+ */
+class CountInvocation {
+ public:
+  explicit CountInvocation(int& counter) : counter_(&counter) {}
+
+  void operator()() const {
+    (*counter_)++;
+  }
+
+ private:
+  int* counter_;
+};
+
+/**
+ * Stores the ID of the invoking thread.
+ */
+class StoreThreadID {
+ public:
+  explicit StoreThreadID(embb::base::Thread::ID& id) : id_(&id) {}
+
+  void operator()() const {
+    *id_ = embb::base::Thread::CurrentGetID();
+  }
+
+ private:
+  embb::base::Thread::ID* id_;
+};
+
+/**
+ * Invokes two counting function objects when invoked.
+ */
+class InvokeCounters {
+ public:
+  InvokeCounters(int& counter1, int& counter2)
+    : counter1_(&counter1), counter2_(&counter2) {}
+
+  void operator()() const {
+    embb::algorithms::Invoke(CountInvocation(*counter1_),
+                             CountInvocation(*counter2_));
+  }
+
+ private:
+  int* counter1_;
+  int* counter2_;
+};
+
+/**
+ * Checks that all counters are one and resets them to zero.
+ */
+bool CheckAndResetCounters(int* counters, int count) {
+  bool result = true;
+  for (int i = 0; i < count; i++) {
+    result = result && counters[i] == 1;
+    counters[i] = 0;
+  }
+  return result;
+}
+
+}  // namespace
+
 void InvokeTest::Test() {
   using embb::algorithms::Invoke;
   Invoke(&Invocable1, &Invocable2);
@@ -81,3 +152,95 @@ void InvokeTest::Test() {
          &Invocable6, &Invocable7, &Invocable8, &Invocable9, &Invocable10,
          policy);
 }
+
+void InvokeTest::TestExecution() {
+  using embb::algorithms::Invoke;
+  int c[10] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+  Invoke(CountInvocation(c[0]), CountInvocation(c[1]));
+  PT_EXPECT(CheckAndResetCounters(c, 2));
+  Invoke(CountInvocation(c[0]), CountInvocation(c[1]), CountInvocation(c[2]),
+         CountInvocation(c[3]), CountInvocation(c[4]));
+  PT_EXPECT(CheckAndResetCounters(c, 5));
+  Invoke(CountInvocation(c[0]), CountInvocation(c[1]), CountInvocation(c[2]),
+         CountInvocation(c[3]), CountInvocation(c[4]), CountInvocation(c[5]),
+         CountInvocation(c[6]), CountInvocation(c[7]), CountInvocation(c[8]),
+         CountInvocation(c[9]));
+  PT_EXPECT(CheckAndResetCounters(c, 10));
+
+  embb::tasks::ExecutionPolicy policy(true);
+  Invoke(CountInvocation(c[0]), CountInvocation(c[1]), CountInvocation(c[2]),
+         policy);
+  PT_EXPECT(CheckAndResetCounters(c, 3));
+  Invoke(CountInvocation(c[0]), CountInvocation(c[1]), CountInvocation(c[2]),
+         CountInvocation(c[3]), CountInvocation(c[4]), CountInvocation(c[5]),
+         CountInvocation(c[6]), CountInvocation(c[7]), CountInvocation(c[8]),
+         CountInvocation(c[9]), policy);
+  PT_EXPECT(CheckAndResetCounters(c, 10));
+}
+
+void InvokeTest::TestInlineLast() {
+  using embb::algorithms::Invoke;
+  embb::base::Thread::ID caller = embb::base::Thread::CurrentGetID();
+  embb::base::Thread::ID id1, id2, id3;
+  Invoke(StoreThreadID(id1), StoreThreadID(id2));
+  PT_EXPECT(id2 == caller);
+  Invoke(StoreThreadID(id1), StoreThreadID(id2), StoreThreadID(id3),
+         embb::tasks::ExecutionPolicy());
+  PT_EXPECT(id3 == caller);
+
+  std::vector<StoreThreadID> functions;
+  functions.push_back(StoreThreadID(id1));
+  functions.push_back(StoreThreadID(id2));
+  functions.push_back(StoreThreadID(id3));
+  embb::algorithms::InvokeRange(functions.begin(), functions.end());
+  PT_EXPECT(id3 == caller);
+}
+
+void InvokeTest::TestNested() {
+  using embb::algorithms::Invoke;
+  int c[6] = { 0, 0, 0, 0, 0, 0 };
+  Invoke(InvokeCounters(c[0], c[1]), InvokeCounters(c[2], c[3]),
+         InvokeCounters(c[4], c[5]));
+  PT_EXPECT(CheckAndResetCounters(c, 6));
+}
+
+void InvokeTest::TestRange() {
+  using embb::algorithms::InvokeRange;
+  using embb::algorithms::InvokeFunctionType;
+  const int count = 100;
+  std::vector<int> counters(count, 0);
+  std::vector<InvokeFunctionType> functions;
+
+  // Empty range
+  InvokeRange(functions.begin(), functions.end());
+
+  // Single function object, run by the calling thread
+  functions.push_back(InvokeFunctionType(CountInvocation(counters[0])));
+  InvokeRange(functions.begin(), functions.end());
+  PT_EXPECT(CheckAndResetCounters(&counters[0], 1));
+
+  // More function objects than Invoke supports
+  for (int i = 1; i < count; i++) {
+    functions.push_back(InvokeFunctionType(CountInvocation(counters[i])));
+  }
+  InvokeRange(functions.begin(), functions.end());
+  PT_EXPECT(CheckAndResetCounters(&counters[0], count));
+  InvokeRange(functions.begin(), functions.end(),
+              embb::tasks::ExecutionPolicy(true));
+  PT_EXPECT(CheckAndResetCounters(&counters[0], count));
+
+#ifdef EMBB_USE_EXCEPTIONS
+  bool negative_range_thrown = false;
+  try {
+    InvokeRange(functions.begin() + 1, functions.begin());
+  }
+  catch (embb::base::ErrorException &) {
+    negative_range_thrown = true;
+  }
+  PT_EXPECT_MSG(negative_range_thrown,
+    "Negative range should throw ErrorException");
+  for (int i = 0; i < count; i++) {
+    PT_EXPECT_EQ(counters[i], 0);
+  }
+#endif
+}
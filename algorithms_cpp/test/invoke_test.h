@@ -44,6 +44,26 @@ class InvokeTest : public partest::TestCase {
    * Tests ...
    */
   void Test();
+
+  /**
+   * Tests that every function object is run exactly once.
+   */
+  void TestExecution();
+
+  /**
+   * Tests that the last function object is run by the calling thread.
+   */
+  void TestInlineLast();
+
+  /**
+   * Tests Invoke calls nested in invoked function objects.
+   */
+  void TestNested();
+
+  /**
+   * Tests InvokeRange with empty, single, and large ranges.
+   */
+  void TestRange();
 };
 
 #endif  // ALGORITHMS_CPP_TEST_INVOKE_TEST_H_
@@ -33,11 +33,19 @@
 #include <for_each_test.h>
 #include <reduce_test.h>
 #include <scan_test.h>
+#include <transform_test.h>
+#include <compaction_test.h>
 #include <count_test.h>
+#include <find_test.h>
+#include <histogram_test.h>
 #include <partitioner_test.h>
 #include <zip_iterator_test.h>
 #include <quick_sort_test.h>
 #include <merge_sort_test.h>
+#include <merge_test.h>
+#include <min_max_element_test.h>
+#include <selection_test.h>
+#include <radix_sort_test.h>
 #include <invoke_test.h>
 
 #include<embb/algorithms/merge_sort.h>
@@ -72,10 +80,18 @@ PT_MAIN("Algorithms") {
   PT_RUN(ForEachTest);
   PT_RUN(ReduceTest);
   PT_RUN(ScanTest);
+  PT_RUN(TransformTest);
+  PT_RUN(CompactionTest);
   PT_RUN(CountTest);
+  PT_RUN(FindTest);
+  PT_RUN(HistogramTest);
   PT_RUN(ZipIteratorTest);
   PT_RUN(QuickSortTest);
   PT_RUN(MergeSortTest);
+  PT_RUN(MergeTest);
+  PT_RUN(MinMaxElementTest);
+  PT_RUN(SelectionTest);
+  PT_RUN(RadixSortTest);
   PT_RUN(InvokeTest);
 
   embb::tasks::Node::Finalize();
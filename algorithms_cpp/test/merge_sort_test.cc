@@ -44,6 +44,7 @@ MergeSortTest::MergeSortTest() {
       this);
   CreateUnit("Ranges").Add(&MergeSortTest::TestRanges, this);
   //CreateUnit("Block sizes").Add(&MergeSortTest::TestBlockSizes, this);
+  CreateUnit("Parallel merge").Add(&MergeSortTest::TestParallelMerge, this);
   CreateUnit("Policies").Add(&MergeSortTest::TestPolicy, this);
   CreateUnit("Stress test").Add(&MergeSortTest::StressTest, this);
 }
@@ -177,6 +178,48 @@ void MergeSortTest::TestBlockSizes() {
       PT_EXPECT_EQ(vector[i], vector_copy[i]);
     }
   }
+
+  // Far more blocks than MTAPI tasks are available
+  const size_t large_count = 1 << 18;
+  std::vector<int> large_init(large_count);
+  for (size_t i = 0; i < large_count; i++) {
+    large_init[i] = static_cast<int>((i * 7919) % 100003);
+  }
+  std::vector<int> large_expected(large_init);
+  std::sort(large_expected.begin(), large_expected.end(), std::greater<int>());
+  for (size_t block_size = 16; block_size <= 1024; block_size *= 8) {
+    std::vector<int> large(large_init);
+    MergeSortAllocate(large.begin(), large.end(), std::greater<int>(),
+      ExecutionPolicy(), block_size);
+    PT_EXPECT(large == large_expected);
+  }
+}
+
+void MergeSortTest::TestParallelMerge() {
+  using embb::algorithms::MergeSortAllocate;
+  using embb::tasks::ExecutionPolicy;
+  size_t count = 5000;
+  std::vector<int> vector(count);
+  std::vector<int> vector_copy(count);
+  // Ascending, descending, few distinct values and alternating halves
+  for (int shape = 0; shape < 4; shape++) {
+    for (size_t i = 0; i < count; i++) {
+      int value = static_cast<int>(i);
+      switch (shape) {
+      case 0: vector[i] = value; break;
+      case 1: vector[i] = static_cast<int>(count) - value; break;
+      case 2: vector[i] = (value * 7919) % 5; break;
+      default: vector[i] = (i < count / 2) ? 2 * value : 2 * value - 4999;
+      }
+    }
+    vector_copy = vector;
+    std::sort(vector_copy.begin(), vector_copy.end());
+    MergeSortAllocate(vector.begin(), vector.end(), std::less<int>(),
+                      ExecutionPolicy(), count / 8);
+    for (size_t i = 0; i < count; i++) {
+      PT_EXPECT_EQ(vector[i], vector_copy[i]);
+    }
+  }
 }
 
 void MergeSortTest::TestPolicy() {
@@ -60,6 +60,11 @@ class MergeSortTest : public partest::TestCase {
    */
   void TestBlockSizes();
 
+  /**
+   * Tests the parallel merge with inputs of various shapes.
+   */
+  void TestParallelMerge();
+
   /**
    * Tests setting policies (without checking their actual execution).
    */
@@ -0,0 +1,303 @@
+/*
+ * Copyright (c) 2014-2015, Siemens AG. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <merge_test.h>
+#include <embb/algorithms/merge.h>
+#include <embb/tasks/execution_policy.h>
+#include <algorithm>
+#include <deque>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace {
+
+/**
+ * Fills a vector with sorted pseudo-random values containing duplicates.
+ */
+void FillSorted(std::vector<int>& values, size_t count, int modulus,
+                unsigned int seed) {
+  values.resize(count);
+  for (size_t i = 0; i < count; i++) {
+    seed = seed * 1103515245u + 12345u;
+    values[i] = static_cast<int>((seed >> 8) % static_cast<unsigned>(modulus));
+  }
+  std::sort(values.begin(), values.end());
+}
+
+/**
+ * Compares pairs by their first elements only, such that the second elements
+ * tell equivalent elements apart.
+ */
+bool LessFirst(const std::pair<int, int>& lhs,
+               const std::pair<int, int>& rhs) {
+  return lhs.first < rhs.first;
+}
+
+}  // namespace
+
+MergeTest::MergeTest() {
+  CreateUnit("Different data structures")
+    .Add(&MergeTest::TestDataStructures, this);
+  CreateUnit("Merge stability").Add(&MergeTest::TestMergeStability, this);
+  CreateUnit("Set operations").Add(&MergeTest::TestSetOperations, this);
+  CreateUnit("Ranges").Add(&MergeTest::TestRanges, this);
+  CreateUnit("Block sizes").Add(&MergeTest::TestBlockSizes, this);
+  CreateUnit("Policies").Add(&MergeTest::TestPolicy, this);
+  CreateUnit("Stress test").Add(&MergeTest::StressTest, this);
+}
+
+void MergeTest::TestDataStructures() {
+  using embb::algorithms::Merge;
+  using embb::algorithms::SetUnion;
+  int array1[] = { 1, 3, 5, 7, 9 };
+  int array2[] = { 2, 3, 4, 8, 10 };
+  std::vector<int> vector(array1, array1 + 5);
+  const std::deque<int> deque(array2, array2 + 5);
+  int expected_merge[] = { 1, 2, 3, 3, 4, 5, 7, 8, 9, 10 };
+  int expected_union[] = { 1, 2, 3, 4, 5, 7, 8, 9, 10 };
+
+  int array_out[10];
+  std::vector<int> vector_out(10);
+  std::deque<int> deque_out(10);
+  PT_EXPECT(Merge(array1, array1 + 5, array2, array2 + 5, array_out) ==
+            array_out + 10);
+  PT_EXPECT(Merge(vector.begin(), vector.end(), deque.begin(), deque.end(),
+                  deque_out.begin()) == deque_out.end());
+  PT_EXPECT(SetUnion(deque.begin(), deque.end(), array1, array1 + 5,
+                     vector_out.begin()) == vector_out.begin() + 9);
+  for (int i = 0; i < 10; i++) {
+    PT_EXPECT_EQ(array_out[i], expected_merge[i]);
+    PT_EXPECT_EQ(deque_out[i], expected_merge[i]);
+  }
+  for (int i = 0; i < 9; i++) {
+    PT_EXPECT_EQ(vector_out[i], expected_union[i]);
+  }
+}
+
+void MergeTest::TestMergeStability() {
+  using embb::algorithms::Merge;
+  using embb::tasks::ExecutionPolicy;
+  typedef std::pair<int, int> element;
+  const size_t count = 5000;
+  std::vector<element> range1(count);
+  std::vector<element> range2(count / 2);
+  for (size_t i = 0; i < range1.size(); i++) {
+    range1[i] = element(static_cast<int>(i / 50), static_cast<int>(i));
+  }
+  for (size_t i = 0; i < range2.size(); i++) {
+    range2[i] = element(static_cast<int>(i / 20), static_cast<int>(count + i));
+  }
+  std::vector<element> expected(range1.size() + range2.size());
+  std::merge(range1.begin(), range1.end(), range2.begin(), range2.end(),
+             expected.begin(), &LessFirst);
+  const size_t block_sizes[] = { 0, 1, 10, 1000 };
+  for (size_t b = 0; b < sizeof(block_sizes) / sizeof(block_sizes[0]); b++) {
+    std::vector<element> output(expected.size());
+    Merge(range1.begin(), range1.end(), range2.begin(), range2.end(),
+          output.begin(), &LessFirst, ExecutionPolicy(), block_sizes[b]);
+    PT_EXPECT(output == expected);
+  }
+}
+
+void MergeTest::TestSetOperations() {
+  using embb::algorithms::SetUnion;
+  using embb::algorithms::SetIntersection;
+  using embb::algorithms::SetDifference;
+  int array1[] = { 1, 1, 1, 2, 4, 4, 6 };
+  int array2[] = { 1, 2, 2, 4, 4, 4, 5 };
+  int expected_union[] = { 1, 1, 1, 2, 2, 4, 4, 4, 5, 6 };
+  int expected_intersection[] = { 1, 2, 4, 4 };
+  int expected_difference[] = { 1, 1, 6 };
+  int output[14];
+  PT_EXPECT(SetUnion(array1, array1 + 7, array2, array2 + 7, output) ==
+            output + 10);
+  PT_EXPECT(std::equal(expected_union, expected_union + 10, output));
+  PT_EXPECT(SetIntersection(array1, array1 + 7, array2, array2 + 7,
+                            output) == output + 4);
+  PT_EXPECT(std::equal(expected_intersection, expected_intersection + 4,
+                       output));
+  PT_EXPECT(SetDifference(array1, array1 + 7, array2, array2 + 7, output) ==
+            output + 3);
+  PT_EXPECT(std::equal(expected_difference, expected_difference + 3,
+                       output));
+
+  // Descending order
+  std::reverse(array1, array1 + 7);
+  std::reverse(array2, array2 + 7);
+  std::reverse(expected_union, expected_union + 10);
+  PT_EXPECT(SetUnion(array1, array1 + 7, array2, array2 + 7, output,
+                     std::greater<int>()) == output + 10);
+  PT_EXPECT(std::equal(expected_union, expected_union + 10, output));
+}
+
+void MergeTest::TestRanges() {
+  using embb::algorithms::Merge;
+  using embb::algorithms::SetUnion;
+  using embb::algorithms::SetIntersection;
+  using embb::algorithms::SetDifference;
+  int array[] = { 1, 2, 3 };
+  int output[3] = { 0, 0, 0 };
+  PT_EXPECT(Merge(array, array, array, array, output) == output);
+  PT_EXPECT(Merge(array, array + 3, array, array, output) == output + 3);
+  PT_EXPECT(std::equal(array, array + 3, output));
+  PT_EXPECT(SetUnion(array, array, array, array + 3, output) == output + 3);
+  PT_EXPECT(SetIntersection(array, array + 3, array, array, output) ==
+            output);
+  PT_EXPECT(SetDifference(array, array + 3, array, array, output) ==
+            output + 3);
+  PT_EXPECT(SetDifference(array, array, array, array + 3, output) == output);
+}
+
+void MergeTest::TestBlockSizes() {
+  using embb::algorithms::Merge;
+  using embb::algorithms::SetUnion;
+  using embb::algorithms::SetIntersection;
+  using embb::algorithms::SetDifference;
+  using embb::tasks::ExecutionPolicy;
+  const size_t sizes[][2] = { { 1, 1 }, { 10, 3 }, { 100, 1000 },
+                              { 5000, 5000 }, { 20000, 7 } };
+  const int moduli[] = { 2, 100, 1000000 };
+  const size_t block_sizes[] = { 0, 1, 3, 100, 10000 };
+  for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+    for (size_t m = 0; m < sizeof(moduli) / sizeof(moduli[0]); m++) {
+      std::vector<int> range1;
+      std::vector<int> range2;
+      FillSorted(range1, sizes[s][0], moduli[m], 1);
+      FillSorted(range2, sizes[s][1], moduli[m], 2);
+      const size_t total = range1.size() + range2.size();
+      std::vector<int> expected_merge(total);
+      std::merge(range1.begin(), range1.end(), range2.begin(), range2.end(),
+                 expected_merge.begin());
+      std::vector<int> expected_union(total);
+      expected_union.erase(std::set_union(range1.begin(), range1.end(),
+        range2.begin(), range2.end(), expected_union.begin()),
+        expected_union.end());
+      std::vector<int> expected_intersection(total);
+      expected_intersection.erase(std::set_intersection(range1.begin(),
+        range1.end(), range2.begin(), range2.end(),
+        expected_intersection.begin()), expected_intersection.end());
+      std::vector<int> expected_difference(total);
+      expected_difference.erase(std::set_difference(range1.begin(),
+        range1.end(), range2.begin(), range2.end(),
+        expected_difference.begin()), expected_difference.end());
+
+      for (size_t b = 0; b < sizeof(block_sizes) / sizeof(block_sizes[0]);
+           b++) {
+        std::vector<int> output(total);
+        std::vector<int>::iterator end;
+        end = Merge(range1.begin(), range1.end(), range2.begin(),
+                    range2.end(), output.begin(), std::less<int>(),
+                    ExecutionPolicy(), block_sizes[b]);
+        PT_EXPECT(end == output.end());
+        PT_EXPECT(output == expected_merge);
+
+        end = SetUnion(range1.begin(), range1.end(), range2.begin(),
+                       range2.end(), output.begin(), std::less<int>(),
+                       ExecutionPolicy(), block_sizes[b]);
+        PT_EXPECT(end - output.begin() ==
+                  static_cast<std::ptrdiff_t>(expected_union.size()));
+        PT_EXPECT(std::equal(expected_union.begin(), expected_union.end(),
+                             output.begin()));
+
+        end = SetIntersection(range1.begin(), range1.end(), range2.begin(),
+                              range2.end(), output.begin(), std::less<int>(),
+                              ExecutionPolicy(), block_sizes[b]);
+        PT_EXPECT(end - output.begin() ==
+                  static_cast<std::ptrdiff_t>(expected_intersection.size()));
+        PT_EXPECT(std::equal(expected_intersection.begin(),
+                             expected_intersection.end(), output.begin()));
+
+        end = SetDifference(range1.begin(), range1.end(), range2.begin(),
+                            range2.end(), output.begin(), std::less<int>(),
+                            ExecutionPolicy(), block_sizes[b]);
+        PT_EXPECT(end - output.begin() ==
+                  static_cast<std::ptrdiff_t>(expected_difference.size()));
+        PT_EXPECT(std::equal(expected_difference.begin(),
+                             expected_difference.end(), output.begin()));
+      }
+    }
+  }
+}
+
+void MergeTest::TestPolicy() {
+  using embb::algorithms::Merge;
+  using embb::algorithms::SetIntersection;
+  using embb::tasks::ExecutionPolicy;
+  int array1[] = { 1, 3, 5, 7, 9 };
+  int array2[] = { 3, 4, 5, 6, 7 };
+  int expected_intersection[] = { 3, 5, 7 };
+  int output[10];
+  PT_EXPECT(Merge(array1, array1 + 5, array2, array2 + 5, output,
+                  std::less<int>(), ExecutionPolicy()) == output + 10);
+  PT_EXPECT(Merge(array1, array1 + 5, array2, array2 + 5, output,
+                  std::less<int>(), ExecutionPolicy(true)) == output + 10);
+  PT_EXPECT(SetIntersection(array1, array1 + 5, array2, array2 + 5, output,
+                            std::less<int>(), ExecutionPolicy(true, 1)) ==
+            output + 3);
+  PT_EXPECT(std::equal(expected_intersection, expected_intersection + 3,
+                       output));
+
+#ifdef EMBB_USE_EXCEPTIONS
+  bool empty_core_set_thrown = false;
+  try {
+    Merge(array1, array1 + 5, array2, array2 + 5, output, std::less<int>(),
+          ExecutionPolicy(false));
+  }
+  catch (embb::base::ErrorException &) {
+    empty_core_set_thrown = true;
+  }
+  PT_EXPECT_MSG(empty_core_set_thrown,
+    "Empty core set should throw ErrorException");
+  bool negative_range_thrown = false;
+  try {
+    SetIntersection(array1 + 1, array1, array2, array2 + 5, output);
+  }
+  catch (embb::base::ErrorException &) {
+    negative_range_thrown = true;
+  }
+  PT_EXPECT_MSG(negative_range_thrown,
+    "Negative range should throw ErrorException");
+#endif
+}
+
+void MergeTest::StressTest() {
+  using embb::algorithms::SetUnion;
+  size_t count = embb::tasks::Node::GetInstance().GetCoreCount() * 10000;
+  std::vector<int> evens(count);
+  std::vector<int> odds(count);
+  for (size_t i = 0; i < count; i++) {
+    evens[i] = static_cast<int>(2 * i);
+    odds[i] = static_cast<int>(2 * i + 1);
+  }
+  std::vector<int> output(2 * count);
+  PT_EXPECT(SetUnion(evens.begin(), evens.end(), odds.begin(), odds.end(),
+                     output.begin()) == output.end());
+  for (size_t i = 0; i < 2 * count; i++) {
+    PT_EXPECT_EQ(output[i], static_cast<int>(i));
+  }
+}
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2014-2015, Siemens AG. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <min_max_element_test.h>
+#include <embb/algorithms/min_max_element.h>
+#include <embb/tasks/execution_policy.h>
+#include <algorithm>
+#include <deque>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace {
+
+struct AbsoluteLess {
+  bool operator()(int lhs, int rhs) const {
+    return (lhs < 0 ? -lhs : lhs) < (rhs < 0 ? -rhs : rhs);
+  }
+};
+
+bool LessFunction(double lhs, double rhs) {
+  return lhs < rhs;
+}
+
+}  // namespace
+
+MinMaxElementTest::MinMaxElementTest() {
+  CreateUnit("Different data structures")
+    .Add(&MinMaxElementTest::TestDataStructures, this);
+  CreateUnit("Comparison functions")
+    .Add(&MinMaxElementTest::TestComparison, this);
+  CreateUnit("Tie breaking").Add(&MinMaxElementTest::TestTieBreaking, this);
+  CreateUnit("Ranges").Add(&MinMaxElementTest::TestRanges, this);
+  CreateUnit("Policies").Add(&MinMaxElementTest::TestPolicy, this);
+  CreateUnit("Stress test").Add(&MinMaxElementTest::StressTest, this);
+}
+
+void MinMaxElementTest::TestDataStructures() {
+  using embb::algorithms::MinElement;
+  using embb::algorithms::MaxElement;
+  using embb::algorithms::MinMaxElement;
+  const int size = 10;
+  int array[] = { 30, 20, 50, 10, 40, 90, 60, 80, 70, 0 };
+  std::vector<int> vector(array, array + size);
+  std::deque<int> deque(array, array + size);
+  const std::vector<int> const_vector(array, array + size);
+
+  PT_EXPECT(MinElement(array, array + size) == array + 9);
+  PT_EXPECT(MaxElement(array, array + size) == array + 5);
+  PT_EXPECT(MinElement(vector.begin(), vector.end()) == vector.begin() + 9);
+  PT_EXPECT(MaxElement(deque.begin(), deque.end()) == deque.begin() + 5);
+  std::pair<std::vector<int>::const_iterator,
+            std::vector<int>::const_iterator> extrema =
+    MinMaxElement(const_vector.begin(), const_vector.end());
+  PT_EXPECT(extrema.first == const_vector.begin() + 9);
+  PT_EXPECT(extrema.second == const_vector.begin() + 5);
+}
+
+void MinMaxElementTest::TestComparison() {
+  using embb::algorithms::MinElement;
+  using embb::algorithms::MaxElement;
+  using embb::algorithms::MinMaxElement;
+  const int size = 10;
+  int array[] = { 3, -2, 5, -9, 4, 1, -6, 8, 7, 2 };
+  double doubles[] = { 0.5, -1.5, 2.5, 0.0, -3.5, 1.0, 3.5, -0.5, 2.0, 1.5 };
+
+  PT_EXPECT(MinElement(array, array + size, AbsoluteLess()) == array + 5);
+  PT_EXPECT(MaxElement(array, array + size, AbsoluteLess()) == array + 3);
+  PT_EXPECT(MinElement(array, array + size, std::greater<int>()) ==
+            array + 7);
+  PT_EXPECT(MinMaxElement(doubles, doubles + size, &LessFunction) ==
+            std::make_pair(doubles + 4, doubles + 6));
+}
+
+void MinMaxElementTest::TestTieBreaking() {
+  using embb::algorithms::MinElement;
+  using embb::algorithms::MaxElement;
+  using embb::algorithms::MinMaxElement;
+  using embb::tasks::ExecutionPolicy;
+  // Sizes below and above the lane count of the arithmetic kernel
+  const size_t sizes[] = { 1, 7, 17, 100, 1003 };
+  for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+    size_t count = sizes[s];
+    std::vector<int> vector(count);
+    std::deque<int> deque(count);
+    for (size_t i = 0; i < count; i++) {
+      vector[i] = deque[i] = static_cast<int>((i * 7) % 5);
+    }
+    std::vector<int>::iterator expected_min =
+      std::min_element(vector.begin(), vector.end());
+    std::vector<int>::iterator expected_max =
+      std::max_element(vector.begin(), vector.end());
+    for (size_t block_size = 1; block_size <= count; block_size *= 3) {
+      PT_EXPECT(MinElement(vector.begin(), vector.end(), std::less<int>(),
+                           ExecutionPolicy(), block_size) == expected_min);
+      PT_EXPECT(MaxElement(vector.begin(), vector.end(), std::less<int>(),
+                           ExecutionPolicy(), block_size) == expected_max);
+      PT_EXPECT(MinMaxElement(vector.begin(), vector.end(), std::less<int>(),
+                              ExecutionPolicy(), block_size) ==
+                std::make_pair(expected_min, expected_max));
+      std::pair<std::deque<int>::iterator, std::deque<int>::iterator>
+        extrema = MinMaxElement(deque.begin(), deque.end(), std::less<int>(),
+                                ExecutionPolicy(), block_size);
+      PT_EXPECT(extrema.first - deque.begin() == expected_min - vector.begin());
+      PT_EXPECT(extrema.second - deque.begin() ==
+                expected_max - vector.begin());
+    }
+  }
+}
+
+void MinMaxElementTest::TestRanges() {
+  using embb::algorithms::MinElement;
+  using embb::algorithms::MaxElement;
+  using embb::algorithms::MinMaxElement;
+  const int size = 4;
+  int array[] = { 1, 2, 3, 4 };
+
+  // Empty range
+  PT_EXPECT(MinElement(array, array) == array);
+  PT_EXPECT(MaxElement(array + 2, array + 2) == array + 2);
+  PT_EXPECT(MinMaxElement(array, array) == std::make_pair(array, array));
+
+  // Ommit first element
+  PT_EXPECT(MinElement(array + 1, array + size) == array + 1);
+
+  // Ommit last element
+  PT_EXPECT(MaxElement(array, array + size - 1) == array + 2);
+
+  // Only do second element
+  PT_EXPECT(MinMaxElement(array + 1, array + 2) ==
+            std::make_pair(array + 1, array + 1));
+}
+
+void MinMaxElementTest::TestPolicy() {
+  using embb::algorithms::MinElement;
+  using embb::tasks::ExecutionPolicy;
+  int a[] = { 30, 20, 50, 10, 40, 90, 60, 80, 70, 10 };
+  std::vector<int> vector(a, a + (sizeof a / sizeof a[0]));
+  PT_EXPECT(MinElement(vector.begin(), vector.end(), std::less<int>(),
+                       ExecutionPolicy()) == vector.begin() + 3);
+  PT_EXPECT(MinElement(vector.begin(), vector.end(), std::less<int>(),
+                       ExecutionPolicy(true)) == vector.begin() + 3);
+  PT_EXPECT(MinElement(vector.begin(), vector.end(), std::less<int>(),
+                       ExecutionPolicy(true, 1)) == vector.begin() + 3);
+}
+
+void MinMaxElementTest::StressTest() {
+  using embb::algorithms::MinMaxElement;
+  size_t count = embb::tasks::Node::GetInstance().GetCoreCount() * 10;
+  std::vector<int> large_vector(count);
+  for (size_t i = 0; i < count; i++) {
+    large_vector[i] = static_cast<int>(i % 10);
+  }
+  PT_EXPECT(MinMaxElement(large_vector.begin(), large_vector.end()) ==
+            std::make_pair(large_vector.begin(), large_vector.begin() + 9));
+}
@@ -48,6 +48,8 @@ QuickSortTest::QuickSortTest() {
       this);
   CreateUnit("Ranges").Add(&QuickSortTest::TestRanges, this);
   CreateUnit("Block sizes").Add(&QuickSortTest::TestBlockSizes, this);
+  CreateUnit("Parallel partition")
+    .Add(&QuickSortTest::TestParallelPartition, this);
   CreateUnit("Policies").Add(&QuickSortTest::TestPolicy, this);
   CreateUnit("Stress test").Add(&QuickSortTest::StressTest, this);
 }
@@ -183,6 +185,49 @@ void QuickSortTest::TestBlockSizes() {
       PT_EXPECT_EQ(vector[i], vector_copy[i]);
     }
   }
+
+  // Far more blocks than MTAPI tasks are available
+  const size_t large_count = 1 << 18;
+  std::vector<int> large_init(large_count);
+  for (size_t i = 0; i < large_count; i++) {
+    large_init[i] = static_cast<int>((i * 7919) % 100003);
+  }
+  std::vector<int> large_expected(large_init);
+  std::sort(large_expected.begin(), large_expected.end(), std::greater<int>());
+  for (size_t block_size = 16; block_size <= 1024; block_size *= 8) {
+    std::vector<int> large(large_init);
+    QuickSort(large.begin(), large.end(), std::greater<int>(),
+              ExecutionPolicy(), block_size);
+    PT_EXPECT(large == large_expected);
+  }
+}
+
+void QuickSortTest::TestParallelPartition() {
+  using embb::algorithms::QuickSort;
+  using embb::tasks::ExecutionPolicy;
+  size_t count = 100000;
+  std::vector<int> vector(count);
+  std::vector<int> vector_copy(count);
+  // Ascending, descending, nearly sorted, equal and few distinct values
+  for (int shape = 0; shape < 5; shape++) {
+    for (size_t i = 0; i < count; i++) {
+      int value = static_cast<int>(i);
+      switch (shape) {
+      case 0: vector[i] = value; break;
+      case 1: vector[i] = static_cast<int>(count) - value; break;
+      case 2: vector[i] = (i % 100 == 0) ? value / 2 : value; break;
+      case 3: vector[i] = 42; break;
+      default: vector[i] = (value * 7919) % 5;
+      }
+    }
+    vector_copy = vector;
+    std::sort(vector_copy.begin(), vector_copy.end());
+    QuickSort(vector.begin(), vector.end(), std::less<int>(),
+              ExecutionPolicy(), 4096);
+    for (size_t i = 0; i < count; i++) {
+      PT_EXPECT_EQ(vector[i], vector_copy[i]);
+    }
+  }
 }
 
 void QuickSortTest::TestPolicy() {
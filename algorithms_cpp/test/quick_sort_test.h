@@ -60,6 +60,11 @@ class QuickSortTest : public partest::TestCase {
    */
   void TestBlockSizes();
 
+  /**
+   * Tests the parallel partitioning with inputs of various shapes.
+   */
+  void TestParallelPartition();
+
   /**
    * Tests setting policies (without checking their actual execution).
    */
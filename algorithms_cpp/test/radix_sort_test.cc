@@ -0,0 +1,372 @@
+/*
+ * Copyright (c) 2014-2015, Siemens AG. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <radix_sort_test.h>
+#include <embb/algorithms/radix_sort.h>
+#include <embb/algorithms/zip_iterator.h>
+#include <embb/tasks/execution_policy.h>
+#include <stdint.h>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <deque>
+#include <algorithm>
+#include <functional>
+
+namespace {
+
+/**
+ * Returns pseudo-random numbers of the full 32 bit range.
+ */
+uint32_t NextRandom(uint32_t& state) {
+  state = state * 1664525u + 1013904223u;
+  return state;
+}
+
+/**
+ * Fills a vector with pseudo-random keys, sorts a copy with std::sort and
+ * the vector with RadixSort, and compares the results.
+ */
+template <typename Key>
+bool SortsLikeStdSort(size_t count, size_t block_size, uint32_t seed) {
+  std::vector<Key> keys(count);
+  for (size_t i = 0; i < count; i++) {
+    uint64_t bits = (static_cast<uint64_t>(NextRandom(seed)) << 32) |
+                    NextRandom(seed);
+    keys[i] = static_cast<Key>(bits);
+  }
+  std::vector<Key> expected(keys);
+  std::sort(expected.begin(), expected.end());
+  embb::algorithms::RadixSort(keys.begin(), keys.end(),
+                              embb::tasks::ExecutionPolicy(), block_size);
+  return keys == expected;
+}
+
+template <typename Key>
+bool SortsLikeStdSort(const std::vector<Key>& values, size_t block_size) {
+  std::vector<Key> keys(values);
+  std::vector<Key> expected(values);
+  std::sort(expected.begin(), expected.end());
+  embb::algorithms::RadixSort(keys.begin(), keys.end(),
+                              embb::tasks::ExecutionPolicy(), block_size);
+  return keys == expected;
+}
+
+struct Record {
+  int key;
+  size_t index;
+};
+
+int RecordKey(const Record& record) {
+  return record.key;
+}
+
+struct RecordKeyFunctor {
+  typedef int result_type;
+  int operator()(const Record& record) const {
+    return record.key;
+  }
+};
+
+struct NamedRecord {
+  unsigned int key;
+  std::string name;
+};
+
+unsigned int NamedRecordKey(const NamedRecord& record) {
+  return record.key;
+}
+
+bool NamedRecordLess(const NamedRecord& lhs, const NamedRecord& rhs) {
+  return lhs.key < rhs.key;
+}
+
+bool RecordLess(const Record& lhs, const Record& rhs) {
+  return lhs.key < rhs.key;
+}
+
+/**
+ * Checks that records are ordered by key and, for equal keys, by their
+ * original index.
+ */
+bool IsStablySorted(const std::vector<Record>& records) {
+  for (size_t i = 1; i < records.size(); i++) {
+    if (records[i - 1].key > records[i].key ||
+        (records[i - 1].key == records[i].key &&
+         records[i - 1].index > records[i].index)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+RadixSortTest::RadixSortTest() {
+  CreateUnit("Integral keys").Add(&RadixSortTest::TestIntegralKeys, this);
+  CreateUnit("Floating-point keys")
+    .Add(&RadixSortTest::TestFloatingPointKeys, this);
+  CreateUnit("Key extractors").Add(&RadixSortTest::TestKeyExtractors, this);
+  CreateUnit("Key/value pairs").Add(&RadixSortTest::TestKeyValuePairs, this);
+  CreateUnit("Non-trivial payloads")
+    .Add(&RadixSortTest::TestNonTrivialPayloads, this);
+  CreateUnit("Ranges").Add(&RadixSortTest::TestRanges, this);
+  CreateUnit("Policies").Add(&RadixSortTest::TestPolicy, this);
+}
+
+void RadixSortTest::TestIntegralKeys() {
+  const size_t count = 20000;
+  // Block sizes for a single block, several blocks and the default
+  const size_t block_sizes[] = { count, 1000, 0 };
+  for (size_t b = 0; b < 3; b++) {
+    size_t block_size = block_sizes[b];
+    PT_EXPECT(SortsLikeStdSort<uint8_t>(count, block_size, 1));
+    PT_EXPECT(SortsLikeStdSort<int8_t>(count, block_size, 2));
+    PT_EXPECT(SortsLikeStdSort<uint16_t>(count, block_size, 3));
+    PT_EXPECT(SortsLikeStdSort<int16_t>(count, block_size, 4));
+    PT_EXPECT(SortsLikeStdSort<uint32_t>(count, block_size, 5));
+    PT_EXPECT(SortsLikeStdSort<int32_t>(count, block_size, 6));
+    PT_EXPECT(SortsLikeStdSort<uint64_t>(count, block_size, 7));
+    PT_EXPECT(SortsLikeStdSort<int64_t>(count, block_size, 8));
+  }
+
+  // Small key ranges, where most passes are skipped
+  std::vector<int> small(count);
+  for (size_t i = 0; i < count; i++) {
+    small[i] = static_cast<int>((i * 7919) % 5) - 2;
+  }
+  PT_EXPECT(SortsLikeStdSort(small, 1000));
+
+  // Already sorted and reversed keys
+  std::vector<int> ascending(count);
+  std::vector<int> descending(count);
+  for (size_t i = 0; i < count; i++) {
+    ascending[i] = static_cast<int>(i);
+    descending[i] = static_cast<int>(count - i);
+  }
+  PT_EXPECT(SortsLikeStdSort(ascending, 1000));
+  PT_EXPECT(SortsLikeStdSort(descending, 1000));
+}
+
+void RadixSortTest::TestFloatingPointKeys() {
+  const size_t count = 20000;
+  uint32_t seed = 42;
+  std::vector<float> floats(count);
+  std::vector<double> doubles(count);
+  for (size_t i = 0; i < count; i++) {
+    int32_t value = static_cast<int32_t>(NextRandom(seed));
+    floats[i] = static_cast<float>(value) / 1024.0f;
+    doubles[i] = static_cast<double>(value) * 1.0e-3;
+  }
+  floats[0] = 0.0f;
+  floats[1] = -1.0e-30f;
+  doubles[0] = 0.0;
+  doubles[1] = -1.0e300;
+  PT_EXPECT(SortsLikeStdSort(floats, count));
+  PT_EXPECT(SortsLikeStdSort(floats, 1000));
+  PT_EXPECT(SortsLikeStdSort(doubles, count));
+  PT_EXPECT(SortsLikeStdSort(doubles, 1000));
+}
+
+void RadixSortTest::TestKeyExtractors() {
+  using embb::algorithms::RadixSort;
+  using embb::tasks::ExecutionPolicy;
+  const size_t count = 20000;
+  std::vector<Record> records(count);
+  for (size_t i = 0; i < count; i++) {
+    records[i].key = static_cast<int>((i * 7919) % 101) - 50;
+    records[i].index = i;
+  }
+  std::vector<Record> expected(records);
+  std::stable_sort(expected.begin(), expected.end(), &RecordLess);
+
+  std::vector<Record> sorted(records);
+  RadixSort(sorted.begin(), sorted.end(), &RecordKey);
+  PT_EXPECT(IsStablySorted(sorted));
+
+  sorted = records;
+  RadixSort(sorted.begin(), sorted.end(), RecordKeyFunctor(),
+            ExecutionPolicy(), 1000);
+  PT_EXPECT(IsStablySorted(sorted));
+  for (size_t i = 0; i < count; i++) {
+    PT_EXPECT_EQ(sorted[i].index, expected[i].index);
+  }
+}
+
+void RadixSortTest::TestKeyValuePairs() {
+  using embb::algorithms::RadixSort;
+  using embb::algorithms::Zip;
+  using embb::tasks::ExecutionPolicy;
+  const size_t count = 20000;
+  uint32_t seed = 7;
+  std::vector<uint32_t> keys(count);
+  std::vector<size_t> values(count);
+  std::vector<Record> expected(count);
+  for (size_t i = 0; i < count; i++) {
+    keys[i] = NextRandom(seed) % 1000;
+    values[i] = i;
+    expected[i].key = static_cast<int>(keys[i]);
+    expected[i].index = i;
+  }
+  std::stable_sort(expected.begin(), expected.end(), &RecordLess);
+
+  RadixSort(Zip(keys.begin(), values.begin()), Zip(keys.end(), values.end()),
+            ExecutionPolicy(), 1000);
+  for (size_t i = 0; i < count; i++) {
+    PT_EXPECT_EQ(keys[i], static_cast<uint32_t>(expected[i].key));
+    PT_EXPECT_EQ(values[i], expected[i].index);
+  }
+
+  // Keys in a deque and values in an array
+  std::deque<int> deque_keys(count);
+  double* array_values = new double[count];
+  for (size_t i = 0; i < count; i++) {
+    deque_keys[i] = -static_cast<int>(i);
+    array_values[i] = static_cast<double>(i);
+  }
+  RadixSort(Zip(deque_keys.begin(), array_values),
+            Zip(deque_keys.end(), array_values + count));
+  for (size_t i = 0; i < count; i++) {
+    PT_EXPECT_EQ(deque_keys[i], static_cast<int>(i) + 1 -
+                                static_cast<int>(count));
+    PT_EXPECT_EQ(array_values[i], static_cast<double>(count - 1 - i));
+  }
+  delete[] array_values;
+}
+
+void RadixSortTest::TestNonTrivialPayloads() {
+  using embb::algorithms::RadixSort;
+  using embb::algorithms::Zip;
+  using embb::tasks::ExecutionPolicy;
+  const size_t count = 5000;
+  uint32_t seed = 11;
+  std::vector<NamedRecord> records(count);
+  for (size_t i = 0; i < count; i++) {
+    // Names exceeding the small string buffer, so that copies allocate
+    std::ostringstream stream;
+    stream << "record with a long enough name " << i;
+    records[i].key = NextRandom(seed) % 100;
+    records[i].name = stream.str();
+  }
+  std::vector<NamedRecord> expected(records);
+  std::stable_sort(expected.begin(), expected.end(), &NamedRecordLess);
+
+  std::vector<NamedRecord> sorted(records);
+  RadixSort(sorted.begin(), sorted.end(), &NamedRecordKey, ExecutionPolicy(),
+            500);
+  for (size_t i = 0; i < count; i++) {
+    PT_EXPECT_EQ(sorted[i].key, expected[i].key);
+    PT_EXPECT(sorted[i].name == expected[i].name);
+  }
+
+  std::vector<unsigned int> keys(count);
+  std::vector<std::string> names(count);
+  for (size_t i = 0; i < count; i++) {
+    keys[i] = records[i].key;
+    names[i] = records[i].name;
+  }
+  RadixSort(Zip(keys.begin(), names.begin()), Zip(keys.end(), names.end()),
+            ExecutionPolicy(), 500);
+  for (size_t i = 0; i < count; i++) {
+    PT_EXPECT_EQ(keys[i], expected[i].key);
+    PT_EXPECT(names[i] == expected[i].name);
+  }
+}
+
+void RadixSortTest::TestRanges() {
+  using embb::algorithms::RadixSort;
+  std::vector<int> init(10);
+  for (size_t i = 0; i < init.size(); i++) {
+    init[i] = 10 - static_cast<int>(i);
+  }
+  std::vector<int> vector(init);
+
+  // Empty range and single element should not change anything
+  RadixSort(vector.begin(), vector.begin());
+  RadixSort(vector.begin(), vector.begin() + 1);
+  PT_EXPECT(vector == init);
+
+  // Omit first and last element
+  RadixSort(vector.begin() + 1, vector.end() - 1);
+  std::vector<int> expected(init);
+  std::sort(expected.begin() + 1, expected.end() - 1);
+  PT_EXPECT(vector == expected);
+
+  // Array
+  int array[5] = { 3, -1, 4, -1, 5 };
+  RadixSort(array, array + 5);
+  PT_EXPECT_EQ(array[0], -1);
+  PT_EXPECT_EQ(array[1], -1);
+  PT_EXPECT_EQ(array[2], 3);
+  PT_EXPECT_EQ(array[3], 4);
+  PT_EXPECT_EQ(array[4], 5);
+}
+
+void RadixSortTest::TestPolicy() {
+  using embb::algorithms::RadixSort;
+  using embb::tasks::ExecutionPolicy;
+  size_t count = 5000;
+  std::vector<int> init(count);
+  for (size_t i = 0; i < count; i++) {
+    init[i] = static_cast<int>((i * 7919) % count);
+  }
+  std::vector<int> expected(init);
+  std::sort(expected.begin(), expected.end());
+
+  std::vector<int> vector(init);
+  RadixSort(vector.begin(), vector.end(), ExecutionPolicy());
+  PT_EXPECT(vector == expected);
+
+  vector = init;
+  RadixSort(vector.begin(), vector.end(), ExecutionPolicy(true), 100);
+  PT_EXPECT(vector == expected);
+
+  vector = init;
+  RadixSort(vector.begin(), vector.end(), ExecutionPolicy(true, 1), 100);
+  PT_EXPECT(vector == expected);
+
+#ifdef EMBB_USE_EXCEPTIONS
+  bool empty_core_set_thrown = false;
+  try {
+    RadixSort(vector.begin(), vector.end(), ExecutionPolicy(false));
+  }
+  catch (embb::base::ErrorException &) {
+    empty_core_set_thrown = true;
+  }
+  PT_EXPECT_MSG(empty_core_set_thrown,
+    "Empty core set should throw ErrorException");
+  bool negative_range_thrown = false;
+  try {
+    RadixSort(vector.begin() + 1, vector.begin());
+  }
+  catch (embb::base::ErrorException &) {
+    negative_range_thrown = true;
+  }
+  PT_EXPECT_MSG(negative_range_thrown,
+    "Negative range should throw ErrorException");
+#endif
+}
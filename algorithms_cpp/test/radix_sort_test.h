@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2014-2015, Siemens AG. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef ALGORITHMS_CPP_TEST_RADIX_SORT_TEST_H_
+#define ALGORITHMS_CPP_TEST_RADIX_SORT_TEST_H_
+
+#include <partest/partest.h>
+
+/**
+ * Provides tests for the RadixSort method.
+ */
+class RadixSortTest : public partest::TestCase {
+ public:
+  /**
+   * Creates test units.
+   */
+  RadixSortTest();
+
+ private:
+  /**
+   * Tests signed and unsigned integral keys of all sizes.
+   */
+  void TestIntegralKeys();
+
+  /**
+   * Tests floating-point keys including negative values.
+   */
+  void TestFloatingPointKeys();
+
+  /**
+   * Tests sorting structures by key extractors and the stability.
+   */
+  void TestKeyExtractors();
+
+  /**
+   * Tests sorting key/value pairs given by zip iterators.
+   */
+  void TestKeyValuePairs();
+
+  /**
+   * Tests records and values with non-trivial copy semantics.
+   */
+  void TestNonTrivialPayloads();
+
+  /**
+   * Tests setting various ranges to be sorted.
+   */
+  void TestRanges();
+
+  /**
+   * Tests setting policies and invalid arguments.
+   */
+  void TestPolicy();
+};
+
+#endif  // ALGORITHMS_CPP_TEST_RADIX_SORT_TEST_H_
@@ -30,6 +30,7 @@
 #include <deque>
 #include <vector>
 #include <functional>
+#include <string>
 
 /**
  * Functor to compute the square of a number.
@@ -41,6 +42,52 @@ struct Square {
   }
 };
 
+/**
+ * Shifts a double into the negative range, such that minima and maxima of
+ * transformed values are tested.
+ */
+struct ShiftDown {
+  double operator()(double value) const {
+    return value - 50.0;
+  }
+};
+
+/**
+ * Addition of doubles that is not recognized as std::plus, such that the
+ * elements of a block are added from left to right.
+ */
+struct AddDoubles {
+  double operator()(double lhs, double rhs) const {
+    return lhs + rhs;
+  }
+};
+
+/**
+ * Converts a number to a string of one letter.
+ */
+struct ToLetter {
+  std::string operator()(int value) const {
+    return std::string(1, static_cast<char>('a' + value % 26));
+  }
+};
+
+/**
+ * Reduces a range like DeterministicReduce, sequentially.
+ */
+static double DeterministicSum(const double* values, size_t count,
+                               size_t block_size) {
+  if (count <= block_size) {
+    double sum = 0.0;
+    for (size_t i = 0; i < count; i++) {
+      sum = sum + values[i];
+    }
+    return sum;
+  }
+  double lower = DeterministicSum(values, count / 2, block_size);
+  return lower + DeterministicSum(values + count / 2, count - count / 2,
+                                  block_size);
+}
+
 static int SquareFunction(int &val) {
   return val * val;
 }
@@ -56,6 +103,11 @@ ReduceTest::ReduceTest() {
   CreateUnit("Function Pointers").Add(&ReduceTest::TestFunctionPointers, this);
   CreateUnit("Ranges").Add(&ReduceTest::TestRanges, this);
   CreateUnit("Block sizes").Add(&ReduceTest::TestBlockSizes, this);
+  CreateUnit("Large ranges").Add(&ReduceTest::TestLargeRanges, this);
+  CreateUnit("Arithmetic kernels")
+    .Add(&ReduceTest::TestArithmeticKernels, this);
+  CreateUnit("Deterministic").Add(&ReduceTest::TestDeterministic, this);
+  CreateUnit("Compensated").Add(&ReduceTest::TestCompensated, this);
   CreateUnit("Policies").Add(&ReduceTest::TestPolicy, this);
   CreateUnit("Stress test").Add(&ReduceTest::StressTest, this);
 }
@@ -161,6 +213,183 @@ void ReduceTest::TestBlockSizes() {
   }
 }
 
+void ReduceTest::TestLargeRanges() {
+  using embb::algorithms::Reduce;
+  using embb::algorithms::Identity;
+  using embb::tasks::ExecutionPolicy;
+  size_t count = MTAPI_NODE_MAX_TASKS_DEFAULT * 64;
+  int sum = 0;
+  std::vector<int> vector(count);
+  for (size_t i = 0; i < count; i++) {
+    vector[i] = static_cast<int>(i % 100);
+    sum += vector[i];
+  }
+
+  for (size_t block_size = 0; block_size < 3; block_size++) {
+    PT_EXPECT_EQ(Reduce(vector.begin(), vector.end(), 0, std::plus<int>(),
+                        Identity(), ExecutionPolicy(), block_size), sum);
+  }
+}
+
+void ReduceTest::TestArithmeticKernels() {
+  using embb::algorithms::Reduce;
+  using embb::algorithms::Identity;
+  using embb::algorithms::Min;
+  using embb::algorithms::Max;
+  using embb::tasks::ExecutionPolicy;
+  // Sizes below, at and above multiples of the accumulator count
+  const size_t sizes[] = { 1, 7, 15, 16, 17, 31, 1000, 1003 };
+  for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+    size_t count = sizes[s];
+    std::vector<unsigned int> vector(count);
+    std::vector<double> doubles(count);
+    unsigned int sum = 0;
+    unsigned int product = 1;
+    unsigned int bits_and = ~0u;
+    unsigned int bits_or = 0;
+    unsigned int bits_xor = 0;
+    unsigned int minimum = ~0u;
+    unsigned int maximum = 0;
+    double double_minimum = 1000.0;
+    double double_maximum = -1000.0;
+    int squares = 0;
+    for (size_t i = 0; i < count; i++) {
+      vector[i] = static_cast<unsigned int>(i * 2654435761u) | 1u;
+      doubles[i] = static_cast<double>(i % 100);
+      sum += vector[i];
+      product *= vector[i];
+      bits_and &= vector[i];
+      bits_or |= vector[i];
+      bits_xor ^= vector[i];
+      minimum = (vector[i] < minimum) ? vector[i] : minimum;
+      maximum = (vector[i] > maximum) ? vector[i] : maximum;
+      double_minimum = (doubles[i] - 50.0 < double_minimum) ?
+        doubles[i] - 50.0 : double_minimum;
+      double_maximum = (doubles[i] - 50.0 > double_maximum) ?
+        doubles[i] - 50.0 : double_maximum;
+      squares += static_cast<int>(i % 100) * static_cast<int>(i % 100);
+    }
+    const unsigned int* array = &vector[0];
+    PT_EXPECT_EQ(Reduce(vector.begin(), vector.end(), 0u,
+                        std::plus<unsigned int>()), sum);
+    PT_EXPECT_EQ(Reduce(array, array + count, 1u,
+                        std::multiplies<unsigned int>()), product);
+    PT_EXPECT_EQ(Reduce(array, array + count, ~0u,
+                        std::bit_and<unsigned int>()), bits_and);
+    PT_EXPECT_EQ(Reduce(vector.begin(), vector.end(), 0u,
+                        std::bit_or<unsigned int>(), Identity(),
+                        ExecutionPolicy(), 4), bits_or);
+    PT_EXPECT_EQ(Reduce(vector.begin(), vector.end(), 0u,
+                        std::bit_xor<unsigned int>()), bits_xor);
+    PT_EXPECT_EQ(Reduce(array, array + count, ~0u, Min<unsigned int>()),
+                 minimum);
+    PT_EXPECT_EQ(Reduce(vector.begin(), vector.end(), 0u,
+                        Max<unsigned int>(), Identity(), ExecutionPolicy(),
+                        4), maximum);
+    PT_EXPECT_EQ(Reduce(doubles.begin(), doubles.end(), 1000.0,
+                        Min<double>(), ShiftDown()), double_minimum);
+    PT_EXPECT_EQ(Reduce(doubles.begin(), doubles.end(), -1000.0,
+                        Max<double>(), ShiftDown()), double_maximum);
+    // Small integers are exact in double, regardless of the order
+    PT_EXPECT_EQ(Reduce(doubles.begin(), doubles.end(), 0.0,
+                        std::plus<double>(), Square()),
+                 static_cast<double>(squares));
+  }
+}
+
+void ReduceTest::TestDeterministic() {
+  using embb::algorithms::DeterministicReduce;
+  using embb::algorithms::Identity;
+  using embb::tasks::ExecutionPolicy;
+  const size_t count = 100003;
+  std::vector<double> vector(count);
+  unsigned int state = 1;
+  for (size_t i = 0; i < count; i++) {
+    state = state * 1103515245u + 12345u;
+    // Values of very different magnitudes make the sum order-dependent
+    double value = static_cast<double>(state >> 8) /
+      static_cast<double>(1u << (state % 24));
+    vector[i] = (state & 1) ? -value : value;
+  }
+  std::deque<double> deque(vector.begin(), vector.end());
+
+  const size_t block_sizes[] = { 0, 1, 100, 5000, count };
+  for (size_t b = 0; b < sizeof(block_sizes) / sizeof(block_sizes[0]); b++) {
+    size_t block_size = block_sizes[b];
+    double expected = DeterministicSum(&vector[0], count,
+                                       block_size == 0 ? 1024 : block_size);
+    PT_EXPECT_EQ(DeterministicReduce(vector.begin(), vector.end(), 0.0,
+                 AddDoubles(), Identity(), ExecutionPolicy(), block_size),
+                 expected);
+    PT_EXPECT_EQ(DeterministicReduce(deque.begin(), deque.end(), 0.0,
+                 AddDoubles(), Identity(), ExecutionPolicy(true, 1),
+                 block_size), expected);
+    // The vectorized kernel for std::plus gives the same result every time
+    double sum = DeterministicReduce(vector.begin(), vector.end(), 0.0,
+      std::plus<double>(), Identity(), ExecutionPolicy(), block_size);
+    for (int run = 0; run < 3; run++) {
+      PT_EXPECT_EQ(DeterministicReduce(vector.begin(), vector.end(), 0.0,
+                   std::plus<double>(), Identity(), ExecutionPolicy(true),
+                   block_size), sum);
+    }
+  }
+
+  // Non-commutative reductions keep the order of the elements
+  std::vector<int> letters(1000);
+  std::string expected_letters;
+  for (size_t i = 0; i < letters.size(); i++) {
+    letters[i] = static_cast<int>(i);
+    expected_letters += ToLetter()(static_cast<int>(i));
+  }
+  PT_EXPECT(DeterministicReduce(letters.begin(), letters.end(),
+            std::string(), std::plus<std::string>(), ToLetter(),
+            ExecutionPolicy(), 7) == expected_letters);
+
+  // Empty range returns the neutral element
+  PT_EXPECT_EQ(DeterministicReduce(vector.begin(), vector.begin(), 41.0,
+               std::plus<double>()), 41.0);
+#ifdef EMBB_USE_EXCEPTIONS
+  bool negative_range_thrown = false;
+  try {
+    DeterministicReduce(vector.begin() + 1, vector.begin(), 0.0,
+                        std::plus<double>());
+  }
+  catch (embb::base::ErrorException &) {
+    negative_range_thrown = true;
+  }
+  PT_EXPECT_MSG(negative_range_thrown,
+    "Negative range should throw ErrorException");
+#endif
+}
+
+void ReduceTest::TestCompensated() {
+  using embb::algorithms::CompensatedPlus;
+  using embb::algorithms::DeterministicReduce;
+  using embb::algorithms::Reduce;
+  using embb::algorithms::Identity;
+  using embb::tasks::ExecutionPolicy;
+  // Adding the small values one by one to the large one loses all of them
+  const size_t count = 100000;
+  std::vector<double> vector(count + 1, 1e-16);
+  vector[0] = 1.0;
+  const double expected = 1.0 + 1e-11;
+  const double tolerance = 1e-15;
+  double sum = DeterministicReduce(vector.begin(), vector.end(), 0.0,
+    CompensatedPlus<double>(), Identity(), ExecutionPolicy(), count + 1);
+  PT_EXPECT(sum - expected < tolerance && expected - sum < tolerance);
+  sum = DeterministicReduce(vector.begin(), vector.end(), 0.0,
+                            CompensatedPlus<double>());
+  PT_EXPECT(sum - expected < tolerance && expected - sum < tolerance);
+  // The blocks of Reduce are compensated separately, such that the error
+  // grows with their number, but stays far below the loss without
+  // compensation.
+  sum = Reduce(vector.begin(), vector.end(), 0.0, CompensatedPlus<double>(),
+               Identity(), ExecutionPolicy(), 1000);
+  PT_EXPECT(sum - expected < tolerance * 100 &&
+            expected - sum < tolerance * 100);
+  PT_EXPECT_EQ(CompensatedPlus<float>()(1.5f, 2.0f), 3.5f);
+}
+
 void ReduceTest::TestPolicy() {
   using embb::algorithms::Reduce;
   using embb::tasks::ExecutionPolicy;
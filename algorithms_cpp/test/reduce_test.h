@@ -65,6 +65,26 @@ class ReduceTest : public partest::TestCase {
    */
   void TestBlockSizes();
 
+  /**
+   * Tests ranges with more blocks than tasks available.
+   */
+  void TestLargeRanges();
+
+  /**
+   * Tests the leaf kernels for contiguous ranges of arithmetic types.
+   */
+  void TestArithmeticKernels();
+
+  /**
+   * Tests that deterministic reductions do not depend on the policy.
+   */
+  void TestDeterministic();
+
+  /**
+   * Tests compensated summation of floating-point values.
+   */
+  void TestCompensated();
+
   /**
    * Tests setting policies (without checking their actual execution).
    */
@@ -28,6 +28,7 @@
 #include <embb/algorithms/scan.h>
 #include <vector>
 #include <deque>
+#include <string>
 #include <functional>
 
 /**
@@ -48,6 +49,15 @@ static int AddFunction(int lhs, int rhs) {
   return lhs + rhs;
 }
 
+/**
+ * Converts a character to a string, for scans that concatenate strings.
+ */
+struct CharToString {
+  std::string operator()(char c) const {
+    return std::string(1, c);
+  }
+};
+
 ScanTest::ScanTest() {
   CreateUnit("Different data structures")
       .Add(&ScanTest::TestDataStructures, this);
@@ -55,6 +65,9 @@ ScanTest::ScanTest() {
   CreateUnit("Function Pointers").Add(&ScanTest::TestFunctionPointers, this);
   CreateUnit("Ranges").Add(&ScanTest::TestRanges, this);
   CreateUnit("Block sizes").Add(&ScanTest::TestBlockSizes, this);
+  CreateUnit("In-place").Add(&ScanTest::TestInPlace, this);
+  CreateUnit("Exclusive scan").Add(&ScanTest::TestExclusiveScan, this);
+  CreateUnit("Segmented scan").Add(&ScanTest::TestSegmentedScan, this);
   CreateUnit("Policies").Add(&ScanTest::TestPolicy, this);
   CreateUnit("Stress test").Add(&ScanTest::StressTest, this);
 }
@@ -251,6 +264,126 @@ void ScanTest::TestBlockSizes() {
   }
 }
 
+void ScanTest::TestInPlace() {
+  using embb::algorithms::Scan;
+  using embb::tasks::ExecutionPolicy;
+  using embb::algorithms::Identity;
+  size_t count = 10000;
+  std::vector<int> vector(count);
+  for (size_t block_size = 0; block_size < 1000; block_size += 333) {
+    for (size_t i = 0; i < count; i++) {
+      vector[i] = static_cast<int>(i % 7);
+    }
+    Scan(vector.begin(), vector.end(), vector.begin(), 0, std::plus<int>(),
+         Identity(), ExecutionPolicy(), block_size);
+    int expected = 0;
+    for (size_t i = 0; i < count; i++) {
+      expected += static_cast<int>(i % 7);
+      PT_EXPECT_EQ(expected, vector[i]);
+    }
+  }
+
+  // Concatenation is associative but not commutative
+  std::string input;
+  for (size_t i = 0; i < 1000; i++) {
+    input += static_cast<char>('a' + (i * 7) % 26);
+  }
+  std::vector<std::string> output(input.size());
+  Scan(input.begin(), input.end(), output.begin(), std::string(),
+       std::plus<std::string>(), CharToString(), ExecutionPolicy(), 16);
+  for (size_t i = 0; i < input.size(); i++) {
+    PT_EXPECT(output[i] == input.substr(0, i + 1));
+  }
+}
+
+void ScanTest::TestExclusiveScan() {
+  using embb::algorithms::ExclusiveScan;
+  using embb::tasks::ExecutionPolicy;
+  using embb::algorithms::Identity;
+  size_t count = 10000;
+  std::vector<int> vector(count);
+  std::vector<int> output(count);
+  for (size_t i = 0; i < count; i++) {
+    vector[i] = static_cast<int>(i % 7);
+  }
+  for (size_t block_size = 0; block_size < 1000; block_size += 333) {
+    ExclusiveScan(vector.begin(), vector.end(), output.begin(), 0,
+                  std::plus<int>(), Identity(), ExecutionPolicy(),
+                  block_size);
+    int expected = 0;
+    for (size_t i = 0; i < count; i++) {
+      PT_EXPECT_EQ(expected, output[i]);
+      expected += vector[i];
+    }
+  }
+
+  // In-place with transformation
+  std::vector<int> init(vector);
+  ExclusiveScan(vector.begin(), vector.end(), vector.begin(), 0,
+                std::plus<int>(), Square());
+  int expected = 0;
+  for (size_t i = 0; i < count; i++) {
+    PT_EXPECT_EQ(expected, vector[i]);
+    expected += init[i] * init[i];
+  }
+
+  std::string input("exclusive");
+  std::vector<std::string> strings(input.size());
+  ExclusiveScan(input.begin(), input.end(), strings.begin(), std::string(),
+                std::plus<std::string>(), CharToString(), ExecutionPolicy(),
+                2);
+  for (size_t i = 0; i < input.size(); i++) {
+    PT_EXPECT(strings[i] == input.substr(0, i));
+  }
+}
+
+void ScanTest::TestSegmentedScan() {
+  using embb::algorithms::SegmentedScan;
+  using embb::tasks::ExecutionPolicy;
+  using embb::algorithms::Identity;
+  size_t count = 10000;
+  std::vector<int> vector(count);
+  std::vector<bool> flags(count);
+  std::vector<int> output(count);
+  for (size_t i = 0; i < count; i++) {
+    vector[i] = static_cast<int>(i % 7);
+    // Segments of different lengths, including some longer than a block
+    flags[i] = (i * i) % 1009 == 3;
+  }
+  for (size_t block_size = 0; block_size < 1000; block_size += 333) {
+    SegmentedScan(vector.begin(), vector.end(), flags.begin(), output.begin(),
+                  0, std::plus<int>(), Identity(), ExecutionPolicy(),
+                  block_size);
+    int expected = 0;
+    for (size_t i = 0; i < count; i++) {
+      expected = flags[i] ? vector[i] : expected + vector[i];
+      PT_EXPECT_EQ(expected, output[i]);
+    }
+  }
+
+  // Every element starts a segment
+  std::vector<char> all(count, 1);
+  SegmentedScan(vector.begin(), vector.end(), all.begin(), output.begin(), 0,
+                std::plus<int>());
+  for (size_t i = 0; i < count; i++) {
+    PT_EXPECT_EQ(vector[i], output[i]);
+  }
+
+  // Concatenation within segments
+  std::string input("segmented scan");
+  std::vector<std::string> strings(input.size());
+  std::vector<int> word_starts(input.size());
+  for (size_t i = 0; i < input.size(); i++) {
+    word_starts[i] = (input[i] == ' ') ? 1 : 0;
+  }
+  SegmentedScan(input.begin(), input.end(), word_starts.begin(),
+                strings.begin(), std::string(), std::plus<std::string>(),
+                CharToString(), ExecutionPolicy(), 3);
+  PT_EXPECT(strings[8] == "segmented");
+  PT_EXPECT(strings[9] == " ");
+  PT_EXPECT(strings[13] == " scan");
+}
+
 void ScanTest::TestPolicy() {
   using embb::algorithms::Scan;
   using embb::tasks::ExecutionPolicy;
@@ -65,6 +65,21 @@ class ScanTest : public partest::TestCase {
    */
   void TestBlockSizes();
 
+  /**
+   * Tests scanning in-place and with an operation that is not commutative.
+   */
+  void TestInPlace();
+
+  /**
+   * Tests the exclusive scan.
+   */
+  void TestExclusiveScan();
+
+  /**
+   * Tests the segmented scan.
+   */
+  void TestSegmentedScan();
+
   /**
    * Tests setting policies (without checking their actual execution).
    */
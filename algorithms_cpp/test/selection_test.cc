@@ -0,0 +1,307 @@
+/*
+ * Copyright (c) 2014-2015, Siemens AG. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <selection_test.h>
+#include <embb/algorithms/selection.h>
+#include <embb/tasks/execution_policy.h>
+#include <algorithm>
+#include <deque>
+#include <functional>
+#include <vector>
+
+namespace {
+
+/**
+ * Fills a vector with pseudo-random values containing duplicates.
+ */
+void FillValues(std::vector<int>& values, size_t count, int modulus) {
+  values.resize(count);
+  unsigned int state = 12345;
+  for (size_t i = 0; i < count; i++) {
+    state = state * 1103515245u + 12345u;
+    values[i] = static_cast<int>((state >> 8) % static_cast<unsigned>(modulus));
+  }
+}
+
+/**
+ * Checks that the element at position \c nth of \c values is at its sorted
+ * position in \c sorted, and that the elements are split around it.
+ */
+template<typename RAI, typename Comparison>
+bool IsNthElement(RAI first, RAI nth, RAI last,
+                  const std::vector<int>& sorted, Comparison comparison) {
+  if (*nth != sorted[static_cast<size_t>(nth - first)]) {
+    return false;
+  }
+  for (RAI it = first; it != nth; ++it) {
+    if (comparison(*nth, *it)) {
+      return false;
+    }
+  }
+  for (RAI it = nth; it != last; ++it) {
+    if (comparison(*it, *nth)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool GreaterFunction(int lhs, int rhs) {
+  return lhs > rhs;
+}
+
+}  // namespace
+
+SelectionTest::SelectionTest() {
+  CreateUnit("Different data structures")
+    .Add(&SelectionTest::TestDataStructures, this);
+  CreateUnit("NthElement").Add(&SelectionTest::TestNthElement, this);
+  CreateUnit("Large ranges").Add(&SelectionTest::TestLargeRanges, this);
+  CreateUnit("PartialSort").Add(&SelectionTest::TestPartialSort, this);
+  CreateUnit("TopK").Add(&SelectionTest::TestTopK, this);
+  CreateUnit("Policies").Add(&SelectionTest::TestPolicy, this);
+  CreateUnit("Stress test").Add(&SelectionTest::StressTest, this);
+}
+
+void SelectionTest::TestDataStructures() {
+  using embb::algorithms::NthElement;
+  using embb::algorithms::PartialSort;
+  using embb::algorithms::TopK;
+  const int size = 10;
+  int array[] = { 5, 9, 1, 7, 3, 8, 2, 6, 0, 4 };
+  std::vector<int> vector(array, array + size);
+  std::deque<int> deque(array, array + size);
+  const std::vector<int> const_vector(array, array + size);
+
+  NthElement(array, array + 4, array + size);
+  PT_EXPECT_EQ(array[4], 4);
+  PartialSort(vector.begin(), vector.begin() + 3, vector.end());
+  PT_EXPECT_EQ(vector[0], 0);
+  PT_EXPECT_EQ(vector[1], 1);
+  PT_EXPECT_EQ(vector[2], 2);
+  NthElement(deque.begin(), deque.begin() + 9, deque.end());
+  PT_EXPECT_EQ(deque[9], 9);
+
+  std::vector<int> output(3);
+  PT_EXPECT(TopK(const_vector.begin(), const_vector.end(), output.begin(), 3,
+                 std::greater<int>()) == output.end());
+  PT_EXPECT_EQ(output[0], 9);
+  PT_EXPECT_EQ(output[1], 8);
+  PT_EXPECT_EQ(output[2], 7);
+}
+
+void SelectionTest::TestNthElement() {
+  using embb::algorithms::NthElement;
+  using embb::tasks::ExecutionPolicy;
+  const size_t sizes[] = { 1, 2, 3, 17, 100 };
+  for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+    std::vector<int> init;
+    FillValues(init, sizes[s], 7);
+    std::vector<int> sorted(init);
+    std::sort(sorted.begin(), sorted.end());
+    std::vector<int> sorted_descending(init);
+    std::sort(sorted_descending.begin(), sorted_descending.end(),
+              std::greater<int>());
+    for (size_t nth = 0; nth < sizes[s]; nth++) {
+      std::vector<int> vector(init);
+      NthElement(vector.begin(), vector.begin() + nth, vector.end());
+      PT_EXPECT(IsNthElement(vector.begin(), vector.begin() + nth,
+                             vector.end(), sorted, std::less<int>()));
+      vector = init;
+      NthElement(vector.begin(), vector.begin() + nth, vector.end(),
+                 &GreaterFunction, ExecutionPolicy(), 1);
+      PT_EXPECT(IsNthElement(vector.begin(), vector.begin() + nth,
+                             vector.end(), sorted_descending,
+                             &GreaterFunction));
+    }
+    // Selecting the end of the range leaves it unchanged
+    std::vector<int> vector(init);
+    NthElement(vector.begin(), vector.end(), vector.end());
+    PT_EXPECT(vector == init);
+  }
+}
+
+void SelectionTest::TestLargeRanges() {
+  using embb::algorithms::NthElement;
+  using embb::tasks::ExecutionPolicy;
+  const size_t count = 50000;
+  const int moduli[] = { 3, 1000, 1000000 };
+  const size_t block_sizes[] = { 0, 1, 100 };
+  for (size_t m = 0; m < sizeof(moduli) / sizeof(moduli[0]); m++) {
+    std::vector<int> init;
+    FillValues(init, count, moduli[m]);
+    std::vector<int> sorted(init);
+    std::sort(sorted.begin(), sorted.end());
+    for (size_t b = 0; b < sizeof(block_sizes) / sizeof(block_sizes[0]);
+         b++) {
+      const size_t positions[] = { 0, 1, count / 3, count / 2, count - 1 };
+      for (size_t p = 0; p < sizeof(positions) / sizeof(positions[0]); p++) {
+        std::vector<int> vector(init);
+        NthElement(vector.begin(), vector.begin() + positions[p],
+                   vector.end(), std::less<int>(), ExecutionPolicy(),
+                   block_sizes[b]);
+        PT_EXPECT(IsNthElement(vector.begin(), vector.begin() + positions[p],
+                               vector.end(), sorted, std::less<int>()));
+      }
+    }
+  }
+
+  // Sorted and reverse sorted ranges
+  std::vector<int> vector(count);
+  for (size_t i = 0; i < count; i++) {
+    vector[i] = static_cast<int>(i);
+  }
+  NthElement(vector.begin(), vector.begin() + count / 4, vector.end());
+  PT_EXPECT_EQ(vector[count / 4], static_cast<int>(count / 4));
+  std::reverse(vector.begin(), vector.end());
+  NthElement(vector.begin(), vector.begin() + count / 4, vector.end());
+  PT_EXPECT_EQ(vector[count / 4], static_cast<int>(count / 4));
+}
+
+void SelectionTest::TestPartialSort() {
+  using embb::algorithms::PartialSort;
+  using embb::tasks::ExecutionPolicy;
+  const size_t count = 20000;
+  std::vector<int> init;
+  FillValues(init, count, 5000);
+  std::vector<int> sorted(init);
+  std::sort(sorted.begin(), sorted.end(), std::greater<int>());
+  const size_t middles[] = { 0, 1, 10, 1000, count - 1, count };
+  for (size_t m = 0; m < sizeof(middles) / sizeof(middles[0]); m++) {
+    std::vector<int> vector(init);
+    PartialSort(vector.begin(), vector.begin() + middles[m], vector.end(),
+                std::greater<int>());
+    PT_EXPECT(std::equal(vector.begin(), vector.begin() + middles[m],
+                         sorted.begin()));
+    std::sort(vector.begin(), vector.end(), std::greater<int>());
+    PT_EXPECT(vector == sorted);
+  }
+  std::vector<int> vector(init.begin(), init.begin() + 100);
+  std::vector<int> small_sorted(vector);
+  std::sort(small_sorted.begin(), small_sorted.end());
+  PartialSort(vector.begin(), vector.begin() + 50, vector.end(),
+              std::less<int>(), ExecutionPolicy(), 3);
+  PT_EXPECT(std::equal(vector.begin(), vector.begin() + 50,
+                       small_sorted.begin()));
+}
+
+void SelectionTest::TestTopK() {
+  using embb::algorithms::TopK;
+  using embb::tasks::ExecutionPolicy;
+  const size_t count = 30000;
+  std::vector<int> init;
+  FillValues(init, count, 100000);
+  std::vector<int> sorted(init);
+  std::sort(sorted.begin(), sorted.end(), std::greater<int>());
+  const size_t ks[] = { 1, 10, 1000, count / 2, count };
+  const size_t block_sizes[] = { 0, 7, 1000 };
+  for (size_t k = 0; k < sizeof(ks) / sizeof(ks[0]); k++) {
+    for (size_t b = 0; b < sizeof(block_sizes) / sizeof(block_sizes[0]);
+         b++) {
+      std::vector<int> output(ks[k]);
+      PT_EXPECT(TopK(init.begin(), init.end(), output.begin(), ks[k],
+                     std::greater<int>(), ExecutionPolicy(), block_sizes[b])
+                == output.end());
+      PT_EXPECT(std::equal(output.begin(), output.end(), sorted.begin()));
+    }
+  }
+
+  // More elements requested than available, and none requested
+  std::vector<int> output(10, -1);
+  PT_EXPECT(TopK(init.begin(), init.begin() + 5, output.begin(), 10) ==
+            output.begin() + 5);
+  std::vector<int> smallest(init.begin(), init.begin() + 5);
+  std::sort(smallest.begin(), smallest.end());
+  PT_EXPECT(std::equal(smallest.begin(), smallest.end(), output.begin()));
+  PT_EXPECT_EQ(output[5], -1);
+  PT_EXPECT(TopK(init.begin(), init.end(), output.begin(), 0) ==
+            output.begin());
+  PT_EXPECT(TopK(init.begin(), init.begin(), output.begin(), 10) ==
+            output.begin());
+}
+
+void SelectionTest::TestPolicy() {
+  using embb::algorithms::NthElement;
+  using embb::algorithms::TopK;
+  using embb::tasks::ExecutionPolicy;
+  int a[] = { 5, 9, 1, 7, 3, 8, 2, 6, 0, 4 };
+  std::vector<int> init(a, a + (sizeof a / sizeof a[0]));
+  std::vector<int> vector(init);
+  NthElement(vector.begin(), vector.begin() + 5, vector.end(),
+             std::less<int>(), ExecutionPolicy());
+  PT_EXPECT_EQ(vector[5], 5);
+  vector = init;
+  NthElement(vector.begin(), vector.begin() + 5, vector.end(),
+             std::less<int>(), ExecutionPolicy(true));
+  PT_EXPECT_EQ(vector[5], 5);
+  vector = init;
+  NthElement(vector.begin(), vector.begin() + 5, vector.end(),
+             std::less<int>(), ExecutionPolicy(true, 1));
+  PT_EXPECT_EQ(vector[5], 5);
+  int output[2];
+  PT_EXPECT(TopK(init.begin(), init.end(), output, 2, std::less<int>(),
+                 ExecutionPolicy(true)) == output + 2);
+  PT_EXPECT_EQ(output[0], 0);
+  PT_EXPECT_EQ(output[1], 1);
+
+#ifdef EMBB_USE_EXCEPTIONS
+  bool empty_core_set_thrown = false;
+  try {
+    NthElement(vector.begin(), vector.begin() + 5, vector.end(),
+               std::less<int>(), ExecutionPolicy(false));
+  }
+  catch (embb::base::ErrorException &) {
+    empty_core_set_thrown = true;
+  }
+  PT_EXPECT_MSG(empty_core_set_thrown,
+    "Empty core set should throw ErrorException");
+  bool outside_range_thrown = false;
+  try {
+    NthElement(vector.begin() + 1, vector.begin(), vector.end());
+  }
+  catch (embb::base::ErrorException &) {
+    outside_range_thrown = true;
+  }
+  PT_EXPECT_MSG(outside_range_thrown,
+    "Element outside of the range should throw ErrorException");
+#endif
+}
+
+void SelectionTest::StressTest() {
+  using embb::algorithms::TopK;
+  size_t count = embb::tasks::Node::GetInstance().GetCoreCount() * 10000;
+  std::vector<int> large_vector(count);
+  for (size_t i = 0; i < count; i++) {
+    large_vector[i] = static_cast<int>((i * 7919) % count);
+  }
+  std::vector<int> output(100);
+  TopK(large_vector.begin(), large_vector.end(), output.begin(), 100,
+       std::greater<int>());
+  for (size_t i = 0; i < 100; i++) {
+    PT_EXPECT_EQ(output[i], static_cast<int>(count - 1 - i));
+  }
+}
@@ -0,0 +1,304 @@
+/*
+ * Copyright (c) 2014-2015, Siemens AG. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <transform_test.h>
+#include <embb/algorithms/transform.h>
+#include <embb/algorithms/zip_iterator.h>
+#include <embb/tasks/execution_policy.h>
+#include <algorithm>
+#include <deque>
+#include <vector>
+#include <functional>
+
+namespace {
+
+struct Square {
+  int operator()(int val) const {
+    return val * val;
+  }
+};
+
+int SquareFunction(int val) {
+  return val * val;
+}
+
+struct ZipProduct {
+  template<typename TypeA, typename TypeB>
+  int operator()(embb::algorithms::ZipPair<TypeA, TypeB> pair) const {
+    return pair.First() * pair.Second();
+  }
+};
+
+struct Constant {
+  int operator()() const {
+    return 42;
+  }
+};
+
+}  // namespace
+
+TransformTest::TransformTest() {
+  CreateUnit("Different data structures")
+    .Add(&TransformTest::TestDataStructures, this);
+  CreateUnit("Binary transform")
+    .Add(&TransformTest::TestBinaryTransform, this);
+  CreateUnit("Ranges").Add(&TransformTest::TestRanges, this);
+  CreateUnit("Block sizes").Add(&TransformTest::TestBlockSizes, this);
+  CreateUnit("Fill, copy, and generate")
+    .Add(&TransformTest::TestFillCopyGenerate, this);
+  CreateUnit("Large ranges").Add(&TransformTest::TestLargeRanges, this);
+  CreateUnit("Policies").Add(&TransformTest::TestPolicy, this);
+  CreateUnit("Stress test").Add(&TransformTest::StressTest, this);
+}
+
+void TransformTest::TestDataStructures() {
+  using embb::algorithms::Transform;
+  const int size = 10;
+  int array[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+  std::vector<int> vector(array, array + size);
+  std::deque<int> deque(array, array + size);
+  const std::vector<int> const_vector(array, array + size);
+
+  int array_out[size];
+  std::vector<int> vector_out(size);
+  std::deque<int> deque_out(size);
+
+  PT_EXPECT(Transform(array, array + size, array_out, Square()) ==
+            array_out + size);
+  PT_EXPECT(Transform(vector.begin(), vector.end(), vector_out.begin(),
+                      &SquareFunction) == vector_out.end());
+  PT_EXPECT(Transform(deque.begin(), deque.end(), deque_out.begin(),
+                      Square()) == deque_out.end());
+  for (int i = 0; i < size; i++) {
+    PT_EXPECT_EQ(array_out[i], array[i] * array[i]);
+    PT_EXPECT_EQ(vector_out[i], array[i] * array[i]);
+    PT_EXPECT_EQ(deque_out[i], array[i] * array[i]);
+  }
+
+  // In place and from constant input
+  Transform(vector.begin(), vector.end(), vector.begin(), Square());
+  Transform(const_vector.begin(), const_vector.end(), deque.begin(), Square());
+  for (int i = 0; i < size; i++) {
+    PT_EXPECT_EQ(vector[i], array[i] * array[i]);
+    PT_EXPECT_EQ(deque[i], array[i] * array[i]);
+  }
+}
+
+void TransformTest::TestBinaryTransform() {
+  using embb::algorithms::Transform;
+  using embb::algorithms::Zip;
+  const int size = 10;
+  int array_a[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+  std::vector<int> vector_b(size);
+  for (int i = 0; i < size; i++) {
+    vector_b[i] = 2 * i;
+  }
+  std::vector<int> sums(size);
+  std::vector<int> products(size);
+
+  PT_EXPECT(Transform(array_a, array_a + size, vector_b.begin(), sums.begin(),
+                      std::plus<int>()) == sums.end());
+  Transform(Zip(array_a, vector_b.begin()),
+            Zip(array_a + size, vector_b.end()), products.begin(),
+            ZipProduct());
+  for (int i = 0; i < size; i++) {
+    PT_EXPECT_EQ(sums[i], array_a[i] + 2 * i);
+    PT_EXPECT_EQ(products[i], array_a[i] * 2 * i);
+  }
+}
+
+void TransformTest::TestRanges() {
+  using embb::algorithms::Transform;
+  size_t count = 4;
+  std::vector<int> init(count);
+  std::vector<int> vector(count);
+  std::vector<int> output(count);
+  for (size_t i = 0; i < count; i++) {
+    init[i] = static_cast<int>(i + 2);
+  }
+
+  // Empty range
+  output = init;
+  PT_EXPECT(Transform(vector.begin(), vector.begin(), output.begin(),
+                      Square()) == output.begin());
+  PT_EXPECT(output == init);
+
+  // Ommit first element
+  vector = init;
+  output = init;
+  Transform(vector.begin() + 1, vector.end(), output.begin() + 1, Square());
+  PT_EXPECT_EQ(output[0], init[0]);
+  for (size_t i = 1; i < count; i++) {
+    PT_EXPECT_EQ(output[i], init[i] * init[i]);
+  }
+
+  // Ommit last element
+  output = init;
+  Transform(vector.begin(), vector.end() - 1, output.begin(), Square());
+  for (size_t i = 0; i < count - 1; i++) {
+    PT_EXPECT_EQ(output[i], init[i] * init[i]);
+  }
+  PT_EXPECT_EQ(output[count - 1], init[count - 1]);
+
+  // Only do second element
+  output = init;
+  Transform(vector.begin() + 1, vector.begin() + 2, output.begin() + 1,
+            Square());
+  for (size_t i = 0; i < count; i++) {
+    PT_EXPECT_EQ(output[i], (i == 1) ? init[i] * init[i] : init[i]);
+  }
+}
+
+void TransformTest::TestBlockSizes() {
+  using embb::algorithms::Transform;
+  using embb::tasks::ExecutionPolicy;
+  size_t count = 4;
+  std::vector<int> init(count);
+  std::vector<int> output(count);
+  for (size_t i = 0; i < count; i++) {
+    init[i] = static_cast<int>(i + 2);
+  }
+
+  for (size_t block_size = 1; block_size < count + 2; block_size++) {
+    std::fill(output.begin(), output.end(), 0);
+    Transform(init.begin(), init.end(), output.begin(), Square(),
+              ExecutionPolicy(), block_size);
+    for (size_t i = 0; i < count; i++) {
+      PT_EXPECT_EQ(output[i], init[i] * init[i]);
+    }
+  }
+}
+
+void TransformTest::TestFillCopyGenerate() {
+  using embb::algorithms::Fill;
+  using embb::algorithms::Copy;
+  using embb::algorithms::Generate;
+  const int size = 10;
+  int array[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+  std::vector<int> vector(size);
+  std::deque<int> deque(size);
+
+  PT_EXPECT(Copy(array, array + size, vector.begin()) == vector.end());
+  PT_EXPECT(Copy(vector.begin(), vector.end(), deque.begin()) == deque.end());
+  for (int i = 0; i < size; i++) {
+    PT_EXPECT_EQ(vector[i], array[i]);
+    PT_EXPECT_EQ(deque[i], array[i]);
+  }
+
+  Fill(vector.begin() + 1, vector.end() - 1, -1);
+  Fill(deque.begin(), deque.end(), 3);
+  for (int i = 0; i < size; i++) {
+    PT_EXPECT_EQ(vector[i], (i == 0 || i == size - 1) ? array[i] : -1);
+    PT_EXPECT_EQ(deque[i], 3);
+  }
+
+  Generate(vector.begin(), vector.end(), Constant());
+  for (int i = 0; i < size; i++) {
+    PT_EXPECT_EQ(vector[i], 42);
+  }
+
+  // Empty ranges
+  PT_EXPECT(Copy(array, array, vector.begin()) == vector.begin());
+  Fill(vector.end(), vector.end(), 0);
+  Generate(vector.end(), vector.end(), Constant());
+}
+
+void TransformTest::TestLargeRanges() {
+  using embb::algorithms::Fill;
+  using embb::algorithms::Copy;
+  // Beyond the size from which outputs are written with non-temporal stores
+  size_t count = (size_t(1) << 22) + 7;
+  std::vector<int> input(count);
+  std::vector<int> output(count + 2, -1);
+  for (size_t i = 0; i < count; i++) {
+    input[i] = static_cast<int>(i);
+  }
+
+  // Output not aligned to vector registers or cache lines
+  Copy(input.begin(), input.end(), output.begin() + 1);
+  bool correct = output[0] == -1 && output[count + 1] == -1;
+  for (size_t i = 0; i < count; i++) {
+    correct = correct && output[i + 1] == input[i];
+  }
+  PT_EXPECT(correct);
+
+  int* pointer = &output[0];
+  Fill(pointer + 1, pointer + count + 1, 7);
+  correct = output[0] == -1 && output[count + 1] == -1;
+  for (size_t i = 1; i <= count; i++) {
+    correct = correct && output[i] == 7;
+  }
+  PT_EXPECT(correct);
+
+  std::vector<char> characters(count * sizeof(int) + 3, 'a');
+  Fill(characters.begin() + 3, characters.end(), 'b');
+  correct = characters[2] == 'a';
+  for (size_t i = 3; i < characters.size(); i++) {
+    correct = correct && characters[i] == 'b';
+  }
+  PT_EXPECT(correct);
+}
+
+void TransformTest::TestPolicy() {
+  using embb::algorithms::Transform;
+  using embb::tasks::ExecutionPolicy;
+  int a[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+  size_t count = sizeof a / sizeof a[0];
+  std::vector<int> vector(a, a + count);
+  std::vector<int> output(count);
+
+  Transform(vector.begin(), vector.end(), output.begin(), Square(),
+            ExecutionPolicy());
+  for (size_t i = 0; i < count; i++) {
+    PT_EXPECT_EQ(output[i], a[i] * a[i]);
+  }
+  Transform(vector.begin(), vector.end(), vector.begin(), output.begin(),
+            std::plus<int>(), ExecutionPolicy(true));
+  for (size_t i = 0; i < count; i++) {
+    PT_EXPECT_EQ(output[i], 2 * a[i]);
+  }
+  Transform(vector.begin(), vector.end(), output.begin(), Square(),
+            ExecutionPolicy(true, 1));
+  for (size_t i = 0; i < count; i++) {
+    PT_EXPECT_EQ(output[i], a[i] * a[i]);
+  }
+}
+
+void TransformTest::StressTest() {
+  using embb::algorithms::Transform;
+  size_t count = embb::tasks::Node::GetInstance().GetCoreCount() * 10;
+  std::vector<int> large_vector(count);
+  std::vector<int> output(count);
+  for (size_t i = 0; i < count; i++) {
+    large_vector[i] = static_cast<int>(i);
+  }
+  Transform(large_vector.begin(), large_vector.end(), output.begin(),
+            Square());
+  for (size_t i = 0; i < count; i++) {
+    PT_EXPECT_EQ(output[i], large_vector[i] * large_vector[i]);
+  }
+}
@@ -28,6 +28,7 @@
 #define EMBB_BASE_C_CORE_SET_H_
 
 #include <stdint.h>
+#include <embb/base/c/internal/bitset.h>
 
 /**
  * \defgroup C_BASE_CORESET Core Set
@@ -53,16 +54,27 @@ extern "C" {
  * For example, the cores of a quad-core system are represented by the set
  * {0,1,2,3}.
  *
+ * A core set can hold up to \c EMBB_CORE_SET_MAX_CORES cores, which is
+ * configured at build time (CMake option \c MAX_CORES).
+ *
  * \see embb_core_count_available()
  */
 #ifdef DOXYGEN
 typedef opaque_type embb_core_set_t;
 #else
 typedef struct embb_core_set_t {
-  uint64_t rep;
+  embb_bitset_t rep;
 } embb_core_set_t;
 #endif /* else defined(DOXYGEN) */
 
+/**
+ * Maximum number of cores that can be represented by a core set.
+ *
+ * Also returned by embb_core_set_find_next() if there is no further core in
+ * the set.
+ */
+#define EMBB_CORE_SET_MAX_CORES EMBB_BITSET_BIT_COUNT
+
 /**
  * Returns the number of available processor cores.
  *
@@ -176,6 +188,31 @@ unsigned int embb_core_set_count(
   /**< [IN] Core set whose elements are counted */
   );
 
+/**
+ * Returns the smallest core number contained in the specified set that is
+ * greater than or equal to \c start.
+ *
+ * Allows to iterate over the cores of a set without testing every single core
+ * number:
+ * \code
+ * unsigned int core = embb_core_set_find_next(&core_set, 0);
+ * while (core < EMBB_CORE_SET_MAX_CORES) {
+ *   // ...
+ *   core = embb_core_set_find_next(&core_set, core + 1);
+ * }
+ * \endcode
+ *
+ * \notthreadsafe
+ * \return Number of the next core in \c core_set, or
+ *         \c EMBB_CORE_SET_MAX_CORES if there is none
+ */
+unsigned int embb_core_set_find_next(
+  const embb_core_set_t* core_set,
+  /**< [IN] Core set to search */
+  unsigned int start
+  /**< [IN] Number of the first core to consider */
+  );
+
 #ifdef __cplusplus
 } /* Close extern "C" { */
 #endif
@@ -33,79 +33,217 @@
 
 #include <embb/base/c/internal/config.h>
 
+#ifdef EMBB_PLATFORM_COMPILER_MSVC
+#include <intrin.h>
+#endif
+
+/**
+ * Number of 64 bit words used to store a bitset.
+ */
+#define EMBB_BITSET_WORD_COUNT ((EMBB_PLATFORM_MAX_CORES + 63) / 64)
+
+/**
+ * Number of bits that can be stored in a bitset.
+ */
+#define EMBB_BITSET_BIT_COUNT (EMBB_BITSET_WORD_COUNT * 64u)
+
+/**
+ * Fixed size bitset consisting of multiple 64 bit words, used to represent
+ * core sets and MTAPI affinities.
+ */
+typedef struct embb_bitset_t {
+  uint64_t rep[EMBB_BITSET_WORD_COUNT];
+} embb_bitset_t;
+
+/**
+ * Returns the index of the least significant bit set in a non-zero word.
+ */
+EMBB_PLATFORM_INLINE unsigned int embb_bitset_word_find_first(
+  uint64_t word
+  ) {
+  assert(0ull != word);
+#if defined(EMBB_PLATFORM_COMPILER_GNUC)
+  return (unsigned int)__builtin_ctzll(word);
+#elif defined(EMBB_PLATFORM_COMPILER_MSVC) && defined(EMBB_PLATFORM_ARCH_X86_64)
+  unsigned long index;
+  _BitScanForward64(&index, word);
+  return (unsigned int)index;
+#else
+  unsigned int index = 0;
+  while (0ull == (word & 1ull)) {
+    word >>= 1;
+    index++;
+  }
+  return index;
+#endif
+}
+
+/**
+ * Returns the number of bits set in a word.
+ */
+EMBB_PLATFORM_INLINE unsigned int embb_bitset_word_count(
+  uint64_t word
+  ) {
+#if defined(EMBB_PLATFORM_COMPILER_GNUC)
+  return (unsigned int)__builtin_popcountll(word);
+#else
+  unsigned int count = 0;
+  while (0ull != word) {
+    word &= word - 1ull;
+    count++;
+  }
+  return count;
+#endif
+}
+
 EMBB_PLATFORM_INLINE void embb_bitset_set(
-  uint64_t * that,
+  embb_bitset_t * that,
   unsigned int bit
   ) {
   assert(NULL != that);
-  assert(64 > bit);
-  *that |= (1ull << bit);
+  assert(EMBB_BITSET_BIT_COUNT > bit);
+  that->rep[bit / 64] |= (1ull << (bit % 64));
 }
 
 EMBB_PLATFORM_INLINE void embb_bitset_set_n(
-  uint64_t * that,
+  embb_bitset_t * that,
   unsigned int count) {
+  unsigned int ii;
   assert(NULL != that);
   assert(0 < count);
-  assert(64 >= count);
-  if (64 == count) {
-    *that = ~0ull;
-  } else {
-    *that = (1ull << count) - 1ull;
+  assert(EMBB_BITSET_BIT_COUNT >= count);
+  for (ii = 0; ii < EMBB_BITSET_WORD_COUNT; ii++) {
+    if (count >= 64) {
+      that->rep[ii] = ~0ull;
+      count -= 64;
+    } else if (count > 0) {
+      that->rep[ii] = (1ull << count) - 1ull;
+      count = 0;
+    } else {
+      that->rep[ii] = 0ull;
+    }
   }
 }
 
 EMBB_PLATFORM_INLINE void embb_bitset_clear(
-  uint64_t * that,
+  embb_bitset_t * that,
   unsigned int bit
   ) {
   assert(NULL != that);
-  assert(64 > bit);
-  *that &= ~(1ull << bit);
+  assert(EMBB_BITSET_BIT_COUNT > bit);
+  that->rep[bit / 64] &= ~(1ull << (bit % 64));
 }
 
 EMBB_PLATFORM_INLINE void embb_bitset_clear_all(
-  uint64_t * that
+  embb_bitset_t * that
   ) {
+  unsigned int ii;
   assert(NULL != that);
-  *that = 0ull;
+  for (ii = 0; ii < EMBB_BITSET_WORD_COUNT; ii++) {
+    that->rep[ii] = 0ull;
+  }
 }
 
 EMBB_PLATFORM_INLINE unsigned int embb_bitset_is_set(
-  uint64_t const * that,
+  embb_bitset_t const * that,
   unsigned int bit
   ) {
-  return (unsigned int)((*that & (1ull << bit)) ? 1 : 0);
+  assert(NULL != that);
+  if (EMBB_BITSET_BIT_COUNT <= bit) {
+    return 0;
+  }
+  return (unsigned int)((that->rep[bit / 64] & (1ull << (bit % 64))) ? 1 : 0);
 }
 
 EMBB_PLATFORM_INLINE void embb_bitset_intersect(
-  uint64_t * that,
-  uint64_t mask
+  embb_bitset_t * that,
+  embb_bitset_t const * mask
   ) {
+  unsigned int ii;
   assert(NULL != that);
-  *that &= mask;
+  assert(NULL != mask);
+  for (ii = 0; ii < EMBB_BITSET_WORD_COUNT; ii++) {
+    that->rep[ii] &= mask->rep[ii];
+  }
 }
 
 EMBB_PLATFORM_INLINE void embb_bitset_union(
-  uint64_t * that,
-  uint64_t mask
+  embb_bitset_t * that,
+  embb_bitset_t const * mask
   ) {
+  unsigned int ii;
   assert(NULL != that);
-  *that |= mask;
+  assert(NULL != mask);
+  for (ii = 0; ii < EMBB_BITSET_WORD_COUNT; ii++) {
+    that->rep[ii] |= mask->rep[ii];
+  }
 }
 
 EMBB_PLATFORM_INLINE unsigned int embb_bitset_count(
-  uint64_t const * that
+  embb_bitset_t const * that
   ) {
   unsigned int count = 0;
-  uint64_t mask = 1ull;
-  for (unsigned int ii = 0; ii < 64; ii++) {
-    if ((*that & mask) > 0) {
-      count++;
-    }
-    mask <<= 1;
+  unsigned int ii;
+  assert(NULL != that);
+  for (ii = 0; ii < EMBB_BITSET_WORD_COUNT; ii++) {
+    count += embb_bitset_word_count(that->rep[ii]);
   }
   return count;
 }
 
+EMBB_PLATFORM_INLINE unsigned int embb_bitset_is_empty(
+  embb_bitset_t const * that
+  ) {
+  unsigned int ii;
+  assert(NULL != that);
+  for (ii = 0; ii < EMBB_BITSET_WORD_COUNT; ii++) {
+    if (0ull != that->rep[ii]) {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+EMBB_PLATFORM_INLINE unsigned int embb_bitset_is_equal(
+  embb_bitset_t const * that,
+  embb_bitset_t const * other
+  ) {
+  unsigned int ii;
+  assert(NULL != that);
+  assert(NULL != other);
+  for (ii = 0; ii < EMBB_BITSET_WORD_COUNT; ii++) {
+    if (that->rep[ii] != other->rep[ii]) {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+/**
+ * Returns the index of the first bit set at or after position \c start, or
+ * EMBB_BITSET_BIT_COUNT if there is no such bit. Whole words are skipped,
+ * so iterating over a sparse bitset does not touch every single bit.
+ */
+EMBB_PLATFORM_INLINE unsigned int embb_bitset_find_next(
+  embb_bitset_t const * that,
+  unsigned int start
+  ) {
+  unsigned int ii;
+  uint64_t word;
+  assert(NULL != that);
+  if (EMBB_BITSET_BIT_COUNT <= start) {
+    return EMBB_BITSET_BIT_COUNT;
+  }
+  ii = start / 64;
+  word = that->rep[ii] & (~0ull << (start % 64));
+  while (0ull == word) {
+    ii++;
+    if (EMBB_BITSET_WORD_COUNT == ii) {
+      return EMBB_BITSET_BIT_COUNT;
+    }
+    word = that->rep[ii];
+  }
+  return ii * 64 + embb_bitset_word_find_first(word);
+}
+
 #endif // EMBB_BASE_C_INTERNAL_BITSET_H_
@@ -36,18 +36,42 @@ extern "C" {
  *
  * A new index has to be obtained only on first call of the function. Later
  * calls always succeed, since they just return the index obtained in the
- * first call.
+ * first call. When the thread terminates, its index is released and handed
+ * out again to another thread, so that the number of indices in use is
+ * bounded by the number of live threads, not by the number of threads ever
+ * created.
  *
  * \pre embb_internal_thread_index_create() has been called.
  * \return EMBB_SUCCESS, if an index could be obtained.
  *         EMBB_ERROR, if no more indices were available.
- * \lockfree
+ * \threadsafe and lock-free, except for the first call of a thread, which
+ *             obtains the index under a spin lock.
  */
 int embb_internal_thread_index(
   unsigned int* index
   /**< [OUT] Pointer to memory location to write thread index to. */
   );
 
+/**
+ * Tries to return the current thread's (internal) index together with a
+ * ticket identifying the thread's ownership of that index.
+ *
+ * Since indices of terminated threads are reused, data stored per index can
+ * be tagged with the ticket to detect that it was left behind by a previous
+ * owner of the index. Tickets are never 0.
+ *
+ * \return EMBB_SUCCESS, if an index could be obtained.
+ *         EMBB_ERROR, if no more indices were available.
+ * \threadsafe and lock-free, except for the first call of a thread, which
+ *             obtains the index under a spin lock.
+ */
+int embb_internal_thread_index_ticket(
+  unsigned int* index,
+  /**< [OUT] Pointer to memory location to write thread index to. */
+  unsigned int* ticket
+  /**< [OUT] Pointer to memory location to write ownership ticket to. */
+  );
+
 /**
  * Returns the maximum number of available thread indices.
  *
@@ -70,12 +94,13 @@ void embb_internal_thread_index_set_max(
   );
 
 /**
- * Sets the thread index to zero.
+ * Makes all thread indices available again, starting with zero.
  *
- * Should only be called in tests, in order to avoid a constantly growing
- * index set.
+ * Should only be called in tests, in order to start with a well-defined
+ * index set. Threads holding an index obtained before the reset do not
+ * release it on termination.
  *
- * \waitfree
+ * \notthreadsafe
  */
 void embb_internal_thread_index_reset();
 
@@ -55,6 +55,7 @@ typedef opaque_type embb_tss_t;
 typedef struct embb_tss_t {
   void** values;
   unsigned int size;
+  unsigned int* tickets;
 } embb_tss_t;
 #endif /* else defined(DOXYGEN) */
 
@@ -64,7 +65,7 @@ typedef struct embb_tss_t {
  * \pre The given TSS has not yet been created or has already been deleted.
  * \return EMBB_SUCCESS if storage could be created \n
  *         EMBB_NOMEM if not enough memory was available
- * \memory embb_thread_get_max_count() pointers
+ * \memory embb_thread_get_max_count() pointers and unsigned integers
  * \notthreadsafe
  * \see embb_tss_delete(), embb_thread_get_max_count()
  */
@@ -82,7 +83,8 @@ int embb_tss_create(
  * \return EMBB_SUCCESS if value could be set \n
  *         EMBB_ERROR if no thread index could be obtained, that is, the
  *         maximum number of threads has been exceeded.
- * \lockfree
+ * \threadsafe and lock-free, except for the first call of a thread, which
+ *             obtains its thread index under a spin lock.
  * \see embb_tss_get(), embb_thread_get_max_count()
  */
 int embb_tss_set(
@@ -97,9 +99,12 @@ int embb_tss_set(
  *
  * \pre The given TSS has been created
  * \return Thread-specific value if embb_tss_set() has previously been called
- *         with a valid address. NULL, if no value was set or the calling thread
- *         could not obtain a thread-specific index.
- * \lockfree
+ *         with a valid address. NULL, if no value was set by the calling
+ *         thread (values set by terminated threads are not visible to threads
+ *         that reuse their index) or the calling thread could not obtain a
+ *         thread-specific index.
+ * \threadsafe and lock-free, except for the first call of a thread, which
+ *             obtains its thread index under a spin lock.
  * \see embb_tss_set()
  */
 void* embb_tss_get(
@@ -33,52 +33,16 @@
 
 #ifdef EMBB_PLATFORM_THREADING_WINTHREADS
 
-/**
- * For handling of more than 64 logical processors on Windows.
- */
-typedef struct processor_info_t {
-  unsigned short group_count;
-  unsigned short processor_counts[64];
-} processor_info_t;
-
-/**
- * Holds information about Windows processor groups.
- *
- * Is initialized on the first call of embb_core_set_init.
- *
- * !!! Not used at the moment. Results in a limitation of 64 logical processors.
- */
-processor_info_t processor_info;
-
 unsigned int embb_core_count_available() {
-  SYSTEM_INFO info;
-  GetSystemInfo(&info);
-  return info.dwNumberOfProcessors;
+  /* Counts the logical processors of all processor groups, not only of the
+     group of the calling thread. */
+  return (unsigned int)GetActiveProcessorCount(ALL_PROCESSOR_GROUPS);
 }
 
 void embb_core_set_init(embb_core_set_t* core_set, int initializer) {
   assert(core_set != NULL);
-  assert(embb_core_count_available() < 64 &&
-    "Core sets are only supported up to 64 processors!");
-
-  /* Cache windows processor grouping information */
-  if (processor_info.group_count == 0) {
-    /* Set relation group */
-    LOGICAL_PROCESSOR_RELATIONSHIP rel = (LOGICAL_PROCESSOR_RELATIONSHIP)4;
-    /* Assume only one element of SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX is
-       returned to the buffer. */
-    SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX buffer;
-    /* The length is that of the buffer */
-    DWORD length = sizeof(SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX);
-    BOOL status = GetLogicalProcessorInformationEx(rel, &buffer, &length);
-    assert(status == TRUE);
-    EMBB_UNUSED_IN_RELEASE(status);
-    processor_info.group_count = buffer.Group.ActiveGroupCount;
-    for (unsigned short i = 0; i < processor_info.group_count; i++) {
-      processor_info.processor_counts[i] =
-        (unsigned short)(buffer.Group.GroupInfo[i].ActiveProcessorCount);
-    }
-  }
+  assert(embb_core_count_available() <= EMBB_CORE_SET_MAX_CORES &&
+    "Core sets are only supported up to EMBB_CORE_SET_MAX_CORES processors!");
 
   if (initializer == 0) {
     embb_bitset_clear_all(&core_set->rep);
@@ -114,8 +78,8 @@ unsigned int embb_core_count_available() {
 
 void embb_core_set_init(embb_core_set_t* core_set, int initializer) {
   assert(core_set != NULL);
-  assert(embb_core_count_available() < 64 &&
-    "Core sets are only supported up to 64 processors!");
+  assert(embb_core_count_available() <= EMBB_CORE_SET_MAX_CORES &&
+    "Core sets are only supported up to EMBB_CORE_SET_MAX_CORES processors!");
   if (initializer == 0) {
     embb_bitset_clear_all(&core_set->rep);
   } else {
@@ -146,13 +110,22 @@ int embb_core_set_contains(const embb_core_set_t* core_set,
 
 void embb_core_set_intersection(embb_core_set_t* set1,
                                 const embb_core_set_t* set2) {
-  embb_bitset_intersect(&set1->rep, set2->rep);
+  assert(set1 != NULL && set2 != NULL);
+  embb_bitset_intersect(&set1->rep, &set2->rep);
 }
 
 void embb_core_set_union(embb_core_set_t* set1, const embb_core_set_t* set2) {
-  embb_bitset_union(&set1->rep, set2->rep);
+  assert(set1 != NULL && set2 != NULL);
+  embb_bitset_union(&set1->rep, &set2->rep);
 }
 
 unsigned int embb_core_set_count(const embb_core_set_t* core_set) {
+  assert(core_set != NULL);
   return embb_bitset_count(&core_set->rep);
 }
+
+unsigned int embb_core_set_find_next(const embb_core_set_t* core_set,
+                                     unsigned int start) {
+  assert(core_set != NULL);
+  return embb_bitset_find_next(&core_set->rep, start);
+}
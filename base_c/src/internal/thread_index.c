@@ -27,7 +27,6 @@
 #include <embb/base/c/internal/thread_index.h>
 #include <embb/base/c/core_set.h>
 #include <embb/base/c/atomic.h>
-#include <embb/base/c/counter.h>
 #include <embb/base/c/errors.h>
 #include <embb/base/c/internal/platform.h>
 #include <assert.h>
@@ -57,56 +56,221 @@ unsigned int* embb_max_number_thread_indices() {
 }
 
 /**
- * Provides global variable for current thread index counter.
+ * Bookkeeping of thread indices.
+ *
+ * Indices are handed out in increasing order until the maximum is reached.
+ * When a thread terminates, its index is pushed onto a free list and handed
+ * out again to the next thread requesting an index. Since a thread obtains
+ * its index only once, the bookkeeping is protected by a simple spin lock.
+ *
+ * The epoch is incremented on each reset, so that threads holding an index
+ * from before a reset do not release it into the new index set.
+ *
+ * These variables have local scope.
+ */
+static embb_atomic_int embb_thread_index_lock = { 0 };
+static unsigned int embb_thread_index_next = 0;
+static unsigned int* embb_thread_index_free_list = NULL;
+static unsigned int embb_thread_index_free_count = 0;
+static unsigned int embb_thread_index_free_capacity = 0;
+static unsigned int embb_thread_index_epoch = 0;
+static unsigned int embb_thread_index_ticket_counter = 0;
+
+static void embb_thread_index_lock_acquire() {
+  int expected = 0;
+  while (!embb_atomic_compare_and_swap_int(
+      &embb_thread_index_lock, &expected, 1)) {
+    expected = 0;
+  }
+}
+
+static void embb_thread_index_lock_release() {
+  embb_atomic_store_int(&embb_thread_index_lock, 0);
+}
+
+/**
+ * Thread specific thread index.
+ *
+ * This variable has local scope.
+ *
+ * This index is only used in certain data structures that have to know the
+ * number of threads and their indices in advance. Only a limited number of
+ * indices is made available.
+ */
+EMBB_THREAD_SPECIFIC unsigned int embb_internal_thread_index_var = UINT_MAX;
+
+/**
+ * Epoch in which the current thread obtained its index, and ticket
+ * identifying the current thread's ownership of its index.
+ *
+ * These variables have local scope.
+ */
+EMBB_THREAD_SPECIFIC unsigned int embb_internal_thread_index_epoch_var = 0;
+EMBB_THREAD_SPECIFIC unsigned int embb_internal_thread_index_ticket_var = 0;
+
+/**
+ * Returns the index of the current thread to the free list.
+ *
+ * Called on termination of a thread that obtained an index.
+ *
+ * This function has local scope.
+ */
+static void embb_release_thread_index() {
+  if (embb_internal_thread_index_var == UINT_MAX) {
+    return;
+  }
+  embb_thread_index_lock_acquire();
+  if (embb_internal_thread_index_epoch_var == embb_thread_index_epoch) {
+    /* Capacity is reserved when an index is handed out for the first time */
+    assert(embb_thread_index_free_count < embb_thread_index_free_capacity);
+    embb_thread_index_free_list[embb_thread_index_free_count++] =
+      embb_internal_thread_index_var;
+  }
+  embb_thread_index_lock_release();
+  embb_internal_thread_index_var = UINT_MAX;
+  embb_internal_thread_index_ticket_var = 0;
+}
+
+#ifdef EMBB_PLATFORM_THREADING_WINTHREADS
+
+/**
+ * Fiber local storage slot whose callback releases the thread index when
+ * a thread terminates, regardless of which library created the thread.
+ *
+ * These functions have local scope.
+ */
+static DWORD embb_thread_index_exit_key = FLS_OUT_OF_INDEXES;
+
+static VOID WINAPI embb_thread_index_exit_callback(PVOID value) {
+  if (value != NULL) {
+    embb_release_thread_index();
+  }
+}
+
+static int embb_thread_index_exit_key_create() {
+  embb_thread_index_exit_key = FlsAlloc(embb_thread_index_exit_callback);
+  return (embb_thread_index_exit_key == FLS_OUT_OF_INDEXES) ?
+    EMBB_ERROR : EMBB_SUCCESS;
+}
+
+static void embb_thread_index_exit_key_set() {
+  FlsSetValue(embb_thread_index_exit_key, (PVOID)1);
+}
+
+#endif /* EMBB_PLATFORM_THREADING_WINTHREADS */
+
+#ifdef EMBB_PLATFORM_THREADING_POSIXTHREADS
+
+/**
+ * Thread-specific data key whose destructor releases the thread index when
+ * a thread terminates, regardless of which library created the thread.
+ *
+ * These functions have local scope.
+ */
+static pthread_key_t embb_thread_index_exit_key;
+
+static void embb_thread_index_exit_callback(void* value) {
+  if (value != NULL) {
+    embb_release_thread_index();
+  }
+}
+
+static int embb_thread_index_exit_key_create() {
+  return (pthread_key_create(&embb_thread_index_exit_key,
+    embb_thread_index_exit_callback) == 0) ? EMBB_SUCCESS : EMBB_ERROR;
+}
+
+static void embb_thread_index_exit_key_set() {
+  pthread_setspecific(embb_thread_index_exit_key, (void*)1);
+}
+
+#endif /* EMBB_PLATFORM_THREADING_POSIXTHREADS */
+
+/**
+ * Creates the thread exit hook on first use.
  *
  * This function has local scope.
+ *
+ * \return EMBB_SUCCESS, if thread indices can be released on thread exit.
  */
-static embb_atomic_int embb_thread_index_counter_flag = { 0 };
-static embb_counter_t embb_thread_index_counter_index;
-embb_counter_t* embb_thread_index_counter() {
+static embb_atomic_int embb_thread_index_exit_key_flag = { 0 };
+static int embb_thread_index_exit_key_status = EMBB_ERROR;
+static int embb_thread_index_exit_key_init() {
   int compare_to = 0;
-  if (embb_atomic_load_int(&embb_thread_index_counter_flag) != 2) {
+  if (embb_atomic_load_int(&embb_thread_index_exit_key_flag) != 2) {
     if (embb_atomic_compare_and_swap_int(
-        &embb_thread_index_counter_flag, &compare_to, 1)) {
-      embb_counter_init(&embb_thread_index_counter_index);
-      embb_atomic_store_int(&embb_thread_index_counter_flag, 2);
+        &embb_thread_index_exit_key_flag, &compare_to, 1)) {
+      embb_thread_index_exit_key_status = embb_thread_index_exit_key_create();
+      embb_atomic_store_int(&embb_thread_index_exit_key_flag, 2);
     }
-    while (embb_atomic_load_int(&embb_thread_index_counter_flag) != 2) {}
+    while (embb_atomic_load_int(&embb_thread_index_exit_key_flag) != 2) {}
   }
-  return &embb_thread_index_counter_index;
+  return embb_thread_index_exit_key_status;
 }
 
 /**
  * Tries to return the next free (internal) thread index.
  *
- * An index is only set, if there was still one available.
+ * Indices released by terminated threads are preferred over fresh ones. An
+ * index is only set, if there was still one available.
  *
  * This function has local scope.
  *
  * \return EMBB_SUCCESS, if a free index was available. EMBB_ERROR otherwise.
  */
-int embb_try_get_next_thread_index(unsigned int* free_index) {
+static int embb_try_get_next_thread_index(unsigned int* free_index) {
+  unsigned int max;
+  int status = EMBB_ERROR;
   assert(free_index != NULL);
-  unsigned int index = embb_counter_increment(embb_thread_index_counter());
-  if (index >= *embb_max_number_thread_indices()) {
-    embb_counter_decrement(embb_thread_index_counter());
+  if (embb_thread_index_exit_key_init() != EMBB_SUCCESS) {
     return EMBB_ERROR;
   }
-  *free_index = index;
-  return EMBB_SUCCESS;
+  max = *embb_max_number_thread_indices();
+  embb_thread_index_lock_acquire();
+  /* Released indices beyond a lowered maximum are dropped */
+  while (embb_thread_index_free_count > 0 &&
+      embb_thread_index_free_list[embb_thread_index_free_count - 1] >= max) {
+    embb_thread_index_free_count--;
+  }
+  if (embb_thread_index_free_count > 0) {
+    *free_index =
+      embb_thread_index_free_list[--embb_thread_index_free_count];
+    status = EMBB_SUCCESS;
+  } else if (embb_thread_index_next < max) {
+    /* Reserve room on the free list, so that releasing never allocates */
+    if (embb_thread_index_next >= embb_thread_index_free_capacity) {
+      unsigned int capacity = embb_thread_index_free_capacity * 2;
+      unsigned int* list;
+      if (capacity <= embb_thread_index_next) {
+        capacity = embb_thread_index_next + 16;
+      }
+      list = (unsigned int*)realloc(
+        embb_thread_index_free_list, capacity * sizeof(unsigned int));
+      if (list != NULL) {
+        embb_thread_index_free_list = list;
+        embb_thread_index_free_capacity = capacity;
+      }
+    }
+    if (embb_thread_index_next < embb_thread_index_free_capacity) {
+      *free_index = embb_thread_index_next++;
+      status = EMBB_SUCCESS;
+    }
+  }
+  if (status == EMBB_SUCCESS) {
+    embb_internal_thread_index_epoch_var = embb_thread_index_epoch;
+    /* Ticket 0 denotes "no owner" */
+    if (++embb_thread_index_ticket_counter == 0) {
+      ++embb_thread_index_ticket_counter;
+    }
+    embb_internal_thread_index_ticket_var = embb_thread_index_ticket_counter;
+  }
+  embb_thread_index_lock_release();
+  if (status == EMBB_SUCCESS) {
+    embb_thread_index_exit_key_set();
+  }
+  return status;
 }
 
-/**
- * Thread specific thread index.
- *
- * This variable has local scope.
- *
- * This index is only used in certain data structures that have to know the
- * number of threads and their indices in advance. Only a limited number of
- * indices is made available.
- */
-EMBB_THREAD_SPECIFIC unsigned int embb_internal_thread_index_var = UINT_MAX;
-
 int embb_internal_thread_index(unsigned int* index) {
   assert(index != NULL);
   if (embb_internal_thread_index_var == UINT_MAX) {
@@ -120,6 +284,17 @@ int embb_internal_thread_index(unsigned int* index) {
   return EMBB_SUCCESS;
 }
 
+int embb_internal_thread_index_ticket(unsigned int* index,
+                                      unsigned int* ticket) {
+  assert(ticket != NULL);
+  int status = embb_internal_thread_index(index);
+  if (status != EMBB_SUCCESS) {
+    return status;
+  }
+  *ticket = embb_internal_thread_index_ticket_var;
+  return EMBB_SUCCESS;
+}
+
 int embb_internal_thread_index_max() {
   return (int)(*embb_max_number_thread_indices());
 }
@@ -129,5 +304,9 @@ void embb_internal_thread_index_set_max(unsigned int max) {
 }
 
 void embb_internal_thread_index_reset() {
-  embb_counter_init(embb_thread_index_counter());
+  embb_thread_index_lock_acquire();
+  embb_thread_index_next = 0;
+  embb_thread_index_free_count = 0;
+  embb_thread_index_epoch++;
+  embb_thread_index_lock_release();
 }
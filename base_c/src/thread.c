@@ -99,17 +99,31 @@ int embb_thread_create(embb_thread_t* thread, const embb_core_set_t* core_set,
   }
 
   if (core_set != NULL) { /* Set thread affinity, if a core set is given */
-    DWORD_PTR core_mask = 0;
-    DWORD bit_mask = 1;
-    assert(embb_core_count_available() < 64);
-    for (unsigned int i = 0; i < embb_core_count_available(); i++) {
-      if (embb_core_set_contains(core_set, i)) {
-        core_mask |= bit_mask;
+    /* Windows numbers logical processors per processor group of up to 64
+       processors, and a thread can only run within a single group. Core
+       numbers are consecutive across groups, so the affinity is set to the
+       cores of the group containing the first core in the set. */
+    GROUP_AFFINITY group_affinity;
+    WORD group_count = GetActiveProcessorGroupCount();
+    unsigned int group_begin = 0;
+    unsigned int core = embb_core_set_find_next(core_set, 0);
+    ZeroMemory(&group_affinity, sizeof(group_affinity));
+    for (WORD group = 0; group < group_count; group++) {
+      unsigned int group_end =
+        group_begin + (unsigned int)GetActiveProcessorCount(group);
+      if (core < group_end) {
+        group_affinity.Group = group;
+        while (core < group_end) {
+          group_affinity.Mask |= (KAFFINITY)1 << (core - group_begin);
+          core = embb_core_set_find_next(core_set, core + 1);
+        }
+        break;
       }
-      bit_mask <<= 1;
+      group_begin = group_end;
     }
-    if (SetThreadAffinityMask(thread->embb_internal_handle, core_mask)
-        == (DWORD_PTR)NULL) {
+    if (group_affinity.Mask == 0 ||
+        SetThreadGroupAffinity(thread->embb_internal_handle, &group_affinity,
+                               NULL) == 0) {
       return EMBB_ERROR;
     }
   }
@@ -217,10 +231,10 @@ int embb_thread_create(embb_thread_t* thread, const embb_core_set_t* core_set,
     cpuset_t cpuset;
 #endif
     CPU_ZERO(&cpuset); /* Disable all processors */
-    for (unsigned int i = 0; i < embb_core_count_available(); i++) {
-      if (embb_core_set_contains(core_set, i)) {
-        CPU_SET(i, &cpuset);
-      }
+    for (unsigned int i = embb_core_set_find_next(core_set, 0);
+         i < EMBB_CORE_SET_MAX_CORES && i < CPU_SETSIZE;
+         i = embb_core_set_find_next(core_set, i + 1)) {
+      CPU_SET(i, &cpuset);
     }
     status = pthread_attr_setaffinity_np(&attr, sizeof(cpuset), &cpuset);
     if (status != 0) return EMBB_ERROR;
@@ -63,6 +63,18 @@ void CoreSetTest::Test() {
     PT_EXPECT_EQ(cores, i+1);
   }
 
+  // Test iterating over the cores in a set
+  embb_core_set_init(&set, 1);
+  unsigned int visited = 0;
+  for (unsigned int i = embb_core_set_find_next(&set, 0);
+    i < EMBB_CORE_SET_MAX_CORES; i = embb_core_set_find_next(&set, i + 1)) {
+    PT_EXPECT_EQ(i, visited);
+    visited++;
+  }
+  PT_EXPECT_EQ(visited, available_cores);
+  embb_core_set_init(&set, 0);
+  PT_EXPECT_EQ(embb_core_set_find_next(&set, 0), EMBB_CORE_SET_MAX_CORES);
+
   // Test logical & and | operations
   embb_core_set_t set2;
   embb_core_set_init(&set, 0);
@@ -73,6 +85,21 @@ void CoreSetTest::Test() {
   embb_core_set_union(&set, &set2);
   cores = embb_core_set_count(&set);
   PT_EXPECT_EQ(cores, available_cores);
+
+  // Test bits beyond the first word of the underlying bitset
+  embb_bitset_t bitset;
+  embb_bitset_clear_all(&bitset);
+  unsigned int last_bit = EMBB_BITSET_BIT_COUNT - 1;
+  embb_bitset_set(&bitset, last_bit);
+  PT_EXPECT_EQ(embb_bitset_is_set(&bitset, last_bit), 1u);
+  PT_EXPECT_EQ(embb_bitset_count(&bitset), 1u);
+  PT_EXPECT_EQ(embb_bitset_find_next(&bitset, 0), last_bit);
+  PT_EXPECT_EQ(embb_bitset_find_next(&bitset, last_bit), last_bit);
+  embb_bitset_set_n(&bitset, EMBB_BITSET_BIT_COUNT);
+  PT_EXPECT_EQ(embb_bitset_count(&bitset), EMBB_BITSET_BIT_COUNT);
+  embb_bitset_clear(&bitset, last_bit);
+  PT_EXPECT_EQ(embb_bitset_is_set(&bitset, last_bit), 0u);
+  PT_EXPECT_EQ(embb_bitset_count(&bitset), last_bit);
 }
 
 } // namespace test
@@ -68,8 +68,9 @@ void ThreadIndexTest::Test1() {
     embb_thread_join(&thread, NULL);
   }
   {
+    // The index of the terminated thread is reused
     embb_thread_t thread;
-    bool index_available = false;
+    bool index_available = true;
     int status =
       embb_thread_create(&thread, NULL, ThreadStart, &index_available);
     PT_EXPECT_EQ(status, EMBB_SUCCESS);
@@ -99,11 +100,16 @@ void ThreadIndexTest::TestN() {
     int status = embb_thread_join(threads + i, NULL);
     PT_EXPECT_EQ(status, EMBB_SUCCESS);
   }
-  embb_thread_t thread;
-  bool index_available = false;
-  int status = embb_thread_create(&thread, NULL, ThreadStart, &index_available);
-  PT_EXPECT_EQ(status, EMBB_SUCCESS);
-  embb_thread_join(&thread, NULL);
+  // Indices of terminated threads are reused, also for many more threads
+  // than the maximum, as long as they do not run concurrently
+  for (size_t i = 0; i < 4 * number_threads_; i++) {
+    embb_thread_t thread;
+    bool index_available = true;
+    int status =
+      embb_thread_create(&thread, NULL, ThreadStart, &index_available);
+    PT_EXPECT_EQ(status, EMBB_SUCCESS);
+    embb_thread_join(&thread, NULL);
+  }
   delete[] threads;
   embb_internal_thread_index_set_max(old_max);
 }
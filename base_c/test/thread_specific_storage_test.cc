@@ -40,6 +40,8 @@ ThreadSpecificStorageTest::ThreadSpecificStorageTest()
   CreateUnit("API")
       .Add(&ThreadSpecificStorageTest::Test, this, number_threads_, 1)
       .Post(&ThreadSpecificStorageTest::Post, this);
+  CreateUnit("Index reuse")
+      .Add(&ThreadSpecificStorageTest::TestIndexReuse, this);
 }
 
 ThreadSpecificStorageTest::~ThreadSpecificStorageTest() {
@@ -49,29 +51,50 @@ ThreadSpecificStorageTest::~ThreadSpecificStorageTest() {
 void ThreadSpecificStorageTest::Test() {
   size_t rank = partest::TestSuite::GetCurrentThreadID();
   void* value = embb_tss_get(&tss_);
-  if (value == NULL) {
-    int status = embb_tss_set(&tss_, new size_t(rank));
-    PT_EXPECT_EQ(status, EMBB_SUCCESS);
-  } else {
-    size_t stored_rank = *static_cast<size_t*>(value);
-    PT_EXPECT_EQ(rank, stored_rank);
-  }
+  PT_EXPECT_EQ(value, static_cast<void*>(NULL));
+  int status = embb_tss_set(&tss_, new size_t(rank));
+  PT_EXPECT_EQ(status, EMBB_SUCCESS);
+  value = embb_tss_get(&tss_);
+  PT_ASSERT_NE(value, static_cast<void*>(NULL));
+  size_t stored_rank = *static_cast<size_t*>(value);
+  PT_EXPECT_EQ(rank, stored_rank);
+  // The slot is reused by threads obtaining the index after termination of
+  // this thread, so clean up here
+  delete static_cast<size_t*>(value);
+  status = embb_tss_set(&tss_, NULL);
+  PT_EXPECT_EQ(status, EMBB_SUCCESS);
 }
 
 void ThreadSpecificStorageTest::Post() {
-  size_t sum_ranks = 0;
-  for (size_t i = 0; i < embb_thread_get_max_count(); i++) {
-    void* value = tss_.values[i];
-    if (value != NULL) {
-      sum_ranks += *static_cast<size_t*>(value);
-      delete static_cast<size_t*>(value);
-    }
+  for (size_t i = 0; i < tss_.size; i++) {
+    PT_EXPECT_EQ(tss_.values[i], static_cast<void*>(NULL));
   }
-  size_t expected_sum = 0;
-  for (size_t i = 0; i < number_threads_; i++) {
-    expected_sum += i;
+}
+
+static int ThreadSetValue(void* arg) {
+  embb_tss_t* tss = static_cast<embb_tss_t*>(arg);
+  static int value = 0;
+  PT_EXPECT_EQ(embb_tss_get(tss), static_cast<void*>(NULL));
+  PT_EXPECT_EQ(embb_tss_set(tss, &value), EMBB_SUCCESS);
+  PT_EXPECT_EQ(embb_tss_get(tss), static_cast<void*>(&value));
+  return 0;
+}
+
+void ThreadSpecificStorageTest::TestIndexReuse() {
+  embb_internal_thread_index_reset();
+  unsigned int old_max = embb_thread_get_max_count();
+  embb_internal_thread_index_set_max(1);
+  embb_tss_t tss;
+  PT_ASSERT_EQ(embb_tss_create(&tss), EMBB_SUCCESS);
+  for (int i = 0; i < 3; i++) {
+    // Each thread obtains index 0 and must not see the previous value
+    embb_thread_t thread;
+    int status = embb_thread_create(&thread, NULL, ThreadSetValue, &tss);
+    PT_EXPECT_EQ(status, EMBB_SUCCESS);
+    embb_thread_join(&thread, NULL);
   }
-  PT_EXPECT_EQ(sum_ranks, expected_sum);
+  embb_tss_delete(&tss);
+  embb_internal_thread_index_set_max(old_max);
 }
 
 } // namespace test
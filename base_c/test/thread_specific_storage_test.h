@@ -50,6 +50,12 @@ class ThreadSpecificStorageTest : public partest::TestCase {
   void Test();
   void Post();
 
+  /**
+   * Checks that values of terminated threads are hidden from threads reusing
+   * their index.
+   */
+  void TestIndexReuse();
+
   embb_tss_t tss_;
 
   size_t number_threads_;
@@ -139,6 +139,20 @@ class CoreSet {
    */
   unsigned int Count() const;
 
+  /**
+   * Finds the next core in the set, starting at the specified core.
+   *
+   * Allows to iterate over the cores in the set without checking every single
+   * core number, which is useful on machines with many cores.
+   *
+   * \return Smallest core number in the set that is greater than or equal to
+   *         \c start, or \c EMBB_CORE_SET_MAX_CORES if there is none
+   */
+  unsigned int FindNext(
+    unsigned int start
+    /**< [IN] Core to start searching from */
+    ) const;
+
   /**
    * Intersects this core set with the specified one.
    *
@@ -88,6 +88,14 @@ namespace base {
  * Wraps function pointers, member function pointers, and functors with up to
  * five arguments.
  *
+ * Each Function owns a copy of its functor, and copying a Function copies
+ * the functor. State changed by calling one copy is therefore not visible in
+ * the others. To share state, wrap a member function of an object that lives
+ * outside the Function instead. Small functors, i.e., functors that are not
+ * larger than an object reference plus a member function pointer and that
+ * need no stricter alignment than a pointer, are stored inside the Function
+ * object, larger ones are allocated.
+ *
  * \ingroup CPP_BASE_FUNCTION
  */
 template <typename ReturnType, ...>
@@ -96,7 +104,8 @@ class Function {
   /**
    * Constructor from functor. Uses operator() with return type ReturnType
    * and up to five arguments. Copies the functor.
-   * \memory Allocates memory for the copy of the functor.
+   * \memory Allocates memory for the copy of the functor unless it is small
+   *         enough to be stored inside the Function object.
    */
   template <class ClassType>
   explicit Function(
@@ -123,7 +132,9 @@ class Function {
     );
 
   /**
-   * Copy constructor.
+   * Copy constructor. Copies the functor wrapped by \c func (see Function).
+   * \memory Allocates memory for the copy of the functor unless it is small
+   *         enough to be stored inside the Function object.
    */
   Function(
     Function const & func              /**< The Function to copy. */
@@ -142,7 +153,8 @@ class Function {
     );
 
   /**
-   * Assigns this object another Function.
+   * Assigns this object another Function. Copies the functor wrapped by
+   * \c func.
    */
   void operator = (
     Function & func                    /**< The Function. */
@@ -32,7 +32,6 @@
 
 #include <embb/base/internal/nil.h>
 #include <embb/base/memory_allocation.h>
-#include <embb/base/atomic.h>
 #include <embb/base/internal/functionT.h>
 
 namespace embb {
@@ -138,19 +137,13 @@ template <class C, typename R>
 class FunctorWrapper0
   : public Function0<R> {
  public:
-  FunctorWrapper0() : object_(NULL), ref_count_(NULL) {}
-  explicit FunctorWrapper0(C const & obj) {
-    object_ = Allocation::New<C>(obj);
-    ref_count_ = Allocation::New<Atomic<int> >(1);
-  }
-  explicit FunctorWrapper0(FunctorWrapper0 const & other) {
-    object_ = other.object_;
-    ref_count_ = other.ref_count_;
-    ++*ref_count_;
-  }
+  FunctorWrapper0() : object_(NULL) {}
+  explicit FunctorWrapper0(C const & obj)
+  : object_(Allocation::New<C>(obj)) {}
+  explicit FunctorWrapper0(FunctorWrapper0 const & other)
+  : object_(Allocation::New<C>(*other.object_)) {}
   virtual ~FunctorWrapper0() {
-    if (0 == --*ref_count_) {
-      Allocation::Delete(ref_count_);
+    if (NULL != object_) {
       Allocation::Delete(object_);
     }
   }
@@ -163,26 +156,19 @@ class FunctorWrapper0
 
  private:
   C * object_;
-  Atomic<int> * ref_count_;
 };
 
 template <class C>
 class FunctorWrapper0<C, void>
   : public Function0<void> {
  public:
-  FunctorWrapper0() : object_(NULL), ref_count_(NULL) {}
-  explicit FunctorWrapper0(C const & obj) {
-    object_ = Allocation::New<C>(obj);
-    ref_count_ = Allocation::New<Atomic<int> >(1);
-  }
-  explicit FunctorWrapper0(FunctorWrapper0 const & other) {
-    object_ = other.object_;
-    ref_count_ = other.ref_count_;
-    ++*ref_count_;
-  }
+  FunctorWrapper0() : object_(NULL) {}
+  explicit FunctorWrapper0(C const & obj)
+  : object_(Allocation::New<C>(obj)) {}
+  explicit FunctorWrapper0(FunctorWrapper0 const & other)
+  : object_(Allocation::New<C>(*other.object_)) {}
   virtual ~FunctorWrapper0() {
-    if (0 == --*ref_count_) {
-      Allocation::Delete(ref_count_);
+    if (NULL != object_) {
       Allocation::Delete(object_);
     }
   }
@@ -195,7 +181,50 @@ class FunctorWrapper0<C, void>
 
  private:
   C * object_;
-  Atomic<int> * ref_count_;
+};
+
+// functor stored in the Function's own storage
+template <class C, typename R>
+class FunctorInline0
+  : public Function0<R> {
+ public:
+  explicit FunctorInline0(C const & obj) : object_(obj) {}
+  virtual R operator () () {
+    return object_();
+  }
+  virtual void CopyTo(void* dst) {
+    new(dst)FunctorInline0(*this);
+  }
+
+ private:
+  C object_;
+};
+
+template <class C>
+class FunctorInline0<C, void>
+  : public Function0<void> {
+ public:
+  explicit FunctorInline0(C const & obj) : object_(obj) {}
+  virtual void operator () () {
+    object_();
+  }
+  virtual void CopyTo(void* dst) {
+    new(dst)FunctorInline0(*this);
+  }
+
+ private:
+  C object_;
+};
+
+// selects inline storage for functors that fit into a Function
+template <class C, typename R>
+struct FunctorStorage0 {
+  typedef typename SelectType<
+    sizeof(FunctorInline0<C, R>) <=
+      sizeof(MemberFunctionPointer0<Nil, R>) &&
+    AlignmentOf<C>::value <= AlignmentOf<void*>::value,
+    FunctorInline0<C, R>,
+    FunctorWrapper0<C, R> >::Type Type;
 };
 
 } // namespace internal
@@ -211,7 +240,7 @@ class Function<R, Nil, Nil, Nil, Nil, Nil> {
   template <class C>
   explicit Function(C const & obj) {
     function_ = new(storage_)
-      internal::FunctorWrapper0<C, R>(obj);
+      typename internal::FunctorStorage0<C, R>::Type(obj);
   }
   Function(Function const & func) {
     func.function_->CopyTo(&storage_[0]);
@@ -234,7 +263,7 @@ class Function<R, Nil, Nil, Nil, Nil, Nil> {
   void operator = (C const & obj) {
     Free();
     function_ = new(storage_)
-      internal::FunctorWrapper0<C, R>(obj);
+      typename internal::FunctorStorage0<C, R>::Type(obj);
   }
   explicit Function(R(*func)()) {
     function_ = new(storage_)
@@ -32,7 +32,6 @@
 
 #include <embb/base/internal/nil.h>
 #include <embb/base/memory_allocation.h>
-#include <embb/base/atomic.h>
 #include <embb/base/internal/functionT.h>
 #include <embb/base/internal/function0.h>
 
@@ -144,19 +143,13 @@ template <class C, typename R,
 class FunctorWrapper1
   : public Function1<R, T1> {
  public:
-  FunctorWrapper1() : object_(NULL), ref_count_(NULL) {}
-  explicit FunctorWrapper1(C const & obj) {
-    object_ = Allocation::New<C>(obj);
-    ref_count_ = Allocation::New<Atomic<int> >(1);
-  }
-  explicit FunctorWrapper1(FunctorWrapper1 const & other) {
-    object_ = other.object_;
-    ref_count_ = other.ref_count_;
-    ++*ref_count_;
-  }
+  FunctorWrapper1() : object_(NULL) {}
+  explicit FunctorWrapper1(C const & obj)
+  : object_(Allocation::New<C>(obj)) {}
+  explicit FunctorWrapper1(FunctorWrapper1 const & other)
+  : object_(Allocation::New<C>(*other.object_)) {}
   virtual ~FunctorWrapper1() {
-    if (0 == --*ref_count_) {
-      Allocation::Delete(ref_count_);
+    if (NULL != object_) {
       Allocation::Delete(object_);
     }
   }
@@ -169,7 +162,6 @@ class FunctorWrapper1
 
  private:
   C * object_;
-  Atomic<int> * ref_count_;
 };
 
 template <class C,
@@ -177,19 +169,13 @@ template <class C,
 class FunctorWrapper1<C, void, T1>
   : public Function1<void, T1> {
  public:
-  FunctorWrapper1() : object_(NULL), ref_count_(NULL) {}
-  explicit FunctorWrapper1(C const & obj) {
-    object_ = Allocation::New<C>(obj);
-    ref_count_ = Allocation::New<Atomic<int> >(1);
-  }
-  explicit FunctorWrapper1(FunctorWrapper1 const & other) {
-    object_ = other.object_;
-    ref_count_ = other.ref_count_;
-    ++*ref_count_;
-  }
+  FunctorWrapper1() : object_(NULL) {}
+  explicit FunctorWrapper1(C const & obj)
+  : object_(Allocation::New<C>(obj)) {}
+  explicit FunctorWrapper1(FunctorWrapper1 const & other)
+  : object_(Allocation::New<C>(*other.object_)) {}
   virtual ~FunctorWrapper1() {
-    if (0 == --*ref_count_) {
-      Allocation::Delete(ref_count_);
+    if (NULL != object_) {
       Allocation::Delete(object_);
     }
   }
@@ -202,7 +188,53 @@ class FunctorWrapper1<C, void, T1>
 
  private:
   C * object_;
-  Atomic<int> * ref_count_;
+};
+
+// functor stored in the Function's own storage
+template <class C, typename R,
+  typename T1>
+class FunctorInline1
+  : public Function1<R, T1> {
+ public:
+  explicit FunctorInline1(C const & obj) : object_(obj) {}
+  virtual R operator () (T1 p1) {
+    return object_(p1);
+  }
+  virtual void CopyTo(void* dst) {
+    new(dst)FunctorInline1(*this);
+  }
+
+ private:
+  C object_;
+};
+
+template <class C,
+  typename T1>
+class FunctorInline1<C, void, T1>
+  : public Function1<void, T1> {
+ public:
+  explicit FunctorInline1(C const & obj) : object_(obj) {}
+  virtual void operator () (T1 p1) {
+    object_(p1);
+  }
+  virtual void CopyTo(void* dst) {
+    new(dst)FunctorInline1(*this);
+  }
+
+ private:
+  C object_;
+};
+
+// selects inline storage for functors that fit into a Function
+template <class C, typename R,
+  typename T1>
+struct FunctorStorage1 {
+  typedef typename SelectType<
+    sizeof(FunctorInline1<C, R, T1>) <=
+      sizeof(MemberFunctionPointer1<Nil, R, T1>) &&
+    AlignmentOf<C>::value <= AlignmentOf<void*>::value,
+    FunctorInline1<C, R, T1>,
+    FunctorWrapper1<C, R, T1> >::Type Type;
 };
 
 // bind to function0
@@ -238,7 +270,7 @@ class Function<R, T1, Nil, Nil, Nil, Nil> {
   template <class C>
   explicit Function(C const & obj) {
     function_ = new(storage_)
-      internal::FunctorWrapper1<C, R, T1>(obj);
+      typename internal::FunctorStorage1<C, R, T1>::Type(obj);
   }
   Function(Function const & func) {
     func.function_->CopyTo(&storage_[0]);
@@ -261,7 +293,7 @@ class Function<R, T1, Nil, Nil, Nil, Nil> {
   void operator = (C const & obj) {
     Free();
     function_ = new(storage_)
-      internal::FunctorWrapper1<C, R, T1>(obj);
+      typename internal::FunctorStorage1<C, R, T1>::Type(obj);
   }
   explicit Function(R(*func)(T1)) {
     function_ = new(storage_)
@@ -32,7 +32,6 @@
 
 #include <embb/base/internal/nil.h>
 #include <embb/base/memory_allocation.h>
-#include <embb/base/atomic.h>
 #include <embb/base/internal/functionT.h>
 #include <embb/base/internal/function0.h>
 #include <embb/base/internal/function1.h>
@@ -145,19 +144,13 @@ template <class C, typename R,
 class FunctorWrapper2
   : public Function2<R, T1, T2> {
  public:
-  FunctorWrapper2() : object_(NULL), ref_count_(NULL) {}
-  explicit FunctorWrapper2(C const & obj) {
-    object_ = Allocation::New<C>(obj);
-    ref_count_ = Allocation::New<Atomic<int> >(1);
-  }
-  explicit FunctorWrapper2(FunctorWrapper2 const & other) {
-    object_ = other.object_;
-    ref_count_ = other.ref_count_;
-    ++*ref_count_;
-  }
+  FunctorWrapper2() : object_(NULL) {}
+  explicit FunctorWrapper2(C const & obj)
+  : object_(Allocation::New<C>(obj)) {}
+  explicit FunctorWrapper2(FunctorWrapper2 const & other)
+  : object_(Allocation::New<C>(*other.object_)) {}
   virtual ~FunctorWrapper2() {
-    if (0 == --*ref_count_) {
-      Allocation::Delete(ref_count_);
+    if (NULL != object_) {
       Allocation::Delete(object_);
     }
   }
@@ -170,7 +163,6 @@ class FunctorWrapper2
 
  private:
   C * object_;
-  Atomic<int> * ref_count_;
 };
 
 template <class C,
@@ -178,19 +170,13 @@ template <class C,
 class FunctorWrapper2<C, void, T1, T2>
   : public Function2<void, T1, T2> {
  public:
-  FunctorWrapper2() : object_(NULL), ref_count_(NULL) {}
-  explicit FunctorWrapper2(C const & obj) {
-    object_ = Allocation::New<C>(obj);
-    ref_count_ = Allocation::New<Atomic<int> >(1);
-  }
-  explicit FunctorWrapper2(FunctorWrapper2 const & other) {
-    object_ = other.object_;
-    ref_count_ = other.ref_count_;
-    ++*ref_count_;
-  }
+  FunctorWrapper2() : object_(NULL) {}
+  explicit FunctorWrapper2(C const & obj)
+  : object_(Allocation::New<C>(obj)) {}
+  explicit FunctorWrapper2(FunctorWrapper2 const & other)
+  : object_(Allocation::New<C>(*other.object_)) {}
   virtual ~FunctorWrapper2() {
-    if (0 == --*ref_count_) {
-      Allocation::Delete(ref_count_);
+    if (NULL != object_) {
       Allocation::Delete(object_);
     }
   }
@@ -203,7 +189,53 @@ class FunctorWrapper2<C, void, T1, T2>
 
  private:
   C * object_;
-  Atomic<int> * ref_count_;
+};
+
+// functor stored in the Function's own storage
+template <class C, typename R,
+  typename T1, typename T2>
+class FunctorInline2
+  : public Function2<R, T1, T2> {
+ public:
+  explicit FunctorInline2(C const & obj) : object_(obj) {}
+  virtual R operator () (T1 p1, T2 p2) {
+    return object_(p1, p2);
+  }
+  virtual void CopyTo(void* dst) {
+    new(dst)FunctorInline2(*this);
+  }
+
+ private:
+  C object_;
+};
+
+template <class C,
+  typename T1, typename T2>
+class FunctorInline2<C, void, T1, T2>
+  : public Function2<void, T1, T2> {
+ public:
+  explicit FunctorInline2(C const & obj) : object_(obj) {}
+  virtual void operator () (T1 p1, T2 p2) {
+    object_(p1, p2);
+  }
+  virtual void CopyTo(void* dst) {
+    new(dst)FunctorInline2(*this);
+  }
+
+ private:
+  C object_;
+};
+
+// selects inline storage for functors that fit into a Function
+template <class C, typename R,
+  typename T1, typename T2>
+struct FunctorStorage2 {
+  typedef typename SelectType<
+    sizeof(FunctorInline2<C, R, T1, T2>) <=
+      sizeof(MemberFunctionPointer2<Nil, R, T1, T2>) &&
+    AlignmentOf<C>::value <= AlignmentOf<void*>::value,
+    FunctorInline2<C, R, T1, T2>,
+    FunctorWrapper2<C, R, T1, T2> >::Type Type;
 };
 
 // bind to function0
@@ -279,7 +311,7 @@ class Function<R, T1, T2, Nil, Nil, Nil> {
   template <class C>
   explicit Function(C const & obj) {
     function_ = new(storage_)
-      internal::FunctorWrapper2<C, R, T1, T2>(obj);
+      typename internal::FunctorStorage2<C, R, T1, T2>::Type(obj);
   }
   Function(Function const & func) {
     func.function_->CopyTo(&storage_[0]);
@@ -302,7 +334,7 @@ class Function<R, T1, T2, Nil, Nil, Nil> {
   void operator = (C const & obj) {
     Free();
     function_ = new(storage_)
-      internal::FunctorWrapper2<C, R, T1, T2>(obj);
+      typename internal::FunctorStorage2<C, R, T1, T2>::Type(obj);
   }
   explicit Function(R(*func)(T1, T2)) {
     function_ = new(storage_)
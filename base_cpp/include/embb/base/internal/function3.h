@@ -32,7 +32,6 @@
 
 #include <embb/base/internal/nil.h>
 #include <embb/base/memory_allocation.h>
-#include <embb/base/atomic.h>
 #include <embb/base/internal/functionT.h>
 #include <embb/base/internal/function0.h>
 #include <embb/base/internal/function1.h>
@@ -145,19 +144,13 @@ template <class C, typename R,
 class FunctorWrapper3
   : public Function3<R, T1, T2, T3> {
  public:
-  FunctorWrapper3() : object_(NULL), ref_count_(NULL) {}
-  explicit FunctorWrapper3(C const & obj) {
-    object_ = Allocation::New<C>(obj);
-    ref_count_ = Allocation::New<Atomic<int> >(1);
-  }
-  explicit FunctorWrapper3(FunctorWrapper3 const & other) {
-    object_ = other.object_;
-    ref_count_ = other.ref_count_;
-    ++*ref_count_;
-  }
+  FunctorWrapper3() : object_(NULL) {}
+  explicit FunctorWrapper3(C const & obj)
+  : object_(Allocation::New<C>(obj)) {}
+  explicit FunctorWrapper3(FunctorWrapper3 const & other)
+  : object_(Allocation::New<C>(*other.object_)) {}
   virtual ~FunctorWrapper3() {
-    if (0 == --*ref_count_) {
-      Allocation::Delete(ref_count_);
+    if (NULL != object_) {
       Allocation::Delete(object_);
     }
   }
@@ -170,7 +163,6 @@ class FunctorWrapper3
 
  private:
   C * object_;
-  Atomic<int> * ref_count_;
 };
 
 template <class C,
@@ -178,19 +170,13 @@ template <class C,
 class FunctorWrapper3<C, void, T1, T2, T3>
   : public Function3<void, T1, T2, T3> {
  public:
-  FunctorWrapper3() : object_(NULL), ref_count_(NULL) {}
-  explicit FunctorWrapper3(C const & obj) {
-    object_ = Allocation::New<C>(obj);
-    ref_count_ = Allocation::New<Atomic<int> >(1);
-  }
-  explicit FunctorWrapper3(FunctorWrapper3 const & other) {
-    object_ = other.object_;
-    ref_count_ = other.ref_count_;
-    ++*ref_count_;
-  }
+  FunctorWrapper3() : object_(NULL) {}
+  explicit FunctorWrapper3(C const & obj)
+  : object_(Allocation::New<C>(obj)) {}
+  explicit FunctorWrapper3(FunctorWrapper3 const & other)
+  : object_(Allocation::New<C>(*other.object_)) {}
   virtual ~FunctorWrapper3() {
-    if (0 == --*ref_count_) {
-      Allocation::Delete(ref_count_);
+    if (NULL != object_) {
       Allocation::Delete(object_);
     }
   }
@@ -203,7 +189,53 @@ class FunctorWrapper3<C, void, T1, T2, T3>
 
  private:
   C * object_;
-  Atomic<int> * ref_count_;
+};
+
+// functor stored in the Function's own storage
+template <class C, typename R,
+  typename T1, typename T2, typename T3>
+class FunctorInline3
+  : public Function3<R, T1, T2, T3> {
+ public:
+  explicit FunctorInline3(C const & obj) : object_(obj) {}
+  virtual R operator () (T1 p1, T2 p2, T3 p3) {
+    return object_(p1, p2, p3);
+  }
+  virtual void CopyTo(void* dst) {
+    new(dst)FunctorInline3(*this);
+  }
+
+ private:
+  C object_;
+};
+
+template <class C,
+  typename T1, typename T2, typename T3>
+class FunctorInline3<C, void, T1, T2, T3>
+  : public Function3<void, T1, T2, T3> {
+ public:
+  explicit FunctorInline3(C const & obj) : object_(obj) {}
+  virtual void operator () (T1 p1, T2 p2, T3 p3) {
+    object_(p1, p2, p3);
+  }
+  virtual void CopyTo(void* dst) {
+    new(dst)FunctorInline3(*this);
+  }
+
+ private:
+  C object_;
+};
+
+// selects inline storage for functors that fit into a Function
+template <class C, typename R,
+  typename T1, typename T2, typename T3>
+struct FunctorStorage3 {
+  typedef typename SelectType<
+    sizeof(FunctorInline3<C, R, T1, T2, T3>) <=
+      sizeof(MemberFunctionPointer3<Nil, R, T1, T2, T3>) &&
+    AlignmentOf<C>::value <= AlignmentOf<void*>::value,
+    FunctorInline3<C, R, T1, T2, T3>,
+    FunctorWrapper3<C, R, T1, T2, T3> >::Type Type;
 };
 
 // bind to function0
@@ -302,7 +334,7 @@ class Function<R, T1, T2, T3, Nil, Nil> {
   template <class C>
   explicit Function(C const & obj) {
     function_ = new(storage_)
-      internal::FunctorWrapper3<C, R, T1, T2, T3>(obj);
+      typename internal::FunctorStorage3<C, R, T1, T2, T3>::Type(obj);
   }
   Function(Function const & func) {
     func.function_->CopyTo(&storage_[0]);
@@ -325,7 +357,7 @@ class Function<R, T1, T2, T3, Nil, Nil> {
   void operator = (C const & obj) {
     Free();
     function_ = new(storage_)
-      internal::FunctorWrapper3<C, R, T1, T2, T3>(obj);
+      typename internal::FunctorStorage3<C, R, T1, T2, T3>::Type(obj);
   }
   explicit Function(R(*func)(T1, T2, T3)) {
     function_ = new(storage_)
@@ -32,7 +32,6 @@
 
 #include <embb/base/internal/nil.h>
 #include <embb/base/memory_allocation.h>
-#include <embb/base/atomic.h>
 #include <embb/base/internal/functionT.h>
 #include <embb/base/internal/function0.h>
 #include <embb/base/internal/function1.h>
@@ -145,19 +144,13 @@ template <class C, typename R,
 class FunctorWrapper4
   : public Function4<R, T1, T2, T3, T4> {
  public:
-  FunctorWrapper4() : object_(NULL), ref_count_(NULL) {}
-  explicit FunctorWrapper4(C const & obj) {
-    object_ = Allocation::New<C>(obj);
-    ref_count_ = Allocation::New<Atomic<int> >(1);
-  }
-  explicit FunctorWrapper4(FunctorWrapper4 const & other) {
-    object_ = other.object_;
-    ref_count_ = other.ref_count_;
-    ++*ref_count_;
-  }
+  FunctorWrapper4() : object_(NULL) {}
+  explicit FunctorWrapper4(C const & obj)
+  : object_(Allocation::New<C>(obj)) {}
+  explicit FunctorWrapper4(FunctorWrapper4 const & other)
+  : object_(Allocation::New<C>(*other.object_)) {}
   virtual ~FunctorWrapper4() {
-    if (0 == --*ref_count_) {
-      Allocation::Delete(ref_count_);
+    if (NULL != object_) {
       Allocation::Delete(object_);
     }
   }
@@ -170,7 +163,6 @@ class FunctorWrapper4
 
  private:
   C * object_;
-  Atomic<int> * ref_count_;
 };
 
 template <class C,
@@ -178,19 +170,13 @@ template <class C,
 class FunctorWrapper4<C, void, T1, T2, T3, T4>
   : public Function4<void, T1, T2, T3, T4> {
  public:
-  FunctorWrapper4() : object_(NULL), ref_count_(NULL) {}
-  explicit FunctorWrapper4(C const & obj) {
-    object_ = Allocation::New<C>(obj);
-    ref_count_ = Allocation::New<Atomic<int> >(1);
-  }
-  explicit FunctorWrapper4(FunctorWrapper4 const & other) {
-    object_ = other.object_;
-    ref_count_ = other.ref_count_;
-    ++*ref_count_;
-  }
+  FunctorWrapper4() : object_(NULL) {}
+  explicit FunctorWrapper4(C const & obj)
+  : object_(Allocation::New<C>(obj)) {}
+  explicit FunctorWrapper4(FunctorWrapper4 const & other)
+  : object_(Allocation::New<C>(*other.object_)) {}
   virtual ~FunctorWrapper4() {
-    if (0 == --*ref_count_) {
-      Allocation::Delete(ref_count_);
+    if (NULL != object_) {
       Allocation::Delete(object_);
     }
   }
@@ -203,7 +189,53 @@ class FunctorWrapper4<C, void, T1, T2, T3, T4>
 
  private:
   C * object_;
-  Atomic<int> * ref_count_;
+};
+
+// functor stored in the Function's own storage
+template <class C, typename R,
+  typename T1, typename T2, typename T3, typename T4>
+class FunctorInline4
+  : public Function4<R, T1, T2, T3, T4> {
+ public:
+  explicit FunctorInline4(C const & obj) : object_(obj) {}
+  virtual R operator () (T1 p1, T2 p2, T3 p3, T4 p4) {
+    return object_(p1, p2, p3, p4);
+  }
+  virtual void CopyTo(void* dst) {
+    new(dst)FunctorInline4(*this);
+  }
+
+ private:
+  C object_;
+};
+
+template <class C,
+  typename T1, typename T2, typename T3, typename T4>
+class FunctorInline4<C, void, T1, T2, T3, T4>
+  : public Function4<void, T1, T2, T3, T4> {
+ public:
+  explicit FunctorInline4(C const & obj) : object_(obj) {}
+  virtual void operator () (T1 p1, T2 p2, T3 p3, T4 p4) {
+    object_(p1, p2, p3, p4);
+  }
+  virtual void CopyTo(void* dst) {
+    new(dst)FunctorInline4(*this);
+  }
+
+ private:
+  C object_;
+};
+
+// selects inline storage for functors that fit into a Function
+template <class C, typename R,
+  typename T1, typename T2, typename T3, typename T4>
+struct FunctorStorage4 {
+  typedef typename SelectType<
+    sizeof(FunctorInline4<C, R, T1, T2, T3, T4>) <=
+      sizeof(MemberFunctionPointer4<Nil, R, T1, T2, T3, T4>) &&
+    AlignmentOf<C>::value <= AlignmentOf<void*>::value,
+    FunctorInline4<C, R, T1, T2, T3, T4>,
+    FunctorWrapper4<C, R, T1, T2, T3, T4> >::Type Type;
 };
 
 // bind to function0
@@ -328,7 +360,7 @@ class Function<R, T1, T2, T3, T4, Nil> {
   template <class C>
   explicit Function(C const & obj) {
     function_ = new(storage_)
-      internal::FunctorWrapper4<C, R, T1, T2, T3, T4>(obj);
+      typename internal::FunctorStorage4<C, R, T1, T2, T3, T4>::Type(obj);
   }
   Function(Function const & func) {
     func.function_->CopyTo(&storage_[0]);
@@ -351,7 +383,7 @@ class Function<R, T1, T2, T3, T4, Nil> {
   void operator = (C const & obj) {
     Free();
     function_ = new(storage_)
-      internal::FunctorWrapper4<C, R, T1, T2, T3, T4>(obj);
+      typename internal::FunctorStorage4<C, R, T1, T2, T3, T4>::Type(obj);
   }
   explicit Function(R(*func)(T1, T2, T3, T4)) {
     function_ = new(storage_)
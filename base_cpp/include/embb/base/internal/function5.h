@@ -32,7 +32,6 @@
 
 #include <embb/base/internal/nil.h>
 #include <embb/base/memory_allocation.h>
-#include <embb/base/atomic.h>
 #include <embb/base/internal/functionT.h>
 #include <embb/base/internal/function0.h>
 #include <embb/base/internal/function1.h>
@@ -145,19 +144,13 @@ template <class C, typename R,
 class FunctorWrapper5
   : public Function5<R, T1, T2, T3, T4, T5> {
  public:
-  FunctorWrapper5() : object_(NULL), ref_count_(NULL) {}
-  explicit FunctorWrapper5(C const & obj) {
-    object_ = Allocation::New<C>(obj);
-    ref_count_ = Allocation::New<Atomic<int> >(1);
-  }
-  explicit FunctorWrapper5(FunctorWrapper5 const & other) {
-    object_ = other.object_;
-    ref_count_ = other.ref_count_;
-    ++*ref_count_;
-  }
+  FunctorWrapper5() : object_(NULL) {}
+  explicit FunctorWrapper5(C const & obj)
+  : object_(Allocation::New<C>(obj)) {}
+  explicit FunctorWrapper5(FunctorWrapper5 const & other)
+  : object_(Allocation::New<C>(*other.object_)) {}
   virtual ~FunctorWrapper5() {
-    if (0 == --*ref_count_) {
-      Allocation::Delete(ref_count_);
+    if (NULL != object_) {
       Allocation::Delete(object_);
     }
   }
@@ -170,7 +163,6 @@ class FunctorWrapper5
 
  private:
   C * object_;
-  Atomic<int> * ref_count_;
 };
 
 template <class C,
@@ -178,19 +170,13 @@ template <class C,
 class FunctorWrapper5<C, void, T1, T2, T3, T4, T5>
   : public Function5<void, T1, T2, T3, T4, T5> {
  public:
-  FunctorWrapper5() : object_(NULL), ref_count_(NULL) {}
-  explicit FunctorWrapper5(C const & obj) {
-    object_ = Allocation::New<C>(obj);
-    ref_count_ = Allocation::New<Atomic<int> >(1);
-  }
-  explicit FunctorWrapper5(FunctorWrapper5 const & other) {
-    object_ = other.object_;
-    ref_count_ = other.ref_count_;
-    ++*ref_count_;
-  }
+  FunctorWrapper5() : object_(NULL) {}
+  explicit FunctorWrapper5(C const & obj)
+  : object_(Allocation::New<C>(obj)) {}
+  explicit FunctorWrapper5(FunctorWrapper5 const & other)
+  : object_(Allocation::New<C>(*other.object_)) {}
   virtual ~FunctorWrapper5() {
-    if (0 == --*ref_count_) {
-      Allocation::Delete(ref_count_);
+    if (NULL != object_) {
       Allocation::Delete(object_);
     }
   }
@@ -203,7 +189,53 @@ class FunctorWrapper5<C, void, T1, T2, T3, T4, T5>
 
  private:
   C * object_;
-  Atomic<int> * ref_count_;
+};
+
+// functor stored in the Function's own storage
+template <class C, typename R,
+  typename T1, typename T2, typename T3, typename T4, typename T5>
+class FunctorInline5
+  : public Function5<R, T1, T2, T3, T4, T5> {
+ public:
+  explicit FunctorInline5(C const & obj) : object_(obj) {}
+  virtual R operator () (T1 p1, T2 p2, T3 p3, T4 p4, T5 p5) {
+    return object_(p1, p2, p3, p4, p5);
+  }
+  virtual void CopyTo(void* dst) {
+    new(dst)FunctorInline5(*this);
+  }
+
+ private:
+  C object_;
+};
+
+template <class C,
+  typename T1, typename T2, typename T3, typename T4, typename T5>
+class FunctorInline5<C, void, T1, T2, T3, T4, T5>
+  : public Function5<void, T1, T2, T3, T4, T5> {
+ public:
+  explicit FunctorInline5(C const & obj) : object_(obj) {}
+  virtual void operator () (T1 p1, T2 p2, T3 p3, T4 p4, T5 p5) {
+    object_(p1, p2, p3, p4, p5);
+  }
+  virtual void CopyTo(void* dst) {
+    new(dst)FunctorInline5(*this);
+  }
+
+ private:
+  C object_;
+};
+
+// selects inline storage for functors that fit into a Function
+template <class C, typename R,
+  typename T1, typename T2, typename T3, typename T4, typename T5>
+struct FunctorStorage5 {
+  typedef typename SelectType<
+    sizeof(FunctorInline5<C, R, T1, T2, T3, T4, T5>) <=
+      sizeof(MemberFunctionPointer5<Nil, R, T1, T2, T3, T4, T5>) &&
+    AlignmentOf<C>::value <= AlignmentOf<void*>::value,
+    FunctorInline5<C, R, T1, T2, T3, T4, T5>,
+    FunctorWrapper5<C, R, T1, T2, T3, T4, T5> >::Type Type;
 };
 
 // bind to function0
@@ -355,7 +387,7 @@ class Function {
   template <class C>
   explicit Function(C const & obj) {
     function_ = new(storage_)
-      internal::FunctorWrapper5<C, R, T1, T2, T3, T4, T5>(obj);
+      typename internal::FunctorStorage5<C, R, T1, T2, T3, T4, T5>::Type(obj);
   }
   Function(Function const & func) {
     func.function_->CopyTo(&storage_[0]);
@@ -378,7 +410,7 @@ class Function {
   void operator = (C const & obj) {
     Free();
     function_ = new(storage_)
-      internal::FunctorWrapper5<C, R, T1, T2, T3, T4, T5>(obj);
+      typename internal::FunctorStorage5<C, R, T1, T2, T3, T4, T5>::Type(obj);
   }
   explicit Function(R(*func)(T1, T2, T3, T4, T5)) {
     function_ = new(storage_)
@@ -27,11 +27,38 @@
 #ifndef EMBB_BASE_INTERNAL_FUNCTIONT_H_
 #define EMBB_BASE_INTERNAL_FUNCTIONT_H_
 
+#include <cstddef>
+
 #include <embb/base/internal/nil.h>
 
 namespace embb {
 namespace base {
 
+namespace internal {
+
+// alignment of T, determined by the padding in front of a member of type T
+template <typename T>
+struct AlignmentOf {
+  struct Probe {
+    char c;
+    T t;
+  };
+  static const size_t value = sizeof(Probe) - sizeof(T);
+};
+
+// compile time selection of one of two types
+template <bool Condition, class Then, class Else>
+struct SelectType {
+  typedef Then Type;
+};
+
+template <class Then, class Else>
+struct SelectType<false, Then, Else> {
+  typedef Else Type;
+};
+
+} // namespace internal
+
 using embb::base::internal::Nil;
 
 template <
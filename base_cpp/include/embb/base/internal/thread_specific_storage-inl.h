@@ -28,42 +28,128 @@
 #define EMBB_BASE_INTERNAL_THREAD_SPECIFIC_STORAGE_INL_H_
 
 #include <embb/base/c/thread_specific_storage.h>
-#include <embb/base/c/internal/unused.h>
 #include <embb/base/memory_allocation.h>
 
 #include <cassert>
 
 namespace embb {
 namespace base {
+namespace internal {
 
+/**
+ * Creates TSS slot objects, so that slots can be re-created for threads
+ * reusing the index of a terminated thread.
+ */
 template<typename Type>
-ThreadSpecificStorage<Type>::ThreadSpecificStorage()
-    : rep_(), usage_flags_(NULL) {
-  Prepare();
-  for (unsigned int i = 0; i < rep_.size; i++) {
-    rep_.values[i] = Allocation::New<Type>();
+class ThreadSpecificStorageFactory {
+ public:
+  virtual ~ThreadSpecificStorageFactory() {}
+  virtual Type* Create() const = 0;
+};
+
+template<typename Type>
+class ThreadSpecificStorageFactory0
+    : public ThreadSpecificStorageFactory<Type> {
+ public:
+  Type* Create() const {
+    return Allocation::New<Type>();
+  }
+};
+
+template<typename Type, typename Initializer1>
+class ThreadSpecificStorageFactory1
+    : public ThreadSpecificStorageFactory<Type> {
+ public:
+  explicit ThreadSpecificStorageFactory1(Initializer1 initializer1)
+      : initializer1_(initializer1) {}
+  Type* Create() const {
+    return Allocation::New<Type>(initializer1_);
+  }
+ private:
+  Initializer1 initializer1_;
+};
+
+template<typename Type, typename Initializer1, typename Initializer2>
+class ThreadSpecificStorageFactory2
+    : public ThreadSpecificStorageFactory<Type> {
+ public:
+  ThreadSpecificStorageFactory2(Initializer1 initializer1,
+                                Initializer2 initializer2)
+      : initializer1_(initializer1), initializer2_(initializer2) {}
+  Type* Create() const {
+    return Allocation::New<Type>(initializer1_, initializer2_);
   }
+ private:
+  Initializer1 initializer1_;
+  Initializer2 initializer2_;
+};
+
+template<typename Type, typename Initializer1, typename Initializer2,
+         typename Initializer3>
+class ThreadSpecificStorageFactory3
+    : public ThreadSpecificStorageFactory<Type> {
+ public:
+  ThreadSpecificStorageFactory3(Initializer1 initializer1,
+                                Initializer2 initializer2,
+                                Initializer3 initializer3)
+      : initializer1_(initializer1), initializer2_(initializer2),
+        initializer3_(initializer3) {}
+  Type* Create() const {
+    return Allocation::New<Type>(initializer1_, initializer2_,
+                                 initializer3_);
+  }
+ private:
+  Initializer1 initializer1_;
+  Initializer2 initializer2_;
+  Initializer3 initializer3_;
+};
+
+template<typename Type, typename Initializer1, typename Initializer2,
+         typename Initializer3, typename Initializer4>
+class ThreadSpecificStorageFactory4
+    : public ThreadSpecificStorageFactory<Type> {
+ public:
+  ThreadSpecificStorageFactory4(Initializer1 initializer1,
+                                Initializer2 initializer2,
+                                Initializer3 initializer3,
+                                Initializer4 initializer4)
+      : initializer1_(initializer1), initializer2_(initializer2),
+        initializer3_(initializer3), initializer4_(initializer4) {}
+  Type* Create() const {
+    return Allocation::New<Type>(initializer1_, initializer2_,
+                                 initializer3_, initializer4_);
+  }
+ private:
+  Initializer1 initializer1_;
+  Initializer2 initializer2_;
+  Initializer3 initializer3_;
+  Initializer4 initializer4_;
+};
+
+} // namespace internal
+
+template<typename Type>
+ThreadSpecificStorage<Type>::ThreadSpecificStorage()
+    : rep_(), usage_flags_(NULL), factory_(NULL) {
+  Prepare(Allocation::New<internal::ThreadSpecificStorageFactory0<Type> >());
 }
 
 template<typename Type>
 template<typename Initializer>
 ThreadSpecificStorage<Type>::ThreadSpecificStorage(Initializer initializer)
-    : rep_(), usage_flags_(NULL) {
-  Prepare();
-  for (unsigned int i = 0; i < rep_.size; i++) {
-    rep_.values[i] = Allocation::New<Type>(initializer);
-  }
+    : rep_(), usage_flags_(NULL), factory_(NULL) {
+  Prepare(Allocation::New<
+    internal::ThreadSpecificStorageFactory1<Type, Initializer> >(
+      initializer));
 }
 
 template<typename Type>
 template<typename Initializer1, typename Initializer2>
 ThreadSpecificStorage<Type>::ThreadSpecificStorage(
     Initializer1 initializer1, Initializer2 initializer2)
-    : rep_(), usage_flags_(NULL) {
-  Prepare();
-  for (unsigned int i = 0; i < rep_.size; i++) {
-    rep_.values[i] = Allocation::New<Type>(initializer1, initializer2);
-  }
+    : rep_(), usage_flags_(NULL), factory_(NULL) {
+  Prepare(Allocation::New<internal::ThreadSpecificStorageFactory2<
+    Type, Initializer1, Initializer2> >(initializer1, initializer2));
 }
 
 template<typename Type>
@@ -71,12 +157,10 @@ template<typename Initializer1, typename Initializer2, typename Initializer3>
 ThreadSpecificStorage<Type>::ThreadSpecificStorage(
     Initializer1 initializer1, Initializer2 initializer2,
     Initializer3 initializer3)
-    : rep_(), usage_flags_(NULL) {
-  Prepare();
-  for (unsigned int i = 0; i < rep_.size; i++) {
-    rep_.values[i] = Allocation::New<Type>(initializer1, initializer2,
-                                           initializer3);
-  }
+    : rep_(), usage_flags_(NULL), factory_(NULL) {
+  Prepare(Allocation::New<internal::ThreadSpecificStorageFactory3<
+    Type, Initializer1, Initializer2, Initializer3> >(
+      initializer1, initializer2, initializer3));
 }
 
 template<typename Type>
@@ -85,12 +169,10 @@ template<typename Initializer1, typename Initializer2, typename Initializer3,
 ThreadSpecificStorage<Type>::ThreadSpecificStorage(
     Initializer1 initializer1, Initializer2 initializer2,
     Initializer3 initializer3, Initializer4 initializer4)
-    : rep_(), usage_flags_(NULL) {
-  Prepare();
-  for (unsigned int i = 0; i < rep_.size; i++) {
-    rep_.values[i] = Allocation::New<Type>(initializer1, initializer2,
-                                           initializer3, initializer4);
-  }
+    : rep_(), usage_flags_(NULL), factory_(NULL) {
+  Prepare(Allocation::New<internal::ThreadSpecificStorageFactory4<
+    Type, Initializer1, Initializer2, Initializer3, Initializer4> >(
+      initializer1, initializer2, initializer3, initializer4));
 }
 
 template<typename Type>
@@ -102,40 +184,53 @@ ThreadSpecificStorage<Type>::~ThreadSpecificStorage() {
   }
   embb_tss_delete(&rep_);
   Allocation::Free(usage_flags_);
+  Allocation::Delete(factory_);
 }
 
 template<typename Type>
 Type& ThreadSpecificStorage<Type>::Get() {
-  Type* value = static_cast<Type*>(embb_tss_get(&rep_));
-  if (value == NULL) {
-    EMBB_THROW(ErrorException, "No thread index could be obtained");
-  }
-  unsigned int thread_index = 0;
-  int status = embb_internal_thread_index(&thread_index);
-  assert(status == EMBB_SUCCESS);
-  EMBB_UNUSED_IN_RELEASE(status);
-  usage_flags_[thread_index] = true;
-  return *value;
+  return *GetSlot();
 }
 
 template<typename Type>
 const Type& ThreadSpecificStorage<Type>::Get() const {
-  const Type* value = static_cast<Type*>(embb_tss_get(&rep_));
-  if (value == NULL) {
+  return *GetSlot();
+}
+
+template<typename Type>
+Type* ThreadSpecificStorage<Type>::GetSlot() const {
+  // Slots are accessed directly, since they are preallocated for all thread
+  // indices and embb_tss_get() hides slots not set by the calling thread
+  unsigned int thread_index = 0;
+  unsigned int ticket = 0;
+  int status = embb_internal_thread_index_ticket(&thread_index, &ticket);
+  if (status != EMBB_SUCCESS || thread_index >= rep_.size) {
     EMBB_THROW(ErrorException, "No thread index could be obtained");
   }
-  unsigned int thread_index = 0;
-  int status = embb_internal_thread_index(&thread_index);
-  assert(status == EMBB_SUCCESS);
-  EMBB_UNUSED_IN_RELEASE(status);
+  Type* value = static_cast<Type*>(rep_.values[thread_index]);
+  assert(value != NULL);
+  if (rep_.tickets[thread_index] != ticket) {
+    // Ticket 0 marks a slot that has not been used since construction,
+    // any other ticket belongs to a terminated owner of this index
+    if (rep_.tickets[thread_index] != 0) {
+      Type* fresh = factory_->Create();
+      Allocation::Delete(value);
+      value = fresh;
+      rep_.values[thread_index] = value;
+    }
+    rep_.tickets[thread_index] = ticket;
+  }
   usage_flags_[thread_index] = true;
-  return *value;
+  return value;
 }
 
 template<typename Type>
-void ThreadSpecificStorage<Type>::Prepare() {
+void ThreadSpecificStorage<Type>::Prepare(
+    internal::ThreadSpecificStorageFactory<Type>* factory) {
+  factory_ = factory;
   int status = embb_tss_create(&rep_);
   if (status == EMBB_NOMEM) {
+    Allocation::Delete(factory_);
     EMBB_THROW(NoMemoryException, "Not enough memory to allocate "
       "thread-specific storage");
   }
@@ -143,6 +238,7 @@ void ThreadSpecificStorage<Type>::Prepare() {
                  Allocation::Allocate(sizeof(bool) * rep_.size));
   for (unsigned int i = 0; i < rep_.size; i++) {
     usage_flags_[i] = false;
+    rep_.values[i] = factory_->Create();
   }
 }
 
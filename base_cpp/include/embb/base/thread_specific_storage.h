@@ -41,6 +41,14 @@ namespace test {
 class ThreadSpecificStorageTest;
 }
 
+namespace internal {
+/**
+ * Forward declaration of the creator of TSS slot objects.
+ */
+template<typename Type>
+class ThreadSpecificStorageFactory;
+}
+
 /**
  * \defgroup CPP_BASE_TSS Thread-Specific Storage
  *
@@ -53,6 +61,9 @@ class ThreadSpecificStorageTest;
  * Represents thread-specific storage (TSS).
  *
  * Provides for each thread a separate slot storing an object of the given type.
+ * Slots are bound to internal thread indices, which are reused after a thread
+ * terminates. A thread that reuses the index of a terminated thread finds a
+ * freshly constructed object in its slot, not the one left behind.
  *
  * \tparam Type Type of the objects
  * \ingroup CPP_BASE_TSS
@@ -153,7 +164,13 @@ class ThreadSpecificStorage {
   /**
    * Common construction code.
    */
-  void Prepare();
+  void Prepare(internal::ThreadSpecificStorageFactory<Type>* factory);
+
+  /**
+   * Returns the slot object of the calling thread, which is re-created if
+   * the slot was last used by a terminated thread with the same index.
+   */
+  Type* GetSlot() const;
 
   /**
    * Representation of TSS implemented in Base C.
@@ -165,6 +182,11 @@ class ThreadSpecificStorage {
    */
   bool* usage_flags_;
 
+  /**
+   * Creates slot objects with the initializers given on construction.
+   */
+  internal::ThreadSpecificStorageFactory<Type>* factory_;
+
   /**
    * To allow white-box tests.
    */
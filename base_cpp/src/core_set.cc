@@ -77,6 +77,10 @@ unsigned int CoreSet::Count() const {
   return embb_core_set_count(&rep_);
 }
 
+unsigned int CoreSet::FindNext(unsigned int start) const {
+  return embb_core_set_find_next(&rep_, start);
+}
+
 CoreSet CoreSet::operator&(const CoreSet& rhs) const {
   CoreSet result(*this);
   embb_core_set_intersection(&(result.rep_), &(rhs.rep_));
@@ -86,6 +86,20 @@ void CoreSetTest::Test() {
       PT_EXPECT_EQ(set.Count(), cores - i - 1);
     }
   }
+  { // Iterating over the cores in a set
+    CoreSet set(false);
+    PT_EXPECT_EQ(set.FindNext(0), EMBB_CORE_SET_MAX_CORES);
+    set.Reset(true);
+    unsigned int visited = 0;
+    for (unsigned int i = set.FindNext(0); i < EMBB_CORE_SET_MAX_CORES;
+      i = set.FindNext(i + 1)) {
+      PT_EXPECT_EQ(i, visited);
+      visited++;
+    }
+    PT_EXPECT_EQ(visited, cores);
+    set.Remove(0);
+    PT_EXPECT_EQ(set.FindNext(0), (cores > 1) ? 1u : EMBB_CORE_SET_MAX_CORES);
+  }
   { // Logical operators
     CoreSet lhs(false);
     CoreSet rhs(true);
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2014-2015, Siemens AG. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <function_test.h>
+
+#include <embb/base/function.h>
+#include <embb/base/c/memory_allocation.h>
+
+namespace embb {
+namespace base {
+namespace test {
+
+FunctionTest::FunctionTest() {
+  CreateUnit("Small functor copy")
+    .Add(&FunctionTest::TestSmallFunctorCopy, this);
+  CreateUnit("Large functor copy")
+    .Add(&FunctionTest::TestLargeFunctorCopy, this);
+}
+
+void FunctionTest::TestSmallFunctorCopy() {
+  size_t bytes_allocated = embb_get_bytes_allocated();
+  SmallCounter counter;
+  Function<int> func(counter);
+  // Small functors are stored inside the Function, no allocation happens
+  PT_EXPECT_EQ(embb_get_bytes_allocated(), bytes_allocated);
+  PT_EXPECT_EQ(func(), 1);
+  PT_EXPECT_EQ(func(), 2);
+
+  Function<int> copy(func);
+  PT_EXPECT_EQ(embb_get_bytes_allocated(), bytes_allocated);
+  // The copy starts with the state of the original at the time of the copy
+  PT_EXPECT_EQ(copy(), 3);
+  // but both evolve independently afterwards
+  PT_EXPECT_EQ(func(), 3);
+  PT_EXPECT_EQ(func(), 4);
+  PT_EXPECT_EQ(copy(), 4);
+
+  Function<int> assigned(counter);
+  assigned = func;
+  PT_EXPECT_EQ(assigned(), 5);
+  PT_EXPECT_EQ(func(), 5);
+
+  // The functor passed to the constructor is copied as well
+  PT_EXPECT_EQ(counter(), 1);
+}
+
+void FunctionTest::TestLargeFunctorCopy() {
+  size_t bytes_allocated = embb_get_bytes_allocated();
+  {
+    LargeCounter counter;
+    Function<int> func(counter);
+    PT_EXPECT_EQ(func(), 1);
+    PT_EXPECT_EQ(func(), 2);
+
+    Function<int> copy(func);
+    // Large functors are copied just like small ones
+    PT_EXPECT_EQ(copy(), 3);
+    PT_EXPECT_EQ(func(), 3);
+    PT_EXPECT_EQ(func(), 4);
+    PT_EXPECT_EQ(copy(), 4);
+
+    Function<int> assigned(counter);
+    assigned = func;
+    PT_EXPECT_EQ(assigned(), 5);
+    PT_EXPECT_EQ(func(), 5);
+
+    // The functor passed to the constructor is copied as well
+    PT_EXPECT_EQ(counter(), 1);
+  }
+  // Each copy frees its own functor
+  PT_EXPECT_EQ(embb_get_bytes_allocated(), bytes_allocated);
+}
+
+} // namespace test
+} // namespace base
+} // namespace embb
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2014-2015, Siemens AG. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef BASE_CPP_TEST_FUNCTION_TEST_H_
+#define BASE_CPP_TEST_FUNCTION_TEST_H_
+
+#include <partest/partest.h>
+
+namespace embb {
+namespace base {
+namespace test {
+
+/**
+ * Tests the copy semantics of Function for small and large functors.
+ */
+class FunctionTest : public partest::TestCase {
+ public:
+  /**
+   * Adds test methods.
+   */
+  FunctionTest();
+
+ private:
+  /**
+   * Checks that copies of a Function with a small functor have their own
+   * copy of the functor.
+   */
+  void TestSmallFunctorCopy();
+
+  /**
+   * Checks that copies of a Function with an allocated functor have their own
+   * copy of the functor.
+   */
+  void TestLargeFunctorCopy();
+
+  /**
+   * Functor that fits into the storage of a Function.
+   */
+  class SmallCounter {
+   public:
+    SmallCounter() : count_(0) {}
+    int operator()() { return ++count_; }
+
+   private:
+    int count_;
+  };
+
+  /**
+   * Functor that is too large for the storage of a Function.
+   */
+  class LargeCounter {
+   public:
+    LargeCounter() : count_(0) {
+      for (int i = 0; i < 16; i++) {
+        padding_[i] = 0;
+      }
+    }
+    int operator()() { return ++count_; }
+
+   private:
+    int count_;
+    void * padding_[16];
+  };
+};
+
+} // namespace test
+} // namespace base
+} // namespace embb
+
+#endif // BASE_CPP_TEST_FUNCTION_TEST_H_
@@ -42,6 +42,8 @@ ThreadSpecificStorageTest::ThreadSpecificStorageTest()
       .Add(&ThreadSpecificStorageTest::TestMultipleTSSVariables, this);
   CreateUnit("TestConstructors")
       .Add(&ThreadSpecificStorageTest::TestConstructors, this);
+  CreateUnit("Index reuse")
+      .Add(&ThreadSpecificStorageTest::TestIndexReuse, this);
 }
 
 void ThreadSpecificStorageTest::TestInternalRepresentation() {
@@ -59,22 +61,19 @@ void ThreadSpecificStorageTest::TestInternalRepresentation() {
   }
   delete[] threads;
 
-  // Check results
-  int sum = 0;
+  // Check results. Indices of terminated threads are reused, so at most
+  // the first num_threads slots are used, each holding one of the ranks.
+  size_t used_slots = 0;
   for (size_t i = 0; i < tss_.rep_.size; i++) {
-    if (i < num_threads) {
-      PT_EXPECT_EQ(tss_.usage_flags_[i], true);
-      void* value = tss_.rep_.values[i];
-      sum += *static_cast<int*>(value);
-    } else {
-      PT_EXPECT_EQ(tss_.usage_flags_[i], false);
+    if (tss_.usage_flags_[i]) {
+      PT_EXPECT_LT(i, num_threads);
+      size_t rank = *static_cast<size_t*>(tss_.rep_.values[i]);
+      PT_EXPECT_LT(rank, num_threads);
+      used_slots++;
     }
   }
-  int expected_sum = 0;
-  for (size_t i = 0; i < num_threads; i++) {
-    expected_sum += static_cast<int>(i);
-  }
-  PT_EXPECT_EQ(sum, expected_sum);
+  PT_EXPECT_GT(used_slots, static_cast<size_t>(0));
+  PT_EXPECT_LE(used_slots, num_threads);
 }
 
 void ThreadSpecificStorageTest::TestInternalRepresentationSetGet(
@@ -124,6 +123,35 @@ void ThreadSpecificStorageTest::TestConstructors() {
   }
 }
 
+void ThreadSpecificStorageTest::TestIndexReuse() {
+  ThreadSpecificStorage<OneArgumentConstructorType> tss(1);
+  IndexReuseObservation first = { 0, 0 };
+  IndexReuseObservation second = { 0, 0 };
+  // Thread indices are released on termination and the most recently
+  // released index is handed out first, so the second thread reuses the
+  // index of the first one
+  embb::base::Thread first_thread(
+    ThreadSpecificStorageTest::TestIndexReuseSetGet, &tss, &first);
+  first_thread.Join();
+  embb::base::Thread second_thread(
+    ThreadSpecificStorageTest::TestIndexReuseSetGet, &tss, &second);
+  second_thread.Join();
+  PT_EXPECT_EQ(first.index, second.index);
+  PT_EXPECT_EQ(first.found, 1);
+  PT_EXPECT_EQ(second.found, 1);
+}
+
+void ThreadSpecificStorageTest::TestIndexReuseSetGet(
+    ThreadSpecificStorage<OneArgumentConstructorType>* tss,
+    IndexReuseObservation* observation) {
+  assert(tss != NULL);
+  assert(observation != NULL);
+  int status = embb_internal_thread_index(&observation->index);
+  PT_EXPECT_EQ(status, EMBB_SUCCESS);
+  observation->found = tss->Get().var;
+  tss->Get().var = 2;
+}
+
 } // namespace test
 } // namespace base
 } // namespace embb
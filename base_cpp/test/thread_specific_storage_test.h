@@ -94,6 +94,22 @@ class ThreadSpecificStorageTest : public partest::TestCase {
    */
   void TestConstructors();
 
+  /**
+   * Tests that a thread reusing the index of a terminated thread gets a
+   * freshly constructed slot object.
+   */
+  void TestIndexReuse();
+  /**
+   * Thread index and initial slot value observed by a thread.
+   */
+  struct IndexReuseObservation {
+    unsigned int index;
+    int found;
+  };
+  static void TestIndexReuseSetGet(
+                  ThreadSpecificStorage<OneArgumentConstructorType>* tss,
+                  IndexReuseObservation* observation);
+
   /**
    * Used to differentiate between used and unused TSS slots.
    */
@@ -239,17 +239,15 @@ QueueTestSingleProducerSingleConsumer_Post() {
 template<typename Queue_t, bool MultipleProducers, bool MultipleConsumers>
 void QueueTest<Queue_t, MultipleProducers, MultipleConsumers>::
 QueueTestSingleProducerSingleConsumer_ThreadMethod() {
-  unsigned int thread_index;
-  int return_val = embb_internal_thread_index(&thread_index);
-  PT_ASSERT(return_val == EMBB_SUCCESS);
+  // Thread indices are reused when threads terminate, so the rank of the
+  // test thread is used to distinguish producer and consumer
+  int thread_rank = static_cast<int>(partest::TestSuite::GetCurrentThreadID());
   if (thread_selector_producer == -1) {
     int expected = -1;
-    thread_selector_producer.CompareAndSwap(expected,
-      static_cast<int>(thread_index));
+    thread_selector_producer.CompareAndSwap(expected, thread_rank);
     while (thread_selector_producer == -1) {}
   }
-  if (static_cast<unsigned int>(thread_selector_producer.Load()) ==
-    thread_index) {
+  if (thread_selector_producer.Load() == thread_rank) {
     // we are the producer
     while (produce_count >= n_queue_size) { }
 
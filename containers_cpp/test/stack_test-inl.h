@@ -94,12 +94,11 @@ void StackTest<Stack_t>::StackTest1_Post() {
 
 template<typename Stack_t>
 void StackTest<Stack_t>::StackTest1_ThreadMethod() {
-  unsigned int thread_index;
-  int return_val = embb_internal_thread_index(&thread_index);
+  // Thread indices are reused when threads terminate, so the rank of the
+  // test thread is used to select its elements
+  size_t thread_rank = partest::TestSuite::GetCurrentThreadID();
 
-  PT_ASSERT(EMBB_SUCCESS == return_val);
-
-  std::vector<int>& my_elements = thread_local_vectors[thread_index];
+  std::vector<int>& my_elements = thread_local_vectors[thread_rank];
 
   for (std::vector<int>::iterator it = my_elements.begin();
     it != my_elements.end();
@@ -319,9 +319,12 @@ typedef struct mtapi_info_struct mtapi_info_t;
 
 /**
  * Core affinity type.
+ *
+ * Holds one bit per worker thread of the node and supports as many workers as
+ * a core set holds cores (\c EMBB_CORE_SET_MAX_CORES).
  * \ingroup CORE_AFFINITY_MASKS
  */
-typedef mtapi_uint64_t mtapi_affinity_t;
+typedef embb_bitset_t mtapi_affinity_t;
 
 
 /* ---- BASIC enumerations ------------------------------------------------- */
@@ -563,7 +566,13 @@ enum mtapi_node_attributes_enum {
  */
 typedef struct mtapi_task_hndl_struct mtapi_task_hndl_t;
 
-/** task completion callback */
+/**
+ * Task completion callback. It is called by the worker thread that
+ * finished or cancelled the task, before the task is handed to its group.
+ * Its user data can be retrieved using mtapi_task_get_attribute() with
+ * \c MTAPI_TASK_USER_DATA, unless a task without group was deleted by
+ * mtapi_task_wait() in the meantime.
+ */
 typedef void(*mtapi_task_complete_function_t)(
   MTAPI_IN mtapi_task_hndl_t task,
   MTAPI_OUT mtapi_status_t* status);
@@ -168,6 +168,73 @@ mtapi_action_hndl_t mtapi_ext_plugin_action_create(
                                              may be \c MTAPI_NULL */
 );
 
+/**
+ * This function executes a pending task or yields the calling thread.
+ *
+ * If called from a worker thread of the runtime, one task that is ready for
+ * execution is taken from the worker's queues and executed. Otherwise, or if
+ * no task is available, the calling thread yields. Applications use this to
+ * help with the execution of tasks while waiting for a condition that is
+ * signaled by other tasks, e.g., a counter of outstanding child tasks.
+ *
+ * On success, \c *status is set to \c MTAPI_SUCCESS. On error, \c *status is
+ * set to the appropriate error defined below.
+ * <table>
+ *   <tr>
+ *     <th>Error code</th>
+ *     <th>Description</th>
+ *   </tr>
+ *   <tr>
+ *     <td>\c MTAPI_ERR_NODE_NOTINIT</td>
+ *     <td>The calling node is not initialized.</td>
+ *   </tr>
+ * </table>
+ *
+ * \threadsafe
+ * \ingroup C_MTAPI_EXT
+ */
+void mtapi_ext_yield(
+  MTAPI_OUT mtapi_status_t* status/**< [out] Pointer to error code,
+                                             may be \c MTAPI_NULL */
+);
+
+/**
+ * This function returns the number of worker threads that are currently
+ * looking for work or sleeping.
+ *
+ * If \c affinity is not \c MTAPI_NULL, only the worker threads contained in
+ * it are counted, such that tasks with this affinity could be executed by the
+ * counted workers. Counting a subset of the workers takes time linear in the
+ * number of workers, counting all of them takes constant time.
+ *
+ * The value is a snapshot and may change at any time. Applications use it as
+ * a hint for splitting work lazily, i.e., creating additional tasks only if
+ * there are workers that could execute them.
+ *
+ * On success, \c *status is set to \c MTAPI_SUCCESS. On error, \c *status is
+ * set to the appropriate error defined below.
+ * <table>
+ *   <tr>
+ *     <th>Error code</th>
+ *     <th>Description</th>
+ *   </tr>
+ *   <tr>
+ *     <td>\c MTAPI_ERR_NODE_NOTINIT</td>
+ *     <td>The calling node is not initialized.</td>
+ *   </tr>
+ * </table>
+ *
+ * \returns The number of idle worker threads
+ * \waitfree
+ * \ingroup C_MTAPI_EXT
+ */
+mtapi_uint_t mtapi_ext_get_idle_worker_count(
+  MTAPI_IN mtapi_affinity_t* affinity, /**< [in] Worker threads to count,
+                                             \c MTAPI_NULL for all */
+  MTAPI_OUT mtapi_status_t* status     /**< [out] Pointer to error code,
+                                             may be \c MTAPI_NULL */
+);
+
 
 #ifdef __cplusplus
 }
@@ -79,7 +79,7 @@ mtapi_action_hndl_t mtapi_ext_plugin_action_create(
         }
 
         /* check if affinity is sane */
-        if (0 == new_action->attributes.affinity) {
+        if (embb_bitset_is_empty(&new_action->attributes.affinity)) {
           local_status = MTAPI_ERR_PARAMETER;
         }
 
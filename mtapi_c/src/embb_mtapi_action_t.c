@@ -27,6 +27,7 @@
 #include <assert.h>
 
 #include <embb/mtapi/c/mtapi.h>
+#include <embb/base/c/internal/bitset.h>
 #include <embb/base/c/duration.h>
 #include <embb/base/c/time.h>
 
@@ -154,7 +155,7 @@ mtapi_action_hndl_t mtapi_action_create(
         }
 
         /* check if affinity is sane */
-        if (0 == new_action->attributes.affinity) {
+        if (embb_bitset_is_empty(&new_action->attributes.affinity)) {
           local_status = MTAPI_ERR_PARAMETER;
         }
 
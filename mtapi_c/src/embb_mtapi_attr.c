@@ -38,7 +38,8 @@ mtapi_status_t embb_mtapi_attr_set_##TYPE(TYPE* target, \
     assert(MTAPI_NULL != attribute); \
     memcpy(target, attribute, sizeof(TYPE)); \
     return MTAPI_SUCCESS; \
-  } else if (MTAPI_ATTRIBUTE_POINTER_AS_VALUE == attribute_size) { \
+  } else if (MTAPI_ATTRIBUTE_POINTER_AS_VALUE == attribute_size && \
+    sizeof(TYPE) <= sizeof(attribute)) { \
     memcpy(target, &attribute, sizeof(TYPE)); \
     return MTAPI_SUCCESS; \
   } else { \
@@ -36,53 +36,71 @@ void embb_mtapi_id_pool_initialize(
   mtapi_uint_t ii;
 
   that->capacity = capacity;
-  that->id_buffer = (mtapi_uint_t*)
-    embb_mtapi_alloc_allocate(sizeof(mtapi_uint_t)*(capacity + 1));
-  that->id_buffer[0] = EMBB_MTAPI_IDPOOL_INVALID_ID;
-  for (ii = 1; ii <= capacity; ii++) {
-    that->id_buffer[ii] = ii;
+
+  /* reserve enough bits for the largest id, the rest is used as tag */
+  that->id_bits = 1;
+  while (that->id_bits < sizeof(uintptr_t) * 8 - 1 &&
+    ((uintptr_t)1 << that->id_bits) <= (uintptr_t)capacity) {
+    that->id_bits++;
+  }
+  that->id_mask = ((uintptr_t)1 << that->id_bits) - 1;
+
+  /* chain all ids 1..capacity, id 0 terminates the list */
+  that->next_id = (embb_atomic_unsigned_int*)
+    embb_mtapi_alloc_allocate(sizeof(embb_atomic_unsigned_int)*(capacity + 1));
+  that->in_use = (embb_atomic_int*)
+    embb_mtapi_alloc_allocate(sizeof(embb_atomic_int)*(capacity + 1));
+  embb_atomic_store_unsigned_int(&that->next_id[0],
+    EMBB_MTAPI_IDPOOL_INVALID_ID);
+  for (ii = 1; ii < capacity; ii++) {
+    embb_atomic_store_unsigned_int(&that->next_id[ii], ii + 1);
+  }
+  for (ii = 0; ii <= capacity; ii++) {
+    embb_atomic_store_int(&that->in_use[ii], 0);
+  }
+  if (0 < capacity) {
+    embb_atomic_store_unsigned_int(&that->next_id[capacity],
+      EMBB_MTAPI_IDPOOL_INVALID_ID);
+    embb_atomic_store_uintptr_t(&that->head, 1);
+  } else {
+    embb_atomic_store_uintptr_t(&that->head, EMBB_MTAPI_IDPOOL_INVALID_ID);
   }
-  that->ids_available = capacity;
-  that->put_id_position = 0;
-  that->get_id_position = 1;
-  embb_mtapi_spinlock_initialize(&that->lock);
 }
 
 void embb_mtapi_id_pool_finalize(embb_mtapi_id_pool_t * that) {
   that->capacity = 0;
-  that->ids_available = 0;
-  that->get_id_position = 0;
-  that->put_id_position = 0;
-  embb_mtapi_alloc_deallocate(that->id_buffer);
-  that->id_buffer = NULL;
-  embb_mtapi_spinlock_finalize(&that->lock);
+  that->id_bits = 0;
+  that->id_mask = 0;
+  embb_atomic_store_uintptr_t(&that->head, EMBB_MTAPI_IDPOOL_INVALID_ID);
+  embb_mtapi_alloc_deallocate(that->next_id);
+  that->next_id = NULL;
+  embb_mtapi_alloc_deallocate(that->in_use);
+  that->in_use = NULL;
 }
 
 mtapi_uint_t embb_mtapi_id_pool_allocate(embb_mtapi_id_pool_t * that) {
-  mtapi_uint_t id = EMBB_MTAPI_IDPOOL_INVALID_ID;
+  uintptr_t head;
+  uintptr_t new_head;
+  mtapi_uint_t id;
 
   assert(MTAPI_NULL != that);
 
-  if (embb_mtapi_spinlock_acquire(&that->lock)) {
-    if (0 < that->ids_available) {
-      /* take away one id */
-      that->ids_available--;
-
-      /* acquire position to fetch id from */
-      mtapi_uint_t id_position = that->get_id_position;
-      that->get_id_position++;
-      if (that->capacity < that->get_id_position) {
-        that->get_id_position = 0;
-      }
-
-      /* fetch id */
-      id = that->id_buffer[id_position];
-
-      /* make id entry invalid just in case */
-      that->id_buffer[id_position] = EMBB_MTAPI_IDPOOL_INVALID_ID;
+  head = embb_atomic_load_uintptr_t(&that->head);
+  do {
+    id = (mtapi_uint_t)(head & that->id_mask);
+    if (EMBB_MTAPI_IDPOOL_INVALID_ID == id) {
+      /* pool is exhausted */
+      return EMBB_MTAPI_IDPOOL_INVALID_ID;
     }
-    embb_mtapi_spinlock_release(&that->lock);
-  }
+    /* the link may be stale if id was taken concurrently, but then the tag
+       has changed as well and the compare-and-swap below fails */
+    new_head =
+      (head & ~that->id_mask) + ((uintptr_t)1 << that->id_bits);
+    new_head |= (uintptr_t)embb_atomic_load_unsigned_int(&that->next_id[id]);
+  } while (!embb_atomic_compare_and_swap_uintptr_t(
+    &that->head, &head, new_head));
+
+  embb_atomic_store_int(&that->in_use[id], 1);
 
   return id;
 }
@@ -90,26 +108,32 @@ mtapi_uint_t embb_mtapi_id_pool_allocate(embb_mtapi_id_pool_t * that) {
 void embb_mtapi_id_pool_deallocate(
   embb_mtapi_id_pool_t * that,
   mtapi_uint_t id) {
-  assert(MTAPI_NULL != that);
+  uintptr_t head;
+  uintptr_t new_head;
+  int in_use = 1;
 
-  if (embb_mtapi_spinlock_acquire(&that->lock)) {
-    if (that->capacity > that->ids_available) {
-      /* acquire position to put id to */
-      mtapi_uint_t id_position = that->put_id_position;
-      that->put_id_position++;
-      if (that->capacity < that->put_id_position) {
-        that->put_id_position = 0;
-      }
+  assert(MTAPI_NULL != that);
 
-      /* put id back into buffer */
-      that->id_buffer[id_position] = id;
+  if (EMBB_MTAPI_IDPOOL_INVALID_ID == id || that->capacity < id) {
+    embb_mtapi_log_error(
+      "invalid id passed to embb_mtapi_id_pool_deallocate\n");
+    return;
+  }
 
-      /* make it available */
-      that->ids_available++;
-    }
-    embb_mtapi_spinlock_release(&that->lock);
-  } else {
+  /* only one caller may return an allocated id, pushing it twice would
+     link it into the list twice and hand it out to two owners */
+  if (!embb_atomic_compare_and_swap_int(&that->in_use[id], &in_use, 0)) {
     embb_mtapi_log_error(
-      "could not acquire lock in embb_mtapi_IdPool_deallocate\n");
+      "id passed to embb_mtapi_id_pool_deallocate is not allocated\n");
+    return;
   }
+
+  head = embb_atomic_load_uintptr_t(&that->head);
+  do {
+    embb_atomic_store_unsigned_int(&that->next_id[id],
+      (unsigned int)(head & that->id_mask));
+    new_head =
+      ((head & ~that->id_mask) + ((uintptr_t)1 << that->id_bits)) | id;
+  } while (!embb_atomic_compare_and_swap_uintptr_t(
+    &that->head, &head, new_head));
 }
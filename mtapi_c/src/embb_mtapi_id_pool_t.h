@@ -30,8 +30,6 @@
 #include <embb/mtapi/c/mtapi.h>
 #include <embb/base/c/atomic.h>
 
-#include <embb_mtapi_spinlock_t.h>
-
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -43,15 +41,22 @@ extern "C" {
  * \internal
  * IdPool class.
  *
+ * Lock-free stack of free ids. The head word holds the id on top of the stack
+ * in its lower \c id_bits bits and a modification counter in the remaining
+ * bits, which protects the compare-and-swap against ABA problems. Each free id
+ * links to the next free id via \c next_id, 0 terminates the list. The
+ * \c in_use flag of an id is set while it is allocated, so that returning an
+ * id twice does not corrupt the list.
+ *
  * \ingroup INTERNAL
  */
 struct embb_mtapi_id_pool_struct {
   mtapi_uint_t capacity;
-  mtapi_uint_t *id_buffer;
-  mtapi_uint_t ids_available;
-  mtapi_uint_t get_id_position;
-  mtapi_uint_t put_id_position;
-  embb_mtapi_spinlock_t lock;
+  unsigned int id_bits;
+  uintptr_t id_mask;
+  embb_atomic_unsigned_int *next_id;
+  embb_atomic_int *in_use;
+  embb_atomic_uintptr_t head;
 };
 
 /**
@@ -83,7 +88,8 @@ void embb_mtapi_id_pool_finalize(embb_mtapi_id_pool_t * that);
 mtapi_uint_t embb_mtapi_id_pool_allocate(embb_mtapi_id_pool_t * that);
 
 /**
- * Dellocates a single item and puts its id back into the pool.
+ * Dellocates a single item and puts its id back into the pool. Ids that are
+ * invalid or not allocated are rejected with an error message.
  * \memberof embb_mtapi_id_pool_struct
  */
 void embb_mtapi_id_pool_deallocate(
@@ -26,9 +26,11 @@
 
 #include <assert.h>
 
+#include <embb/mtapi/c/mtapi_ext.h>
 #include <embb/base/c/base.h>
 
 #include <embb/base/c/internal/unused.h>
+#include <embb/base/c/internal/bitset.h>
 
 #include <embb_mtapi_scheduler_t.h>
 #include <embb_mtapi_log.h>
@@ -37,9 +39,11 @@
 #include <embb_mtapi_thread_context_t.h>
 #include <embb_mtapi_task_context_t.h>
 #include <embb_mtapi_task_t.h>
+#include <embb_mtapi_group_t.h>
 #include <embb_mtapi_action_t.h>
 #include <embb_mtapi_alloc.h>
 #include <embb_mtapi_queue_t.h>
+#include <mtapi_status_t.h>
 
 
 /* ---- CLASS MEMBERS ------------------------------------------------------ */
@@ -212,6 +216,19 @@ embb_mtapi_thread_context_t * embb_mtapi_scheduler_get_current_thread_context(
   return context;
 }
 
+/* nobody is going to wait for a completed detached task, so it may be
+   deleted; this is decided before execution, as a waiter may delete any other
+   task as soon as it has completed */
+static mtapi_boolean_t embb_mtapi_scheduler_is_detached_task(
+  embb_mtapi_node_t * node,
+  embb_mtapi_task_t * task) {
+  if (task->attributes.is_detached &&
+    !embb_mtapi_group_pool_is_handle_valid(node->group_pool, task->group)) {
+    return MTAPI_TRUE;
+  }
+  return MTAPI_FALSE;
+}
+
 void embb_mtapi_scheduler_execute_task_or_yield(
   embb_mtapi_scheduler_t * that,
   embb_mtapi_node_t * node,
@@ -225,9 +242,13 @@ void embb_mtapi_scheduler_execute_task_or_yield(
     /* if there was work, execute it */
     if (MTAPI_NULL != new_task) {
       embb_mtapi_task_context_t task_context;
+      mtapi_boolean_t is_detached =
+        embb_mtapi_scheduler_is_detached_task(node, new_task);
       embb_mtapi_task_context_initialize_with_thread_context_and_task(
         &task_context, thread_context, new_task);
-      embb_mtapi_task_execute(new_task, &task_context);
+      if (embb_mtapi_task_execute(new_task, &task_context) && is_detached) {
+        embb_mtapi_task_delete(new_task, node->task_pool);
+      }
     } else {
       embb_thread_yield();
     }
@@ -257,6 +278,7 @@ int embb_mtapi_scheduler_worker(void * arg) {
   embb_duration_t sleep_duration;
   int err;
   int counter = 0;
+  mtapi_boolean_t is_idle = MTAPI_FALSE;
 
   embb_mtapi_log_trace(
     "embb_mtapi_scheduler_worker() called for thread %d on core %d\n",
@@ -293,6 +315,19 @@ int embb_mtapi_scheduler_worker(void * arg) {
     /* check if there was work */
     if (MTAPI_NULL != task) {
       embb_mtapi_queue_t * local_queue = MTAPI_NULL;
+      mtapi_boolean_t task_done = MTAPI_FALSE;
+      mtapi_task_hndl_t task_handle = task->handle;
+      mtapi_task_complete_function_t complete_func =
+        task->attributes.complete_func;
+      mtapi_boolean_t is_detached =
+        embb_mtapi_scheduler_is_detached_task(node, task);
+
+      if (is_idle) {
+        embb_atomic_fetch_and_add_int(
+          &node->scheduler->idle_worker_count, -1);
+        embb_atomic_store_int(&thread_context->is_idle, 0);
+        is_idle = MTAPI_FALSE;
+      }
 
       /* is task associated with a queue? */
       if (embb_mtapi_queue_pool_is_handle_valid(
@@ -314,6 +349,7 @@ int embb_mtapi_scheduler_worker(void * arg) {
           if (MTAPI_NULL != local_queue) {
             embb_mtapi_queue_task_finished(local_queue);
           }
+          task_done = MTAPI_TRUE;
         }
         counter = 0;
         break;
@@ -330,12 +366,26 @@ int embb_mtapi_scheduler_worker(void * arg) {
       case MTAPI_TASK_CANCELLED:
         /* set return value to canceled */
         task->error_code = MTAPI_ERR_ACTION_CANCELLED;
+        /* the instance will not run, so it is no longer in flight for its
+           action, see embb_mtapi_scheduler_schedule_task() */
+        if (embb_mtapi_action_pool_is_handle_valid(
+          node->action_pool, task->action)) {
+          embb_mtapi_action_t* local_action =
+            embb_mtapi_action_pool_get_storage_for_handle(
+            node->action_pool, task->action);
+          embb_atomic_fetch_and_add_int(&local_action->num_tasks, -1);
+        }
         if (embb_atomic_fetch_and_add_unsigned_int(
-          &task->instances_todo, (unsigned int)-1) == 0) {
+          &task->instances_todo, (unsigned int)-1) == 1) {
           /* tell queue that a task is done */
           if (MTAPI_NULL != local_queue) {
             embb_mtapi_queue_task_finished(local_queue);
           }
+          /* the action did not run, but callback and group waiters still
+             need to learn about the task */
+          embb_mtapi_task_finish(
+            task, node, task_handle, complete_func, task->group);
+          task_done = MTAPI_TRUE;
         }
         break;
 
@@ -351,10 +401,14 @@ int embb_mtapi_scheduler_worker(void * arg) {
         break;
       }
 
-      /* issue task complete callback if set */
-      if (MTAPI_NULL != task->attributes.complete_func) {
-        task->attributes.complete_func(task->handle, MTAPI_NULL);
+      if (task_done && is_detached) {
+        embb_mtapi_task_delete(task, node->task_pool);
       }
+    } else if (!is_idle) {
+      /* announce demand for work, see mtapi_ext_get_idle_worker_count() */
+      embb_atomic_fetch_and_add_int(&node->scheduler->idle_worker_count, 1);
+      embb_atomic_store_int(&thread_context->is_idle, 1);
+      is_idle = MTAPI_TRUE;
     } else if (counter < 1024) {
       /* spin and yield for a while before going to sleep */
       embb_thread_yield();
@@ -372,6 +426,11 @@ int embb_mtapi_scheduler_worker(void * arg) {
     }
   }
 
+  if (is_idle) {
+    embb_atomic_fetch_and_add_int(&node->scheduler->idle_worker_count, -1);
+    embb_atomic_store_int(&thread_context->is_idle, 0);
+  }
+
   embb_tss_delete(&(thread_context->tss_id));
 
   return MTAPI_TRUE;
@@ -431,6 +490,7 @@ mtapi_boolean_t embb_mtapi_scheduler_initialize_with_mode(
   embb_mtapi_scheduler_mode_t mode) {
   embb_mtapi_node_t* node = embb_mtapi_node_get_instance();
   mtapi_uint_t ii = 0;
+  unsigned int core_num = 0;
 
   embb_mtapi_log_trace("embb_mtapi_scheduler_initialize() called\n");
 
@@ -438,6 +498,7 @@ mtapi_boolean_t embb_mtapi_scheduler_initialize_with_mode(
   assert(MTAPI_NULL != node);
 
   embb_atomic_store_int(&that->affine_task_counter, 0);
+  embb_atomic_store_int(&that->idle_worker_count, 0);
 
   /* Paranoia sanitizing of scheduler mode */
   if (mode >= NUM_SCHEDULER_MODES) {
@@ -452,19 +513,13 @@ mtapi_boolean_t embb_mtapi_scheduler_initialize_with_mode(
   that->worker_contexts = (embb_mtapi_thread_context_t*)
     embb_mtapi_alloc_allocate(
       sizeof(embb_mtapi_thread_context_t)*that->worker_count);
+  core_num = embb_core_set_find_next(&node->attributes.core_affinity, 0);
   for (ii = 0; ii < that->worker_count; ii++) {
-    unsigned int core_num = 0;
-    mtapi_uint_t ll = 0;
-    mtapi_boolean_t run = MTAPI_TRUE;
-    while (run) {
-      if (embb_core_set_contains(&node->attributes.core_affinity, core_num)) {
-        if (ll == ii) break;
-        ll++;
-      }
-      core_num++;
-    }
+    assert(core_num < EMBB_CORE_SET_MAX_CORES);
     embb_mtapi_thread_context_initialize_with_node_worker_and_core(
       &that->worker_contexts[ii], node, ii, core_num);
+    core_num = embb_core_set_find_next(
+      &node->attributes.core_affinity, core_num + 1);
   }
   for (ii = 0; ii < that->worker_count; ii++) {
     if (MTAPI_FALSE == embb_mtapi_thread_context_start(
@@ -556,8 +611,8 @@ mtapi_boolean_t embb_mtapi_scheduler_schedule_task(
       embb_mtapi_action_pool_get_storage_for_handle(
       node->action_pool, task->action);
 
-    mtapi_affinity_t affinity =
-      local_action->attributes.affinity & task->attributes.affinity;
+    mtapi_affinity_t affinity = local_action->attributes.affinity;
+    embb_bitset_intersect(&affinity, &task->attributes.affinity);
 
     /* check if task is running from an ordered queue */
     if (embb_mtapi_queue_pool_is_handle_valid(node->queue_pool, task->queue)) {
@@ -570,28 +625,28 @@ mtapi_boolean_t embb_mtapi_scheduler_schedule_task(
     }
 
     /* check affinity */
-    if (affinity == 0) {
+    if (embb_bitset_is_empty(&affinity)) {
       affinity = node->affinity_all;
     }
 
     /* one more task in flight for this action */
     embb_atomic_fetch_and_add_int(&local_action->num_tasks, 1);
 
-    if (affinity == node->affinity_all) {
+    if (embb_bitset_is_equal(&affinity, &node->affinity_all)) {
       /* no affinity restrictions, schedule for stealing */
       pushed = embb_mtapi_task_queue_push(
         scheduler->worker_contexts[ii].queue[task->attributes.priority],
         task);
     } else {
-      mtapi_status_t affinity_status;
-
       /* affinity is restricted, check and adapt scheduling target */
       ii = (mtapi_uint_t)embb_atomic_fetch_and_add_int(
-        &scheduler->affine_task_counter, 1);
-      while (MTAPI_FALSE == mtapi_affinity_get(
-        &affinity, ii, &affinity_status)) {
-        ii = (ii + 1) % scheduler->worker_count;
+        &scheduler->affine_task_counter, 1) % scheduler->worker_count;
+      ii = embb_bitset_find_next(&affinity, ii);
+      if (ii >= scheduler->worker_count) {
+        /* wrap around, affinity is not empty so there is a valid worker */
+        ii = embb_bitset_find_next(&affinity, 0);
       }
+      assert(ii < scheduler->worker_count);
       /* schedule into private queue to disable stealing */
       pushed = embb_mtapi_task_queue_push(
         scheduler->worker_contexts[ii].private_queue[task->attributes.priority],
@@ -612,3 +667,58 @@ mtapi_boolean_t embb_mtapi_scheduler_schedule_task(
 
   return pushed;
 }
+
+void mtapi_ext_yield(
+  MTAPI_OUT mtapi_status_t* status) {
+  mtapi_status_t local_status = MTAPI_ERR_UNKNOWN;
+
+  embb_mtapi_log_trace("mtapi_ext_yield() called\n");
+
+  if (embb_mtapi_node_is_initialized()) {
+    embb_mtapi_node_t* node = embb_mtapi_node_get_instance();
+    embb_mtapi_thread_context_t * context =
+      embb_mtapi_scheduler_get_current_thread_context(node->scheduler);
+    embb_mtapi_scheduler_execute_task_or_yield(
+      node->scheduler, node, context);
+    local_status = MTAPI_SUCCESS;
+  } else {
+    embb_mtapi_log_error("mtapi not initialized\n");
+    local_status = MTAPI_ERR_NODE_NOTINIT;
+  }
+
+  mtapi_status_set(status, local_status);
+}
+
+mtapi_uint_t mtapi_ext_get_idle_worker_count(
+  MTAPI_IN mtapi_affinity_t* affinity,
+  MTAPI_OUT mtapi_status_t* status) {
+  mtapi_status_t local_status = MTAPI_ERR_UNKNOWN;
+  mtapi_uint_t idle_worker_count = 0;
+
+  embb_mtapi_log_trace("mtapi_ext_get_idle_worker_count() called\n");
+
+  if (embb_mtapi_node_is_initialized()) {
+    embb_mtapi_node_t* node = embb_mtapi_node_get_instance();
+    embb_mtapi_scheduler_t* scheduler = node->scheduler;
+    if (MTAPI_NULL == affinity ||
+      embb_bitset_is_equal(affinity, &node->affinity_all)) {
+      int count = embb_atomic_load_int(&scheduler->idle_worker_count);
+      idle_worker_count = (0 < count) ? (mtapi_uint_t)count : 0;
+    } else {
+      mtapi_uint_t ii;
+      for (ii = 0; ii < scheduler->worker_count; ii++) {
+        if (embb_bitset_is_set(affinity, ii) &&
+          embb_atomic_load_int(&scheduler->worker_contexts[ii].is_idle)) {
+          idle_worker_count++;
+        }
+      }
+    }
+    local_status = MTAPI_SUCCESS;
+  } else {
+    embb_mtapi_log_error("mtapi not initialized\n");
+    local_status = MTAPI_ERR_NODE_NOTINIT;
+  }
+
+  mtapi_status_set(status, local_status);
+  return idle_worker_count;
+}
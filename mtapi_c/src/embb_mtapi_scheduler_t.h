@@ -85,6 +85,9 @@ struct embb_mtapi_scheduler_struct {
   embb_mtapi_scheduler_mode_t mode;
 
   embb_atomic_int affine_task_counter;
+
+  /* number of workers currently not executing a task */
+  embb_atomic_int idle_worker_count;
 };
 
 #include <embb_mtapi_scheduler_t_fwd.h>
@@ -25,6 +25,7 @@
  */
 
 #include <assert.h>
+#include <string.h>
 
 #include <embb/mtapi/c/mtapi.h>
 
@@ -99,6 +100,10 @@ mtapi_boolean_t embb_mtapi_task_execute(
   embb_mtapi_task_t* that,
   embb_mtapi_task_context_t * context) {
   unsigned int todo = that->attributes.num_instances;
+  mtapi_task_hndl_t task_handle = that->handle;
+  mtapi_task_complete_function_t complete_func =
+    that->attributes.complete_func;
+  mtapi_group_hndl_t group = that->group;
 
   assert(MTAPI_NULL != that);
   assert(MTAPI_NULL != context);
@@ -139,20 +144,36 @@ mtapi_boolean_t embb_mtapi_task_execute(
   }
 
   if (todo == 1) {
-    /* is task associated with a group? */
-    if (embb_mtapi_group_pool_is_handle_valid(
-      context->thread_context->node->group_pool, that->group)) {
-      embb_mtapi_group_t* local_group =
-        embb_mtapi_group_pool_get_storage_for_handle(
-        context->thread_context->node->group_pool, that->group);
-      embb_mtapi_task_queue_push(&local_group->queue, that);
-    }
+    embb_mtapi_task_finish(that, context->thread_context->node,
+      task_handle, complete_func, group);
     return MTAPI_TRUE;
   } else {
     return MTAPI_FALSE;
   }
 }
 
+void embb_mtapi_task_finish(
+  embb_mtapi_task_t* that,
+  embb_mtapi_node_t* node,
+  mtapi_task_hndl_t task_handle,
+  mtapi_task_complete_function_t complete_func,
+  mtapi_group_hndl_t group) {
+  assert(MTAPI_NULL != that);
+  assert(MTAPI_NULL != node);
+
+  /* issue task complete callback if set */
+  if (MTAPI_NULL != complete_func) {
+    complete_func(task_handle, MTAPI_NULL);
+  }
+
+  /* is task associated with a group? */
+  if (embb_mtapi_group_pool_is_handle_valid(node->group_pool, group)) {
+    embb_mtapi_group_t* local_group =
+      embb_mtapi_group_pool_get_storage_for_handle(node->group_pool, group);
+    embb_mtapi_task_queue_push(&local_group->queue, that);
+  }
+}
+
 void embb_mtapi_task_set_state(
   embb_mtapi_task_t* that,
   mtapi_task_state_t state) {
@@ -262,6 +283,10 @@ static mtapi_task_hndl_t embb_mtapi_task_start(
         if (MTAPI_SUCCESS == local_status) {
           embb_mtapi_scheduler_t * scheduler = node->scheduler;
           mtapi_boolean_t was_scheduled;
+          /* a detached task may be deleted as soon as it was scheduled,
+             so keep what is needed afterwards */
+          mtapi_boolean_t is_detached = task->attributes.is_detached;
+          mtapi_uint_t num_instances = task->attributes.num_instances;
           embb_mtapi_action_t * local_action =
             embb_mtapi_action_pool_get_storage_for_handle(
               node->action_pool, task->action);
@@ -279,8 +304,7 @@ static mtapi_task_hndl_t embb_mtapi_task_start(
             /* schedule local task */
             was_scheduled = MTAPI_TRUE;
 
-            for (mtapi_uint_t kk = 0; kk < task->attributes.num_instances;
-              kk++) {
+            for (mtapi_uint_t kk = 0; kk < num_instances; kk++) {
               was_scheduled = (mtapi_boolean_t)(was_scheduled &
                 embb_mtapi_scheduler_schedule_task(scheduler, task, kk));
             }
@@ -289,7 +313,7 @@ static mtapi_task_hndl_t embb_mtapi_task_start(
           if (was_scheduled) {
             /* if task is detached, do not return a handle, it will be deleted
             on completion */
-            if (task->attributes.is_detached) {
+            if (is_detached) {
               task_hndl.id = EMBB_MTAPI_IDPOOL_INVALID_ID;
             }
 
@@ -439,6 +463,16 @@ void mtapi_task_get_attribute(
             &local_task->attributes.priority, attribute, attribute_size);
           break;
 
+        case MTAPI_TASK_USER_DATA:
+          if (sizeof(void*) == attribute_size) {
+            memcpy(attribute, &local_task->attributes.user_data,
+              sizeof(void*));
+            local_status = MTAPI_SUCCESS;
+          } else {
+            local_status = MTAPI_ERR_ATTR_SIZE;
+          }
+          break;
+
         default:
           local_status = MTAPI_ERR_ATTR_NUM;
           break;
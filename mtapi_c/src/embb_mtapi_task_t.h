@@ -41,6 +41,7 @@ extern "C" {
 /* ---- FORWARD DECLARATIONS ----------------------------------------------- */
 
 #include <embb_mtapi_task_context_t_fwd.h>
+#include <embb_mtapi_node_t_fwd.h>
 
 
 /* ---- CLASS DECLARATION -------------------------------------------------- */
@@ -102,15 +103,31 @@ void embb_mtapi_task_initialize(embb_mtapi_task_t* that);
 void embb_mtapi_task_finalize(embb_mtapi_task_t* that);
 
 /**
- * Execute the action function of a task within the given context. Notfies
- * the associated task group or queue if set. Deletes the task if it is
- * detached.
+ * Execute the action function of a task within the given context. Finishes
+ * the task using embb_mtapi_task_finish() once all instances are done.
+ * Returns MTAPI_TRUE if the task has completed, detached tasks are then
+ * deleted by the scheduler.
  * \memberof embb_mtapi_task_struct
  */
 mtapi_boolean_t embb_mtapi_task_execute(
   embb_mtapi_task_t* that,
   embb_mtapi_task_context_t * context);
 
+/**
+ * Issues the complete callback of a completed or cancelled task and notifies
+ * the associated task group if set. The callback comes first, as waiters of
+ * the group may delete the task as soon as it is handed to the group. Handle,
+ * callback and group are read before the task completes, as waiters of
+ * tasks without a group may delete them right after that.
+ * \memberof embb_mtapi_task_struct
+ */
+void embb_mtapi_task_finish(
+  embb_mtapi_task_t* that,
+  embb_mtapi_node_t* node,
+  mtapi_task_hndl_t task_handle,
+  mtapi_task_complete_function_t complete_func,
+  mtapi_group_hndl_t group);
+
 /**
  * Set the current task state.
  * \memberof embb_mtapi_task_struct
@@ -38,6 +38,9 @@ IdPoolTest::IdPoolTest() {
     , 20).
     Post(&IdPoolTest::TestParallelPost, this).
     Pre(&IdPoolTest::TestParallelPre, this);
+
+  CreateUnit("mtapi id pool test double free").
+    Add(&IdPoolTest::TestDoubleFree, this);
 }
 
 void IdPoolTest::TestParallel() {
@@ -78,6 +81,22 @@ void IdPoolTest::TestBasicPost() {
   embb_mtapi_id_pool_finalize(&id_pool);
 }
 
+void IdPoolTest::TestDoubleFree() {
+  embb_mtapi_id_pool_t pool;
+  embb_mtapi_id_pool_initialize(&pool, id_pool_size_1);
+
+  mtapi_uint_t id = embb_mtapi_id_pool_allocate(&pool);
+  PT_ASSERT(id != EMBB_MTAPI_IDPOOL_INVALID_ID);
+  embb_mtapi_id_pool_deallocate(&pool, id);
+  // the second deallocation has to be rejected
+  embb_mtapi_id_pool_deallocate(&pool, id);
+
+  // the pool must still contain every id exactly once
+  TestAllocateDeallocateNElementsFromPool(pool, id_pool_size_1, true);
+
+  embb_mtapi_id_pool_finalize(&pool);
+}
+
 void IdPoolTest::TestAllocateDeallocateNElementsFromPool(
   embb_mtapi_id_pool_t &pool,
   int count_elements,
@@ -69,6 +69,12 @@ class IdPoolTest : public partest::TestCase {
   void TestBasicPre();
   void TestBasicPost();
 
+  /**
+   * Return an id twice and check that the pool still hands out each id
+   * only once.
+   */
+  void TestDoubleFree();
+
   static void TestAllocateDeallocateNElementsFromPool(
     embb_mtapi_id_pool_t &pool,
     int count_elements,
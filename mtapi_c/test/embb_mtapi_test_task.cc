@@ -30,10 +30,13 @@
 #include <embb_mtapi_test_task.h>
 
 #include <embb/base/c/memory_allocation.h>
+#include <embb/base/c/atomic.h>
+#include <embb/base/c/thread.h>
 #include <embb/base/c/internal/unused.h>
 
 #define JOB_TEST_TASK 42
 #define JOB_TEST_MULTIINSTANCE_TASK 43
+#define JOB_TEST_DETACHED_TASK 44
 #define TASK_TEST_ID 23
 
 static void testTaskAction(
@@ -90,6 +93,17 @@ void testMultiInstanceTaskAction(
   result[this_instance] = this_instance;
 }
 
+static void testDetachedTaskAction(
+  const void* args,
+  mtapi_size_t /*arg_size*/,
+  void* /*result_buffer*/,
+  mtapi_size_t /*result_buffer_size*/,
+  const void* /*node_local_data*/,
+  mtapi_size_t /*node_local_data_size*/,
+  mtapi_task_context_t* /*task_context*/) {
+  embb_atomic_fetch_and_add_int(
+    reinterpret_cast<embb_atomic_int*>(const_cast<void*>(args)), 1);
+}
 
 static void testDoSomethingElse() {
 }
@@ -253,6 +267,62 @@ void TaskTest::TestBasic() {
   mtapi_action_delete(multiinstance_action, 10, &status);
   MTAPI_CHECK_STATUS(status);
 
+  /* detached tasks release their resources on completion, so more of them
+     than the maximum number of tasks can be started one after the other */
+  status = MTAPI_ERR_UNKNOWN;
+  mtapi_action_hndl_t detached_action = mtapi_action_create(
+    JOB_TEST_DETACHED_TASK,
+    testDetachedTaskAction,
+    MTAPI_NULL,
+    0,
+    &action_attr,
+    &status);
+  MTAPI_CHECK_STATUS(status);
+
+  status = MTAPI_ERR_UNKNOWN;
+  mtapi_job_hndl_t detached_job = mtapi_job_get(
+    JOB_TEST_DETACHED_TASK, THIS_DOMAIN_ID, &status);
+  MTAPI_CHECK_STATUS(status);
+
+  status = MTAPI_ERR_UNKNOWN;
+  mtapi_taskattr_init(&task_attr, &status);
+  MTAPI_CHECK_STATUS(status);
+
+  const mtapi_boolean_t kDetached = MTAPI_TRUE;
+  status = MTAPI_ERR_UNKNOWN;
+  mtapi_taskattr_set(&task_attr, MTAPI_TASK_DETACHED,
+    &kDetached, sizeof(mtapi_boolean_t),
+    &status);
+  MTAPI_CHECK_STATUS(status);
+
+  const int kDetachedTasks = 2 * MTAPI_NODE_MAX_TASKS_DEFAULT;
+  embb_atomic_int detached_counter;
+  embb_atomic_store_int(&detached_counter, 0);
+  for (ii = 0; ii < kDetachedTasks; ii++) {
+    mtapi_task_hndl_t detached_task;
+    do {
+      status = MTAPI_ERR_UNKNOWN;
+      detached_task = mtapi_task_start(MTAPI_TASK_ID_NONE, detached_job,
+        &detached_counter, sizeof(detached_counter),
+        MTAPI_NULL, 0,
+        &task_attr,
+        MTAPI_GROUP_NONE,
+        &status);
+      if (MTAPI_ERR_TASK_LIMIT == status) {
+        embb_thread_yield();
+      }
+    } while (MTAPI_ERR_TASK_LIMIT == status);
+    MTAPI_CHECK_STATUS(status);
+    EMBB_UNUSED(detached_task);
+  }
+  while (embb_atomic_load_int(&detached_counter) < kDetachedTasks) {
+    embb_thread_yield();
+  }
+
+  status = MTAPI_ERR_UNKNOWN;
+  mtapi_action_delete(detached_action, MTAPI_INFINITE, &status);
+  MTAPI_CHECK_STATUS(status);
+
   status = MTAPI_ERR_UNKNOWN;
   mtapi_finalize(&status);
   MTAPI_CHECK_STATUS(status);
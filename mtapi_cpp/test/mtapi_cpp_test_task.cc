@@ -84,13 +84,18 @@ void TaskTest::TestBasic() {
 
   {
     embb::mtapi::Affinity affinity(false);
-    PT_EXPECT_EQ(affinity.GetInternal(), 0u);
+    mtapi_affinity_t internal = affinity.GetInternal();
+    PT_EXPECT_EQ(embb_bitset_count(&internal), 0u);
     affinity.Set(0u, true);
-    PT_EXPECT_EQ(affinity.GetInternal(), 1u);
+    internal = affinity.GetInternal();
+    PT_EXPECT_EQ(embb_bitset_count(&internal), 1u);
     affinity.Set(1u, true);
-    PT_EXPECT_EQ(affinity.GetInternal(), 3u);
+    internal = affinity.GetInternal();
+    PT_EXPECT_EQ(embb_bitset_count(&internal), 2u);
     affinity.Set(0u, false);
-    PT_EXPECT_EQ(affinity.GetInternal(), 2u);
+    internal = affinity.GetInternal();
+    PT_EXPECT_EQ(embb_bitset_count(&internal), 1u);
+    PT_EXPECT_EQ(embb_bitset_find_next(&internal, 0), 1u);
     PT_EXPECT_EQ(affinity.Get(0), false);
     PT_EXPECT_EQ(affinity.Get(1), true);
   }
@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2014-2015, Siemens AG. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <vector>
+
+#include <tasks_cpp_test_config.h>
+#include <tasks_cpp_test_coroutine.h>
+
+#include <embb/base/atomic.h>
+#include <embb/base/thread.h>
+#include <embb/base/c/memory_allocation.h>
+#include <embb/tasks/coroutine.h>
+
+namespace {
+
+using embb::tasks::Action;
+using embb::tasks::Coroutine;
+using embb::tasks::TaskContext;
+
+Coroutine<int> SumOfSquares(int count) {
+  int sum = 0;
+  for (int ii = 0; ii < count; ii++) {
+    int square = 0;
+    mtapi_status_t status = co_await embb::tasks::Spawn(
+      Action([&square, ii](TaskContext &) { square = ii * ii; }));
+    if (MTAPI_SUCCESS != status) {
+      co_return -1;
+    }
+    sum += square;
+  }
+  co_return sum;
+}
+
+Coroutine<int> AddNested(int count) {
+  int first = co_await SumOfSquares(count);
+  int second = co_await SumOfSquares(count);
+  co_return first + second;
+}
+
+Coroutine<int> Increment(embb::tasks::Future<int> future) {
+  int value = co_await future;
+  co_return value + 1;
+}
+
+Coroutine<int> IncrementOrFail(embb::tasks::Future<int> future) {
+  int value = 0;
+  try {
+    value = co_await future;
+  }
+  catch (embb::base::ErrorException &) {
+    co_return -1;
+  }
+  co_return value + 1;
+}
+
+Coroutine<bool> Enqueue(embb::tasks::Queue & queue, int count) {
+  std::vector<int> order;
+  for (int ii = 0; ii < count; ii++) {
+    mtapi_status_t status = co_await embb::tasks::Spawn(queue,
+      Action([&order, ii](TaskContext &) { order.push_back(ii); }));
+    if (MTAPI_SUCCESS != status) {
+      co_return false;
+    }
+  }
+  for (int ii = 0; ii < count; ii++) {
+    if (order[static_cast<size_t>(ii)] != ii) {
+      co_return false;
+    }
+  }
+  co_return true;
+}
+
+Coroutine<unsigned int> AwaitGroup(
+  embb::tasks::Group & group,
+  embb::base::Atomic<unsigned int> & counter,
+  unsigned int count) {
+  for (unsigned int ii = 0; ii < count; ii++) {
+    group.Spawn(Action([&counter](TaskContext &) { ++counter; }));
+  }
+  mtapi_status_t status = co_await embb::tasks::WaitAll(group);
+  if (MTAPI_SUCCESS != status) {
+    co_return 0;
+  }
+  // the Group is empty now, so this does not suspend
+  status = co_await embb::tasks::WaitAll(group);
+  if (MTAPI_SUCCESS != status) {
+    co_return 0;
+  }
+  co_return counter.Load();
+}
+
+Coroutine<mtapi_status_t> AwaitGroupStatus(embb::tasks::Group & group) {
+  mtapi_status_t status = co_await embb::tasks::WaitAll(group);
+  co_return status;
+}
+
+} // namespace
+
+CoroutineTest::CoroutineTest() {
+  CreateUnit("tasks_cpp coroutine test").Add(&CoroutineTest::TestBasic, this);
+}
+
+void CoroutineTest::TestBasic() {
+  embb::tasks::Node::Initialize(THIS_DOMAIN_ID, THIS_NODE_ID);
+
+  embb::tasks::Node & node = embb::tasks::Node::GetInstance();
+
+  {
+    // many more suspended coroutines than worker threads
+    std::vector<embb::tasks::Future<int> > results;
+    for (int ii = 0; ii < 200; ii++) {
+      results.push_back(SumOfSquares(10).GetFuture());
+    }
+    for (size_t ii = 0; ii < results.size(); ii++) {
+      PT_EXPECT_EQ(results[ii].Get(), 285);
+    }
+  }
+
+  {
+    embb::tasks::Future<int> result = AddNested(10).GetFuture();
+    PT_EXPECT_EQ(result.Get(), 570);
+  }
+
+  {
+    embb::tasks::Promise<int> promise;
+    std::vector<embb::tasks::Future<int> > results;
+    for (int ii = 0; ii < 100; ii++) {
+      results.push_back(Increment(promise.GetFuture()).GetFuture());
+    }
+    PT_EXPECT(!results[0].IsReady());
+    promise.SetValue(41);
+    for (size_t ii = 0; ii < results.size(); ii++) {
+      PT_EXPECT_EQ(results[ii].Get(), 42);
+    }
+  }
+
+  {
+    // a broken promise resumes the coroutine with an exception
+    embb::tasks::Future<int> result;
+    {
+      embb::tasks::Promise<int> promise;
+      result = IncrementOrFail(promise.GetFuture()).GetFuture();
+    }
+    PT_EXPECT_EQ(result.Get(), -1);
+  }
+
+  {
+    embb::tasks::Queue & queue = node.CreateQueue(0, true);
+    embb::tasks::Future<bool> result = Enqueue(queue, 100).GetFuture();
+    PT_EXPECT(result.Get());
+    node.DestroyQueue(queue);
+  }
+
+  {
+    std::vector<embb::tasks::Group*> groups;
+    std::vector<embb::base::Atomic<unsigned int>*> counters;
+    std::vector<embb::tasks::Future<unsigned int> > results;
+    for (int ii = 0; ii < 10; ii++) {
+      groups.push_back(&node.CreateGroup());
+      counters.push_back(new embb::base::Atomic<unsigned int>(0));
+      results.push_back(
+        AwaitGroup(*groups.back(), *counters.back(), 50).GetFuture());
+    }
+    for (size_t ii = 0; ii < results.size(); ii++) {
+      PT_EXPECT_EQ(results[ii].Get(), 50u);
+      node.DestroyGroup(*groups[ii]);
+      delete counters[ii];
+    }
+  }
+
+  {
+    // a Task cancelled before it ran still counts as finished for the Group
+    embb::tasks::Group & group = node.CreateGroup();
+    embb::base::Atomic<bool> started(false);
+    embb::base::Atomic<bool> go(false);
+    embb::base::Atomic<int> counter(0);
+    embb::tasks::ExecutionPolicy first_worker(false);
+    first_worker.AddWorker(0u);
+    group.Spawn(Action([&started, &go](TaskContext &) {
+      started = true;
+      while (!go) {
+        embb::base::Thread::CurrentYield();
+      }
+    }, first_worker));
+    while (!started) {
+      embb::base::Thread::CurrentYield();
+    }
+    // the only worker allowed to run this Task is busy until go is set
+    embb::tasks::Task cancelled = group.Spawn(
+      Action([&counter](TaskContext &) { ++counter; }, first_worker));
+    cancelled.Cancel();
+    embb::tasks::Future<mtapi_status_t> result =
+      AwaitGroupStatus(group).GetFuture();
+    go = true;
+    PT_EXPECT_EQ(result.Get(), MTAPI_ERR_ACTION_CANCELLED);
+    PT_EXPECT_EQ(counter.Load(), 0);
+    node.DestroyGroup(group);
+  }
+
+  embb::tasks::Node::Finalize();
+
+  PT_EXPECT_EQ(embb_get_bytes_allocated(), 0u);
+}
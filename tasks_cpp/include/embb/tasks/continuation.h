@@ -27,6 +27,8 @@
 #ifndef EMBB_TASKS_CONTINUATION_H_
 #define EMBB_TASKS_CONTINUATION_H_
 
+#include <vector>
+
 #include <embb/mtapi/c/mtapi.h>
 #include <embb/tasks/task_context.h>
 #include <embb/tasks/action.h>
@@ -43,9 +45,12 @@ namespace tasks {
 struct ContinuationStage;
 
 /**
- * A Continuation encapsulates a chain of \link Action Actions \endlink to be
+ * A Continuation encapsulates a graph of \link Action Actions \endlink to be
  * executed consecutively.
  *
+ * Each stage of the graph is started as soon as all of its predecessors have
+ * finished. No thread is blocked while waiting for predecessors.
+ *
  * \ingroup CPP_TASKS
  */
 class Continuation {
@@ -63,7 +68,8 @@ class Continuation {
   ~Continuation();
 
   /**
-   * Appends an Action to the Continuation chain.
+   * Appends an Action to the Continuation chain. The Action is started when
+   * all previously appended Actions have finished.
    * \returns A reference to this Continuation chain.
    * \notthreadsafe
    */
@@ -72,6 +78,54 @@ class Continuation {
                                             continuation */
     );
 
+  /**
+   * Appends two Actions to the Continuation chain. Both Actions are started
+   * in parallel when all previously appended Actions have finished.
+   * \returns A reference to this Continuation chain.
+   * \notthreadsafe
+   */
+  Continuation & Then(
+    Action action1,                    /**< [in] First Action to append */
+    Action action2                     /**< [in] Second Action to append */
+    );
+
+  /**
+   * Appends three Actions to the Continuation chain. All Actions are started
+   * in parallel when all previously appended Actions have finished.
+   * \returns A reference to this Continuation chain.
+   * \notthreadsafe
+   */
+  Continuation & Then(
+    Action action1,                    /**< [in] First Action to append */
+    Action action2,                    /**< [in] Second Action to append */
+    Action action3                     /**< [in] Third Action to append */
+    );
+
+  /**
+   * Appends four Actions to the Continuation chain. All Actions are started
+   * in parallel when all previously appended Actions have finished.
+   * \returns A reference to this Continuation chain.
+   * \notthreadsafe
+   */
+  Continuation & Then(
+    Action action1,                    /**< [in] First Action to append */
+    Action action2,                    /**< [in] Second Action to append */
+    Action action3,                    /**< [in] Third Action to append */
+    Action action4                     /**< [in] Fourth Action to append */
+    );
+
+  /**
+   * Merges another Continuation into this one. Both run in parallel when the
+   * Continuation is spawned, and the next appended Action is started when
+   * the last Actions of both have finished. The other Continuation must not
+   * be used afterwards.
+   * \returns A reference to this Continuation chain.
+   * \notthreadsafe
+   */
+  Continuation & WhenAll(
+    Continuation const & other         /**< [in] The Continuation to join */
+    );
+
   /**
    * Runs the Continuation chain.
    * \returns The Task representing the Continuation chain.
@@ -80,7 +134,8 @@ class Continuation {
   Task Spawn();
 
   /**
-   * Runs the Continuation chain with the specified execution_policy.
+   * Runs the Continuation chain, executing all Actions with the specified
+   * execution_policy.
    * \returns The Task representing the Continuation chain.
    * \notthreadsafe
    */
@@ -93,10 +148,11 @@ class Continuation {
  private:
   explicit Continuation(Action action);
 
-  void ExecuteContinuation(TaskContext & context);
+  Task SpawnStages(ExecutionPolicy const * execution_policy);
+  void Append(std::vector<Action> & actions);
 
-  ContinuationStage * first_;
-  ContinuationStage * last_;
+  std::vector<ContinuationStage*> stages_;
+  std::vector<ContinuationStage*> last_;
 };
 
 } // namespace tasks
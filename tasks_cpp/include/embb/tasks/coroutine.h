@@ -0,0 +1,347 @@
+/*
+ * Copyright (c) 2014-2015, Siemens AG. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef EMBB_TASKS_COROUTINE_H_
+#define EMBB_TASKS_COROUTINE_H_
+
+#include <embb/tasks/tasks.h>
+
+/**
+ * \defgroup CPP_TASKS_COROUTINE Coroutines
+ * Awaitable adapters for Actions, Queues, Groups and Futures and a coroutine
+ * type resumed by the scheduler. Only available if the compiler supports
+ * C++20 coroutines, which is indicated by \c EMBB_TASKS_HAS_COROUTINES.
+ * \ingroup CPP_TASKS
+ */
+
+#if defined(__cpp_impl_coroutine) && (__cpp_impl_coroutine >= 201902L)
+
+#define EMBB_TASKS_HAS_COROUTINES 1
+
+#include <coroutine>
+#include <exception>
+
+#include <embb/tasks/internal/task_observer.h>
+
+namespace embb {
+namespace tasks {
+namespace internal {
+
+/**
+ * Resumes a suspended coroutine when called on a worker thread.
+ */
+class CoroutineResumer {
+ public:
+  explicit CoroutineResumer(std::coroutine_handle<> handle)
+    : handle_(handle) {
+  }
+
+  bool operator()() {
+    handle_.resume();
+    return true;
+  }
+
+ private:
+  std::coroutine_handle<> handle_;
+};
+
+/**
+ * Suspends the coroutine and resumes it on a worker thread.
+ */
+class ScheduleAwaiter {
+ public:
+  bool await_ready() const noexcept {
+    return false;
+  }
+
+  void await_suspend(std::coroutine_handle<> handle) {
+    Node::GetInstance().Spawn(
+      embb::base::Function<bool>(CoroutineResumer(handle)));
+  }
+
+  void await_resume() const noexcept {
+  }
+};
+
+/**
+ * Dependent of a Future state that resumes a coroutine on a worker thread
+ * when the Future becomes ready, whether it has a result or not.
+ */
+class CoroutineResumeState : public FutureStateBase {
+ public:
+  explicit CoroutineResumeState(std::coroutine_handle<> handle)
+    : handle_(handle) {
+  }
+
+ protected:
+  virtual void Notify() {
+    Node::GetInstance().Spawn(
+      embb::base::Function<bool>(CoroutineResumer(handle_)));
+  }
+
+ private:
+  std::coroutine_handle<> handle_;
+};
+
+/**
+ * Awaits a Future without blocking a thread. The coroutine is resumed by a
+ * task started when the Future becomes ready. If the Future has no result,
+ * resuming the coroutine throws, see Future::Get().
+ */
+template <typename T>
+class FutureAwaiter {
+ public:
+  explicit FutureAwaiter(Future<T> const & future)
+    : future_(future) {
+  }
+
+  bool await_ready() const {
+    return future_.IsReady();
+  }
+
+  void await_suspend(std::coroutine_handle<> handle) {
+    // the coroutine may be resumed and this awaiter destroyed before
+    // AddDependent() returns, so keep the source alive until then
+    FutureState<T> * source = future_.state_;
+    CoroutineResumeState * resume_state =
+      embb::base::Allocation::New<CoroutineResumeState>(handle);
+    source->AddReference();
+    source->AddDependent(resume_state);
+    source->Release();
+    resume_state->Release();
+  }
+
+  T const & await_resume() {
+    return future_.Get();
+  }
+
+ private:
+  Future<T> future_;
+};
+
+/**
+ * Runs an Action and resumes the coroutine on the worker thread that
+ * finished it, from the completion callback of its task.
+ */
+class SpawnAwaiter : public TaskObserver {
+ public:
+  SpawnAwaiter(Action action, Queue * queue)
+    : action_(action)
+    , queue_(queue) {
+  }
+
+  bool await_ready() const noexcept {
+    return false;
+  }
+
+  void await_suspend(std::coroutine_handle<> handle) {
+    coroutine_ = handle;
+    Start(action_, queue_);
+  }
+
+  mtapi_status_t await_resume() {
+    return GetStatus();
+  }
+
+ protected:
+  virtual void Notify() {
+    coroutine_.resume();
+  }
+
+ private:
+  Action action_;
+  Queue * queue_;
+  std::coroutine_handle<> coroutine_;
+};
+
+/**
+ * Awaits all Tasks of a Group and resumes the coroutine on a worker thread
+ * after the last of them has finished.
+ */
+class GroupAwaiter : public TaskObserver {
+ public:
+  explicit GroupAwaiter(Group & group)
+    : group_(group) {
+  }
+
+  bool await_ready() const noexcept {
+    return false;
+  }
+
+  bool await_suspend(std::coroutine_handle<> handle) {
+    coroutine_ = handle;
+    return Observe(group_);
+  }
+
+  mtapi_status_t await_resume() {
+    // all Tasks have finished, this collects their status
+    return group_.WaitAll(MTAPI_INFINITE);
+  }
+
+ protected:
+  virtual void Notify() {
+    coroutine_.resume();
+  }
+
+ private:
+  Group & group_;
+  std::coroutine_handle<> coroutine_;
+};
+
+} // namespace internal
+
+/**
+ * Return type of coroutines executed by the worker threads of the Node.
+ *
+ * The coroutine starts on a worker thread and is resumed on a worker thread
+ * whenever an awaited Future, Action or Group completes, no thread blocks
+ * in the meantime. Its result is provided by a Future.
+ *
+ * \tparam T Result type of the coroutine, must not be \c void
+ * \ingroup CPP_TASKS_COROUTINE
+ */
+template <typename T>
+class Coroutine {
+ public:
+  /**
+    * Coroutine promise used by the compiler.
+    */
+  class promise_type {
+   public:
+    Coroutine get_return_object() {
+      return Coroutine(promise_.GetFuture());
+    }
+
+    internal::ScheduleAwaiter initial_suspend() noexcept {
+      return internal::ScheduleAwaiter();
+    }
+
+    std::suspend_never final_suspend() noexcept {
+      return std::suspend_never();
+    }
+
+    void return_value(T const & value) {
+      promise_.SetValue(value);
+    }
+
+    void unhandled_exception() {
+      std::terminate();
+    }
+
+   private:
+    Promise<T> promise_;
+  };
+
+  /**
+    * Returns a Future for the result of the coroutine.
+    * \return The Future of the result
+    * \waitfree
+    */
+  Future<T> GetFuture() const {
+    return future_;
+  }
+
+ private:
+  explicit Coroutine(Future<T> const & future)
+    : future_(future) {
+  }
+
+  Future<T> future_;
+};
+
+/**
+ * Awaits the result of a Future.
+ * \return An awaitable yielding a reference to the result
+ * \ingroup CPP_TASKS_COROUTINE
+ */
+template <typename T>
+internal::FutureAwaiter<T> operator co_await(
+  Future<T> const & future             /**< [in] The Future to await */
+  ) {
+  return internal::FutureAwaiter<T>(future);
+}
+
+/**
+ * Awaits the result of another coroutine.
+ * \return An awaitable yielding a reference to the result
+ * \ingroup CPP_TASKS_COROUTINE
+ */
+template <typename T>
+internal::FutureAwaiter<T> operator co_await(
+  Coroutine<T> const & coroutine       /**< [in] The coroutine to await */
+  ) {
+  return internal::FutureAwaiter<T>(coroutine.GetFuture());
+}
+
+/**
+ * Runs an Action as a Task when awaited and resumes the coroutine when the
+ * Task has finished. Tasks returned by Node::Spawn() cannot be awaited, as
+ * MTAPI only reports the completion of tasks started with a callback.
+ * \return An awaitable yielding the status of the Task
+ * \throws ErrorException if the Task could not be started.
+ * \ingroup CPP_TASKS_COROUTINE
+ */
+inline internal::SpawnAwaiter Spawn(
+  Action action                        /**< [in] The Action to run */
+  ) {
+  return internal::SpawnAwaiter(action, NULL);
+}
+
+/**
+ * Runs an Action in a Queue when awaited, see Queue::Spawn(), and resumes the
+ * coroutine when the Task has finished.
+ * \return An awaitable yielding the status of the Task
+ * \throws ErrorException if the Task could not be started.
+ * \ingroup CPP_TASKS_COROUTINE
+ */
+inline internal::SpawnAwaiter Spawn(
+  Queue & queue,                       /**< [in] The Queue to run the Action
+                                            in */
+  Action action                        /**< [in] The Action to run */
+  ) {
+  return internal::SpawnAwaiter(action, &queue);
+}
+
+/**
+ * Awaits all \link Task Tasks \endlink of a Group, see Group::WaitAll(). The
+ * coroutine is resumed after the last Task has finished. Only one coroutine
+ * may await a Group at a time.
+ * \return An awaitable yielding the status of Group::WaitAll()
+ * \throws ErrorException if the Group is already awaited.
+ * \ingroup CPP_TASKS_COROUTINE
+ */
+inline internal::GroupAwaiter WaitAll(
+  Group & group                        /**< [in] The Group to await */
+  ) {
+  return internal::GroupAwaiter(group);
+}
+
+} // namespace tasks
+} // namespace embb
+
+#endif // __cpp_impl_coroutine
+
+#endif // EMBB_TASKS_COROUTINE_H_
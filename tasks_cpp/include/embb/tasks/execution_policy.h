@@ -127,6 +127,7 @@ class ExecutionPolicy{
   mtapi_uint_t GetPriority() const;
 
   friend class Task;
+  friend class Node;
 
  private:
   /**
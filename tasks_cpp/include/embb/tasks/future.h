@@ -0,0 +1,276 @@
+/*
+ * Copyright (c) 2014-2015, Siemens AG. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef EMBB_TASKS_FUTURE_H_
+#define EMBB_TASKS_FUTURE_H_
+
+#include <cstddef>
+#include <vector>
+
+#include <embb/base/function.h>
+#include <embb/mtapi/c/mtapi.h>
+#include <embb/tasks/execution_policy.h>
+#include <embb/tasks/internal/future_state.h>
+
+namespace embb {
+namespace tasks {
+
+template <typename T>
+class Promise;
+
+namespace internal {
+
+template <typename T>
+class FutureAwaiter;
+
+} // namespace internal
+
+/**
+  * A Future provides access to the result of an asynchronous computation.
+  *
+  * The result is stored inline in a state shared between all copies of the
+  * Future and the producer. Once the producer has finished, dependent
+  * computations registered with Then(), WhenAll() or WhenAny() are started
+  * by the finishing task, so consumers do not have to wait.
+  *
+  * \tparam T Type of the result, must be copy constructible and not \c void
+  * \ingroup CPP_TASKS
+  */
+template <typename T>
+class Future {
+ public:
+  /**
+    * Constructs an invalid Future.
+    * \waitfree
+    */
+  Future();
+
+  /**
+    * Copies a Future. Both Futures refer to the same result.
+    * \waitfree
+    */
+  Future(
+    Future const & other               /**< [in] The Future to copy */
+    );
+
+  /**
+    * Destroys a Future.
+    */
+  ~Future();
+
+  /**
+    * Assigns a Future. Both Futures refer to the same result.
+    * \return A reference to this Future.
+    */
+  Future & operator=(
+    Future const & other               /**< [in] The Future to assign */
+    );
+
+  /**
+    * Checks whether the Future refers to a result.
+    * \return \c true if the Future is valid, otherwise \c false
+    * \waitfree
+    */
+  bool IsValid() const;
+
+  /**
+    * Checks whether the result is available.
+    * \return \c true if the result is available, otherwise \c false
+    * \waitfree
+    */
+  bool IsReady() const;
+
+  /**
+    * Waits for the result for \c timeout milliseconds. Executes other tasks
+    * while waiting.
+    * \return \c MTAPI_SUCCESS if the result is available, \c MTAPI_TIMEOUT
+    *         if it is not available yet, otherwise the reason why there will
+    *         be no result (see Promise and WhenAny()). Results computed from
+    *         a Future without result fail with the same status.
+    * \threadsafe
+    */
+  mtapi_status_t Wait(
+    mtapi_timeout_t timeout            /**< [in] Timeout duration in
+                                            milliseconds */
+    );
+
+  /**
+    * Waits for the result and returns it.
+    * \return A reference to the result, valid as long as any Future referring
+    *         to it exists
+    * \throws ErrorException if no result will ever be available, see Wait().
+    * \threadsafe
+    */
+  T const & Get();
+
+  /**
+    * Runs a function on the result as soon as it is available.
+    * \return A Future for the result of \c function
+    * \throws ErrorException if the function could not be started.
+    * \threadsafe
+    * \memory Allocates the state of the returned Future.
+    * \tparam R Result type of \c function
+    */
+  template <typename R>
+  Future<R> Then(
+    embb::base::Function<R, T const &> function
+                                       /**< [in] The function to run */
+    );
+
+  /**
+    * Runs a function on the result as soon as it is available, using the
+    * specified execution policy.
+    * \return A Future for the result of \c function
+    * \throws ErrorException if the function could not be started.
+    * \threadsafe
+    * \memory Allocates the state of the returned Future.
+    * \tparam R Result type of \c function
+    */
+  template <typename R>
+  Future<R> Then(
+    embb::base::Function<R, T const &> function,
+                                       /**< [in] The function to run */
+    ExecutionPolicy const & execution_policy
+                                       /**< [in] The execution policy to use */
+    );
+
+  template <typename U>
+  friend class Future;
+  friend class Promise<T>;
+  friend class Node;
+  template <typename U>
+  friend Future<std::vector<U> > WhenAll(
+    std::vector<Future<U> > const & futures);
+  template <typename U>
+  friend Future<size_t> WhenAny(
+    std::vector<Future<U> > const & futures);
+  template <typename U>
+  friend class internal::FutureAwaiter;
+
+ private:
+  explicit Future(internal::FutureState<T> * state);
+
+  internal::FutureState<T> * state_;
+};
+
+/**
+  * A Promise is the producing end of a Future that is not computed by a
+  * task but set explicitly. If all Promises referring to a result are
+  * destroyed before it was set, the Future becomes ready without a result:
+  * Future::Wait() returns \c MTAPI_ERR_ACTION_CANCELLED, Future::Get()
+  * throws, and computations depending on it fail the same way.
+  *
+  * \tparam T Type of the result, must be copy constructible and not \c void
+  * \ingroup CPP_TASKS
+  */
+template <typename T>
+class Promise {
+ public:
+  /**
+    * Constructs a Promise with a new shared state.
+    * \memory Allocates the shared state.
+    */
+  Promise();
+
+  /**
+    * Copies a Promise. Both Promises refer to the same shared state.
+    * \waitfree
+    */
+  Promise(
+    Promise const & other              /**< [in] The Promise to copy */
+    );
+
+  /**
+    * Destroys a Promise.
+    */
+  ~Promise();
+
+  /**
+    * Assigns a Promise. Both Promises refer to the same shared state.
+    * \return A reference to this Promise.
+    */
+  Promise & operator=(
+    Promise const & other              /**< [in] The Promise to assign */
+    );
+
+  /**
+    * Returns a Future referring to the result of this Promise.
+    * \return A Future for the result
+    * \waitfree
+    */
+  Future<T> GetFuture();
+
+  /**
+    * Sets the result and starts dependent computations. Must be called at
+    * most once.
+    * \threadsafe
+    */
+  void SetValue(
+    T const & value                    /**< [in] The result */
+    );
+
+ private:
+  internal::PromiseState<T> * state_;
+};
+
+/**
+  * Combines several Futures into one that becomes ready when all of them are
+  * ready. If any of them has no result, neither has the returned Future.
+  * \return A Future for the results, in the order of \c futures
+  * \threadsafe
+  * \memory Allocates the state of the returned Future.
+  * \tparam T Result type of the Futures
+  * \ingroup CPP_TASKS
+  */
+template <typename T>
+Future<std::vector<T> > WhenAll(
+  std::vector<Future<T> > const & futures
+                                       /**< [in] The Futures to combine */
+  );
+
+/**
+  * Combines several Futures into one that becomes ready as soon as one of
+  * them is ready. The ready Future may have no result, which is reported by
+  * its own Get(). If \c futures is empty, the returned Future has no result
+  * and its Wait() returns \c MTAPI_ERR_PARAMETER.
+  * \return A Future for the index of a ready Future in \c futures
+  * \threadsafe
+  * \memory Allocates the state of the returned Future.
+  * \tparam T Result type of the Futures
+  * \ingroup CPP_TASKS
+  */
+template <typename T>
+Future<size_t> WhenAny(
+  std::vector<Future<T> > const & futures
+                                       /**< [in] The Futures to combine */
+  );
+
+} // namespace tasks
+} // namespace embb
+
+#include <embb/tasks/internal/future-inl.h>
+
+#endif // EMBB_TASKS_FUTURE_H_
@@ -27,6 +27,7 @@
 #ifndef EMBB_TASKS_GROUP_H_
 #define EMBB_TASKS_GROUP_H_
 
+#include <embb/base/atomic.h>
 #include <embb/mtapi/c/mtapi.h>
 #include <embb/tasks/action.h>
 #include <embb/tasks/task.h>
@@ -41,6 +42,12 @@ class Allocation;
 
 namespace tasks {
 
+namespace internal {
+
+class TaskObserver;
+
+} // namespace internal
+
 /**
   * Represents a facility to wait for multiple related
   * \link Task Tasks\endlink.
@@ -108,6 +115,8 @@ class Group {
   friend class embb::base::Allocation;
   friend class Node;
   friend class Queue;
+  friend class Task;
+  friend class internal::TaskObserver;
 
  private:
   Group(Group const & group);
@@ -115,8 +124,11 @@ class Group {
   ~Group();
 
   void Create();
+  void TaskFinished();
 
   mtapi_group_hndl_t handle_;
+  embb::base::Atomic<unsigned int> pending_;
+  embb::base::Atomic<internal::TaskObserver*> observer_;
 };
 
 } // namespace tasks
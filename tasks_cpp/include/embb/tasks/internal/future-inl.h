@@ -0,0 +1,351 @@
+/*
+ * Copyright (c) 2014-2015, Siemens AG. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef EMBB_TASKS_INTERNAL_FUTURE_INL_H_
+#define EMBB_TASKS_INTERNAL_FUTURE_INL_H_
+
+#include <cassert>
+#include <new>
+
+#include <embb/base/exceptions.h>
+#include <embb/base/memory_allocation.h>
+
+namespace embb {
+namespace tasks {
+namespace internal {
+
+template <typename T>
+FutureState<T>::FutureState()
+  : has_value_(false) {
+}
+
+template <typename T>
+FutureState<T>::~FutureState() {
+  if (has_value_) {
+    reinterpret_cast<T*>(storage_.value)->~T();
+  }
+}
+
+template <typename T>
+void FutureState<T>::SetValue(T const & value) {
+  assert(!has_value_);
+  new (storage_.value) T(value);
+  has_value_ = true;
+  MarkReady();
+}
+
+template <typename T>
+T const & FutureState<T>::GetValue() const {
+  return *reinterpret_cast<T const *>(storage_.value);
+}
+
+template <typename T>
+PromiseState<T>::PromiseState()
+  : promises_(1) {
+}
+
+template <typename T>
+void PromiseState<T>::AddPromise() {
+  ++promises_;
+}
+
+template <typename T>
+void PromiseState<T>::ReleasePromise() {
+  if (0 == --promises_ && !this->IsReady()) {
+    // no value will ever be set, so release waiters and dependents
+    this->MarkFailed(MTAPI_ERR_ACTION_CANCELLED);
+  }
+}
+
+template <typename T>
+SpawnedFutureState<T>::SpawnedFutureState(
+  embb::base::Function<T> function)
+  : function_(function) {
+}
+
+template <typename T>
+void SpawnedFutureState<T>::Run() {
+  this->SetValue(function_());
+}
+
+template <typename T, typename R>
+ThenFutureState<T, R>::ThenFutureState(
+  FutureState<T> * source,
+  embb::base::Function<R, T const &> function,
+  ExecutionPolicy const & execution_policy)
+  : source_(source)
+  , function_(function)
+  , execution_policy_(execution_policy) {
+  source_->AddReference();
+}
+
+template <typename T, typename R>
+ThenFutureState<T, R>::~ThenFutureState() {
+  source_->Release();
+}
+
+template <typename T, typename R>
+void ThenFutureState<T, R>::Run() {
+  this->SetValue(function_(source_->GetValue()));
+}
+
+template <typename T, typename R>
+void ThenFutureState<T, R>::Notify() {
+  mtapi_status_t status = source_->GetStatus();
+  if (MTAPI_SUCCESS != status) {
+    // there is no value to run the function on
+    this->MarkFailed(status);
+  } else {
+    this->Start(execution_policy_);
+  }
+}
+
+template <typename T>
+WhenAllFutureState<T>::WhenAllFutureState(
+  std::vector<FutureState<T>*> const & sources)
+  : sources_(sources)
+  , remaining_(sources.size()) {
+  for (size_t ii = 0; ii < sources_.size(); ii++) {
+    sources_[ii]->AddReference();
+  }
+  if (sources_.empty()) {
+    this->SetValue(std::vector<T>());
+  }
+}
+
+template <typename T>
+WhenAllFutureState<T>::~WhenAllFutureState() {
+  for (size_t ii = 0; ii < sources_.size(); ii++) {
+    sources_[ii]->Release();
+  }
+}
+
+template <typename T>
+void WhenAllFutureState<T>::Notify() {
+  if (0 == --remaining_) {
+    std::vector<T> values;
+    values.reserve(sources_.size());
+    for (size_t ii = 0; ii < sources_.size(); ii++) {
+      mtapi_status_t status = sources_[ii]->GetStatus();
+      if (MTAPI_SUCCESS != status) {
+        this->MarkFailed(status);
+        return;
+      }
+      values.push_back(sources_[ii]->GetValue());
+    }
+    this->SetValue(values);
+  }
+}
+
+template <typename T>
+WhenAnyFutureState<T>::WhenAnyFutureState(
+  std::vector<FutureState<T>*> const & sources)
+  : sources_(sources)
+  , done_(false) {
+  for (size_t ii = 0; ii < sources_.size(); ii++) {
+    sources_[ii]->AddReference();
+  }
+  if (sources_.empty()) {
+    // there is no index to report
+    done_ = true;
+    this->MarkFailed(MTAPI_ERR_PARAMETER);
+  }
+}
+
+template <typename T>
+WhenAnyFutureState<T>::~WhenAnyFutureState() {
+  for (size_t ii = 0; ii < sources_.size(); ii++) {
+    sources_[ii]->Release();
+  }
+}
+
+template <typename T>
+void WhenAnyFutureState<T>::Notify() {
+  bool expected = false;
+  if (done_.CompareAndSwap(expected, true)) {
+    // the notifying source is ready, so the search always succeeds
+    size_t index = 0;
+    while (!sources_[index]->IsReady()) {
+      index++;
+    }
+    this->SetValue(index);
+  }
+}
+
+} // namespace internal
+
+template <typename T>
+Future<T>::Future()
+  : state_(NULL) {
+}
+
+template <typename T>
+Future<T>::Future(internal::FutureState<T> * state)
+  : state_(state) {
+}
+
+template <typename T>
+Future<T>::Future(Future const & other)
+  : state_(other.state_) {
+  if (NULL != state_) {
+    state_->AddReference();
+  }
+}
+
+template <typename T>
+Future<T>::~Future() {
+  if (NULL != state_) {
+    state_->Release();
+  }
+}
+
+template <typename T>
+Future<T> & Future<T>::operator=(Future const & other) {
+  if (NULL != other.state_) {
+    other.state_->AddReference();
+  }
+  if (NULL != state_) {
+    state_->Release();
+  }
+  state_ = other.state_;
+  return *this;
+}
+
+template <typename T>
+bool Future<T>::IsValid() const {
+  return NULL != state_;
+}
+
+template <typename T>
+bool Future<T>::IsReady() const {
+  return state_->IsReady();
+}
+
+template <typename T>
+mtapi_status_t Future<T>::Wait(mtapi_timeout_t timeout) {
+  return state_->Wait(timeout);
+}
+
+template <typename T>
+T const & Future<T>::Get() {
+  if (MTAPI_SUCCESS != state_->Wait(MTAPI_INFINITE)) {
+    EMBB_THROW(embb::base::ErrorException, "Future has no result");
+  }
+  return state_->GetValue();
+}
+
+template <typename T>
+template <typename R>
+Future<R> Future<T>::Then(
+  embb::base::Function<R, T const &> function) {
+  return Then(function, ExecutionPolicy());
+}
+
+template <typename T>
+template <typename R>
+Future<R> Future<T>::Then(
+  embb::base::Function<R, T const &> function,
+  ExecutionPolicy const & execution_policy) {
+  internal::ThenFutureState<T, R> * state =
+    embb::base::Allocation::New<internal::ThenFutureState<T, R> >(
+      state_, function, execution_policy);
+  state_->AddDependent(state);
+  return Future<R>(state);
+}
+
+template <typename T>
+Promise<T>::Promise()
+  : state_(embb::base::Allocation::New<internal::PromiseState<T> >()) {
+}
+
+template <typename T>
+Promise<T>::Promise(Promise const & other)
+  : state_(other.state_) {
+  state_->AddReference();
+  state_->AddPromise();
+}
+
+template <typename T>
+Promise<T>::~Promise() {
+  state_->ReleasePromise();
+  state_->Release();
+}
+
+template <typename T>
+Promise<T> & Promise<T>::operator=(Promise const & other) {
+  other.state_->AddReference();
+  other.state_->AddPromise();
+  state_->ReleasePromise();
+  state_->Release();
+  state_ = other.state_;
+  return *this;
+}
+
+template <typename T>
+Future<T> Promise<T>::GetFuture() {
+  state_->AddReference();
+  return Future<T>(state_);
+}
+
+template <typename T>
+void Promise<T>::SetValue(T const & value) {
+  state_->SetValue(value);
+}
+
+template <typename T>
+Future<std::vector<T> > WhenAll(std::vector<Future<T> > const & futures) {
+  std::vector<internal::FutureState<T>*> sources;
+  sources.reserve(futures.size());
+  for (size_t ii = 0; ii < futures.size(); ii++) {
+    sources.push_back(futures[ii].state_);
+  }
+  internal::WhenAllFutureState<T> * state =
+    embb::base::Allocation::New<internal::WhenAllFutureState<T> >(sources);
+  for (size_t ii = 0; ii < sources.size(); ii++) {
+    sources[ii]->AddDependent(state);
+  }
+  return Future<std::vector<T> >(state);
+}
+
+template <typename T>
+Future<size_t> WhenAny(std::vector<Future<T> > const & futures) {
+  std::vector<internal::FutureState<T>*> sources;
+  sources.reserve(futures.size());
+  for (size_t ii = 0; ii < futures.size(); ii++) {
+    sources.push_back(futures[ii].state_);
+  }
+  internal::WhenAnyFutureState<T> * state =
+    embb::base::Allocation::New<internal::WhenAnyFutureState<T> >(sources);
+  for (size_t ii = 0; ii < sources.size(); ii++) {
+    sources[ii]->AddDependent(state);
+  }
+  return Future<size_t>(state);
+}
+
+} // namespace tasks
+} // namespace embb
+
+#endif // EMBB_TASKS_INTERNAL_FUTURE_INL_H_
@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2014-2015, Siemens AG. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef EMBB_TASKS_INTERNAL_FUTURE_STATE_H_
+#define EMBB_TASKS_INTERNAL_FUTURE_STATE_H_
+
+#include <cstddef>
+#include <vector>
+
+#include <embb/base/atomic.h>
+#include <embb/base/function.h>
+#include <embb/base/mutex.h>
+#include <embb/mtapi/c/mtapi.h>
+#include <embb/tasks/execution_policy.h>
+#include <embb/tasks/task_context.h>
+
+namespace embb {
+namespace tasks {
+namespace internal {
+
+/**
+ * Reference counted state shared by Futures, Promises and the task computing
+ * the result. Dependent states are notified when the state becomes ready.
+ */
+class FutureStateBase {
+ public:
+  FutureStateBase();
+  virtual ~FutureStateBase();
+
+  void AddReference();
+  void Release();
+
+  bool IsReady() const;
+
+  /**
+   * Returns MTAPI_SUCCESS if the state holds a result, otherwise the reason
+   * why it has none. Only valid once the state is ready.
+   */
+  mtapi_status_t GetStatus() const;
+
+  mtapi_status_t Wait(mtapi_timeout_t timeout);
+
+  /**
+   * Notifies \c dependent when this state becomes ready, or immediately if
+   * it already is.
+   */
+  void AddDependent(FutureStateBase * dependent);
+
+  /**
+   * Runs Run() as a detached task with the given execution policy.
+   */
+  void Start(ExecutionPolicy const & execution_policy);
+
+ protected:
+  /**
+   * Computes the result, called by the task started by Start().
+   */
+  virtual void Run();
+
+  /**
+   * Called when a state this one depends on becomes ready.
+   */
+  virtual void Notify();
+
+  /**
+   * Marks the state as ready and notifies all dependents.
+   */
+  void MarkReady();
+
+  /**
+   * Marks the state as ready without a result and notifies all dependents.
+   * Called when the result can never be computed.
+   */
+  void MarkFailed(mtapi_status_t status);
+
+ private:
+  FutureStateBase(FutureStateBase const & other);
+  FutureStateBase & operator=(FutureStateBase const & other);
+
+  void Execute(TaskContext & context);
+
+  embb::base::Atomic<unsigned int> references_;
+  embb::base::Atomic<bool> ready_;
+  // written before ready_ is set
+  mtapi_status_t status_;
+  embb::base::Mutex lock_;
+  std::vector<FutureStateBase*> dependents_;
+};
+
+/**
+ * Shared state holding a result of type \c T inline.
+ */
+template <typename T>
+class FutureState : public FutureStateBase {
+ public:
+  FutureState();
+  virtual ~FutureState();
+
+  void SetValue(T const & value);
+  T const & GetValue() const;
+
+ private:
+  union Storage {
+    char value[sizeof(T)];
+    void * align_pointer;
+    long long align_integer;
+    double align_floating_point;
+  };
+
+  Storage storage_;
+  bool has_value_;
+};
+
+/**
+ * State of a Future set by Promises, counting the Promises referring to it.
+ */
+template <typename T>
+class PromiseState : public FutureState<T> {
+ public:
+  PromiseState();
+
+  void AddPromise();
+  void ReleasePromise();
+
+ private:
+  embb::base::Atomic<unsigned int> promises_;
+};
+
+/**
+ * State of a Future computed by a task spawned on the Node.
+ */
+template <typename T>
+class SpawnedFutureState : public FutureState<T> {
+ public:
+  explicit SpawnedFutureState(embb::base::Function<T> function);
+
+ protected:
+  virtual void Run();
+
+ private:
+  embb::base::Function<T> function_;
+};
+
+/**
+ * State of a Future computed from the result of another Future.
+ */
+template <typename T, typename R>
+class ThenFutureState : public FutureState<R> {
+ public:
+  ThenFutureState(
+    FutureState<T> * source,
+    embb::base::Function<R, T const &> function,
+    ExecutionPolicy const & execution_policy);
+  virtual ~ThenFutureState();
+
+ protected:
+  virtual void Run();
+  virtual void Notify();
+
+ private:
+  FutureState<T> * source_;
+  embb::base::Function<R, T const &> function_;
+  ExecutionPolicy execution_policy_;
+};
+
+/**
+ * State of a Future that is ready when all its sources are ready.
+ */
+template <typename T>
+class WhenAllFutureState : public FutureState<std::vector<T> > {
+ public:
+  explicit WhenAllFutureState(std::vector<FutureState<T>*> const & sources);
+  virtual ~WhenAllFutureState();
+
+ protected:
+  virtual void Notify();
+
+ private:
+  std::vector<FutureState<T>*> sources_;
+  embb::base::Atomic<size_t> remaining_;
+};
+
+/**
+ * State of a Future that is ready when any of its sources is ready.
+ */
+template <typename T>
+class WhenAnyFutureState : public FutureState<size_t> {
+ public:
+  explicit WhenAnyFutureState(std::vector<FutureState<T>*> const & sources);
+  virtual ~WhenAnyFutureState();
+
+ protected:
+  virtual void Notify();
+
+ private:
+  std::vector<FutureState<T>*> sources_;
+  embb::base::Atomic<bool> done_;
+};
+
+} // namespace internal
+} // namespace tasks
+} // namespace embb
+
+#endif // EMBB_TASKS_INTERNAL_FUTURE_STATE_H_
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2014-2015, Siemens AG. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef EMBB_TASKS_INTERNAL_TASK_OBSERVER_H_
+#define EMBB_TASKS_INTERNAL_TASK_OBSERVER_H_
+
+#include <embb/mtapi/c/mtapi.h>
+#include <embb/tasks/action.h>
+#include <embb/tasks/task_context.h>
+
+namespace embb {
+namespace tasks {
+
+class Group;
+class Queue;
+
+namespace internal {
+
+/**
+ * Gets notified on a worker thread when an Action or all Tasks of a Group
+ * have finished, without blocking a thread until then. Used to resume
+ * suspended coroutines.
+ */
+class TaskObserver {
+ public:
+  TaskObserver();
+  virtual ~TaskObserver();
+
+  /**
+   * Runs \c action, in \c queue unless it is NULL, and calls Notify() on the
+   * worker thread that finished it. The observer must not be accessed after
+   * starting the Action until Notify() is called.
+   */
+  void Start(Action action, Queue * queue);
+
+  /**
+   * Returns the status of the Action run by Start() and releases its task.
+   * Must be called exactly once after Notify().
+   */
+  mtapi_status_t GetStatus();
+
+  /**
+   * Calls Notify() on a worker thread when all Tasks of \c group have
+   * finished. Only one observer may observe a Group at a time.
+   * \return \c false if there are no unfinished Tasks in the group, in which
+   *         case Notify() is not called.
+   */
+  bool Observe(Group & group);
+
+ protected:
+  /**
+   * Called when the observed Action or Group has finished.
+   */
+  virtual void Notify() = 0;
+
+ private:
+  friend class embb::tasks::Group;
+
+  /**
+   * Calls Notify() in a new task, used when the Tasks of a Group finish, as
+   * they have not completed yet.
+   */
+  void Schedule();
+
+  void Execute(TaskContext & context);
+
+  static void complete_func(
+    mtapi_task_hndl_t task,
+    mtapi_status_t * status);
+
+  mtapi_task_hndl_t handle_;
+};
+
+} // namespace internal
+} // namespace tasks
+} // namespace embb
+
+#endif // EMBB_TASKS_INTERNAL_TASK_OBSERVER_H_
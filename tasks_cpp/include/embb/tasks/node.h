@@ -29,9 +29,13 @@
 
 #include <list>
 #include <embb/base/core_set.h>
+#include <embb/base/function.h>
+#include <embb/base/memory_allocation.h>
 #include <embb/mtapi/c/mtapi.h>
 #include <embb/tasks/action.h>
+#include <embb/tasks/future.h>
 #include <embb/tasks/task.h>
+#include <embb/tasks/task_group.h>
 #include <embb/tasks/continuation.h>
 #include <embb/tasks/group.h>
 #include <embb/tasks/queue.h>
@@ -46,6 +50,9 @@ class Allocation;
 
 namespace tasks {
 
+class ActionPool;
+struct TaskArguments;
+
 /**
   * A singleton representing the MTAPI runtime.
   *
@@ -189,6 +196,43 @@ class Node {
     Action action                      /**< [in] The Action to execute */
     );
 
+  /**
+    * Runs a function computing a result.
+    * \return A Future for the result of \c function
+    * \throws ErrorException if the function could not be started.
+    * \threadsafe
+    * \memory Allocates the state of the returned Future, which holds the
+    *         result inline.
+    * \tparam T Result type of \c function
+    */
+  template <typename T>
+  Future<T> Spawn(
+    embb::base::Function<T> function   /**< [in] The function to run */
+    ) {
+    return Spawn(function, ExecutionPolicy());
+  }
+
+  /**
+    * Runs a function computing a result with the specified execution policy.
+    * \return A Future for the result of \c function
+    * \throws ErrorException if the function could not be started.
+    * \threadsafe
+    * \memory Allocates the state of the returned Future, which holds the
+    *         result inline.
+    * \tparam T Result type of \c function
+    */
+  template <typename T>
+  Future<T> Spawn(
+    embb::base::Function<T> function,  /**< [in] The function to run */
+    ExecutionPolicy const & execution_policy
+                                       /**< [in] The execution policy to use */
+    ) {
+    internal::SpawnedFutureState<T> * state =
+      embb::base::Allocation::New<internal::SpawnedFutureState<T> >(function);
+    state->Start(execution_policy);
+    return Future<T>(state);
+  }
+
   /**
     * Creates a Continuation.
     * \return A Continuation chain
@@ -200,6 +244,11 @@ class Node {
     );
 
   friend class embb::base::Allocation;
+  friend class Task;
+  friend class TaskGroup;
+  friend struct ContinuationStage;
+  friend class internal::FutureStateBase;
+  friend class internal::TaskObserver;
 
  private:
   Node(Node const & node);
@@ -209,6 +258,16 @@ class Node {
     mtapi_node_attributes_t * attr);
   ~Node();
 
+  TaskArguments * AllocateArguments(
+    Action const & action,
+    TaskGroup * group,
+    Group * owner);
+  void FreeArguments(TaskArguments * arguments);
+  void SpawnDetached(Action const & action, TaskGroup * group);
+  static void SetGroupTaskAttributes(
+    mtapi_task_attributes_t * attr,
+    TaskArguments * arguments);
+
   static void action_func(
     const void* args,
     mtapi_size_t args_size,
@@ -217,10 +276,14 @@ class Node {
     const void* node_local_data,
     mtapi_size_t node_local_data_size,
     mtapi_task_context_t * context);
+  static void group_task_complete_func(
+    mtapi_task_hndl_t task,
+    mtapi_status_t * status);
 
   mtapi_uint_t core_count_;
   mtapi_uint_t worker_thread_count_;
   mtapi_action_hndl_t action_handle_;
+  ActionPool * action_pool_;
   std::list<Queue*> queues_;
   std::list<Group*> groups_;
 };
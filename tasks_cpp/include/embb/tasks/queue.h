@@ -101,6 +101,7 @@ class Queue {
 
   friend class embb::base::Allocation;
   friend class Node;
+  friend class internal::TaskObserver;
 
  private:
   Queue(Queue const & taskqueue);
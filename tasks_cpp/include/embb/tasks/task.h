@@ -33,6 +33,9 @@
 namespace embb {
 namespace tasks {
 
+struct ContinuationState;
+class Group;
+
 /**
   * A Task represents a running Action.
   *
@@ -57,6 +60,14 @@ class Task {
     */
   ~Task();
 
+  /**
+    * Assigns a Task
+    * \return A reference to this Task.
+    */
+  Task & operator=(
+    Task const & task                  /**< The task to assign. */
+    );
+
   /**
     * Waits for Task to finish for \c timeout milliseconds.
     * \return The status of the finished Task, \c MTAPI_TIMEOUT or
@@ -77,19 +88,23 @@ class Task {
   friend class Group;
   friend class Queue;
   friend class Node;
+  friend class Continuation;
 
  private:
+  explicit Task(
+    ContinuationState * continuation);
+
   Task(
     Action action);
 
   Task(
     Action action,
-    mtapi_group_hndl_t group);
+    Group * group);
 
   Task(
     mtapi_task_id_t id,
     Action action,
-    mtapi_group_hndl_t group);
+    Group * group);
 
   Task(
     Action action,
@@ -98,15 +113,16 @@ class Task {
   Task(
     Action action,
     mtapi_queue_hndl_t queue,
-    mtapi_group_hndl_t group);
+    Group * group);
 
   Task(
     mtapi_task_id_t id,
     Action action,
     mtapi_queue_hndl_t queue,
-    mtapi_group_hndl_t group);
+    Group * group);
 
   mtapi_task_hndl_t handle_;
+  ContinuationState * continuation_;
 };
 
 } // namespace tasks
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2014-2015, Siemens AG. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef EMBB_TASKS_TASK_GROUP_H_
+#define EMBB_TASKS_TASK_GROUP_H_
+
+#include <embb/base/atomic.h>
+#include <embb/tasks/action.h>
+
+namespace embb {
+namespace tasks {
+
+/**
+  * Lightweight structured fork-join of \link Action Actions\endlink.
+  *
+  * Children spawned into a TaskGroup only decrement a counter of the
+  * TaskGroup when they are done. Neither MTAPI groups nor task handles are
+  * involved. While waiting, the calling thread helps executing tasks if it
+  * is a worker thread. A TaskGroup has to outlive its children, therefore
+  * the destructor waits for all children to finish.
+  *
+  * \ingroup CPP_TASKS
+  */
+class TaskGroup {
+ public:
+  /**
+    * Constructs an empty TaskGroup.
+    * \waitfree
+    */
+  TaskGroup();
+
+  /**
+    * Waits for all children and destroys the TaskGroup.
+    */
+  ~TaskGroup();
+
+  /**
+    * Runs an Action as child of the TaskGroup. If the maximum number of tasks
+    * is reached, the Action is executed immediately when called from within a
+    * task, otherwise the calling thread helps executing tasks until the
+    * Action can be started.
+    * \throws ErrorException if the Action could not be started.
+    * \threadsafe
+    */
+  void Spawn(
+    Action action                      /**< [in] The Action to run */
+    );
+
+  /**
+    * Runs an Action as child of the TaskGroup and waits for all children to
+    * finish.
+    * \throws ErrorException if the Action could not be started.
+    * \threadsafe
+    */
+  void SpawnAndSync(
+    Action action                      /**< [in] The Action to run */
+    );
+
+  /**
+    * Waits for all children to finish. Executes other tasks while waiting if
+    * called from a worker thread.
+    * \threadsafe
+    */
+  void Sync();
+
+  friend class Node;
+
+ private:
+  TaskGroup(TaskGroup const & other);
+  TaskGroup & operator=(TaskGroup const & other);
+
+  void Release();
+
+  embb::base::Atomic<unsigned int> pending_;
+};
+
+} // namespace tasks
+} // namespace embb
+
+#endif // EMBB_TASKS_TASK_GROUP_H_
@@ -44,10 +44,12 @@
 #include <embb/tasks/execution_policy.h>
 #include <embb/tasks/action.h>
 #include <embb/tasks/continuation.h>
+#include <embb/tasks/future.h>
 #include <embb/tasks/group.h>
 #include <embb/tasks/node.h>
 #include <embb/tasks/queue.h>
 #include <embb/tasks/task.h>
 #include <embb/tasks/task_context.h>
+#include <embb/tasks/task_group.h>
 
 #endif // EMBB_TASKS_TASKS_H_
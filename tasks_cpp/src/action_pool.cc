@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2014-2015, Siemens AG. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <new>
+
+#include <embb/base/memory_allocation.h>
+
+#include <action_pool.h>
+
+namespace embb {
+namespace tasks {
+
+ActionPool::ActionPool(mtapi_uint_t capacity)
+  : capacity_(capacity) {
+  // slot 0 is never handed out, it corresponds to the invalid id
+  slots_ = static_cast<TaskArguments*>(embb::base::Allocation::Allocate(
+    sizeof(TaskArguments) * (capacity_ + 1)));
+  embb_mtapi_id_pool_initialize(&free_slots_, capacity_);
+}
+
+ActionPool::~ActionPool() {
+  embb_mtapi_id_pool_finalize(&free_slots_);
+  embb::base::Allocation::Free(slots_);
+}
+
+TaskArguments * ActionPool::Allocate(
+  Action const & action,
+  TaskGroup * group,
+  Group * owner) {
+  mtapi_uint_t index = embb_mtapi_id_pool_allocate(&free_slots_);
+  if (EMBB_MTAPI_IDPOOL_INVALID_ID == index) {
+    // all slots in use, fall back to the heap
+    return embb::base::Allocation::New<TaskArguments>(action, group, owner);
+  }
+  return new(slots_ + index) TaskArguments(action, group, owner);
+}
+
+void ActionPool::Free(TaskArguments * arguments) {
+  uintptr_t first = reinterpret_cast<uintptr_t>(slots_ + 1);
+  uintptr_t last = reinterpret_cast<uintptr_t>(slots_ + capacity_);
+  uintptr_t address = reinterpret_cast<uintptr_t>(arguments);
+  if (address < first || address > last) {
+    embb::base::Allocation::Delete(arguments);
+    return;
+  }
+
+  mtapi_uint_t index = static_cast<mtapi_uint_t>(arguments - slots_);
+  arguments->~TaskArguments();
+  embb_mtapi_id_pool_deallocate(&free_slots_, index);
+}
+
+} // namespace tasks
+} // namespace embb
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2014-2015, Siemens AG. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef TASKS_CPP_SRC_ACTION_POOL_H_
+#define TASKS_CPP_SRC_ACTION_POOL_H_
+
+#include <embb/tasks/tasks.h>
+
+#include <embb_mtapi_id_pool_t.h>
+
+namespace embb {
+namespace tasks {
+
+/**
+ * Arguments of the MTAPI tasks started by tasks_cpp.
+ */
+struct TaskArguments {
+  TaskArguments(
+    Action const & task_action,
+    TaskGroup * task_group,
+    Group * task_owner)
+    : action(task_action)
+    , group(task_group)
+    , owner(task_owner) {
+    // empty
+  }
+
+  Action action;
+  TaskGroup * group;                   // notified on completion, may be NULL
+  Group * owner;                       // notified on completion, may be NULL
+};
+
+/**
+ * Lock-free pool of storage for the arguments of started tasks.
+ *
+ * Since MTAPI limits the number of tasks in flight, a pool with one slot per
+ * task saves the heap allocation per spawn. Free slots are managed by the
+ * lock-free id pool of MTAPI, slot ids run from 1 to the capacity. If the
+ * pool is exhausted, arguments are allocated on the heap.
+ */
+class ActionPool {
+ public:
+  explicit ActionPool(mtapi_uint_t capacity);
+  ~ActionPool();
+
+  /**
+   * Constructs task arguments from the given Action in a free slot.
+   * \return Pointer to the arguments, to be released using Free()
+   */
+  TaskArguments * Allocate(
+    Action const & action,
+    TaskGroup * group,
+    Group * owner);
+
+  /**
+   * Destroys arguments obtained from Allocate() and releases their storage.
+   */
+  void Free(TaskArguments * arguments);
+
+ private:
+  ActionPool(ActionPool const & other);
+  ActionPool & operator=(ActionPool const & other);
+
+  mtapi_uint_t capacity_;
+  TaskArguments * slots_;
+  embb_mtapi_id_pool_t free_slots_;
+};
+
+} // namespace tasks
+} // namespace embb
+
+#endif // TASKS_CPP_SRC_ACTION_POOL_H_
@@ -25,6 +25,7 @@
  */
 
 #include <cstddef>
+#include <vector>
 
 #include <embb/base/memory_allocation.h>
 #include <embb/base/function.h>
@@ -35,59 +36,164 @@
 namespace embb {
 namespace tasks {
 
+ContinuationState::ContinuationState(
+  unsigned int stage_count,
+  ExecutionPolicy const * execution_policy)
+  : pending(stage_count)
+  , references(1)
+  , cancelled(false)
+  , skipped(0)
+  , has_policy(NULL != execution_policy)
+  , policy(has_policy ? *execution_policy : ExecutionPolicy()) {
+}
+
+void ContinuationState::AddReference() {
+  ++references;
+}
+
+void ContinuationState::Release() {
+  if (0 == --references) {
+    embb::base::Allocation::Delete(this);
+  }
+}
+
+ContinuationStage::ContinuationStage()
+  : predecessors(0)
+  , state(NULL) {
+}
+
+void ContinuationStage::Spawn() {
+  ExecutionPolicy policy = state->has_policy ?
+    state->policy : action.GetExecutionPolicy();
+  Node::GetInstance().SpawnDetached(
+    Action(embb::base::MakeFunction(*this, &ContinuationStage::Execute),
+      policy),
+    NULL);
+}
+
+void ContinuationStage::Execute(TaskContext & context) {
+  ContinuationState * cur_state = state;
+  if (!cur_state->cancelled) {
+    action(context);
+  } else {
+    ++cur_state->skipped;
+  }
+  for (size_t ii = 0; ii < successors.size(); ii++) {
+    ContinuationStage * next = successors[ii];
+    if (0 == --next->predecessors) {
+      next->Spawn();
+    }
+  }
+  embb::base::Allocation::Delete(this);
+  if (0 == --cur_state->pending) {
+    cur_state->Release();
+  }
+}
+
 Continuation::Continuation(Action action) {
-  first_ = last_ = embb::base::Allocation::New<ContinuationStage>();
-  first_->action = action;
-  first_->next = NULL;
+  ContinuationStage * stage =
+    embb::base::Allocation::New<ContinuationStage>();
+  stage->action = action;
+  stages_.push_back(stage);
+  last_.push_back(stage);
 }
 
 Continuation::Continuation(Continuation const & cont)
-  : first_(cont.first_)
+  : stages_(cont.stages_)
   , last_(cont.last_) {
 }
 
 Continuation::~Continuation() {
 }
 
-void Continuation::ExecuteContinuation(TaskContext &) {
-  ContinuationStage * stage = first_;
-  Node & node = Node::GetInstance();
-  while (NULL != stage) {
-    Task task = node.Spawn(stage->action);
-    task.Wait(MTAPI_INFINITE);
-    stage = stage->next;
+void Continuation::Append(std::vector<Action> & actions) {
+  std::vector<ContinuationStage*> stages;
+  for (size_t ii = 0; ii < actions.size(); ii++) {
+    ContinuationStage * stage =
+      embb::base::Allocation::New<ContinuationStage>();
+    stage->action = actions[ii];
+    stages.push_back(stage);
   }
-
-  // delete stages
-  stage = first_;
-  while (NULL != stage) {
-    ContinuationStage * next = stage->next;
-    embb::base::Allocation::Delete(stage);
-    stage = next;
+  for (size_t ii = 0; ii < last_.size(); ii++) {
+    for (size_t jj = 0; jj < stages.size(); jj++) {
+      last_[ii]->successors.push_back(stages[jj]);
+      ++stages[jj]->predecessors;
+    }
   }
+  stages_.insert(stages_.end(), stages.begin(), stages.end());
+  last_ = stages;
 }
 
 Continuation & Continuation::Then(Action action) {
-  ContinuationStage * cur = embb::base::Allocation::New<ContinuationStage>();
-  cur->action = action;
-  cur->next = NULL;
+  std::vector<Action> actions;
+  actions.push_back(action);
+  Append(actions);
+  return *this;
+}
+
+Continuation & Continuation::Then(Action action1, Action action2) {
+  std::vector<Action> actions;
+  actions.push_back(action1);
+  actions.push_back(action2);
+  Append(actions);
+  return *this;
+}
 
-  last_->next = cur;
-  last_ = cur;
+Continuation & Continuation::Then(
+  Action action1, Action action2, Action action3) {
+  std::vector<Action> actions;
+  actions.push_back(action1);
+  actions.push_back(action2);
+  actions.push_back(action3);
+  Append(actions);
+  return *this;
+}
 
+Continuation & Continuation::Then(
+  Action action1, Action action2, Action action3, Action action4) {
+  std::vector<Action> actions;
+  actions.push_back(action1);
+  actions.push_back(action2);
+  actions.push_back(action3);
+  actions.push_back(action4);
+  Append(actions);
+  return *this;
+}
+
+Continuation & Continuation::WhenAll(Continuation const & other) {
+  stages_.insert(stages_.end(), other.stages_.begin(), other.stages_.end());
+  last_.insert(last_.end(), other.last_.begin(), other.last_.end());
   return *this;
 }
 
 Task Continuation::Spawn() {
-  return Spawn(ExecutionPolicy());
+  return SpawnStages(NULL);
 }
 
 Task Continuation::Spawn(ExecutionPolicy execution_policy) {
-  Node & node = Node::GetInstance();
-  return node.Spawn(
-    Action(
-      embb::base::MakeFunction(*this, &Continuation::ExecuteContinuation),
-      ExecutionPolicy(execution_policy)));
+  return SpawnStages(&execution_policy);
+}
+
+Task Continuation::SpawnStages(ExecutionPolicy const * execution_policy) {
+  ContinuationState * state =
+    embb::base::Allocation::New<ContinuationState>(
+      static_cast<unsigned int>(stages_.size()), execution_policy);
+  // the returned Task holds a reference until it is destroyed
+  Task task(state);
+  std::vector<ContinuationStage*> roots;
+  for (size_t ii = 0; ii < stages_.size(); ii++) {
+    stages_[ii]->state = state;
+    if (0 == stages_[ii]->predecessors) {
+      roots.push_back(stages_[ii]);
+    }
+  }
+  // stages delete themselves after execution
+  stages_.clear();
+  last_.clear();
+  for (size_t ii = 0; ii < roots.size(); ii++) {
+    roots[ii]->Spawn();
+  }
+  return task;
 }
 
 } // namespace tasks
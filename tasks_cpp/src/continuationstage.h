@@ -27,14 +27,54 @@
 #ifndef TASKS_CPP_SRC_CONTINUATIONSTAGE_H_
 #define TASKS_CPP_SRC_CONTINUATIONSTAGE_H_
 
+#include <vector>
+
+#include <embb/base/atomic.h>
 #include <embb/tasks/tasks.h>
 
 namespace embb {
 namespace tasks {
 
+/**
+ * Shared state of a spawned Continuation graph. It is referenced by the
+ * graph itself and by every Task representing the Continuation.
+ */
+struct ContinuationState {
+  ContinuationState(
+    unsigned int stage_count,
+    ExecutionPolicy const * execution_policy);
+
+  void AddReference();
+  void Release();
+
+  embb::base::Atomic<unsigned int> pending;
+  embb::base::Atomic<unsigned int> references;
+  embb::base::Atomic<bool> cancelled;
+  // number of stages whose Action was not run due to cancellation
+  embb::base::Atomic<unsigned int> skipped;
+  bool has_policy;
+  ExecutionPolicy policy;
+};
+
 struct ContinuationStage {
+  ContinuationStage();
+
+  /**
+   * Starts the stage as a detached task.
+   */
+  void Spawn();
+
+  /**
+   * Runs the Action unless the Continuation was cancelled, and starts every
+   * successor whose predecessors have all finished. Deletes the stage
+   * afterwards.
+   */
+  void Execute(TaskContext & context);
+
   Action action;
-  ContinuationStage * next;
+  std::vector<ContinuationStage*> successors;
+  embb::base::Atomic<unsigned int> predecessors;
+  ContinuationState * state;
 };
 
 } // namespace tasks
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2014-2015, Siemens AG. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <cstddef>
+#include <vector>
+
+#include <embb/base/memory_allocation.h>
+#include <embb/base/function.h>
+#include <embb/base/c/duration.h>
+#include <embb/base/c/time.h>
+#include <embb/mtapi/c/mtapi_ext.h>
+#include <embb/tasks/tasks.h>
+
+namespace embb {
+namespace tasks {
+namespace internal {
+
+FutureStateBase::FutureStateBase()
+  : references_(1)
+  , ready_(false)
+  , status_(MTAPI_SUCCESS)
+  , lock_()
+  , dependents_() {
+}
+
+FutureStateBase::~FutureStateBase() {
+  for (size_t ii = 0; ii < dependents_.size(); ii++) {
+    dependents_[ii]->Release();
+  }
+}
+
+void FutureStateBase::AddReference() {
+  ++references_;
+}
+
+void FutureStateBase::Release() {
+  if (0 == --references_) {
+    embb::base::Allocation::Delete(this);
+  }
+}
+
+bool FutureStateBase::IsReady() const {
+  return ready_.Load();
+}
+
+mtapi_status_t FutureStateBase::GetStatus() const {
+  return status_;
+}
+
+mtapi_status_t FutureStateBase::Wait(mtapi_timeout_t timeout) {
+  embb_duration_t wait_duration;
+  embb_time_t end_time;
+  if (MTAPI_INFINITE < timeout) {
+    embb_duration_set_milliseconds(
+      &wait_duration, static_cast<unsigned long long>(timeout));
+    embb_time_in(&end_time, &wait_duration);
+  }
+  while (!ready_) {
+    if (MTAPI_INFINITE < timeout) {
+      embb_time_t current_time;
+      embb_time_now(&current_time);
+      if (embb_time_compare(&current_time, &end_time) > 0) {
+        return MTAPI_TIMEOUT;
+      }
+    }
+    mtapi_ext_yield(MTAPI_NULL);
+  }
+  return status_;
+}
+
+void FutureStateBase::AddDependent(FutureStateBase * dependent) {
+  lock_.Lock();
+  if (!ready_) {
+    // released after notification
+    dependent->AddReference();
+    dependents_.push_back(dependent);
+    lock_.Unlock();
+  } else {
+    lock_.Unlock();
+    dependent->Notify();
+  }
+}
+
+void FutureStateBase::Start(ExecutionPolicy const & execution_policy) {
+  // the task holds a reference until Run() has finished
+  AddReference();
+  Node::GetInstance().SpawnDetached(
+    Action(embb::base::MakeFunction(*this, &FutureStateBase::Execute),
+      execution_policy),
+    NULL);
+}
+
+void FutureStateBase::Run() {
+}
+
+void FutureStateBase::Notify() {
+}
+
+void FutureStateBase::MarkReady() {
+  std::vector<FutureStateBase*> dependents;
+  lock_.Lock();
+  ready_ = true;
+  dependents.swap(dependents_);
+  lock_.Unlock();
+  for (size_t ii = 0; ii < dependents.size(); ii++) {
+    dependents[ii]->Notify();
+    dependents[ii]->Release();
+  }
+}
+
+void FutureStateBase::MarkFailed(mtapi_status_t status) {
+  status_ = status;
+  MarkReady();
+}
+
+void FutureStateBase::Execute(TaskContext &) {
+  Run();
+  Release();
+}
+
+} // namespace internal
+} // namespace tasks
+} // namespace embb
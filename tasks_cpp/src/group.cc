@@ -29,11 +29,14 @@
 
 #include <embb/base/exceptions.h>
 #include <embb/tasks/tasks.h>
+#include <embb/tasks/internal/task_observer.h>
 
 namespace embb {
 namespace tasks {
 
-Group::Group() {
+Group::Group()
+  : pending_(0)
+  , observer_(NULL) {
   Create();
 }
 
@@ -53,11 +56,11 @@ void Group::Create() {
 }
 
 Task Group::Spawn(Action action) {
-  return Task(action, handle_);
+  return Task(action, this);
 }
 
 Task Group::Spawn(mtapi_task_id_t id, Action action) {
-  return Task(id, action, handle_);
+  return Task(id, action, this);
 }
 
 mtapi_status_t Group::WaitAny(mtapi_timeout_t timeout) {
@@ -92,5 +95,14 @@ mtapi_status_t Group::WaitAll(mtapi_timeout_t timeout) {
   return status;
 }
 
+void Group::TaskFinished() {
+  if (0 == --pending_) {
+    internal::TaskObserver * observer = observer_.Swap(NULL);
+    if (NULL != observer) {
+      observer->Schedule();
+    }
+  }
+}
+
 } // namespace tasks
 } // namespace embb
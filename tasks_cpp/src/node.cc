@@ -28,10 +28,13 @@
 #include <cstddef>
 #include <cstdlib>
 #include <cassert>
+#include <cstring>
 
 #include <embb/base/memory_allocation.h>
 #include <embb/base/exceptions.h>
+#include <embb/mtapi/c/mtapi_ext.h>
 #include <embb/tasks/tasks.h>
+#include <action_pool.h>
 #if TASKS_CPP_AUTOMATIC_INITIALIZE
 #include <embb/base/mutex.h>
 #endif
@@ -39,6 +42,7 @@
 namespace {
 
 static embb::tasks::Node * node_instance = NULL;
+EMBB_THREAD_SPECIFIC mtapi_task_context_t * current_task_context = NULL;
 #if TASKS_CPP_AUTOMATIC_INITIALIZE
 static embb::base::Mutex init_mutex;
 #endif
@@ -56,11 +60,53 @@ void Node::action_func(
   const void* /*node_local_data*/,
   mtapi_size_t /*node_local_data_size*/,
   mtapi_task_context_t * context) {
-  Action * action =
-    reinterpret_cast<Action*>(const_cast<void*>(args));
+  TaskArguments * arguments =
+    reinterpret_cast<TaskArguments*>(const_cast<void*>(args));
   TaskContext task_context(context);
-  (*action)(task_context);
-  embb::base::Allocation::Delete(action);
+  mtapi_task_context_t * outer_task_context = current_task_context;
+  current_task_context = context;
+  arguments->action(task_context);
+  current_task_context = outer_task_context;
+  if (NULL != arguments->owner) {
+    // released by group_task_complete_func(), which is also called if the
+    // task is cancelled before its Action ran
+    return;
+  }
+  TaskGroup * group = arguments->group;
+  node_instance->FreeArguments(arguments);
+  if (NULL != group) {
+    group->Release();
+  }
+}
+
+void Node::group_task_complete_func(
+  mtapi_task_hndl_t task,
+  mtapi_status_t * /*status*/) {
+  // the task is handed to its group afterwards, so it has not been deleted
+  void * user_data = MTAPI_NULL;
+  mtapi_status_t status;
+  mtapi_task_get_attribute(task, MTAPI_TASK_USER_DATA,
+    &user_data, sizeof(user_data), &status);
+  assert(MTAPI_SUCCESS == status);
+  TaskArguments * arguments = static_cast<TaskArguments*>(user_data);
+  Group * owner = arguments->owner;
+  node_instance->FreeArguments(arguments);
+  owner->TaskFinished();
+}
+
+void Node::SetGroupTaskAttributes(
+  mtapi_task_attributes_t * attr,
+  TaskArguments * arguments) {
+  mtapi_status_t status;
+  mtapi_taskattr_set(attr, MTAPI_TASK_USER_DATA,
+    arguments, 0, &status);
+  assert(MTAPI_SUCCESS == status);
+  mtapi_task_complete_function_t func = group_task_complete_func;
+  void * func_ptr;
+  memcpy(&func_ptr, &func, sizeof(void*));
+  mtapi_taskattr_set(attr, MTAPI_TASK_COMPLETE_FUNCTION,
+    func_ptr, 0, &status);
+  assert(MTAPI_SUCCESS == status);
 }
 
 Node::Node(
@@ -82,6 +128,7 @@ Node::Node(
     EMBB_THROW(embb::base::ErrorException,
       "mtapi::Node could not create an action");
   }
+  action_pool_ = embb::base::Allocation::New<ActionPool>(attr->max_tasks);
 }
 
 Node::~Node() {
@@ -104,6 +151,71 @@ Node::~Node() {
   assert(MTAPI_SUCCESS == status);
   mtapi_finalize(&status);
   assert(MTAPI_SUCCESS == status);
+  embb::base::Allocation::Delete(action_pool_);
+}
+
+TaskArguments * Node::AllocateArguments(
+  Action const & action,
+  TaskGroup * group,
+  Group * owner) {
+  return action_pool_->Allocate(action, group, owner);
+}
+
+void Node::FreeArguments(TaskArguments * arguments) {
+  action_pool_->Free(arguments);
+}
+
+void Node::SpawnDetached(Action const & action, TaskGroup * group) {
+  mtapi_status_t status;
+  mtapi_task_attributes_t attr;
+  ExecutionPolicy policy = action.GetExecutionPolicy();
+  mtapi_taskattr_init(&attr, &status);
+  assert(MTAPI_SUCCESS == status);
+  mtapi_taskattr_set(&attr, MTAPI_TASK_PRIORITY,
+    &policy.priority_, sizeof(policy.priority_), &status);
+  assert(MTAPI_SUCCESS == status);
+  mtapi_taskattr_set(&attr, MTAPI_TASK_AFFINITY,
+    &policy.affinity_, sizeof(policy.affinity_), &status);
+  assert(MTAPI_SUCCESS == status);
+  mtapi_boolean_t detached = MTAPI_TRUE;
+  mtapi_taskattr_set(&attr, MTAPI_TASK_DETACHED,
+    &detached, sizeof(detached), &status);
+  assert(MTAPI_SUCCESS == status);
+  mtapi_domain_t domain_id = mtapi_domain_id_get(&status);
+  assert(MTAPI_SUCCESS == status);
+  mtapi_job_hndl_t job = mtapi_job_get(TASKS_CPP_JOB, domain_id, &status);
+  assert(MTAPI_SUCCESS == status);
+  TaskArguments* holder = AllocateArguments(action, group, NULL);
+  mtapi_task_start(MTAPI_TASK_ID_NONE, job,
+    holder, sizeof(TaskArguments), MTAPI_NULL, 0, &attr, MTAPI_GROUP_NONE,
+    &status);
+  while (MTAPI_ERR_TASK_LIMIT == status) {
+    mtapi_task_context_t * context = current_task_context;
+    if (MTAPI_NULL != context) {
+      // all task slots are in use, waiting for them on a worker may
+      // deadlock, so run the Action in the context of the current task
+      TaskContext task_context(context);
+      holder->action(task_context);
+      FreeArguments(holder);
+      if (NULL != group) {
+        group->Release();
+      }
+      return;
+    }
+    // help finishing some tasks and try again
+    mtapi_ext_yield(MTAPI_NULL);
+    mtapi_task_start(MTAPI_TASK_ID_NONE, job,
+      holder, sizeof(TaskArguments), MTAPI_NULL, 0, &attr, MTAPI_GROUP_NONE,
+      &status);
+  }
+  if (MTAPI_SUCCESS != status) {
+    FreeArguments(holder);
+    if (NULL != group) {
+      group->Release();
+    }
+    EMBB_THROW(embb::base::ErrorException,
+      "mtapi::Task could not be started");
+  }
 }
 
 void Node::Initialize(
@@ -94,7 +94,8 @@ Task Queue::Spawn(Action action) {
 }
 
 Task Queue::Spawn(Group const * group, Action action) {
-  return Task(action, handle_, group->handle_);
+  // the Group only counts its unfinished Tasks
+  return Task(action, handle_, const_cast<Group*>(group));
 }
 
 } // namespace tasks
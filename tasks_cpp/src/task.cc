@@ -29,23 +29,42 @@
 
 #include <embb/base/memory_allocation.h>
 #include <embb/base/exceptions.h>
+#include <embb/base/c/duration.h>
+#include <embb/base/c/time.h>
+#include <embb/mtapi/c/mtapi_ext.h>
 #include <embb/tasks/tasks.h>
 
+#include <action_pool.h>
+#include <continuationstage.h>
+
 namespace embb {
 namespace tasks {
 
-Task::Task() {
+Task::Task()
+  : continuation_(NULL) {
   handle_.id = 0;
   handle_.tag = 0;
 }
 
 Task::Task(Task const & task)
-  : handle_(task.handle_) {
-  // empty
+  : handle_(task.handle_)
+  , continuation_(task.continuation_) {
+  if (NULL != continuation_) {
+    continuation_->AddReference();
+  }
+}
+
+Task::Task(
+  ContinuationState * continuation)
+  : continuation_(continuation) {
+  handle_.id = 0;
+  handle_.tag = 0;
+  continuation_->AddReference();
 }
 
 Task::Task(
-  Action action) {
+  Action action)
+  : continuation_(NULL) {
   mtapi_status_t status;
   mtapi_task_attributes_t attr;
   ExecutionPolicy policy = action.GetExecutionPolicy();
@@ -61,10 +80,13 @@ Task::Task(
   assert(MTAPI_SUCCESS == status);
   mtapi_job_hndl_t job = mtapi_job_get(TASKS_CPP_JOB, domain_id, &status);
   assert(MTAPI_SUCCESS == status);
-  Action* holder = embb::base::Allocation::New<Action>(action);
+  Node & node = Node::GetInstance();
+  TaskArguments* holder = node.AllocateArguments(action, NULL, NULL);
   handle_ = mtapi_task_start(MTAPI_TASK_ID_NONE, job,
-    holder, sizeof(Action), MTAPI_NULL, 0, &attr, MTAPI_GROUP_NONE, &status);
+    holder, sizeof(TaskArguments), MTAPI_NULL, 0, &attr, MTAPI_GROUP_NONE,
+    &status);
   if (MTAPI_SUCCESS != status) {
+    node.FreeArguments(holder);
     EMBB_THROW(embb::base::ErrorException,
       "mtapi::Task could not be started");
   }
@@ -72,7 +94,8 @@ Task::Task(
 
 Task::Task(
   Action action,
-  mtapi_group_hndl_t group) {
+  Group * group)
+  : continuation_(NULL) {
   mtapi_status_t status;
   mtapi_task_attributes_t attr;
   ExecutionPolicy policy = action.GetExecutionPolicy();
@@ -88,10 +111,16 @@ Task::Task(
   assert(MTAPI_SUCCESS == status);
   mtapi_job_hndl_t job = mtapi_job_get(TASKS_CPP_JOB, domain_id, &status);
   assert(MTAPI_SUCCESS == status);
-  Action* holder = embb::base::Allocation::New<Action>(action);
+  Node & node = Node::GetInstance();
+  TaskArguments* holder = node.AllocateArguments(action, NULL, group);
+  Node::SetGroupTaskAttributes(&attr, holder);
+  ++group->pending_;
   handle_ = mtapi_task_start(MTAPI_TASK_ID_NONE, job,
-    holder, sizeof(Action), MTAPI_NULL, 0, &attr, group, &status);
+    holder, sizeof(TaskArguments), MTAPI_NULL, 0, &attr, group->handle_,
+    &status);
   if (MTAPI_SUCCESS != status) {
+    node.FreeArguments(holder);
+    group->TaskFinished();
     EMBB_THROW(embb::base::ErrorException,
       "mtapi::Task could not be started");
   }
@@ -100,7 +129,8 @@ Task::Task(
 Task::Task(
   mtapi_task_id_t id,
   Action action,
-  mtapi_group_hndl_t group) {
+  Group * group)
+  : continuation_(NULL) {
   mtapi_status_t status;
   mtapi_task_attributes_t attr;
   ExecutionPolicy policy = action.GetExecutionPolicy();
@@ -116,12 +146,18 @@ Task::Task(
   assert(MTAPI_SUCCESS == status);
   mtapi_job_hndl_t job = mtapi_job_get(TASKS_CPP_JOB, domain_id, &status);
   assert(MTAPI_SUCCESS == status);
-  Action* holder = embb::base::Allocation::New<Action>(action);
+  Node & node = Node::GetInstance();
+  TaskArguments* holder = node.AllocateArguments(action, NULL, group);
+  Node::SetGroupTaskAttributes(&attr, holder);
+  ++group->pending_;
   void * idptr = MTAPI_NULL;
   memcpy(&idptr, &id, sizeof(id));
   handle_ = mtapi_task_start(id, job,
-    holder, sizeof(Action), idptr, 0, &attr, group, &status);
+    holder, sizeof(TaskArguments), idptr, 0, &attr, group->handle_,
+    &status);
   if (MTAPI_SUCCESS != status) {
+    node.FreeArguments(holder);
+    group->TaskFinished();
     EMBB_THROW(embb::base::ErrorException,
       "mtapi::Task could not be started");
   }
@@ -129,7 +165,8 @@ Task::Task(
 
 Task::Task(
   Action action,
-  mtapi_queue_hndl_t queue) {
+  mtapi_queue_hndl_t queue)
+  : continuation_(NULL) {
   mtapi_status_t status;
   mtapi_task_attributes_t attr;
   ExecutionPolicy policy = action.GetExecutionPolicy();
@@ -141,10 +178,13 @@ Task::Task(
   mtapi_taskattr_set(&attr, MTAPI_TASK_AFFINITY,
     &policy.affinity_, sizeof(policy.affinity_), &status);
   assert(MTAPI_SUCCESS == status);
-  Action* holder = embb::base::Allocation::New<Action>(action);
+  Node & node = Node::GetInstance();
+  TaskArguments* holder = node.AllocateArguments(action, NULL, NULL);
   handle_ = mtapi_task_enqueue(MTAPI_TASK_ID_NONE, queue,
-    holder, sizeof(Action), MTAPI_NULL, 0, &attr, MTAPI_GROUP_NONE, &status);
+    holder, sizeof(TaskArguments), MTAPI_NULL, 0, &attr, MTAPI_GROUP_NONE,
+    &status);
   if (MTAPI_SUCCESS != status) {
+    node.FreeArguments(holder);
     EMBB_THROW(embb::base::ErrorException,
       "mtapi::Task could not be started");
   }
@@ -153,7 +193,8 @@ Task::Task(
 Task::Task(
   Action action,
   mtapi_queue_hndl_t queue,
-  mtapi_group_hndl_t group) {
+  Group * group)
+  : continuation_(NULL) {
   mtapi_status_t status;
   mtapi_task_attributes_t attr;
   ExecutionPolicy policy = action.GetExecutionPolicy();
@@ -165,10 +206,16 @@ Task::Task(
   mtapi_taskattr_set(&attr, MTAPI_TASK_AFFINITY,
     &policy.affinity_, sizeof(policy.affinity_), &status);
   assert(MTAPI_SUCCESS == status);
-  Action* holder = embb::base::Allocation::New<Action>(action);
+  Node & node = Node::GetInstance();
+  TaskArguments* holder = node.AllocateArguments(action, NULL, group);
+  Node::SetGroupTaskAttributes(&attr, holder);
+  ++group->pending_;
   handle_ = mtapi_task_enqueue(MTAPI_TASK_ID_NONE, queue,
-    holder, sizeof(Action), MTAPI_NULL, 0, &attr, group, &status);
+    holder, sizeof(TaskArguments), MTAPI_NULL, 0, &attr, group->handle_,
+    &status);
   if (MTAPI_SUCCESS != status) {
+    node.FreeArguments(holder);
+    group->TaskFinished();
     EMBB_THROW(embb::base::ErrorException,
       "mtapi::Task could not be started");
   }
@@ -178,7 +225,8 @@ Task::Task(
   mtapi_task_id_t id,
   Action action,
   mtapi_queue_hndl_t queue,
-  mtapi_group_hndl_t group) {
+  Group * group)
+  : continuation_(NULL) {
   mtapi_status_t status;
   mtapi_task_attributes_t attr;
   ExecutionPolicy policy = action.GetExecutionPolicy();
@@ -190,27 +238,76 @@ Task::Task(
   mtapi_taskattr_set(&attr, MTAPI_TASK_AFFINITY,
     &policy.affinity_, sizeof(policy.affinity_), &status);
   assert(MTAPI_SUCCESS == status);
-  Action* holder = embb::base::Allocation::New<Action>(action);
+  Node & node = Node::GetInstance();
+  TaskArguments* holder = node.AllocateArguments(action, NULL, group);
+  Node::SetGroupTaskAttributes(&attr, holder);
+  ++group->pending_;
   void * idptr = MTAPI_NULL;
   memcpy(&idptr, &id, sizeof(id));
   handle_ = mtapi_task_enqueue(id, queue,
-    holder, sizeof(Action), idptr, 0, &attr, group, &status);
+    holder, sizeof(TaskArguments), idptr, 0, &attr, group->handle_,
+    &status);
   if (MTAPI_SUCCESS != status) {
+    node.FreeArguments(holder);
+    group->TaskFinished();
     EMBB_THROW(embb::base::ErrorException,
       "mtapi::Task could not be started");
   }
 }
 
 Task::~Task() {
+  if (NULL != continuation_) {
+    continuation_->Release();
+  }
+}
+
+Task & Task::operator=(Task const & task) {
+  if (NULL != task.continuation_) {
+    task.continuation_->AddReference();
+  }
+  if (NULL != continuation_) {
+    continuation_->Release();
+  }
+  handle_ = task.handle_;
+  continuation_ = task.continuation_;
+  return *this;
 }
 
 mtapi_status_t Task::Wait(mtapi_timeout_t timeout) {
   mtapi_status_t status;
+  if (NULL != continuation_) {
+    // stages of a Continuation are detached, so help executing tasks
+    // until all of them have finished
+    embb_duration_t wait_duration;
+    embb_time_t end_time;
+    if (MTAPI_INFINITE < timeout) {
+      embb_duration_set_milliseconds(
+        &wait_duration, static_cast<unsigned long long>(timeout));
+      embb_time_in(&end_time, &wait_duration);
+    }
+    while (0 < continuation_->pending) {
+      if (MTAPI_INFINITE < timeout) {
+        embb_time_t current_time;
+        embb_time_now(&current_time);
+        if (embb_time_compare(&current_time, &end_time) > 0) {
+          return MTAPI_TIMEOUT;
+        }
+      }
+      mtapi_ext_yield(MTAPI_NULL);
+    }
+    // cancelling only matters if it actually prevented a stage from running
+    return (0 < continuation_->skipped) ?
+      MTAPI_ERR_ACTION_CANCELLED : MTAPI_SUCCESS;
+  }
   mtapi_task_wait(handle_, timeout, &status);
   return status;
 }
 
 void Task::Cancel() {
+  if (NULL != continuation_) {
+    continuation_->cancelled = true;
+    return;
+  }
   mtapi_status_t status;
   mtapi_task_cancel(handle_, &status);
   assert(MTAPI_SUCCESS == status);
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2014-2015, Siemens AG. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <embb/mtapi/c/mtapi_ext.h>
+#include <embb/tasks/tasks.h>
+
+namespace embb {
+namespace tasks {
+
+TaskGroup::TaskGroup()
+  : pending_(0) {
+  // empty
+}
+
+TaskGroup::~TaskGroup() {
+  Sync();
+}
+
+void TaskGroup::Spawn(Action action) {
+  ++pending_;
+  Node::GetInstance().SpawnDetached(action, this);
+}
+
+void TaskGroup::SpawnAndSync(Action action) {
+  Spawn(action);
+  Sync();
+}
+
+void TaskGroup::Sync() {
+  while (0 < pending_) {
+    mtapi_ext_yield(MTAPI_NULL);
+  }
+}
+
+void TaskGroup::Release() {
+  --pending_;
+}
+
+} // namespace tasks
+} // namespace embb
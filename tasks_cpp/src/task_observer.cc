@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2014-2015, Siemens AG. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <cassert>
+#include <cstring>
+
+#include <embb/base/exceptions.h>
+#include <embb/base/function.h>
+#include <embb/tasks/tasks.h>
+#include <embb/tasks/internal/task_observer.h>
+
+#include <action_pool.h>
+
+namespace embb {
+namespace tasks {
+namespace internal {
+
+TaskObserver::TaskObserver() {
+  handle_.id = 0;
+  handle_.tag = 0;
+}
+
+TaskObserver::~TaskObserver() {
+}
+
+void TaskObserver::Start(Action action, Queue * queue) {
+  mtapi_status_t status;
+  mtapi_task_attributes_t attr;
+  ExecutionPolicy policy = action.GetExecutionPolicy();
+  mtapi_uint_t priority = policy.GetPriority();
+  mtapi_affinity_t affinity = policy.GetAffinity();
+  mtapi_taskattr_init(&attr, &status);
+  assert(MTAPI_SUCCESS == status);
+  mtapi_taskattr_set(&attr, MTAPI_TASK_PRIORITY,
+    &priority, sizeof(priority), &status);
+  assert(MTAPI_SUCCESS == status);
+  mtapi_taskattr_set(&attr, MTAPI_TASK_AFFINITY,
+    &affinity, sizeof(affinity), &status);
+  assert(MTAPI_SUCCESS == status);
+  mtapi_taskattr_set(&attr, MTAPI_TASK_USER_DATA,
+    this, 0, &status);
+  assert(MTAPI_SUCCESS == status);
+  mtapi_task_complete_function_t func = complete_func;
+  void * func_ptr;
+  memcpy(&func_ptr, &func, sizeof(void*));
+  mtapi_taskattr_set(&attr, MTAPI_TASK_COMPLETE_FUNCTION,
+    func_ptr, 0, &status);
+  assert(MTAPI_SUCCESS == status);
+  Node & node = Node::GetInstance();
+  TaskArguments* holder = node.AllocateArguments(action, NULL, NULL);
+  // the handle is stored by complete_func(), as the task may have finished
+  // and this observer may be gone when mtapi_task_start() returns
+  if (NULL == queue) {
+    mtapi_domain_t domain_id = mtapi_domain_id_get(&status);
+    assert(MTAPI_SUCCESS == status);
+    mtapi_job_hndl_t job = mtapi_job_get(TASKS_CPP_JOB, domain_id, &status);
+    assert(MTAPI_SUCCESS == status);
+    mtapi_task_start(MTAPI_TASK_ID_NONE, job,
+      holder, sizeof(TaskArguments), MTAPI_NULL, 0, &attr, MTAPI_GROUP_NONE,
+      &status);
+  } else {
+    mtapi_task_enqueue(MTAPI_TASK_ID_NONE, queue->handle_,
+      holder, sizeof(TaskArguments), MTAPI_NULL, 0, &attr, MTAPI_GROUP_NONE,
+      &status);
+  }
+  if (MTAPI_SUCCESS != status) {
+    node.FreeArguments(holder);
+    EMBB_THROW(embb::base::ErrorException,
+      "mtapi::Task could not be started");
+  }
+}
+
+mtapi_status_t TaskObserver::GetStatus() {
+  // the task has completed, so this does not block
+  mtapi_status_t status;
+  mtapi_task_wait(handle_, MTAPI_INFINITE, &status);
+  return status;
+}
+
+bool TaskObserver::Observe(Group & group) {
+  TaskObserver * expected = NULL;
+  if (!group.observer_.CompareAndSwap(expected, this)) {
+    EMBB_THROW(embb::base::ErrorException,
+      "mtapi::Group is already observed");
+  }
+  if (0 == group.pending_) {
+    // take back the registration unless the last Task did
+    expected = this;
+    if (group.observer_.CompareAndSwap(expected, NULL)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void TaskObserver::Schedule() {
+  Node::GetInstance().SpawnDetached(
+    Action(embb::base::MakeFunction(*this, &TaskObserver::Execute)),
+    NULL);
+}
+
+void TaskObserver::Execute(TaskContext &) {
+  Notify();
+}
+
+void TaskObserver::complete_func(
+  mtapi_task_hndl_t task,
+  mtapi_status_t * /*status*/) {
+  // nobody else holds the handle, so the task has not been deleted
+  void * user_data = MTAPI_NULL;
+  mtapi_status_t status;
+  mtapi_task_get_attribute(task, MTAPI_TASK_USER_DATA,
+    &user_data, sizeof(user_data), &status);
+  assert(MTAPI_SUCCESS == status);
+  TaskObserver * observer = static_cast<TaskObserver*>(user_data);
+  observer->handle_ = task;
+  observer->Notify();
+}
+
+} // namespace internal
+} // namespace tasks
+} // namespace embb
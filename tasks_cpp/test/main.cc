@@ -31,10 +31,14 @@
 #include <tasks_cpp_test_task.h>
 #include <tasks_cpp_test_group.h>
 #include <tasks_cpp_test_queue.h>
+#include <tasks_cpp_test_task_group.h>
+#include <tasks_cpp_test_future.h>
 
 
 PT_MAIN("TASKS") {
   PT_RUN(TaskTest);
   PT_RUN(GroupTest);
   PT_RUN(QueueTest);
+  PT_RUN(TaskGroupTest);
+  PT_RUN(FutureTest);
 }
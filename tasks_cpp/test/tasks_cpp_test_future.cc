@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2014-2015, Siemens AG. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <vector>
+#include <string>
+
+#include <tasks_cpp_test_config.h>
+#include <tasks_cpp_test_future.h>
+
+#include <embb/base/c/memory_allocation.h>
+
+namespace {
+
+static int testFortyTwo() {
+  return 42;
+}
+
+static int testIncrement(int const & value) {
+  return value + 1;
+}
+
+static std::string testToString(int const & value) {
+  return value == 43 ? "forty-three" : "other";
+}
+
+static int testSum(std::vector<int> const & values) {
+  int sum = 0;
+  for (size_t ii = 0; ii < values.size(); ii++) {
+    sum += values[ii];
+  }
+  return sum;
+}
+
+class Square {
+ public:
+  explicit Square(int value) : value_(value) {}
+
+  int operator()() {
+    return value_ * value_;
+  }
+
+ private:
+  int value_;
+};
+
+} // namespace
+
+FutureTest::FutureTest() {
+  CreateUnit("tasks_cpp future test").Add(&FutureTest::TestBasic, this);
+}
+
+void FutureTest::TestBasic() {
+  embb::tasks::Node::Initialize(THIS_DOMAIN_ID, THIS_NODE_ID);
+
+  embb::tasks::Node & node = embb::tasks::Node::GetInstance();
+
+  {
+    embb::tasks::Future<int> future =
+      node.Spawn(embb::base::Function<int>(testFortyTwo));
+    PT_EXPECT(future.IsValid());
+    PT_EXPECT_EQ(future.Get(), 42);
+    PT_EXPECT(future.IsReady());
+  }
+
+  {
+    // continuations are attached while the producer may still be running
+    embb::tasks::Future<std::string> future =
+      node.Spawn(embb::base::Function<int>(testFortyTwo)).
+        Then(embb::base::Function<int, int const &>(testIncrement)).
+        Then(embb::base::Function<std::string, int const &>(testToString));
+    PT_EXPECT_EQ(future.Wait(MTAPI_INFINITE), MTAPI_SUCCESS);
+    PT_EXPECT(future.Get() == "forty-three");
+  }
+
+  {
+    std::vector<embb::tasks::Future<int> > futures;
+    for (int ii = 0; ii < 10; ii++) {
+      futures.push_back(
+        node.Spawn(embb::base::Function<int>(Square(ii))));
+    }
+    embb::tasks::Future<int> sum = embb::tasks::WhenAll(futures).
+      Then(embb::base::Function<int, std::vector<int> const &>(testSum));
+    PT_EXPECT_EQ(sum.Get(), 285);
+  }
+
+  {
+    embb::tasks::Promise<int> never;
+    embb::tasks::Promise<int> promise;
+    std::vector<embb::tasks::Future<int> > futures;
+    futures.push_back(never.GetFuture());
+    futures.push_back(promise.GetFuture());
+    embb::tasks::Future<size_t> any = embb::tasks::WhenAny(futures);
+    embb::tasks::Future<int> next = promise.GetFuture().
+      Then(embb::base::Function<int, int const &>(testIncrement));
+    PT_EXPECT_EQ(any.Wait(MTAPI_NOWAIT), MTAPI_TIMEOUT);
+    promise.SetValue(7);
+    PT_EXPECT_EQ(any.Get(), 1u);
+    PT_EXPECT_EQ(next.Get(), 8);
+    PT_EXPECT(!futures[0].IsReady());
+  }
+
+  {
+    // a Promise destroyed without setting a value breaks its Future and
+    // everything computed from it
+    embb::tasks::Future<int> future;
+    embb::tasks::Future<int> next;
+    embb::tasks::Future<int> sum;
+    {
+      embb::tasks::Promise<int> promise;
+      embb::tasks::Promise<int> copy(promise);
+      future = promise.GetFuture();
+      next = future.Then(
+        embb::base::Function<int, int const &>(testIncrement));
+      std::vector<embb::tasks::Future<int> > futures;
+      futures.push_back(node.Spawn(embb::base::Function<int>(testFortyTwo)));
+      futures.push_back(future);
+      sum = embb::tasks::WhenAll(futures).
+        Then(embb::base::Function<int, std::vector<int> const &>(testSum));
+    }
+    PT_EXPECT_EQ(future.Wait(MTAPI_INFINITE), MTAPI_ERR_ACTION_CANCELLED);
+    PT_EXPECT(future.IsReady());
+    PT_EXPECT_EQ(next.Wait(MTAPI_INFINITE), MTAPI_ERR_ACTION_CANCELLED);
+    PT_EXPECT_EQ(sum.Wait(MTAPI_INFINITE), MTAPI_ERR_ACTION_CANCELLED);
+#ifdef EMBB_USE_EXCEPTIONS
+    bool broken_promise_thrown = false;
+    try {
+      next.Get();
+    }
+    catch (embb::base::ErrorException &) {
+      broken_promise_thrown = true;
+    }
+    PT_EXPECT_MSG(broken_promise_thrown,
+      "Broken promise should throw ErrorException");
+#endif
+  }
+
+  {
+    // there is no index to report for an empty WhenAny
+    std::vector<embb::tasks::Future<int> > futures;
+    embb::tasks::Future<size_t> any = embb::tasks::WhenAny(futures);
+    PT_EXPECT(any.IsReady());
+    PT_EXPECT_EQ(any.Wait(MTAPI_INFINITE), MTAPI_ERR_PARAMETER);
+#ifdef EMBB_USE_EXCEPTIONS
+    bool empty_any_thrown = false;
+    try {
+      any.Get();
+    }
+    catch (embb::base::ErrorException &) {
+      empty_any_thrown = true;
+    }
+    PT_EXPECT_MSG(empty_any_thrown,
+      "Empty WhenAny should throw ErrorException");
+#endif
+  }
+
+  embb::tasks::Node::Finalize();
+
+  PT_EXPECT_EQ(embb_get_bytes_allocated(), 0u);
+}
@@ -31,6 +31,8 @@
 #include <tasks_cpp_test_config.h>
 #include <tasks_cpp_test_task.h>
 
+#include <embb/base/atomic.h>
+#include <embb/base/thread.h>
 #include <embb/base/c/memory_allocation.h>
 
 #define JOB_TEST_TASK 42
@@ -57,6 +59,27 @@ static void testRecursiveTaskAction(
   PT_EXPECT(*value == 1000);
 }
 
+static void testCountTaskAction(
+  embb::base::Atomic<int> * counter,
+  embb::tasks::TaskContext & /*context*/) {
+  ++(*counter);
+}
+
+static void testReadCountTaskAction(
+  embb::base::Atomic<int> * counter,
+  int * value,
+  embb::tasks::TaskContext & /*context*/) {
+  *value = *counter;
+}
+
+static void testWaitForTaskAction(
+  embb::base::Atomic<bool> * go,
+  embb::tasks::TaskContext & /*context*/) {
+  while (!*go) {
+    embb::base::Thread::CurrentYield();
+  }
+}
+
 static void testErrorTaskAction(embb::tasks::TaskContext & context) {
   context.SetStatus(MTAPI_ERR_ACTION_FAILED);
 }
@@ -74,14 +97,14 @@ void TaskTest::TestBasic() {
   embb::tasks::Node & node = embb::tasks::Node::GetInstance();
 
   embb::tasks::ExecutionPolicy policy(false);
-  PT_EXPECT_EQ(policy.GetAffinity(), 0u);
+  PT_EXPECT_EQ(policy.GetCoreCount(), 0u);
   PT_EXPECT_EQ(policy.GetPriority(), 0u);
   policy.AddWorker(0u);
-  PT_EXPECT_EQ(policy.GetAffinity(), 1u);
+  PT_EXPECT_EQ(policy.GetCoreCount(), 1u);
   policy.AddWorker(1u);
-  PT_EXPECT_EQ(policy.GetAffinity(), 3u);
+  PT_EXPECT_EQ(policy.GetCoreCount(), 2u);
   policy.RemoveWorker(0u);
-  PT_EXPECT_EQ(policy.GetAffinity(), 2u);
+  PT_EXPECT_EQ(policy.GetCoreCount(), 1u);
   PT_EXPECT_EQ(policy.IsSetWorker(0), false);
   PT_EXPECT_EQ(policy.IsSetWorker(1), true);
 
@@ -93,6 +116,7 @@ void TaskTest::TestBasic() {
   task.Wait(MTAPI_INFINITE);
   PT_EXPECT(test == "simple");
 
+  mtapi_status_t status;
   std::string test1, test2, test3;
   task = node.First(
     embb::base::Bind(
@@ -108,6 +132,49 @@ void TaskTest::TestBasic() {
   PT_EXPECT(test2 == "second");
   PT_EXPECT(test3 == "third");
 
+  {
+    embb::base::Atomic<int> counter(0);
+    int count = 0;
+    embb::tasks::Action count_action(embb::base::Bind(
+      testCountTaskAction, &counter, embb::base::Placeholder::_1));
+    embb::tasks::Continuation other = node.First(count_action).
+      Then(count_action, count_action);
+    task = node.First(count_action).
+      Then(count_action, count_action, count_action).
+      Then(count_action, count_action, count_action, count_action).
+      WhenAll(other).
+      Then(embb::base::Bind(
+        testReadCountTaskAction, &counter, &count,
+        embb::base::Placeholder::_1)).
+      Spawn();
+    testDoSomethingElse();
+    status = task.Wait(MTAPI_INFINITE);
+    PT_EXPECT(MTAPI_SUCCESS == status);
+    PT_EXPECT_EQ(count, 11);
+    PT_EXPECT_EQ(counter.Load(), 11);
+
+    // cancelling a finished Continuation does not change its status
+    task.Cancel();
+    status = task.Wait(MTAPI_INFINITE);
+    PT_EXPECT(MTAPI_SUCCESS == status);
+  }
+
+  {
+    embb::base::Atomic<bool> go(false);
+    embb::base::Atomic<int> counter(0);
+    task = node.First(embb::base::Bind(
+      testWaitForTaskAction, &go, embb::base::Placeholder::_1)).
+      Then(embb::base::Bind(
+        testCountTaskAction, &counter, embb::base::Placeholder::_1)).
+      Spawn();
+    // the second stage cannot start before go is set
+    task.Cancel();
+    go = true;
+    status = task.Wait(MTAPI_INFINITE);
+    PT_EXPECT(MTAPI_ERR_ACTION_CANCELLED == status);
+    PT_EXPECT_EQ(counter.Load(), 0);
+  }
+
   int value = 0;
   task = node.Spawn(
     embb::base::Bind(
@@ -115,7 +182,6 @@ void TaskTest::TestBasic() {
   task.Wait(MTAPI_INFINITE);
   PT_EXPECT(value == 1000);
 
-  mtapi_status_t status;
   task = node.Spawn(testErrorTaskAction);
   testDoSomethingElse();
   status = task.Wait(MTAPI_INFINITE);
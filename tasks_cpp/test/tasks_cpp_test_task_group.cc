@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2014-2015, Siemens AG. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <tasks_cpp_test_config.h>
+#include <tasks_cpp_test_task_group.h>
+
+#include <embb/base/c/memory_allocation.h>
+
+namespace {
+
+class Fibonacci {
+ public:
+  Fibonacci(int n, int * result) : n_(n), result_(result) {}
+
+  void operator()(embb::tasks::TaskContext &) {
+    if (n_ < 2) {
+      *result_ = n_;
+    } else {
+      int x, y;
+      embb::tasks::TaskGroup group;
+      group.Spawn(Fibonacci(n_ - 1, &x));
+      group.SpawnAndSync(Fibonacci(n_ - 2, &y));
+      *result_ = x + y;
+    }
+  }
+
+ private:
+  int n_;
+  int * result_;
+};
+
+static void testIncrement(
+  embb::base::Atomic<int> * counter,
+  embb::tasks::TaskContext & /*context*/) {
+  ++*counter;
+}
+
+} // namespace
+
+TaskGroupTest::TaskGroupTest() {
+  CreateUnit("tasks_cpp task group test").Add(&TaskGroupTest::TestBasic, this);
+}
+
+void TaskGroupTest::TestBasic() {
+  embb::tasks::Node::Initialize(THIS_DOMAIN_ID, THIS_NODE_ID);
+
+  {
+    // spawn more children than the node has task slots in total
+    embb::base::Atomic<int> counter(0);
+    embb::tasks::TaskGroup group;
+    for (int ii = 0; ii < 2000; ii++) {
+      group.Spawn(embb::base::Bind(
+        testIncrement, &counter, embb::base::Placeholder::_1));
+    }
+    group.Sync();
+    PT_EXPECT_EQ(counter.Load(), 2000);
+  }
+
+  {
+    int result = -1;
+    embb::tasks::TaskGroup group;
+    group.SpawnAndSync(Fibonacci(15, &result));
+    PT_EXPECT_EQ(result, 610);
+  }
+
+  embb::tasks::Node::Finalize();
+
+  PT_EXPECT_EQ(embb_get_bytes_allocated(), 0u);
+}